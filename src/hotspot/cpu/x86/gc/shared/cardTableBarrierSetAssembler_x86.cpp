@@ -128,6 +128,15 @@ void CardTableBarrierSetAssembler::store_check(MacroAssembler* masm, Register ob
 
   __ shrptr(obj, CardTable::card_shift());
 
+  Label L_filtered;
+  if (ctbs->filter_card_marks()) {
+    // Stores into the young generation need no card mark. Card indices are
+    // never negative, so a signed comparison suffices.
+    __ mov64(rscratch1, (int64_t)ctbs->young_boundary_card_index());
+    __ cmpptr(obj, rscratch1);
+    __ jcc(ctbs->young_below_boundary() ? Assembler::less : Assembler::greaterEqual, L_filtered);
+  }
+
   Address card_addr;
 
   // The calculation for byte_map_base is as follows:
@@ -158,6 +167,7 @@ void CardTableBarrierSetAssembler::store_check(MacroAssembler* masm, Register ob
   } else {
     __ movb(card_addr, dirty);
   }
+  __ bind(L_filtered);
 }
 
 void CardTableBarrierSetAssembler::oop_store_at(MacroAssembler* masm, DecoratorSet decorators, BasicType type,
@@ -172,6 +182,13 @@ void CardTableBarrierSetAssembler::oop_store_at(MacroAssembler* masm, DecoratorS
 
   BarrierSetAssembler::store_at(masm, decorators, type, dst, val, noreg, noreg, noreg);
   if (needs_post_barrier) {
+    Label L_null;
+    if (CardTableBarrierSet::barrier_set()->filter_card_marks()) {
+      // Storing null needs no card mark. A compressed oop is null if and
+      // only if it was null before.
+      __ testptr(val, val);
+      __ jcc(Assembler::zero, L_null);
+    }
     // flatten object address if needed
     if (!precise || (dst.index() == noreg && dst.disp() == 0)) {
       store_check(masm, dst.base(), dst);
@@ -179,5 +196,6 @@ void CardTableBarrierSetAssembler::oop_store_at(MacroAssembler* masm, DecoratorS
       __ lea(tmp1, dst);
       store_check(masm, tmp1, dst);
     }
+    __ bind(L_null);
   }
 }
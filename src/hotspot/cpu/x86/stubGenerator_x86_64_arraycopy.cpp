@@ -2790,6 +2790,78 @@ static void do_setmemory_atomic_loop(USM_TYPE type, Register dest,
   __ jccb(Assembler::notZero, L_TailLoop);
 }
 
+// Helper for generate_unsafe_setmemory
+//
+// Fill the bulk of a quadword aligned region with vector stores and leave
+// the remaining (size % 128) bytes to do_setmemory_atomic_loop. Fills of
+// at least large_threshold bytes use non-temporal stores on AVX-512 targets,
+// so that they do not evict the rest of the last level cache.
+static void do_setmemory_vector_loop(Register dest, Register size,
+                                     Register wide_value, Register tmp,
+                                     MacroAssembler *_masm) {
+  const int vector_threshold = 512;
+  const int large_threshold = 2621440; // 2.5 MB
+  Label L_align_loop, L_aligned, L_fill_loop, L_tail, L_done;
+
+  __ cmpq(size, vector_threshold);
+  __ jcc(Assembler::below, L_done);
+
+  // Align dest to 64 bytes, size is large enough to cover the partial fill
+  __ BIND(L_align_loop);
+  __ testl(dest, 63);
+  __ jccb(Assembler::zero, L_aligned);
+  __ movq(Address(dest, 0), wide_value);
+  __ addq(dest, 8);
+  __ subq(size, 8);
+  __ jmpb(L_align_loop);
+
+  __ BIND(L_aligned);
+  __ movdq(xmm0, wide_value);
+
+  // Number of 128-byte chunks into tmp
+  __ movq(tmp, size);
+  __ shrq(tmp, 7);
+
+  Label L_fill_large;
+  if (UseAVX > 2) {
+    __ cmpq(size, large_threshold);
+    __ jcc(Assembler::aboveEqual, L_fill_large);
+  }
+
+  __ vpbroadcastq(xmm0, xmm0, Assembler::AVX_256bit);
+  __ align(16);
+  __ BIND(L_fill_loop);
+  for (int i = 0; i < 4; i++) {
+    __ vmovdqu(Address(dest, 32 * i), xmm0);
+  }
+  __ addq(dest, 128);
+  __ decrementq(tmp);
+  __ jccb(Assembler::notZero, L_fill_loop);
+
+  if (UseAVX > 2) {
+    Label L_fill_large_loop;
+    __ jmpb(L_tail);
+
+    __ BIND(L_fill_large);
+    __ vpbroadcastq(xmm0, xmm0, Assembler::AVX_512bit);
+    __ align(16);
+    __ BIND(L_fill_large_loop);
+    __ evmovntdquq(Address(dest, 0), xmm0, Assembler::AVX_512bit);
+    __ evmovntdquq(Address(dest, 64), xmm0, Assembler::AVX_512bit);
+    __ addq(dest, 128);
+    __ decrementq(tmp);
+    __ jccb(Assembler::notZero, L_fill_large_loop);
+    // fence needed because of the non-temporal stores
+    __ sfence();
+  }
+
+  __ BIND(L_tail);
+  __ vzeroupper();
+  __ andq(size, 127);
+
+  __ BIND(L_done);
+}
+
 //  Generate 'unsafe' set memory stub
 //  Though just as safe as the other stubs, it takes an unscaled
 //  size_t (# bytes) argument instead of an element count.
@@ -2800,7 +2872,8 @@ static void do_setmemory_atomic_loop(USM_TYPE type, Register dest,
 //    c_rarg2   - byte value
 //
 // Examines the alignment of the operands and dispatches
-// to an int, short, or byte fill loop.
+// to an int, short, or byte fill loop. Large quadword aligned
+// fills are done with vector stores on AVX2 targets.
 //
 address StubGenerator::generate_unsafe_setmemory(address unsafe_byte_fill) {
   __ align(CodeEntryAlignment);
@@ -2857,7 +2930,7 @@ address StubGenerator::generate_unsafe_setmemory(address unsafe_byte_fill) {
       do_setmemory_atomic_loop(USM_SHORT, dest, size, wide_value, rScratch1,
                                L_exit, _masm);
     }
-    __ jmpb(L_exit);
+    __ jmp(L_exit);
 
     __ BIND(L_fillQuadwords);
 
@@ -2867,6 +2940,9 @@ address StubGenerator::generate_unsafe_setmemory(address unsafe_byte_fill) {
 
       // At this point, we know the lower 3 bits of size are zero and a
       // multiple of 8
+      if (UseAVX >= 2 && UseUnalignedLoadStores) {
+        do_setmemory_vector_loop(dest, size, wide_value, rScratch1, _masm);
+      }
       do_setmemory_atomic_loop(USM_QUADWORD, dest, size, wide_value, rScratch1,
                                L_exit, _masm);
     }
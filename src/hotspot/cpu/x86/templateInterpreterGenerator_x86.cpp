@@ -652,7 +652,10 @@ address TemplateInterpreterGenerator::generate_Reference_get_entry(void) {
   // rdx: scratch
   // rdi: scratch
 
-  // Load the value of the referent field.
+  // Load the value of the referent field. The barrier set assembler inlines
+  // the fast path of the barrier (the bad mask test for ZGC, the marking
+  // active test and SATB enqueue for G1) and only calls into the runtime on
+  // its slow path.
   const Address field_address(rax, referent_offset);
   __ load_heap_oop(rax, field_address, /*tmp1*/ rbx, ON_WEAK_OOP_REF);
 
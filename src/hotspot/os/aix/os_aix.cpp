@@ -2293,6 +2293,11 @@ int os::Machine::active_processor_count() {
   return online_cpus;
 }
 
+bool os::bind_to_processor(uint processor_index) {
+  // Not yet implemented.
+  return false;
+}
+
 void os::set_native_thread_name(const char *name) {
   // Not yet implemented.
   return;
@@ -2216,6 +2216,11 @@ int os::Machine::active_processor_count() {
   return _processor_count;
 }
 
+bool os::bind_to_processor(uint processor_index) {
+  // Not yet implemented.
+  return false;
+}
+
 uint os::processor_id() {
 #if defined(__APPLE__) && defined(__x86_64__)
   // Get the initial APIC id and return the associated processor id. The initial APIC
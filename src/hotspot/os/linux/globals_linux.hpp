@@ -86,6 +86,12 @@
   product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
           "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
                                                                         \
+  product(bool, HeapDumpDirectSegmentWrite, false, EXPERIMENTAL,        \
+          "Write the heap dump segments of all dump threads directly "  \
+          "into a preallocated, memory mapped region of the heap dump " \
+          "file instead of writing separate segment files which are "   \
+          "merged afterwards")                                          \
+                                                                        \
   product(bool, PrintMemoryMapAtExit, false, DIAGNOSTIC,                \
           "Print an annotated memory map at exit")                      \
                                                                         \
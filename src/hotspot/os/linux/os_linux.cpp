@@ -3019,15 +3019,17 @@ void os::pd_disclaim_memory(char *addr, size_t bytes) {
 
 size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
   const size_t len = pointer_delta(last, first, sizeof(char)) + page_size;
-  // Use madvise to pretouch on Linux when THP is used, and fallback to the
-  // common method if unsupported. THP can form right after madvise rather than
-  // being assembled later.
-  if (HugePages::thp_mode() == THPMode::always || UseTransparentHugePages) {
-    int err = 0;
-    if (UseMadvPopulateWrite &&
-        ::madvise(first, len, MADV_POPULATE_WRITE) == -1) {
-      err = errno;
-    }
+  // Use madvise to pretouch on Linux, and fallback to the common method if
+  // unsupported. A single madvise populates the whole range without taking a
+  // page fault per page. With THP, huge pages can form right after madvise
+  // rather than being assembled later.
+  const bool thp = HugePages::thp_mode() == THPMode::always || UseTransparentHugePages;
+  int err = 0;
+  if (UseMadvPopulateWrite &&
+      ::madvise(first, len, MADV_POPULATE_WRITE) == -1) {
+    err = errno;
+  }
+  if (thp) {
     if (!UseMadvPopulateWrite || err == EINVAL) { // Not to use or not supported
       // When using THP we need to always pre-touch using small pages as the
       // OS will initially always use small pages.
@@ -3039,7 +3041,12 @@ size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
     }
     return 0;
   }
-  return page_size;
+  if (!UseMadvPopulateWrite || err != 0) {
+    // Other failures, e.g. of a mapping that does not support it, are left to
+    // the touching loop, which behaves as before.
+    return page_size;
+  }
+  return 0;
 }
 
 void os::numa_set_thread_affinity(Thread* thread, int node) {
@@ -4785,6 +4792,89 @@ int os::Linux::active_processor_count() {
   return get_active_processor_count();
 }
 
+// Returns a physical core id of cpu, combining its package and core id, or
+// the cpu itself if the topology is not available.
+static int physical_core_of(int cpu) {
+  int ids[2];
+  const char* const names[2] = { "physical_package_id", "core_id" };
+  for (int i = 0; i < 2; i++) {
+    char path[64];
+    os::snprintf_checked(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, names[i]);
+    FILE* f = os::fopen(path, "r");
+    if (f == nullptr) {
+      return -1 - cpu;
+    }
+    int matched = fscanf(f, "%d", &ids[i]);
+    fclose(f);
+    if (matched != 1 || ids[i] < 0) {
+      return -1 - cpu;
+    }
+  }
+  return (ids[0] << 16) | ids[1];
+}
+
+static bool bind_current_thread_to_processor(uint processor_index) {
+  // Note: keep this function, with its CPU_xx macros, *outside* the os namespace (see JDK-8289477).
+  cpu_set_t cpus;
+  if (os::processor_count() > CPU_SETSIZE ||
+      sched_getaffinity(0, sizeof(cpus), &cpus) != 0) {
+    return false;
+  }
+
+  int allowed[CPU_SETSIZE];
+  int cores[CPU_SETSIZE];
+  int num_allowed = 0;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &cpus)) {
+      allowed[num_allowed] = cpu;
+      cores[num_allowed] = physical_core_of(cpu);
+      num_allowed++;
+    }
+  }
+  if (num_allowed == 0) {
+    return false;
+  }
+
+  // Processors are ordered by their rank among the hardware threads of their
+  // core, then by id, so that the first processors are all on distinct cores.
+  int ranks[CPU_SETSIZE];
+  for (int i = 0; i < num_allowed; i++) {
+    ranks[i] = 0;
+    for (int j = 0; j < i; j++) {
+      if (cores[j] == cores[i]) {
+        ranks[i]++;
+      }
+    }
+  }
+
+  uint index = processor_index % (uint)num_allowed;
+  int target = -1;
+  for (int rank = 0; target < 0; rank++) {
+    for (int i = 0; i < num_allowed && target < 0; i++) {
+      if (ranks[i] != rank) {
+        continue;
+      }
+      if (index == 0) {
+        target = allowed[i];
+      } else {
+        index--;
+      }
+    }
+  }
+
+  CPU_ZERO(&cpus);
+  CPU_SET(target, &cpus);
+  if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+    return false;
+  }
+  log_debug(os, thread)("Thread bound to processor %d", target);
+  return true;
+}
+
+bool os::bind_to_processor(uint processor_index) {
+  return bind_current_thread_to_processor(processor_index);
+}
+
 // Determine the active processor count from one of
 // three different sources:
 //
@@ -1054,6 +1054,11 @@ uint os::processor_id() {
   return (uint)GetCurrentProcessorNumber();
 }
 
+bool os::bind_to_processor(uint processor_index) {
+  // Not yet implemented.
+  return false;
+}
+
 // For dynamic lookup of SetThreadDescription API
 typedef HRESULT (WINAPI *SetThreadDescriptionFnPtr)(HANDLE, PCWSTR);
 typedef HRESULT (WINAPI *GetThreadDescriptionFnPtr)(HANDLE, PWSTR*);
@@ -238,6 +238,7 @@ void Compilation::build_hir() {
     PhaseTraceTime timeit(_t_optimize_null_checks);
 
     _hir->eliminate_null_checks();
+    _hir->eliminate_reference_keep_alive();
   }
 
   _hir->verify();
@@ -304,6 +304,13 @@ void IR::eliminate_null_checks() {
   }
 }
 
+void IR::eliminate_reference_keep_alive() {
+  Optimizer opt(this);
+  if (C1EliminateReferenceKeepAlive) {
+    opt.eliminate_reference_keep_alive();
+  }
+}
+
 // The functionality of this class is to insert a new block between
 // the 'from' and 'to' block of a critical edge.
 // It first collects the block pairs, and then processes them.
@@ -322,6 +322,7 @@ class IR: public CompilationResourceObj {
   // ir manipulation
   void optimize_blocks();
   void eliminate_null_checks();
+  void eliminate_reference_keep_alive();
   void compute_predecessors();
   void split_critical_edges();
   void compute_code();
@@ -359,6 +359,7 @@ class Instruction: public CompilationResourceObj {
     DeoptimizeOnException,
     KillsMemoryFlag,
     OmitChecksFlag,
+    NoKeepAliveFlag,
     InstructionLastFlag
   };
 
@@ -1553,6 +1554,10 @@ LEAF(Intrinsic, StateSplit)
   Value receiver() const                         { assert(has_receiver(), "must have receiver"); return _recv; }
   bool preserves_state() const                   { return check_flag(PreservesStateFlag); }
 
+  // Reference.get() whose result is only compared (see Optimizer::eliminate_reference_keep_alive)
+  bool no_keep_alive() const                     { return check_flag(NoKeepAliveFlag); }
+  void set_no_keep_alive()                       { set_flag(NoKeepAliveFlag, true); }
+
   bool arg_needs_null_check(int i) const {
     return _nonnull_state.arg_needs_null_check(i);
   }
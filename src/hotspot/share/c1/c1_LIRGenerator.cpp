@@ -1198,8 +1198,23 @@ void LIRGenerator::do_Reference_get0(Intrinsic* x) {
     info = state_for(x);
   }
 
+#ifndef PRODUCT
+  if (PrintC1Statistics) {
+    increment_counter(Runtime1::reference_get_count_address(), T_INT);
+    if (x->no_keep_alive()) {
+      increment_counter(Runtime1::reference_get_compare_only_count_address(), T_INT);
+    }
+  }
+#endif
+
+  // A result that is only compared does not need to keep the referent alive
+  DecoratorSet decorators = IN_HEAP | ON_WEAK_OOP_REF;
+  if (x->no_keep_alive()) {
+    decorators |= AS_NO_KEEPALIVE;
+  }
+
   LIR_Opr result = rlock_result(x, T_OBJECT);
-  access_load_at(IN_HEAP | ON_WEAK_OOP_REF, T_OBJECT,
+  access_load_at(decorators, T_OBJECT,
                  reference, LIR_OprFact::intConst(referent_offset), result,
                  nullptr, info);
 }
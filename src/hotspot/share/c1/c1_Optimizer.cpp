@@ -1274,3 +1274,63 @@ void Optimizer::eliminate_null_checks() {
                   ir()->method()->signature()->as_symbol()->as_utf8());
   }
 }
+
+// Reference.get() loads the referent with a keep-alive barrier, so that a
+// concurrent marking sees it as strongly reachable once the program has got
+// hold of it. A result that is only compared, against null or for identity,
+// is never stored, passed on or kept in debug info, so the referent does not
+// need to be kept alive for it. This is the common cache lookup pattern
+// "if (ref.get() == null)".
+class ReferenceGetEscapeMarker : public ValueVisitor {
+ private:
+  ResourceBitMap& _escaped;
+
+ public:
+  ReferenceGetEscapeMarker(ResourceBitMap& escaped) : _escaped(escaped) {}
+
+  void visit(Value* v) { _escaped.set_bit((*v)->id()); }
+};
+
+void Optimizer::eliminate_reference_keep_alive() {
+  ResourceMark rm;
+  ResourceBitMap escaped(Instruction::number_of_instructions());
+  ReferenceGetEscapeMarker marker(escaped);
+  GrowableArray<Intrinsic*> candidates;
+
+  BlockList* blocks = ir()->code();
+  for (int i = 0; i < blocks->length(); i++) {
+    for (Instruction* x = blocks->at(i); x != nullptr; x = x->next()) {
+      Intrinsic* intrinsic = x->as_Intrinsic();
+      if (intrinsic != nullptr && intrinsic->id() == vmIntrinsics::_Reference_get0) {
+        candidates.append(intrinsic);
+      }
+      // Mark every value used other than as an operand of a compare
+      If* if_x = x->as_If();
+      IfOp* ifop_x = x->as_IfOp();
+      if (if_x == nullptr && ifop_x == nullptr) {
+        x->input_values_do(&marker);
+      } else if (ifop_x != nullptr) {
+        Value tval = ifop_x->tval();
+        Value fval = ifop_x->fval();
+        marker.visit(&tval);
+        marker.visit(&fval);
+      }
+      x->state_values_do(&marker);
+      x->other_values_do(&marker);
+    }
+  }
+
+  int eliminated = 0;
+  for (int i = 0; i < candidates.length(); i++) {
+    Intrinsic* intrinsic = candidates.at(i);
+    if (!escaped.at(intrinsic->Instruction::id())) {
+      intrinsic->set_no_keep_alive();
+      eliminated++;
+    }
+  }
+
+  CompileLog* log = ir()->compilation()->log();
+  if (log != nullptr && candidates.length() > 0) {
+    log->elem("reference_keep_alive_elimination candidates='%d' eliminated='%d'", candidates.length(), eliminated);
+  }
+}
@@ -126,6 +126,8 @@ uint Runtime1::_throw_null_pointer_exception_count = 0;
 uint Runtime1::_throw_class_cast_exception_count = 0;
 uint Runtime1::_throw_incompatible_class_change_error_count = 0;
 uint Runtime1::_throw_count = 0;
+uint Runtime1::_reference_get_count = 0;
+uint Runtime1::_reference_get_compare_only_count = 0;
 
 static uint _byte_arraycopy_stub_cnt = 0;
 static uint _short_arraycopy_stub_cnt = 0;
@@ -1556,6 +1558,8 @@ void Runtime1::print_statistics() {
   tty->print_cr(" _throw_class_cast_exception_count:             %u:", _throw_class_cast_exception_count);
   tty->print_cr(" _throw_incompatible_class_change_error_count:  %u:", _throw_incompatible_class_change_error_count);
   tty->print_cr(" _throw_count:                                  %u:", _throw_count);
+  tty->print_cr(" _reference_get_count:                          %u:", _reference_get_count);
+  tty->print_cr(" _reference_get_compare_only_count:             %u:", _reference_get_compare_only_count);
 
   SharedRuntime::print_ic_miss_histogram();
   tty->cr();
@@ -68,6 +68,8 @@ class Runtime1: public AllStatic {
   static uint _throw_class_cast_exception_count;
   static uint _throw_incompatible_class_change_error_count;
   static uint _throw_count;
+  static uint _reference_get_count;
+  static uint _reference_get_compare_only_count;
 #endif
 
  private:
@@ -141,6 +143,8 @@ class Runtime1: public AllStatic {
 
 #ifndef PRODUCT
   static address throw_count_address()               { return (address)&_throw_count;             }
+  static address reference_get_count_address()       { return (address)&_reference_get_count;     }
+  static address reference_get_compare_only_count_address() { return (address)&_reference_get_compare_only_count; }
   static address arraycopy_count_address(BasicType type);
 #endif
 
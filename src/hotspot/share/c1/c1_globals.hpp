@@ -145,6 +145,10 @@
   develop(bool, EliminateFieldAccess, true,                                 \
           "Optimize field loads and stores")                                \
                                                                             \
+  product(bool, C1EliminateReferenceKeepAlive, false, DIAGNOSTIC,           \
+          "Load the referent in Reference.get() without keeping it "        \
+          "alive if the result is only compared for null or identity")      \
+                                                                            \
   develop(bool, InlineMethodsWithExceptionHandlers, true,                   \
           "Inline methods containing exception handlers "                   \
           "(NOTE: does not work with current backend)")                     \
@@ -58,6 +58,18 @@ class AOTGrowableArray : public GrowableArrayWithAllocator<E, AOTGrowableArray<E
 #endif
   }
 
+  // The data array may be in the AOT cache, so it cannot be reallocated in place.
+  E* reallocate(E* mem, int old_capacity) {
+    E* new_mem = allocate();
+    if (this->_len > 0) {
+      memcpy((void*)new_mem, (const void*)mem, this->_len * sizeof(E));
+    }
+    if (mem != nullptr) {
+      deallocate(mem);
+    }
+    return new_mem;
+  }
+
 public:
   AOTGrowableArray(int initial_capacity, MemTag mem_tag) :
       GrowableArrayWithAllocator<E, AOTGrowableArray>(
@@ -43,6 +43,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/serviceThread.hpp"
+#include "runtime/timerTrace.hpp"
 #include "utilities/growableArray.hpp"
 
 void AOTLinkedClassBulkLoader::serialize(SerializeClosure* soc) {
@@ -66,6 +67,7 @@ void AOTLinkedClassBulkLoader::preload_classes(JavaThread* current) {
 
 void AOTLinkedClassBulkLoader::preload_classes_impl(TRAPS) {
   precond(CDSConfig::is_using_aot_linked_classes());
+  TraceTime timer("Preload AOT-linked classes", TRACETIME_LOG(Info, startuptime));
 
   ClassLoaderDataShared::restore_archived_modules_for_preloading_classes(THREAD);
   Handle h_platform_loader(THREAD, SystemDictionary::java_platform_loader());
@@ -126,8 +128,16 @@ void AOTLinkedClassBulkLoader::link_classes(JavaThread* current) {
   }
 }
 
+// The classes are linked one by one on the main thread. Linking cannot be
+// handed to other threads at this point: each class is linked while holding
+// its init_lock object monitor, and may need to report errors as exceptions,
+// both of which need a JavaThread, but no java.lang.Thread other than the main
+// thread's exists before the first bytecode runs. With verification
+// constraints preserved in the AOT cache, the remaining per-class work is
+// mostly linking methods to their entries and adapters.
 void AOTLinkedClassBulkLoader::link_classes_impl(TRAPS) {
   precond(CDSConfig::is_using_aot_linked_classes());
+  TraceTime timer("Link AOT-linked classes", TRACETIME_LOG(Info, startuptime));
 
   AOTLinkedClassTable* table = AOTLinkedClassTable::get();
 
@@ -216,6 +226,7 @@ void AOTLinkedClassBulkLoader::validate_module(Klass* k, const char* category_na
 #endif
 
 void AOTLinkedClassBulkLoader::init_javabase_classes(JavaThread* current) {
+  TraceTime timer("Initialize AOT-linked java.base classes", TRACETIME_LOG(Info, startuptime));
   init_classes_for_loader(Handle(), AOTLinkedClassTable::get()->boot1(), current);
   if (current->has_pending_exception()) {
     exit_on_exception(current);
@@ -231,6 +242,7 @@ void AOTLinkedClassBulkLoader::init_non_javabase_classes(JavaThread* current) {
 
 void AOTLinkedClassBulkLoader::init_non_javabase_classes_impl(TRAPS) {
   assert(CDSConfig::is_using_aot_linked_classes(), "sanity");
+  TraceTime timer("Initialize AOT-linked non-java.base classes", TRACETIME_LOG(Info, startuptime));
 
   DEBUG_ONLY(validate_module_of_preloaded_classes());
 
@@ -46,6 +46,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/exceptions.hpp"
@@ -88,6 +89,15 @@ static uint64_t _cleanup_materialization_time_ns = 0;
 static volatile uint64_t _accumulated_lazy_materialization_time_ns = 0;
 static Ticks _materialization_start_ticks;
 
+// Archive pages spanned by the roots that were materialized on demand, i.e.
+// that someone asked for before the AOT thread got to them. Logged when
+// materialization is done, as access temperature input for laying out the
+// archive at dump time. Empty unless aot+heap logging is on.
+static CHeapBitMap _demanded_pages(mtClassShared);
+static int _num_demanded_roots = 0;
+// Set while the remaining roots are forced in, which is not demand.
+static bool _forcing_all_roots = false;
+
 int AOTStreamedHeapLoader::object_index_for_root_index(int root_index) {
   return _roots_archive[root_index];
 }
@@ -843,6 +853,33 @@ void AOTStreamedHeapLoader::log_statistics() {
   uint64_t materialized_bytes = _allocated_words * HeapWordSize;
   log_info(aot, heap)("%s materialized " UINT64_FORMAT "K (" UINT64_FORMAT "M/s)", async_or_sync,
                       materialized_bytes / 1024, uint64_t(materialized_bytes * UCONST64(1'000'000'000) / M / iterative_time));
+
+  if (_demanded_pages.size() > 0) {
+    log_info(aot, heap)("demanded roots: %d of %d, spanning %zu of %zu archive pages",
+                        _num_demanded_roots, _num_roots, _demanded_pages.count_one_bits(), _demanded_pages.size());
+    _demanded_pages.resize(0);
+  }
+}
+
+void AOTStreamedHeapLoader::record_demanded_root(int root_index) {
+  assert_lock_strong(AOTHeapLoading_lock);
+  if (_demanded_pages.size() == 0 || _forcing_all_roots) {
+    return;
+  }
+  _num_demanded_roots++;
+  const int first_object_index = object_index_for_root_index(root_index);
+  if (first_object_index == 0) {
+    // null root
+    return;
+  }
+  const int last_object_index = MAX2(first_object_index, highest_object_index_for_root_index(root_index));
+  const size_t start = buffer_offset_for_object_index(first_object_index);
+  const size_t end = buffer_offset_for_object_index(last_object_index) +
+                     archive_object_size(archive_object_for_object_index(last_object_index)) * HeapWordSize;
+  const size_t page_size = os::vm_page_size();
+  _demanded_pages.set_range(start / page_size, align_up(end, page_size) / page_size);
+  log_debug(aot, heap)("Demanded root %d: objects %d-%d, archive bytes %zu-%zu",
+                       root_index, first_object_index, last_object_index, start, end);
 }
 
 void AOTStreamedHeapLoader::materialize_objects() {
@@ -952,6 +989,7 @@ void AOTStreamedHeapLoader::finish_materialize_objects() {
     assert(_current_root_index == 0, "sanity");
     // Without the full module graph we have done only lazy tracing materialization.
     // Ensure all roots are processed here by triggering root loading on every root.
+    _forcing_all_roots = true;
     for (int i = 0; i < _num_roots; ++i) {
       get_root(i);
     }
@@ -1008,6 +1046,10 @@ void AOTStreamedHeapLoader::initialize() {
   address start = (address)(_bitmap_region->mapped_base()) + _heap_region->oopmap_offset();
   _oopmap = BitMapView((BitMap::bm_word_t*)start, _heap_region->oopmap_size_in_bits());
 
+  if (log_is_enabled(Info, aot, heap)) {
+    _demanded_pages.initialize(align_up(_heap_region_used, os::vm_page_size()) / os::vm_page_size());
+  }
+
 
   if (FLAG_IS_DEFAULT(AOTEagerlyLoadObjects)) {
     // Concurrency will not help much if there are no extra cores available.
@@ -1059,6 +1101,7 @@ oop AOTStreamedHeapLoader::materialize_root(int root_index) {
     } else {
       // The root has not been materialized, start tracing materialization
       result = TracingObjectLoader::materialize_root(root_index, dfs_stack, CHECK_NULL);
+      record_demanded_root(root_index);
     }
   }
 
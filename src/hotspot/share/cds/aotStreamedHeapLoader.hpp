@@ -194,6 +194,7 @@ class AOTStreamedHeapLoader {
   static void materialize_late(TRAPS);
   static void cleanup();
   static void log_statistics();
+  static void record_demanded_root(int root_index);
 
   class TracingObjectLoader {
     static oop materialize_object(int object_index, Stack<AOTHeapTraversalEntry, mtClassShared>& dfs_stack, TRAPS);
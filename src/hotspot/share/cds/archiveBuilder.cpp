@@ -58,9 +58,11 @@
 #include "oops/oopHandle.inline.hpp"
 #include "oops/trainingData.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomicAccess.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timerTrace.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -122,9 +124,11 @@ class RelocateEmbeddedPointers : public BitMapClosure {
   ArchiveBuilder* _builder;
   address _buffered_obj;
   BitMap::idx_t _start_idx;
+  ArchiveBuilder::RelocatedPtrInfo* _info;
 public:
-  RelocateEmbeddedPointers(ArchiveBuilder* builder, address buffered_obj, BitMap::idx_t start_idx) :
-    _builder(builder), _buffered_obj(buffered_obj), _start_idx(start_idx) {}
+  RelocateEmbeddedPointers(ArchiveBuilder* builder, address buffered_obj, BitMap::idx_t start_idx,
+                           ArchiveBuilder::RelocatedPtrInfo* info) :
+    _builder(builder), _buffered_obj(buffered_obj), _start_idx(start_idx), _info(info) {}
 
   bool do_bit(BitMap::idx_t bit_offset) {
     size_t field_offset = size_t(bit_offset - _start_idx) * sizeof(address);
@@ -150,18 +154,20 @@ class RelocateEmbeddedPointers : public BitMapClosure {
                    p2i(ptr_loc), p2i(old_p) + tags, p2i(new_p), tags);
 
     ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
-    ArchiveBuilder::current()->count_relocated_pointer(tags != 0, nulled);
+    _info->_num_ptrs ++;
+    _info->_num_tagged_ptrs += (tags != 0) ? 1 : 0;
+    _info->_num_nulled_ptrs += nulled ? 1 : 0;
     return true; // keep iterating the bitmap
   }
 };
 
-void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder) {
+void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder, RelocatedPtrInfo* info) {
   SourceObjInfo* src_info = objs()->at(i);
   assert(src_info->should_copy(), "must be");
   BitMap::idx_t start = BitMap::idx_t(src_info->ptrmap_start()); // inclusive
   BitMap::idx_t end = BitMap::idx_t(src_info->ptrmap_end());     // exclusive
 
-  RelocateEmbeddedPointers relocator(builder, src_info->buffered_addr(), start);
+  RelocateEmbeddedPointers relocator(builder, src_info->buffered_addr(), start, info);
   _ptrmap.iterate(&relocator, start, end);
 }
 
@@ -314,9 +320,52 @@ int ArchiveBuilder::compare_klass_by_name(Klass** a, Klass** b) {
   return a[0]->name()->fast_compare(b[0]->name());
 }
 
+// Classes are grouped as follows, so that the classes (and the Methods and
+// ConstantPools that are copied right after them) that are used first during
+// start-up are placed next to each other in the archive:
+//   0: classes listed in the classlist, in classlist order. The classlist is
+//      written in the order in which the training run loaded the classes.
+//   1: classes from the preimage of a final static archive, in the order in
+//      which they were laid out in the preimage.
+//   2: all other classes, by name.
+static int klass_load_order_group(Klass* k, intptr_t& key) {
+  Klass* bottom = k->is_objArray_klass() ? ObjArrayKlass::cast(k)->bottom_klass() : k;
+  if (bottom->is_instance_klass()) {
+    int id = SystemDictionaryShared::classlist_id(InstanceKlass::cast(bottom));
+    if (id >= 0) {
+      key = id;
+      return 0;
+    }
+  }
+  if (k->in_aot_cache()) {
+    key = (intptr_t)k;
+    return 1;
+  }
+  key = 0;
+  return 2;
+}
+
+int ArchiveBuilder::compare_klass_by_load_order(Klass** a, Klass** b) {
+  intptr_t key_a, key_b;
+  int group_a = klass_load_order_group(a[0], key_a);
+  int group_b = klass_load_order_group(b[0], key_b);
+  if (group_a != group_b) {
+    return group_a < group_b ? -1 : 1;
+  }
+  if (key_a != key_b) {
+    return key_a < key_b ? -1 : 1;
+  }
+  // An instance class, and its array classes, share the same classlist ID.
+  return compare_klass_by_name(a, b);
+}
+
 void ArchiveBuilder::sort_klasses() {
   aot_log_info(aot)("Sorting classes ... ");
-  _klasses->sort(compare_klass_by_name);
+  if (ArchiveClassesInLoadOrder) {
+    _klasses->sort(compare_klass_by_load_order);
+  } else {
+    _klasses->sort(compare_klass_by_name);
+  }
 }
 
 address ArchiveBuilder::reserve_buffer() {
@@ -519,6 +568,7 @@ void ArchiveBuilder::remember_embedded_pointer_in_enclosing_obj(MetaspaceClosure
 }
 
 void ArchiveBuilder::gather_source_objs() {
+  TraceTime timer("Gather source objects", TRACETIME_LOG(Info, cds));
   ResourceMark rm;
   aot_log_info(aot)("Gathering all archivable objects ... ");
   gather_klasses_and_symbols();
@@ -612,12 +662,14 @@ void ArchiveBuilder::sort_metadata_objs() {
 }
 
 void ArchiveBuilder::dump_rw_metadata() {
+  TraceTime timer("Copy RW objects", TRACETIME_LOG(Info, cds));
   ResourceMark rm;
   aot_log_info(aot)("Allocating RW objects ... ");
   make_shallow_copies(&_rw_region, &_rw_src_objs);
 }
 
 void ArchiveBuilder::dump_ro_metadata() {
+  TraceTime timer("Copy RO objects", TRACETIME_LOG(Info, cds));
   ResourceMark rm;
   aot_log_info(aot)("Allocating RO objects ... ");
 
@@ -759,16 +811,56 @@ address ArchiveBuilder::get_source_addr(address buffered_addr) const {
   return *src_p;
 }
 
-void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs, int start, int end) {
+  RelocatedPtrInfo info = {0, 0, 0};
+  for (int i = start; i < end; i++) {
+    src_objs->relocate(i, this, &info);
   }
+  count_relocated_pointers(info);
 }
 
+// Each source object is relocated only within its own buffered copy, and the
+// resulting pointer bitmap does not depend on the order in which bits are set,
+// so the archive contents are the same no matter how the work is split up.
+class RelocateEmbeddedPointersTask : public ArchiveWorkerTask {
+private:
+  ArchiveBuilder* const _builder;
+  ArchiveBuilder::SourceObjList* const _rw_src_objs;
+  ArchiveBuilder::SourceObjList* const _ro_src_objs;
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder,
+                               ArchiveBuilder::SourceObjList* rw_src_objs,
+                               ArchiveBuilder::SourceObjList* ro_src_objs) :
+                               ArchiveWorkerTask("Relocate Embedded Pointers"),
+                               _builder(builder), _rw_src_objs(rw_src_objs), _ro_src_objs(ro_src_objs) {}
+
+  void work(int chunk, int max_chunks) override {
+    work_on(chunk, max_chunks, _rw_src_objs);
+    work_on(chunk, max_chunks, _ro_src_objs);
+  }
+
+  void work_on(int chunk, int max_chunks, ArchiveBuilder::SourceObjList* src_objs) {
+    int size  = src_objs->objs()->length();
+    int start = (int)((jlong)size * chunk / max_chunks);
+    int end   = (int)((jlong)size * (chunk + 1) / max_chunks);
+    _builder->relocate_embedded_pointers(src_objs, start, end);
+  }
+};
+
 void ArchiveBuilder::relocate_metaspaceobj_embedded_pointers() {
+  TraceTime timer("Relocate embedded pointers", TRACETIME_LOG(Info, cds));
   aot_log_info(aot)("Relocating embedded pointers in core regions ... ");
-  relocate_embedded_pointers(&_rw_src_objs);
-  relocate_embedded_pointers(&_ro_src_objs);
+  if (AOTCacheParallelRelocation) {
+    ArchivePtrMarker::begin_parallel_marking();
+    ArchiveWorkers workers;
+    RelocateEmbeddedPointersTask task(this, &_rw_src_objs, &_ro_src_objs);
+    workers.run_task(&task);
+    ArchivePtrMarker::end_parallel_marking();
+  } else {
+    relocate_embedded_pointers(&_rw_src_objs, 0, _rw_src_objs.objs()->length());
+    relocate_embedded_pointers(&_ro_src_objs, 0, _ro_src_objs.objs()->length());
+  }
   log_info(cds)("Relocating %zu pointers, %zu tagged, %zu nulled",
                 _relocated_ptr_info._num_ptrs,
                 _relocated_ptr_info._num_tagged_ptrs,
@@ -1206,10 +1298,10 @@ void ArchiveBuilder::write_region(FileMapInfo* mapinfo, int region_idx, DumpRegi
   mapinfo->write_region(region_idx, dump_region->base(), dump_region->used(), read_only, allow_exec);
 }
 
-void ArchiveBuilder::count_relocated_pointer(bool tagged, bool nulled) {
-  _relocated_ptr_info._num_ptrs ++;
-  _relocated_ptr_info._num_tagged_ptrs += tagged ? 1 : 0;
-  _relocated_ptr_info._num_nulled_ptrs += nulled ? 1 : 0;
+void ArchiveBuilder::count_relocated_pointers(const RelocatedPtrInfo& info) {
+  AtomicAccess::add(&_relocated_ptr_info._num_ptrs, info._num_ptrs, memory_order_relaxed);
+  AtomicAccess::add(&_relocated_ptr_info._num_tagged_ptrs, info._num_tagged_ptrs, memory_order_relaxed);
+  AtomicAccess::add(&_relocated_ptr_info._num_nulled_ptrs, info._num_nulled_ptrs, memory_order_relaxed);
 }
 
 void ArchiveBuilder::print_region_stats(FileMapInfo *mapinfo,
@@ -95,6 +95,7 @@ constexpr size_t SharedSpaceObjectAlignment = Metaspace::min_allocation_alignmen
 //
 class ArchiveBuilder : public StackObj {
   friend class AOTMapLogger;
+  friend class RelocateEmbeddedPointersTask;
 
 protected:
   DumpRegion* _current_dump_region;
@@ -124,6 +125,12 @@ class ArchiveBuilder : public StackObj {
     make_a_copy, point_to_it, set_to_null
   };
 
+  struct RelocatedPtrInfo {
+    size_t _num_ptrs;
+    size_t _num_tagged_ptrs;
+    size_t _num_nulled_ptrs;
+  };
+
 private:
   class SourceObjInfo {
     uintx _ptrmap_start;     // The bit-offset of the start of this object (inclusive)
@@ -199,7 +206,7 @@ class ArchiveBuilder : public StackObj {
 
     void append(SourceObjInfo* src_info);
     void remember_embedded_pointer(SourceObjInfo* pointing_obj, MetaspaceClosure::Ref* ref);
-    void relocate(int i, ArchiveBuilder* builder);
+    void relocate(int i, ArchiveBuilder* builder, RelocatedPtrInfo* info);
 
     // convenience accessor
     SourceObjInfo* at(int i) const { return objs()->at(i); }
@@ -240,11 +247,7 @@ class ArchiveBuilder : public StackObj {
   // statistics
   DumpAllocStats _alloc_stats;
   size_t _total_heap_region_size;
-  struct {
-    size_t _num_ptrs;
-    size_t _num_tagged_ptrs;
-    size_t _num_nulled_ptrs;
-  } _relocated_ptr_info;
+  RelocatedPtrInfo _relocated_ptr_info;
 
   void print_region_stats(FileMapInfo *map_info,
                           ArchiveMappedHeapInfo* mapped_heap_info,
@@ -267,7 +270,7 @@ class ArchiveBuilder : public StackObj {
     ~OtherROAllocMark();
   };
 
-  void count_relocated_pointer(bool tagged, bool nulled);
+  void count_relocated_pointers(const RelocatedPtrInfo& info);
 
 private:
   FollowMode get_follow_mode(MetaspaceClosure::Ref *ref);
@@ -276,11 +279,12 @@ class ArchiveBuilder : public StackObj {
   void sort_klasses();
   static int compare_symbols_by_address(Symbol** a, Symbol** b);
   static int compare_klass_by_name(Klass** a, Klass** b);
+  static int compare_klass_by_load_order(Klass** a, Klass** b);
 
   void make_shallow_copies(DumpRegion *dump_region, const SourceObjList* src_objs);
   void make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
 
-  void relocate_embedded_pointers(SourceObjList* src_objs);
+  void relocate_embedded_pointers(SourceObjList* src_objs, int start, int end);
 
   bool is_excluded(Klass* k);
   void clean_up_src_obj_table();
@@ -53,6 +53,7 @@ CHeapBitMap* ArchivePtrMarker::_ro_ptrmap = nullptr;
 VirtualSpace* ArchivePtrMarker::_vs;
 
 bool ArchivePtrMarker::_compacted;
+bool ArchivePtrMarker::_parallel_marking = false;
 
 void ArchivePtrMarker::initialize(CHeapBitMap* ptrmap, VirtualSpace* vs) {
   assert(_ptrmap == nullptr, "initialize only once");
@@ -124,6 +125,11 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
     if (value != nullptr) {
       assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
       size_t idx = ptr_loc - ptr_base();
+      if (_parallel_marking) {
+        assert(idx < _ptrmap->size(), "expanded by begin_parallel_marking()");
+        _ptrmap->par_set_bit(idx, memory_order_relaxed);
+        return;
+      }
       if (_ptrmap->size() <= idx) {
         _ptrmap->resize((idx + 1) * 2);
       }
@@ -134,6 +140,24 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   }
 }
 
+// All pointers marked during parallel marking are inside the committed part of _vs,
+// so expanding _ptrmap to cover it up front avoids resizing it concurrently.
+void ArchivePtrMarker::begin_parallel_marking() {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  assert(!_parallel_marking, "already started");
+  size_t committed_bits = ptr_end() - ptr_base();
+  if (_ptrmap->size() < committed_bits) {
+    _ptrmap->resize(committed_bits);
+  }
+  _parallel_marking = true;
+}
+
+void ArchivePtrMarker::end_parallel_marking() {
+  assert(_parallel_marking, "not started");
+  _parallel_marking = false;
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != nullptr, "not initialized");
   assert(!_compacted, "cannot clear anymore");
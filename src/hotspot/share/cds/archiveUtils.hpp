@@ -57,6 +57,10 @@ class ArchivePtrMarker : AllStatic {
   // avoid unintentional copy operations after the bitmap has been finalized and written.
   static bool         _compacted;
 
+  // While set, mark_pointer() may be called concurrently by ArchiveWorkers, so
+  // _ptrmap must not be resized and bits must be set atomically.
+  static bool         _parallel_marking;
+
   static address* ptr_base() { return (address*)_vs->low();  } // committed lower bound (inclusive)
   static address* ptr_end()  { return (address*)_vs->high(); } // committed upper bound (exclusive)
 
@@ -65,6 +69,8 @@ class ArchivePtrMarker : AllStatic {
   static void initialize_rw_ro_maps(CHeapBitMap* rw_ptrmap, CHeapBitMap* ro_ptrmap);
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
+  static void begin_parallel_marking();
+  static void end_parallel_marking();
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
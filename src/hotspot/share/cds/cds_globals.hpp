@@ -82,6 +82,10 @@
   product(bool, AOTEagerlyLoadObjects, false, DIAGNOSTIC,                   \
           "Load streamable objects synchronously without concurrency")      \
                                                                             \
+  product(bool, ArchiveClassesInLoadOrder, true, DIAGNOSTIC,                \
+          "Lay out the classes of a static archive in the order in which "  \
+          "they were loaded, instead of sorting them by name")              \
+                                                                            \
   product(ccstr, SharedClassListFile, nullptr,                              \
           "Override the default CDS class list")                            \
                                                                             \
@@ -134,7 +138,8 @@
           "loaders before application main")                                \
                                                                             \
   product(bool, AOTCacheParallelRelocation, true, DIAGNOSTIC,               \
-          "Use parallel relocation code to speed up startup.")              \
+          "Use parallel relocation code to speed up startup and archive "   \
+          "dumping.")                                                       \
                                                                             \
   /* flags to control training and deployment modes  */                     \
                                                                             \
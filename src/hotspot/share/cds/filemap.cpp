@@ -1361,8 +1361,10 @@ bool FileMapInfo::map_aot_code_region(ReservedSpace rs) {
     mapped_base = requested_base;
   } else {
     // We do not execute in-place in the AOT code region.
-    // AOT code is copied to the CodeCache for execution.
-    bool read_only = false, allow_exec = false;
+    // AOT code is copied to the CodeCache for execution, and relocated
+    // there, when it is first used. The region is only read, so map it
+    // read-only to share its pages with other processes using the cache.
+    bool read_only = true, allow_exec = false;
     mapped_base = map_memory(_fd, _full_path, r->file_offset(),
                              requested_base, r->used_aligned(), read_only, allow_exec, mtClassShared);
   }
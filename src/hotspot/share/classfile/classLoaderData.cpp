@@ -138,6 +138,7 @@ ClassLoaderData::ClassLoaderData(Handle h_class_loader, bool has_class_mirror_ho
   _metaspace_lock(new Mutex(Mutex::nosafepoint-2, "MetaspaceAllocation_lock")),
   _unloading(false), _has_class_mirror_holder(has_class_mirror_holder),
   _modified_oops(true),
+  _on_modified_list(false),
   // A non-strong hidden class loader data doesn't have anything to keep
   // it from being unloaded during parsing of the non-strong hidden class.
   // The null-class-loader should always be kept alive.
@@ -149,6 +150,7 @@ ClassLoaderData::ClassLoaderData(Handle h_class_loader, bool has_class_mirror_ho
   _deallocate_list(nullptr),
   _next(nullptr),
   _unloading_next(nullptr),
+  _next_modified(nullptr),
   _class_loader_klass(nullptr), _name(nullptr), _name_and_id(nullptr) {
 
   if (!h_class_loader.is_null()) {
@@ -269,13 +271,73 @@ bool ClassLoaderData::ChunkedHandleList::owner_of(oop* oop_handle) {
 }
 #endif // PRODUCT
 
+// Returns value replicated into the epoch field of every claim bit.
+static constexpr uint64_t claim_epoch_fields(uint64_t value, int bits, int epoch_bits) {
+  return bits == 0 ? 0 : (value << ((bits - 1) * epoch_bits)) | claim_epoch_fields(value, bits - 1, epoch_bits);
+}
+
+// All epochs start at 1; a field of 0 in _claim means never claimed.
+volatile uint64_t ClassLoaderData::_claim_epochs = claim_epoch_fields(1, claim_bits, claim_epoch_bits);
+
+uint64_t ClassLoaderData::claim_field_mask(int claim) {
+  assert((claim & ~right_n_bits(claim_bits)) == 0, "unexpected claim %d", claim);
+  uint64_t mask = 0;
+  for (int bit = 0; bit < claim_bits; bit++) {
+    if ((claim & (1 << bit)) != 0) {
+      mask |= max_claim_epoch << (bit * claim_epoch_bits);
+    }
+  }
+  return mask;
+}
+
+bool ClassLoaderData::advance_claim_epochs(int claim) {
+  for (;;) {
+    const uint64_t old_epochs = AtomicAccess::load(&_claim_epochs);
+    uint64_t new_epochs = old_epochs;
+    bool wrapped = false;
+    for (int bit = 0; bit < claim_bits; bit++) {
+      if ((claim & (1 << bit)) != 0) {
+        const int shift = bit * claim_epoch_bits;
+        uint64_t epoch = ((old_epochs >> shift) & max_claim_epoch) + 1;
+        if (epoch > max_claim_epoch) {
+          epoch = 1;
+          wrapped = true;
+        }
+        new_epochs = (new_epochs & ~(max_claim_epoch << shift)) | (epoch << shift);
+      }
+    }
+    if (AtomicAccess::cmpxchg(&_claim_epochs, old_epochs, new_epochs) == old_epochs) {
+      return wrapped;
+    }
+  }
+}
+
+int ClassLoaderData::claimed_bits() const {
+  const uint64_t claim = AtomicAccess::load(&_claim);
+  const uint64_t epochs = AtomicAccess::load(&_claim_epochs);
+  int bits = 0;
+  for (int bit = 0; bit < claim_bits; bit++) {
+    const int shift = bit * claim_epoch_bits;
+    if (((claim ^ epochs) >> shift & max_claim_epoch) == 0) {
+      bits |= 1 << bit;
+    }
+  }
+  return bits;
+}
+
+bool ClassLoaderData::claimed(int claim) const {
+  const uint64_t mask = claim_field_mask(claim);
+  return ((AtomicAccess::load(&_claim) ^ AtomicAccess::load(&_claim_epochs)) & mask) == 0;
+}
+
 void ClassLoaderData::clear_claim(int claim) {
+  const uint64_t mask = claim_field_mask(claim);
   for (;;) {
-    int old_claim = AtomicAccess::load(&_claim);
-    if ((old_claim & claim) == 0) {
+    uint64_t old_claim = AtomicAccess::load(&_claim);
+    if ((old_claim & mask) == 0) {
       return;
     }
-    int new_claim = old_claim & ~claim;
+    uint64_t new_claim = old_claim & ~mask;
     if (AtomicAccess::cmpxchg(&_claim, old_claim, new_claim) == old_claim) {
       return;
     }
@@ -284,23 +346,31 @@ void ClassLoaderData::clear_claim(int claim) {
 
 #ifdef ASSERT
 void ClassLoaderData::verify_not_claimed(int claim) {
-  assert((_claim & claim) == 0, "Found claim: %d bits in _claim: %d", claim, _claim);
+  assert((claimed_bits() & claim) == 0, "Found claim: %d bits in claim: %d", claim, claimed_bits());
 }
 #endif
 
 bool ClassLoaderData::try_claim(int claim) {
+  const uint64_t mask = claim_field_mask(claim);
+  const uint64_t epochs = AtomicAccess::load(&_claim_epochs);
   for (;;) {
-    int old_claim = AtomicAccess::load(&_claim);
-    if ((old_claim & claim) == claim) {
+    uint64_t old_claim = AtomicAccess::load(&_claim);
+    if (((old_claim ^ epochs) & mask) == 0) {
       return false;
     }
-    int new_claim = old_claim | claim;
+    uint64_t new_claim = (old_claim & ~mask) | (epochs & mask);
     if (AtomicAccess::cmpxchg(&_claim, old_claim, new_claim) == old_claim) {
       return true;
     }
   }
 }
 
+void ClassLoaderData::add_to_modified_list() {
+  if (AtomicAccess::cmpxchg(&_on_modified_list, false, true) == false) {
+    ClassLoaderDataGraph::add_to_modified_list(this);
+  }
+}
+
 void ClassLoaderData::demote_strong_roots() {
   // The oop handle area contains strong roots that the GC traces from. We are about
   // to demote them to strong native oops that the GC does *not* trace from. Conceptually,
@@ -1023,7 +1093,7 @@ void ClassLoaderData::print_on(outputStream* out) const {
   out->print_cr(" - modified oops       %s", _modified_oops ? "true" : "false");
   out->print_cr(" - _keep_alive_ref_count %d", _keep_alive_ref_count);
   out->print   (" - claim               ");
-  switch(_claim) {
+  switch(claimed_bits()) {
     case _claim_none:                       out->print_cr("none"); break;
     case _claim_finalizable:                out->print_cr("finalizable"); break;
     case _claim_strong:                     out->print_cr("strong"); break;
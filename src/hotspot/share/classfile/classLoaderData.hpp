@@ -119,14 +119,32 @@ class ClassLoaderData : public CHeapObj<mtClass> {
 
   // Remembered sets support for the oops in the class loader data.
   bool _modified_oops;     // Card Table Equivalent
+  volatile bool _on_modified_list; // Linked into ClassLoaderDataGraph's list of
+                                   // CLDs with modified oops, via _next_modified.
 
   int _keep_alive_ref_count; // if this CLD should not be considered eligible for unloading.
                              // Used for non-strong hidden classes and the
                              // boot class loader. _keep_alive_ref_count does not need to be volatile or
                              // atomic since there is one unique CLD per non-strong hidden class.
 
-  volatile int _claim; // non-zero if claimed, for example during GC traces.
-                       // To avoid applying oop closure more than once.
+  // Claims are tracked per claim bit (see Claim below). Each claim bit owns a
+  // field of claim_epoch_bits in _claim, holding the epoch of that bit in which
+  // this CLD was claimed, or 0. A bit is claimed iff its field matches the
+  // current epoch of the bit in _claim_epochs. All CLDs are thereby unclaimed
+  // by advancing the epoch, without walking the ClassLoaderDataGraph.
+  static const int      claim_bits       = 5;
+  static const int      claim_epoch_bits = 12;
+  static const uint64_t max_claim_epoch  = (1 << claim_epoch_bits) - 1;
+  static volatile uint64_t _claim_epochs;
+
+  volatile uint64_t _claim; // To avoid applying oop closure more than once.
+
+  static uint64_t claim_field_mask(int claim);
+  // Advances the epochs of the bits in claim. Returns true if an epoch wrapped
+  // around, in which case the caller needs to clear these bits in all CLDs.
+  static bool advance_claim_epochs(int claim);
+  int claimed_bits() const;
+
   ChunkedHandleList _handles; // Handles to constant pool arrays, Modules, etc, which
                               // have the same life cycle of the corresponding ClassLoader.
 
@@ -168,8 +186,14 @@ class ClassLoaderData : public CHeapObj<mtClass> {
   // And finally, when no threads are using the unloading CLDs anymore, we
   // remove them from the class unloading list and delete them. See:
   // ClassLoaderDataGraph::purge();
+  //
+  // The third list [_modified_head, _next_modified] holds the CLDs that have
+  // had their oops modified since the last young collection, so that young
+  // collections do not have to walk all CLDs. See
+  // ClassLoaderDataGraph::modified_cld_do().
   ClassLoaderData* _next;
   ClassLoaderData* _unloading_next;
+  ClassLoaderData* volatile _next_modified;
 
   Klass*  _class_loader_klass;
   Symbol* _name;
@@ -194,8 +218,14 @@ class ClassLoaderData : public CHeapObj<mtClass> {
   // the Mod Union Table can't be used to mark when CLD have modified oops.
   // The CT and MUT bits saves this information for the whole class loader data.
   void clear_modified_oops()             { _modified_oops = false; }
+  void add_to_modified_list();
  public:
-  void record_modified_oops()            { _modified_oops = true; }
+  void record_modified_oops() {
+    _modified_oops = true;
+    if (!AtomicAccess::load(&_on_modified_list)) {
+      add_to_modified_list();
+    }
+  }
   bool has_modified_oops()               { return _modified_oops; }
 
   oop holder_no_keepalive() const;
@@ -237,11 +267,11 @@ class ClassLoaderData : public CHeapObj<mtClass> {
     _claim_stw_fullgc_adjust = 8,
     _claim_other             = 16
   };
-  void clear_claim() { _claim = 0; }
+  void clear_claim() { AtomicAccess::store(&_claim, (uint64_t)0); }
   void clear_claim(int claim);
   void verify_not_claimed(int claim) NOT_DEBUG_RETURN;
-  bool claimed() const { return _claim != 0; }
-  bool claimed(int claim) const { return (_claim & claim) == claim; }
+  bool claimed() const { return claimed_bits() != 0; }
+  bool claimed(int claim) const;
   bool try_claim(int claim);
 
   // Computes if the CLD is alive or not. This is safe to call in concurrent
@@ -51,7 +51,23 @@
 volatile size_t ClassLoaderDataGraph::_num_array_classes = 0;
 volatile size_t ClassLoaderDataGraph::_num_instance_classes = 0;
 
+static const int all_claims = ClassLoaderData::_claim_strong |
+                              ClassLoaderData::_claim_stw_fullgc_mark |
+                              ClassLoaderData::_claim_stw_fullgc_adjust |
+                              ClassLoaderData::_claim_other;
+
 void ClassLoaderDataGraph::clear_claimed_marks() {
+  clear_claimed_marks(all_claims);
+}
+
+void ClassLoaderDataGraph::clear_claimed_marks(int claim) {
+  // Advancing the claim epochs unclaims all CLDs at once. Only when an epoch
+  // wraps around do the stale claims of that epoch have to be cleared in
+  // every CLD, so that they are not mistaken for new claims.
+  if (!ClassLoaderData::advance_claim_epochs(claim)) {
+    return;
+  }
+
   // The claimed marks of the CLDs in the ClassLoaderDataGraph are cleared
   // outside a safepoint and without locking the ClassLoaderDataGraph_lock.
   // This is required to avoid a deadlock between concurrent GC threads and safepointing.
@@ -63,13 +79,57 @@ void ClassLoaderDataGraph::clear_claimed_marks() {
   // Any ClassLoaderData added after or during walking the list are prepended to
   // _head. Their claim mark need not be handled here.
   for (ClassLoaderData* cld = AtomicAccess::load_acquire(&_head); cld != nullptr; cld = cld->next()) {
-    cld->clear_claim();
+    cld->clear_claim(claim);
   }
 }
 
-void ClassLoaderDataGraph::clear_claimed_marks(int claim) {
- for (ClassLoaderData* cld = AtomicAccess::load_acquire(&_head); cld != nullptr; cld = cld->next()) {
-    cld->clear_claim(claim);
+void ClassLoaderDataGraph::add_to_modified_list(ClassLoaderData* cld) {
+  // Pushes may race with each other, and with unlink_unloading_from_modified_list()
+  // unlinking the head. Nothing else changes the list concurrently.
+  for (;;) {
+    ClassLoaderData* head = AtomicAccess::load(&_modified_head);
+    AtomicAccess::store(&cld->_next_modified, head);
+    if (AtomicAccess::cmpxchg(&_modified_head, head, cld) == head) {
+      return;
+    }
+  }
+}
+
+void ClassLoaderDataGraph::unlink_unloading_from_modified_list() {
+  assert_locked_or_safepoint(ClassLoaderDataGraph_lock);
+
+  // Unlink unloading CLDs at the head, racing with concurrent pushes.
+  ClassLoaderData* head = AtomicAccess::load_acquire(&_modified_head);
+  while (head != nullptr && head->is_unloading()) {
+    ClassLoaderData* next = AtomicAccess::load(&head->_next_modified);
+    ClassLoaderData* witness = AtomicAccess::cmpxchg(&_modified_head, head, next);
+    head = (witness == head) ? next : witness;
+  }
+
+  // The rest of the list is only ever changed here.
+  for (ClassLoaderData* prev = head; prev != nullptr;) {
+    ClassLoaderData* next = AtomicAccess::load(&prev->_next_modified);
+    if (next != nullptr && next->is_unloading()) {
+      AtomicAccess::store(&prev->_next_modified, AtomicAccess::load(&next->_next_modified));
+    } else {
+      prev = next;
+    }
+  }
+}
+
+void ClassLoaderDataGraph::modified_cld_do(CLDClosure* cl) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must only be called at safepoint");
+  // Detach the list, so that closures can push CLDs that remain
+  // modified onto a new one.
+  ClassLoaderData* cld = AtomicAccess::xchg(&_modified_head, (ClassLoaderData*)nullptr);
+  while (cld != nullptr) {
+    ClassLoaderData* next = AtomicAccess::load(&cld->_next_modified);
+    AtomicAccess::store(&cld->_next_modified, (ClassLoaderData*)nullptr);
+    AtomicAccess::release_store(&cld->_on_modified_list, false);
+    if (cld->has_modified_oops()) {
+      cl->do_cld(cld);
+    }
+    cld = next;
   }
 }
 
@@ -125,6 +185,7 @@ void ClassLoaderDataGraph::walk_metadata_and_clean_metaspaces() {
 
 // List head of all class loader data.
 ClassLoaderData* volatile ClassLoaderDataGraph::_head = nullptr;
+ClassLoaderData* volatile ClassLoaderDataGraph::_modified_head = nullptr;
 
 bool ClassLoaderDataGraph::_should_clean_deallocate_lists = false;
 bool ClassLoaderDataGraph::_safepoint_cleanup_needed = false;
@@ -159,6 +220,9 @@ ClassLoaderData* ClassLoaderDataGraph::add_to_graph(Handle loader, bool has_clas
   cld->set_next(_head);
   AtomicAccess::release_store(&_head, cld);
 
+  // New CLDs start out with modified oops.
+  cld->add_to_modified_list();
+
   // Next associate with the class_loader.
   if (!has_class_mirror_holder) {
     // Use OrderAccess, since readers need to get the loader_data only after
@@ -435,6 +499,10 @@ bool ClassLoaderDataGraph::do_unloading() {
     }
   }
 
+  if (loaders_removed != 0) {
+    unlink_unloading_from_modified_list();
+  }
+
   log_debug(class, loader, data)("do_unloading: loaders processed %u, loaders removed %u", loaders_processed, loaders_removed);
 
   return loaders_removed != 0;
@@ -442,24 +510,36 @@ bool ClassLoaderDataGraph::do_unloading() {
 
 // There's at least one dead class loader.  Purge refererences of healthy module
 // reads lists and package export lists to modules belonging to dead loaders.
+static void clean_module_and_package_info_of(ClassLoaderData* data) {
+  // Walk a ModuleEntry's reads, and a PackageEntry's exports
+  // lists to determine if there are modules on those lists that are now
+  // dead and should be removed.  A module's life cycle is equivalent
+  // to its defining class loader's life cycle.  Since a module is
+  // considered dead if its class loader is dead, these walks must
+  // occur after each class loader's aliveness is determined.
+  if (data->packages() != nullptr) {
+    data->packages()->purge_all_package_exports();
+  }
+  if (data->modules_defined()) {
+    data->modules()->purge_all_module_reads();
+  }
+}
+
 void ClassLoaderDataGraph::clean_module_and_package_info() {
   assert_locked_or_safepoint(ClassLoaderDataGraph_lock);
 
-  ClassLoaderData* data = _head;
-  while (data != nullptr) {
-    // Walk a ModuleEntry's reads, and a PackageEntry's exports
-    // lists to determine if there are modules on those lists that are now
-    // dead and should be removed.  A module's life cycle is equivalent
-    // to its defining class loader's life cycle.  Since a module is
-    // considered dead if its class loader is dead, these walks must
-    // occur after each class loader's aliveness is determined.
-    if (data->packages() != nullptr) {
-      data->packages()->purge_all_package_exports();
-    }
-    if (data->modules_defined()) {
-      data->modules()->purge_all_module_reads();
-    }
-    data = data->next();
+  for (ClassLoaderData* data = _head; data != nullptr; data = data->next()) {
+    clean_module_and_package_info_of(data);
+  }
+}
+
+void ClassLoaderDataGraph::clean_module_and_package_info(ClassLoaderDataGraphIteratorAtomic* clds) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must only be called at safepoint");
+
+  // The entries of each CLD only refer to other CLDs to check if they are
+  // alive, so the CLDs can be cleaned independently of each other.
+  for (ClassLoaderData* data = clds->next(); data != nullptr; data = clds->next()) {
+    clean_module_and_package_info_of(data);
   }
 }
 
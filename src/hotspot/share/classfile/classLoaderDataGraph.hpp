@@ -30,6 +30,8 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 
+class ClassLoaderDataGraphIteratorAtomic;
+
 // GC root for walking class loader data created
 
 class ClassLoaderDataGraph : public AllStatic {
@@ -42,6 +44,10 @@ class ClassLoaderDataGraph : public AllStatic {
   // All CLDs (except unlinked CLDs) can be reached by walking _head->_next->...
   static ClassLoaderData* volatile _head;
 
+  // All CLDs with modified oops can be reached by walking
+  // _modified_head->_next_modified->... CLDs are only inserted at the head.
+  static ClassLoaderData* volatile _modified_head;
+
   // Set if there's anything to purge in the deallocate lists or previous versions
   // during a safepoint after class unloading in a full GC.
   static bool _should_clean_deallocate_lists;
@@ -56,16 +62,26 @@ class ClassLoaderDataGraph : public AllStatic {
 
   static ClassLoaderData* add_to_graph(Handle class_loader, bool has_class_mirror_holder);
 
+  static void add_to_modified_list(ClassLoaderData* cld);
+  static void unlink_unloading_from_modified_list();
+
  public:
   static ClassLoaderData* find_or_create(Handle class_loader);
   static ClassLoaderData* add(Handle class_loader, bool has_class_mirror_holder);
   static void clean_module_and_package_info();
+  // Parallel version of the above, for the CLDs handed out by clds.
+  static void clean_module_and_package_info(ClassLoaderDataGraphIteratorAtomic* clds);
   static void purge(bool at_safepoint);
   static void clear_claimed_marks();
   static void clear_claimed_marks(int claim);
   static void verify_claimed_marks_cleared(int claim);
   // Iteration through CLDG; GC support
   static void cld_do(CLDClosure* cl);
+  // Applies cl to (at least) all CLDs that have had their oops modified since
+  // the last call, in place of walking all CLDs. Young collections only need
+  // to visit these. Closures must record_modified_oops() again for CLDs that
+  // still have oops into the young generation.
+  static void modified_cld_do(CLDClosure* cl);
   static void roots_cld_do(CLDClosure* strong, CLDClosure* weak);
   static void always_strong_cld_do(CLDClosure* cl);
   // Iteration through CLDG not by GC.
@@ -3947,6 +3947,7 @@ int java_lang_ref_Reference::_referent_offset;
 int java_lang_ref_Reference::_queue_offset;
 int java_lang_ref_Reference::_next_offset;
 int java_lang_ref_Reference::_discovered_offset;
+int java_lang_ref_Reference::_gc_state_offset;
 
 #define REFERENCE_FIELDS_DO(macro) \
   macro(_referent_offset,   k, "referent", object_signature, false); \
@@ -3961,12 +3962,14 @@ void java_lang_ref_Reference::compute_offsets() {
   _offsets_initialized = true;
   InstanceKlass* k = vmClasses::Reference_klass();
   REFERENCE_FIELDS_DO(FIELD_COMPUTE_OFFSET);
+  REFERENCE_INJECTED_FIELDS(INJECTED_FIELD_COMPUTE_OFFSET);
 }
 
 #if INCLUDE_CDS
 void java_lang_ref_Reference::serialize_offsets(SerializeClosure* f) {
   f->do_bool(&_offsets_initialized);
   REFERENCE_FIELDS_DO(FIELD_SERIALIZE_OFFSET);
+  REFERENCE_INJECTED_FIELDS(INJECTED_FIELD_SERIALIZE_OFFSET);
 }
 #endif
 
@@ -176,6 +176,18 @@ class java_lang_String : AllStatic {
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
+    // Four bytes per step, with the powers of 31 spelled out, so that the
+    // multiplications of one step do not depend on each other. Same result
+    // as the plain loop below.
+    while (len >= 4) {
+      h = 923521 * h +
+          29791 * (((unsigned int) s[0]) & 0xFF) +
+          961   * (((unsigned int) s[1]) & 0xFF) +
+          31    * (((unsigned int) s[2]) & 0xFF) +
+                  (((unsigned int) s[3]) & 0xFF);
+      s += 4;
+      len -= 4;
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
@@ -1015,11 +1027,21 @@ class java_lang_boxing_object: AllStatic {
 
 // Interface to java.lang.ref.Reference objects
 
+#define REFERENCE_INJECTED_FIELDS(macro)                                 \
+  macro(java_lang_ref_Reference, gc_state, int_signature, false)
+
 class java_lang_ref_Reference: AllStatic {
   static int _referent_offset;
   static int _queue_offset;
   static int _next_offset;
   static int _discovered_offset;
+  static int _gc_state_offset;
+
+  // Layout of the injected gc_state field
+  static const int referent_survivals_bits  = 8;
+  static const int queue_state_shift        = referent_survivals_bits;
+  static const jint referent_survivals_mask = right_n_bits(referent_survivals_bits);
+  static const jint queue_state_mask        = right_n_bits(2) << queue_state_shift;
 
   static bool _offsets_initialized;
 
@@ -1040,6 +1062,21 @@ class java_lang_ref_Reference: AllStatic {
   static inline void set_discovered(oop ref, oop value);
   static inline void set_discovered_raw(oop ref, oop value);
   static inline HeapWord* discovered_addr_raw(oop ref);
+  // Number of collections in a row that discovered the reference
+  // and then found its referent alive, see ReferentLivenessPrediction
+  static const jint max_referent_survivals = referent_survivals_mask;
+  static inline jint referent_survivals(oop ref);
+  static inline void set_referent_survivals(oop ref, jint value);
+  // Whether the reference was constructed with a ReferenceQueue, as last
+  // seen by a collector. The queue of an active reference only changes
+  // when the reference is enqueued, which also makes it inactive.
+  enum QueueState {
+    queue_unknown = 0,
+    queue_none    = 1,
+    queue_present = 2
+  };
+  static inline QueueState queue_state(oop ref);
+  static inline void set_queue_state(oop ref, QueueState state);
   static bool is_referent_field(oop obj, ptrdiff_t offset);
   static inline bool is_final(oop ref);
   static inline bool is_phantom(oop ref);
@@ -191,6 +191,25 @@ HeapWord* java_lang_ref_Reference::discovered_addr_raw(oop ref) {
   return ref->field_addr<HeapWord>(_discovered_offset);
 }
 
+jint java_lang_ref_Reference::referent_survivals(oop ref) {
+  return ref->int_field(_gc_state_offset) & referent_survivals_mask;
+}
+
+void java_lang_ref_Reference::set_referent_survivals(oop ref, jint value) {
+  assert(value >= 0 && value <= max_referent_survivals, "Invalid survivals %d", value);
+  const jint state = ref->int_field(_gc_state_offset);
+  ref->int_field_put(_gc_state_offset, (state & ~referent_survivals_mask) | value);
+}
+
+java_lang_ref_Reference::QueueState java_lang_ref_Reference::queue_state(oop ref) {
+  return (QueueState)((ref->int_field(_gc_state_offset) & queue_state_mask) >> queue_state_shift);
+}
+
+void java_lang_ref_Reference::set_queue_state(oop ref, QueueState state) {
+  const jint value = ref->int_field(_gc_state_offset);
+  ref->int_field_put(_gc_state_offset, (value & ~queue_state_mask) | ((jint)state << queue_state_shift));
+}
+
 bool java_lang_ref_Reference::is_final(oop ref) {
   return InstanceKlass::cast(ref->klass())->reference_type() == REF_FINAL;
 }
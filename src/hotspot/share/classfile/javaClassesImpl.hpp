@@ -42,6 +42,7 @@
   THREAD_INJECTED_FIELDS(macro)             \
   VTHREAD_INJECTED_FIELDS(macro)            \
   INTERNALERROR_INJECTED_FIELDS(macro)      \
+  REFERENCE_INJECTED_FIELDS(macro)          \
   STACKCHUNK_INJECTED_FIELDS(macro)         \
   CONSTANTPOOL_INJECTED_FIELDS(macro)
 
@@ -31,6 +31,7 @@
 #include "classfile/classLoadInfo.hpp"
 #include "classfile/klassFactory.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "memory/classLoaderMetaspace.hpp"
 #include "memory/resourceArea.hpp"
 #include "prims/jvmtiEnvBase.hpp"
 #include "prims/jvmtiRedefineClasses.hpp"
@@ -197,6 +198,10 @@ InstanceKlass* KlassFactory::create_from_stream(ClassFileStream* stream,
                                         CHECK_NULL);
   }
 
+  // Threads defining classes for the same loader in parallel should not
+  // serialize on its metaspace lock for every piece of metadata.
+  MetaspaceAllocationBuffer metaspace_buffer(loader_data->metaspace_non_null());
+
   ClassFileParser parser(stream,
                          name,
                          loader_data,
@@ -36,6 +36,7 @@
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -566,9 +567,38 @@ void StringTable::grow(JavaThread* jt) {
   log_debug(stringtable)("Grown to size:%zu", _current_size);
 }
 
-struct StringTableDoDelete : StackObj {
+// Releases the OopStorage entries of deleted nodes in batches, instead of
+// one at a time from StringTableConfig::free_node().
+class StringTableDoDelete : public StackObj {
+  static const size_t BatchSize = 256;
+
+  OopStorage* const _storage;
+  size_t _count;
+  const oop* _batch[BatchSize];
+
+public:
+  StringTableDoDelete(OopStorage* storage) : _storage(storage), _count(0) {}
+
+  ~StringTableDoDelete() {
+    assert(_count == 0, "not flushed");
+  }
+
   void operator()(WeakHandle* val) {
-    /* do nothing */
+    oop* p = val->ptr_raw();
+    NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(p, nullptr);
+    // Leave nothing for free_node() to release.
+    *val = WeakHandle();
+    _batch[_count++] = p;
+    if (_count == BatchSize) {
+      flush();
+    }
+  }
+
+  void flush() {
+    if (_count > 0) {
+      _storage->release(_batch, _count);
+      _count = 0;
+    }
   }
 };
 
@@ -599,10 +629,11 @@ void StringTable::clean_dead_entries(JavaThread* jt) {
   }
 
   StringTableDeleteCheck stdc;
-  StringTableDoDelete stdd;
+  StringTableDoDelete stdd(_oop_storage);
   {
     TraceTime timer("Clean", TRACETIME_LOG(Debug, stringtable, perf));
     while(bdt.do_task(jt, stdc, stdd)) {
+      stdd.flush();
       bdt.pause(jt);
       {
         ThreadBlockInVM tbivm(jt);
@@ -614,6 +645,67 @@ void StringTable::clean_dead_entries(JavaThread* jt) {
   log_debug(stringtable)("Cleaned %ld of %ld", stdc._count, stdc._item);
 }
 
+class StringTableParCleanTask : public WorkerTask {
+  StringTableHash::BulkDeleteTask _bdt;
+  OopStorage* const _storage;
+  volatile size_t _count;
+  volatile size_t _item;
+
+public:
+  StringTableParCleanTask(StringTableHash* table, OopStorage* storage) :
+    WorkerTask("StringTable Cleaning"),
+    _bdt(table, true /* is_mt */),
+    _storage(storage),
+    _count(0),
+    _item(0) {}
+
+  bool prepare(Thread* thread) { return _bdt.prepare(thread); }
+  void done(Thread* thread)    { _bdt.done(thread); }
+
+  size_t count() const { return _count; }
+  size_t item() const  { return _item; }
+
+  virtual void work(uint worker_id) {
+    Thread* const thread = Thread::current();
+    StringTableDeleteCheck stdc;
+    StringTableDoDelete stdd(_storage);
+    while (_bdt.do_task(thread, stdc, stdd)) {
+      // Claim the next range.
+    }
+    stdd.flush();
+    AtomicAccess::add(&_count, (size_t)stdc._count);
+    AtomicAccess::add(&_item, (size_t)stdc._item);
+  }
+};
+
+void StringTable::clean_dead_entries(WorkerThreads* workers, uint num_workers) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // Only take over the cleaning the service thread has been asked to do.
+  // Growing and rehashing remain service thread work.
+  if (!StringTableCleanDuringGC || !has_work() || needs_rehashing() || should_grow()) {
+    return;
+  }
+  // Don't wait in the pause for a trim in progress, leave the work to the
+  // service thread instead.
+  NativeHeapTrimmer::TrySuspendMark sm("stringtable");
+  if (!sm.suspended()) {
+    return;
+  }
+  Thread* const thread = Thread::current();
+  StringTableParCleanTask task(_local_table, _oop_storage);
+  // Fails if the service thread is in the middle of a table operation.
+  if (!task.prepare(thread)) {
+    return;
+  }
+  {
+    TraceTime timer("Parallel Clean", TRACETIME_LOG(Debug, stringtable, perf));
+    workers->run_task(&task, num_workers);
+    task.done(thread);
+  }
+  AtomicAccess::release_store(&_has_work, false);
+  log_debug(stringtable)("Cleaned %zu of %zu using %u workers", task.count(), task.item(), num_workers);
+}
+
 void StringTable::gc_notification(size_t num_dead) {
   log_trace(stringtable)("Uncleaned items:%zu", num_dead);
 
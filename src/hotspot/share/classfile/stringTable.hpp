@@ -35,6 +35,7 @@
 class CompactHashtableWriter;
 class JavaThread;
 class SerializeClosure;
+class WorkerThreads;
 
 class StringTableConfig;
 
@@ -91,6 +92,11 @@ class StringTable : AllStatic {
   static void do_concurrent_work(JavaThread* jt);
   static bool has_work();
 
+  // Called by the GC at a safepoint, right after weak processing has
+  // reported the number of dead entries. Removes them in parallel on the
+  // given workers if the service thread would otherwise be asked to.
+  static void clean_dead_entries(WorkerThreads* workers, uint num_workers);
+
   // Probing
   static oop lookup(Symbol* symbol);
   static oop lookup(const jchar* chars, int length);
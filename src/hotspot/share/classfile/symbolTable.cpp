@@ -92,6 +92,12 @@ static volatile bool _alt_hash = false;
 // are updating "lookup success history" in a global shared variable, so use built-in TLS
 static THREAD_LOCAL bool _lookup_shared_first = false;
 
+// While new_symbols() enters a batch of permanent symbols, their nodes are
+// bump allocated from one region of the symbol arena that is reserved for the
+// whole batch, instead of taking SymbolArena_lock once per symbol.
+static THREAD_LOCAL char* _batch_top = nullptr;
+static THREAD_LOCAL char* _batch_end = nullptr;
+
 // Static arena for symbols that are not deallocated
 Arena* SymbolTable::_arena = nullptr;
 
@@ -158,11 +164,17 @@ class SymbolTableConfig : public AllStatic {
     if (value.refcount() != PERM_REFCOUNT) {
       FreeHeap(memory);
     } else {
+      size_t alloc_size = SymbolTableHash::get_dynamic_node_size(value.byte_size());
+      if (_batch_top != nullptr && (char*)memory + ARENA_ALIGN(alloc_size) == _batch_top) {
+        // Node of this thread's batch that lost the insert race, take it back.
+        _batch_top = (char*)memory;
+        SymbolTable::item_removed();
+        return;
+      }
       MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
       // Deleting permanent symbol should not occur very often (insert race condition),
       // so log it.
       log_trace_symboltable_helper(&value, "Freeing permanent symbol");
-      size_t alloc_size = SymbolTableHash::get_dynamic_node_size(value.byte_size());
       if (!SymbolTable::arena()->Afree(memory, alloc_size)) {
         // Can't access the symbol after Afree, but we just printed it above.
         NOT_PRODUCT(log_trace(symboltable)(" - Leaked permanent symbol");)
@@ -193,6 +205,11 @@ class SymbolTableConfig : public AllStatic {
 #endif
     if (value.refcount() != PERM_REFCOUNT) {
       return AllocateHeap(alloc_size, mtSymbol);
+    } else if (_batch_top != nullptr && ARENA_ALIGN(alloc_size) <= (size_t)(_batch_end - _batch_top)) {
+      // Bump allocate from the region reserved by new_symbols()
+      void* p = _batch_top;
+      _batch_top += ARENA_ALIGN(alloc_size);
+      return p;
     } else {
       // Allocate to global arena
       MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
@@ -481,21 +498,78 @@ Symbol* SymbolTable::lookup_only_unicode(const jchar* name, int utf16_length,
   }
 }
 
+// Reserves the symbol arena space for a batch of permanent symbols, see
+// _batch_top. Space the batch did not use is given back if nothing else has
+// been allocated from the arena in the meantime.
+class SymbolTable::PermanentBatch : public StackObj {
+  bool _active;
+
+public:
+  PermanentBatch(bool is_permanent, int names_count, const int* lengths) : _active(false) {
+    if (!is_permanent || CDSConfig::is_dumping_static_archive()) {
+      return;
+    }
+    size_t total = 0;
+    for (int i = 0; i < names_count; i++) {
+      total += ARENA_ALIGN(SymbolTableHash::get_dynamic_node_size(Symbol::byte_size(lengths[i])));
+    }
+    assert(_batch_top == nullptr, "batches do not nest");
+    MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
+    _batch_top = (char*)SymbolTable::arena()->Amalloc(total);
+    _batch_end = _batch_top + total;
+    _active = true;
+  }
+
+  ~PermanentBatch() {
+    if (_active) {
+      MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
+      SymbolTable::arena()->Afree(_batch_top, _batch_end - _batch_top);
+      _batch_top = _batch_end = nullptr;
+    }
+  }
+};
+
 void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHandle& cp,
                               int names_count, const char** names, int* lengths,
                               int* cp_indices, unsigned int* hashValues) {
   // Note that is_permanent will be false for non-strong hidden classes.
   // even if their loader is the boot loader because they will have a different cld.
   bool is_permanent = loader_data->is_the_null_class_loader_data();
+  PermanentBatch batch(is_permanent, names_count, lengths);
+  Thread* current = Thread::current();
+  ResourceMark rm(current);
+  SymbolTableLookup* lookups = NEW_RESOURCE_ARRAY_IN_THREAD(current, SymbolTableLookup, names_count);
+  Symbol** tmps = NEW_RESOURCE_ARRAY_IN_THREAD(current, Symbol*, names_count);
   for (int i = 0; i < names_count; i++) {
     const char *name = names[i];
     int len = lengths[i];
     assert(len <= Symbol::max_length(), "must be - these come from the constant pool");
     unsigned int hash = hashValues[i];
     assert(lookup_shared(name, len, hash) == nullptr, "must have checked already");
-    Symbol* sym = do_add_if_needed(name, len, hash, is_permanent);
+    ::new ((void*)&lookups[i]) SymbolTableLookup(name, len, hash);
+    u1* u1_buf = NEW_RESOURCE_ARRAY_IN_THREAD(current, u1, Symbol::byte_size(len));
+    tmps[i] = ::new ((void*)u1_buf) Symbol((const u1*)name, len,
+                                           (is_permanent || CDSConfig::is_dumping_static_archive()) ? PERM_REFCOUNT : 1);
+  }
+
+  // Both an inserted symbol and a duplicate found by SymbolTableLookup carry
+  // the count that is ours, see do_add_if_needed().
+  auto value_f = [&](size_t i) -> const Symbol& {
+    return *tmps[i];
+  };
+  auto found_f = [&](size_t i, Symbol* sym) {
     assert(sym->refcount() != 0, "lookup should have incremented the count");
     cp->symbol_at_put(cp_indices[i], sym);
+  };
+  bool clean_hint = false;
+  bool rehash_warning = false;
+  _local_table->insert_get_batch(current, names_count, lookups, value_f, found_f,
+                                 &rehash_warning, &clean_hint);
+  update_needs_rehash(rehash_warning);
+
+  if (clean_hint) {
+    mark_has_items_to_clean();
+    check_concurrent_work();
   }
 }
 
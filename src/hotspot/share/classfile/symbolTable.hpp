@@ -53,6 +53,8 @@ class SymbolTable : public AllStatic {
   friend class SymbolTableCreateEntry;
 
  private:
+  class PermanentBatch;
+
   static volatile bool _has_work;
 
   // Set if one bucket is out of balance due to hash algorithm deficiency
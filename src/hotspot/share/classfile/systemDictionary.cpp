@@ -44,6 +44,8 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "gc/shared/workerUtils.hpp"
 #include "interpreter/bootstrapInfo.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm.h"
@@ -1551,7 +1553,50 @@ InstanceKlass* SystemDictionary::find_or_define_instance_class(Symbol* class_nam
 // GC support
 
 // Assumes classes in the SystemDictionary are only unloaded at a safepoint
-bool SystemDictionary::do_unloading(GCTimer* gc_timer) {
+// Purges the tables that refer to unloaded class loaders at a safepoint.
+// Each global table is claimed and purged as a whole by one worker, while
+// the module and package info of the remaining CLDs is cleaned by all
+// workers together.
+class SystemDictionaryPurgeTask : public WorkerTask {
+  enum Table : uint {
+    LoaderConstraints,
+    ResolutionErrors,
+    NumTables
+  };
+
+  SubTasksDone _tables;
+  ClassLoaderDataGraphIteratorAtomic _clds;
+  Tickspan _table_times[NumTables];
+
+  template <typename Function>
+  void purge_table(Table table, Function purge) {
+    if (_tables.try_claim_task(table)) {
+      const Ticks start = Ticks::now();
+      purge();
+      _table_times[table] = Ticks::now() - start;
+    }
+  }
+
+public:
+  SystemDictionaryPurgeTask() :
+    WorkerTask("System Dictionary Purge"),
+    _tables(NumTables),
+    _clds() {}
+
+  void work(uint worker_id) {
+    purge_table(LoaderConstraints, [] { LoaderConstraintTable::purge_loader_constraints(); });
+    purge_table(ResolutionErrors, [] { ResolutionErrorTable::purge_resolution_errors(); });
+    _tables.all_tasks_claimed();
+    ClassLoaderDataGraph::clean_module_and_package_info(&_clds);
+  }
+
+  void log_table_times() const {
+    log_trace(gc, phases)("Loader Constraints %.3fms", _table_times[LoaderConstraints].seconds() * MILLIUNITS);
+    log_trace(gc, phases)("Resolution Errors %.3fms", _table_times[ResolutionErrors].seconds() * MILLIUNITS);
+  }
+};
+
+bool SystemDictionary::do_unloading(GCTimer* gc_timer, WorkerThreads* workers) {
 
   bool unloading_occurred;
   bool is_concurrent = !SafepointSynchronize::is_at_safepoint();
@@ -1565,9 +1610,25 @@ bool SystemDictionary::do_unloading(GCTimer* gc_timer) {
       JFR_ONLY(Jfr::on_unloading_classes();)
       MANAGEMENT_ONLY(FinalizerService::purge_unloaded();)
       ConditionalMutexLocker ml1(SystemDictionary_lock, is_concurrent);
-      ClassLoaderDataGraph::clean_module_and_package_info();
-      LoaderConstraintTable::purge_loader_constraints();
-      ResolutionErrorTable::purge_resolution_errors();
+      if (!is_concurrent && workers != nullptr && workers->active_workers() > 1) {
+        GCTraceTime(Trace, gc, phases) tp("Purge Tables", gc_timer);
+        SystemDictionaryPurgeTask task;
+        workers->run_task(&task);
+        task.log_table_times();
+      } else {
+        {
+          GCTraceTime(Trace, gc, phases) tm("Module and Package Info", gc_timer);
+          ClassLoaderDataGraph::clean_module_and_package_info();
+        }
+        {
+          GCTraceTime(Trace, gc, phases) tl("Loader Constraints", gc_timer);
+          LoaderConstraintTable::purge_loader_constraints();
+        }
+        {
+          GCTraceTime(Trace, gc, phases) tr("Resolution Errors", gc_timer);
+          ResolutionErrorTable::purge_resolution_errors();
+        }
+      }
     }
   }
 
@@ -70,6 +70,7 @@ class ClassLoadInfo;
 class Dictionary;
 class PackageEntry;
 class GCTimer;
+class WorkerThreads;
 class EventClassLoad;
 class Symbol;
 
@@ -189,8 +190,10 @@ class SystemDictionary : AllStatic {
   // Garbage collection support
 
   // Unload (that is, break root links to) all unmarked classes and
-  // loaders.  Returns "true" iff something was unloaded.
-  static bool do_unloading(GCTimer* gc_timer);
+  // loaders.  Returns "true" iff something was unloaded. If workers are
+  // given, the tables referring to unloaded loaders are purged in parallel
+  // when at a safepoint.
+  static bool do_unloading(GCTimer* gc_timer, WorkerThreads* workers = nullptr);
 
   // Printing
   static void print();
@@ -1412,6 +1412,12 @@ void SystemDictionaryShared::update_shared_entry(InstanceKlass* k, int id) {
   info->_id = id;
 }
 
+int SystemDictionaryShared::classlist_id(InstanceKlass* k) {
+  MutexLocker ml(DumpTimeTable_lock, Mutex::_no_safepoint_check_flag);
+  DumpTimeClassInfo* info = _dumptime_table->get(k);
+  return info == nullptr ? -1 : info->_id;
+}
+
 const char* SystemDictionaryShared::loader_type_for_shared_class(Klass* k) {
   assert(k != nullptr, "Sanity");
   assert(k->in_aot_cache(), "Must be");
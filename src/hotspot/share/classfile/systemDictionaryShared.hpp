@@ -234,6 +234,8 @@ class SystemDictionaryShared: public SystemDictionary {
   }
 
   static void update_shared_entry(InstanceKlass* klass, int id);
+  // Returns the classlist ID of k, or -1 if k was not loaded from the classlist.
+  static int classlist_id(InstanceKlass* k);
   static void set_shared_class_misc_info(InstanceKlass* k, ClassFileStream* cfs);
 
   static InstanceKlass* lookup_from_stream(Symbol* class_name,
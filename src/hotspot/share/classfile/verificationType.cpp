@@ -128,9 +128,26 @@ bool VerificationType::is_reference_assignable_from(
       }
     }
 #endif
-    return resolve_and_check_assignability(context->current_class(), name(), from.name(),
-                                           from_field_is_protected, from.is_array(),
-                                           from.is_object(), this_is_interface, THREAD);
+    const AssignabilityCheck check(name(), from.name(), from_field_is_protected);
+    const AssignabilityResult* cached = context->assignability_cache()->get(check);
+    if (cached != nullptr) {
+      if (this_is_interface != nullptr) {
+        *this_is_interface = cached->_target_is_interface;
+      }
+      return cached->_is_assignable;
+    }
+
+    AssignabilityResult result;
+    result._target_is_interface = false;
+    result._is_assignable = resolve_and_check_assignability(context->current_class(), name(), from.name(),
+                                                            from_field_is_protected, from.is_array(),
+                                                            from.is_object(), &result._target_is_interface,
+                                                            CHECK_false);
+    context->assignability_cache()->put_when_absent(check, result);
+    if (this_is_interface != nullptr) {
+      *this_is_interface = result._target_is_interface;
+    }
+    return result._is_assignable;
   } else if (is_array() && from.is_array()) {
     VerificationType comp_this = get_component(context);
     VerificationType comp_from = from.get_component(context);
@@ -273,6 +273,44 @@ class sig_as_verification_types : public ResourceObj {
 typedef HashTable<int, sig_as_verification_types*, 1007>
                           method_signatures_table_type;
 
+// A reference assignability check that needed class resolution. Whether
+// the types are arrays or objects follows from their names.
+class AssignabilityCheck {
+ public:
+  Symbol* _target_name;
+  Symbol* _from_name;
+  bool    _from_field_is_protected;
+
+  AssignabilityCheck(Symbol* target_name, Symbol* from_name, bool from_field_is_protected) :
+    _target_name(target_name), _from_name(from_name), _from_field_is_protected(from_field_is_protected) {
+  }
+
+  static unsigned hash(const AssignabilityCheck& check) {
+    return primitive_hash(check._target_name) ^
+           (primitive_hash(check._from_name) * 31) ^
+           (unsigned)check._from_field_is_protected;
+  }
+
+  static bool equals(const AssignabilityCheck& a, const AssignabilityCheck& b) {
+    return a._target_name == b._target_name &&
+           a._from_name == b._from_name &&
+           a._from_field_is_protected == b._from_field_is_protected;
+  }
+};
+
+class AssignabilityResult {
+ public:
+  bool _is_assignable;
+  bool _target_is_interface;
+};
+
+// Caches the results of the assignability checks of the class being verified,
+// so that the same pair of types is only resolved and compared once
+typedef HashTable<AssignabilityCheck, AssignabilityResult, 137,
+                  AnyObj::RESOURCE_AREA, mtInternal,
+                  AssignabilityCheck::hash, AssignabilityCheck::equals>
+                          assignability_cache_type;
+
 // A new instance of this class is created for each class being verified
 class ClassVerifier : public StackObj {
  private:
@@ -285,6 +323,7 @@ class ClassVerifier : public StackObj {
   char* _message;
 
   method_signatures_table_type _method_signatures_table;
+  assignability_cache_type _assignability_cache;
 
   ErrorContext _error_context;  // contains information about an error
 
@@ -425,6 +464,10 @@ class ClassVerifier : public StackObj {
 
   Klass* load_class(Symbol* name, TRAPS);
 
+  assignability_cache_type* assignability_cache() {
+    return &_assignability_cache;
+  }
+
   method_signatures_table_type* method_signatures_table() {
     return &_method_signatures_table;
   }
@@ -110,6 +110,7 @@ class SerializeClosure;
   template(java_lang_ref_FinalReference,              "java/lang/ref/FinalReference")             \
   template(java_lang_ref_PhantomReference,            "java/lang/ref/PhantomReference")           \
   template(java_lang_ref_Finalizer,                   "java/lang/ref/Finalizer")                  \
+  template(jdk_internal_access_SharedSecrets,         "jdk/internal/access/SharedSecrets")        \
   template(java_lang_reflect_AccessibleObject,        "java/lang/reflect/AccessibleObject")       \
   template(java_lang_reflect_Method,                  "java/lang/reflect/Method")                 \
   template(java_lang_reflect_Constructor,             "java/lang/reflect/Constructor")            \
@@ -389,7 +390,10 @@ class SerializeClosure;
   template(shutdown_name,                             "shutdown")                                 \
   template(finalize_method_name,                      "finalize")                                 \
   template(reference_discovered_name,                 "discovered")                               \
+  template(gc_state_name,                             "gc_state")                                 \
   template(run_finalization_name,                     "runFinalization")                          \
+  template(run_finalizer_name,                        "runFinalizer")                             \
+  template(getJavaLangAccess_name,                    "getJavaLangAccess")                        \
   template(dispatchUncaughtException_name,            "dispatchUncaughtException")                \
   template(loadClass_name,                            "loadClass")                                \
   template(startTransition_name,                      "startTransition")                          \
@@ -592,6 +596,8 @@ class SerializeClosure;
   template(void_classloader_signature,                "()Ljava/lang/ClassLoader;")                                \
   template(void_BuiltinClassLoader_signature,         "()Ljdk/internal/loader/BuiltinClassLoader;")               \
   template(void_object_signature,                     "()Ljava/lang/Object;")                                     \
+  template(void_JavaLangAccess_signature,             "()Ljdk/internal/access/JavaLangAccess;")                   \
+  template(JavaLangAccess_void_signature,             "(Ljdk/internal/access/JavaLangAccess;)V")                  \
   template(void_class_signature,                      "()Ljava/lang/Class;")                                      \
   template(void_class_array_signature,                "()[Ljava/lang/Class;")                                     \
   template(void_string_signature,                     "()Ljava/lang/String;")                                     \
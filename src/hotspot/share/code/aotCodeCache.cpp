@@ -35,6 +35,7 @@
 #include "gc/shared/gcConfig.hpp"
 #include "logging/logStream.hpp"
 #include "memory/memoryReserver.hpp"
+#include "runtime/atomicAccess.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/flags/flagSetting.hpp"
 #include "runtime/globals_extension.hpp"
@@ -45,6 +46,7 @@
 #include "runtime/stubInfo.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "utilities/copy.hpp"
+#include "utilities/powerOfTwo.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Runtime1.hpp"
 #endif
@@ -304,6 +306,10 @@ AOTCodeCache::AOTCodeCache(bool is_dumping, bool is_using) :
   _table(nullptr),
   _load_entries(nullptr),
   _search_entries(nullptr),
+  _entries_index(nullptr),
+  _entries_index_mask(0),
+  _load_hits(0),
+  _load_misses(0),
   _store_entries(nullptr),
   _C_strings_buf(nullptr),
   _store_entries_cnt(0)
@@ -386,7 +392,14 @@ AOTCodeCache::~AOTCodeCache() {
   if (for_dump()) { // Finalize cache
     finish_write();
   }
+  if (for_use()) {
+    log_info(aot, codecache, exit)("AOT Code Cache lookups: %u hits, %u misses", _load_hits, _load_misses);
+  }
   _load_buffer = nullptr;
+  if (_entries_index != nullptr) {
+    FREE_C_HEAP_ARRAY(uint, _entries_index);
+    _entries_index = nullptr;
+  }
   if (_C_store_buffer != nullptr) {
     FREE_C_HEAP_ARRAY(char, _C_store_buffer);
     _C_store_buffer = nullptr;
@@ -606,68 +619,54 @@ void* AOTCodeEntry::operator new(size_t x, AOTCodeCache* cache) {
   return (void*)(cache->add_entry());
 }
 
-static bool check_entry(AOTCodeEntry::Kind kind, uint id, AOTCodeEntry* entry) {
-  if (entry->kind() == kind) {
-    assert(entry->id() == id, "sanity");
-    return true; // Found
+static uint entries_index_slot(uint id, uint mask) {
+  return (id * 2654435761u) & mask; // Fibonacci hashing
+}
+
+// Build the hash index over the [id, index] search table written at dump
+// time. The index is at most half full so probing always finds an empty slot.
+uint* AOTCodeCache::init_entries_index() {
+  uint count = _load_header->entries_count();
+  _search_entries = (uint*)addr(_load_header->entries_offset()); // [id, index]
+  _load_entries = (AOTCodeEntry*)(_search_entries + 2 * count);
+  uint size = round_up_power_of_2(MAX2(2 * count, 2u));
+  uint mask = size - 1;
+  uint* index = NEW_C_HEAP_ARRAY(uint, size, mtCode);
+  memset(index, 0, size * sizeof(uint));
+  for (uint i = 0; i < count; i++) {
+    uint slot = entries_index_slot(_search_entries[2 * i], mask);
+    while (index[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    index[slot] = _search_entries[2 * i + 1] + 1;
   }
-  return false;
+  _entries_index_mask = mask;
+  uint* prev = AtomicAccess::cmpxchg(&_entries_index, (uint*)nullptr, index);
+  if (prev != nullptr) {
+    // Lost the race with another thread, use its index
+    FREE_C_HEAP_ARRAY(uint, index);
+    return prev;
+  }
+  log_debug(aot, codecache, init)("Read %d entries table at offset %d from AOT Code Cache", count, _load_header->entries_offset());
+  return index;
 }
 
 AOTCodeEntry* AOTCodeCache::find_entry(AOTCodeEntry::Kind kind, uint id) {
   assert(_for_use, "sanity");
-  uint count = _load_header->entries_count();
-  if (_load_entries == nullptr) {
-    // Read it
-    _search_entries = (uint*)addr(_load_header->entries_offset()); // [id, index]
-    _load_entries = (AOTCodeEntry*)(_search_entries + 2 * count);
-    log_debug(aot, codecache, init)("Read %d entries table at offset %d from AOT Code Cache", count, _load_header->entries_offset());
-  }
-  // Binary search
-  int l = 0;
-  int h = count - 1;
-  while (l <= h) {
-    int mid = (l + h) >> 1;
-    int ix = mid * 2;
-    uint is = _search_entries[ix];
-    if (is == id) {
-      int index = _search_entries[ix + 1];
-      AOTCodeEntry* entry = &(_load_entries[index]);
-      if (check_entry(kind, id, entry)) {
-        return entry; // Found
-      }
-      // Linear search around to handle id collission
-      for (int i = mid - 1; i >= l; i--) { // search back
-        ix = i * 2;
-        is = _search_entries[ix];
-        if (is != id) {
-          break;
-        }
-        index = _search_entries[ix + 1];
-        AOTCodeEntry* entry = &(_load_entries[index]);
-        if (check_entry(kind, id, entry)) {
-          return entry; // Found
-        }
-      }
-      for (int i = mid + 1; i <= h; i++) { // search forward
-        ix = i * 2;
-        is = _search_entries[ix];
-        if (is != id) {
-          break;
-        }
-        index = _search_entries[ix + 1];
-        AOTCodeEntry* entry = &(_load_entries[index]);
-        if (check_entry(kind, id, entry)) {
-          return entry; // Found
-        }
-      }
-      break; // Not found match
-    } else if (is < id) {
-      l = mid + 1;
-    } else {
-      h = mid - 1;
+  uint* index = AtomicAccess::load_acquire(&_entries_index);
+  if (index == nullptr) {
+    index = init_entries_index();
+  }
+  // Entries of different kinds can share an id, see encode_id()
+  uint mask = _entries_index_mask;
+  for (uint slot = entries_index_slot(id, mask); index[slot] != 0; slot = (slot + 1) & mask) {
+    AOTCodeEntry* entry = &(_load_entries[index[slot] - 1]);
+    if (entry->id() == id && entry->kind() == kind) {
+      AtomicAccess::inc(&_load_hits);
+      return entry; // Found
     }
   }
+  AtomicAccess::inc(&_load_misses);
   return nullptr;
 }
 
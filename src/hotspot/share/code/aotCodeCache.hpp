@@ -264,6 +264,10 @@ class AOTCodeCache : public CHeapObj<mtCode> {
 
   AOTCodeEntry* _load_entries;   // Used when reading cache
   uint*         _search_entries; // sorted by ID table [id, index]
+  uint*         _entries_index;  // Hash index: _load_entries index + 1, or 0 if empty
+  uint          _entries_index_mask;
+  volatile uint _load_hits;      // Lookups that found an entry
+  volatile uint _load_misses;    // Lookups that did not find an entry
   AOTCodeEntry* _store_entries;  // Used when writing cache
   const char*   _C_strings_buf;  // Loaded buffer for _C_strings[] table
   uint          _store_entries_cnt;
@@ -271,6 +275,8 @@ class AOTCodeCache : public CHeapObj<mtCode> {
   static AOTCodeCache* open_for_use();
   static AOTCodeCache* open_for_dump();
 
+  uint* init_entries_index();
+
   bool set_write_position(uint pos);
   bool align_write();
   address reserve_bytes(uint nbytes);
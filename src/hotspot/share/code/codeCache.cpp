@@ -248,7 +248,22 @@ void CodeCache::initialize_heaps() {
     set_size_of_unset_code_heap(&non_nmethod, cache_size, profiled.size + non_profiled.size, non_nmethod_min_size);
   }
 
-  size_t total = non_nmethod.size + profiled.size + non_profiled.size;
+  // The hot code heap is carved from the non-profiled one because it only
+  // receives nmethods relocated from there (see HotCodeGrouper).
+  size_t hot_size = 0;
+  if (heap_available(CodeBlobType::MethodHot)) {
+    if (!NMethodRelocation) {
+      log_warning(codecache)("HotCodeHeapSize requires NMethodRelocation, hot code heap disabled");
+    } else if (non_profiled.size < align_up(HotCodeHeapSize, min_size) + min_size) {
+      log_warning(codecache)("HotCodeHeapSize (%zuK) does not fit in the non-profiled code heap (%zuK), "
+                             "hot code heap disabled", HotCodeHeapSize/K, non_profiled.size/K);
+    } else {
+      hot_size = align_up(HotCodeHeapSize, min_size);
+      non_profiled.size -= hot_size;
+    }
+  }
+
+  size_t total = non_nmethod.size + profiled.size + non_profiled.size + hot_size;
   if (total != cache_size && !cache_size_set) {
     log_info(codecache)("ReservedCodeCache size %zuK changed to total segments size NonNMethod "
                         "%zuK NonProfiled %zuK Profiled %zuK = %zuK",
@@ -258,8 +273,8 @@ void CodeCache::initialize_heaps() {
   }
 
   log_debug(codecache)("Initializing code heaps ReservedCodeCache %zuK NonNMethod %zuK"
-                       " NonProfiled %zuK Profiled %zuK",
-                       cache_size/K, non_nmethod.size/K, non_profiled.size/K, profiled.size/K);
+                       " NonProfiled %zuK Profiled %zuK Hot %zuK",
+                       cache_size/K, non_nmethod.size/K, non_profiled.size/K, profiled.size/K, hot_size/K);
 
   // Validation
   // Check minimal required sizes
@@ -283,6 +298,9 @@ void CodeCache::initialize_heaps() {
     if (non_profiled.enabled) {
       message.append(" + NonProfiledCodeHeapSize (%zuK)", non_profiled.size/K);
     }
+    if (hot_size > 0) {
+      message.append(" + HotCodeHeapSize (%zuK)", hot_size/K);
+    }
     message.append(" = %zuK", total/K);
     message.append((total > cache_size) ? " is greater than " : " is less than ");
     message.append("ReservedCodeCacheSize (%zuK).", cache_size/K);
@@ -305,11 +323,12 @@ void CodeCache::initialize_heaps() {
   non_nmethod.size = align_up(non_nmethod.size, min_size);
   profiled.size = align_up(profiled.size, min_size);
   non_profiled.size = align_up(non_profiled.size, min_size);
-  cache_size = non_nmethod.size + profiled.size + non_profiled.size;
+  cache_size = non_nmethod.size + profiled.size + non_profiled.size + hot_size;
 
   FLAG_SET_ERGO(NonNMethodCodeHeapSize, non_nmethod.size);
   FLAG_SET_ERGO(ProfiledCodeHeapSize, profiled.size);
   FLAG_SET_ERGO(NonProfiledCodeHeapSize, non_profiled.size);
+  FLAG_SET_ERGO(HotCodeHeapSize, hot_size);
   FLAG_SET_ERGO(ReservedCodeCacheSize, cache_size);
 
   ReservedSpace rs = reserve_heap_memory(cache_size, ps);
@@ -332,9 +351,18 @@ void CodeCache::initialize_heaps() {
 
   if (non_profiled.enabled) {
     ReservedSpace non_profiled_space  = rs.partition(offset, non_profiled.size);
+    offset += non_profiled.size;
     // Tier 1 and tier 4 (non-profiled) methods and native methods
     add_heap(non_profiled_space, "CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled);
   }
+
+  if (hot_size > 0) {
+    // Placed right after the non-profiled code heap, and like all other code
+    // heaps covered by large pages if those are in use (see above).
+    ReservedSpace hot_space = rs.partition(offset, hot_size);
+    // Frequently executed non-profiled methods, relocated by the HotCodeGrouper
+    add_heap(hot_space, "CodeHeap 'hot nmethods'", CodeBlobType::MethodHot);
+  }
 }
 
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
@@ -367,6 +395,9 @@ bool CodeCache::heap_available(CodeBlobType code_blob_type) {
   } else if (CompilerConfig::is_interpreter_only()) {
     // Interpreter only: we don't need any method code heaps
     return (code_blob_type == CodeBlobType::NonNMethod);
+  } else if (code_blob_type == CodeBlobType::MethodHot) {
+    // Optional, only receives nmethods relocated from the non-profiled code heap
+    return (HotCodeHeapSize > 0);
   } else if (CompilerConfig::is_c1_profiling()) {
     // Tiered compilation: use all code heaps
     return (code_blob_type < CodeBlobType::All);
@@ -388,6 +419,9 @@ const char* CodeCache::get_code_heap_flag_name(CodeBlobType code_blob_type) {
   case CodeBlobType::MethodProfiled:
     return "ProfiledCodeHeapSize";
     break;
+  case CodeBlobType::MethodHot:
+    return "HotCodeHeapSize";
+    break;
   default:
     ShouldNotReachHere();
     return nullptr;
@@ -543,7 +577,9 @@ CodeBlob* CodeCache::allocate(uint size, CodeBlobType code_blob_type, bool handl
           return allocate(size, type, handle_alloc_failure, orig_code_blob_type);
         }
       }
-      if (handle_alloc_failure) {
+      // The hot code heap is only filled by relocation, which simply
+      // fails if it is full.
+      if (handle_alloc_failure && orig_code_blob_type != CodeBlobType::MethodHot) {
         MutexUnlocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
         CompileBroker::handle_full_code_cache(orig_code_blob_type);
       }
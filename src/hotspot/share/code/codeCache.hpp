@@ -48,6 +48,10 @@
 //    executed at level 2 or 3
 //  - Non-Profiled nmethods: nmethods that are not profiled, i.e., those
 //    executed at level 1 or 4 and native methods
+//  - Hot nmethods: non-profiled nmethods that were found to be executed
+//    frequently and were relocated here to keep them close together. This
+//    heap is carved from the non-profiled one and only exists if
+//    HotCodeHeapSize is set (see HotCodeGrouper)
 //  - All: Used for code of all types if code cache segmentation is disabled.
 //
 // In the rare case of the non-nmethod code heap getting full, non-nmethod code
@@ -264,7 +268,7 @@ class CodeCache : AllStatic {
   }
 
   static bool code_blob_type_accepts_nmethod(CodeBlobType type) {
-    return type == CodeBlobType::All || type <= CodeBlobType::MethodProfiled;
+    return type == CodeBlobType::All || type == CodeBlobType::MethodHot || type <= CodeBlobType::MethodProfiled;
   }
 
   static bool code_blob_type_accepts_allocable(CodeBlobType type) {
@@ -155,6 +155,36 @@ void DependencyContext::release(nmethodBucket* b) {
   }
 }
 
+void DependencyContext::release(nmethodBucket* b, nmethodBucketBatch* released) {
+  if (released != nullptr) {
+    released->add(b);
+  } else {
+    release(b);
+  }
+}
+
+void DependencyContext::release(const nmethodBucketBatch& released) {
+  if (released._first == nullptr) {
+    return;
+  }
+
+  assert(!delete_on_release(), "only used when cleaning");
+  nmethodBucket* purge_list_head = AtomicAccess::load(&_purge_list);
+  for (;;) {
+    released._last->set_purge_list_next(purge_list_head);
+    nmethodBucket* next_purge_list_head = AtomicAccess::cmpxchg(&_purge_list, purge_list_head, released._first);
+    if (next_purge_list_head == purge_list_head) {
+      break;
+    }
+    purge_list_head = next_purge_list_head;
+  }
+
+  if (UsePerfData) {
+    _perf_total_buckets_stale_count->inc(released._count);
+    _perf_total_buckets_stale_acc_count->inc(released._count);
+  }
+}
+
 //
 // Reclaim all unused buckets.
 //
@@ -182,11 +212,13 @@ void DependencyContext::clean_unloading_dependents() {
   }
   // Walk the nmethodBuckets and move dead entries on the purge list, which will
   // be deleted during ClassLoaderDataGraph::purge().
-  nmethodBucket* b = dependencies_not_unloading();
+  nmethodBucketBatch released;
+  nmethodBucket* b = dependencies_not_unloading(&released);
   while (b != nullptr) {
-    nmethodBucket* next = b->next_not_unloading();
+    nmethodBucket* next = b->next_not_unloading(&released);
     b = next;
   }
+  release(released);
 }
 
 //
@@ -279,7 +311,7 @@ bool DependencyContext::delete_on_release() {
 // Retrieve the first nmethodBucket that has a dependent that does not correspond to
 // an is_unloading nmethod. Any nmethodBucket entries observed from the original head
 // that is_unloading() will be unlinked and placed on the purge list.
-nmethodBucket* DependencyContext::dependencies_not_unloading() {
+nmethodBucket* DependencyContext::dependencies_not_unloading(nmethodBucketBatch* released) {
   for (;;) {
     // Need acquire because the read value could come from a concurrent insert.
     nmethodBucket* head = AtomicAccess::load_acquire(_dependency_context_addr);
@@ -294,7 +326,7 @@ nmethodBucket* DependencyContext::dependencies_not_unloading() {
     }
     if (AtomicAccess::cmpxchg(_dependency_context_addr, head, head_next) == head) {
       // Release is_unloading entries if unlinking was claimed
-      DependencyContext::release(head);
+      DependencyContext::release(head, released);
     }
   }
 }
@@ -332,7 +364,7 @@ void DependencyContext::cleaning_end() {
 // dependents as-if they were already cleaned, despite being cleaned
 // concurrently. Any entry observed that is_unloading() will be unlinked
 // and placed on the purge list.
-nmethodBucket* nmethodBucket::next_not_unloading() {
+nmethodBucket* nmethodBucket::next_not_unloading(nmethodBucketBatch* released) {
   for (;;) {
     // Do not need acquire because the loaded entry can never be
     // concurrently inserted.
@@ -348,7 +380,7 @@ nmethodBucket* nmethodBucket::next_not_unloading() {
     }
     if (AtomicAccess::cmpxchg(&_next, next, next_next) == next) {
       // Release is_unloading entries if unlinking was claimed
-      DependencyContext::release(next);
+      DependencyContext::release(next, released);
     }
   }
 }
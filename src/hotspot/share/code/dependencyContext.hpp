@@ -32,6 +32,7 @@
 #include "runtime/safepoint.hpp"
 
 class nmethod;
+class nmethodBucketBatch;
 class DeoptimizationScope;
 class DepChange;
 
@@ -52,13 +53,38 @@ class nmethodBucket: public CHeapObj<mtClass> {
     _nmethod(nmethod), _next(next), _purge_list_next(nullptr) {}
 
   nmethodBucket* next();
-  nmethodBucket* next_not_unloading();
+  nmethodBucket* next_not_unloading(nmethodBucketBatch* released = nullptr);
   void set_next(nmethodBucket* b);
   nmethodBucket* purge_list_next();
   void set_purge_list_next(nmethodBucket* b);
   nmethod* get_nmethod()                     { return _nmethod; }
 };
 
+//
+// Buckets unlinked while cleaning one dependency context, chained through
+// their purge list links. The whole chain is put on the purge list at once,
+// instead of contending on the purge list head for every bucket.
+//
+class nmethodBucketBatch : public StackObj {
+  friend class DependencyContext;
+ private:
+  nmethodBucket* _first;
+  nmethodBucket* _last;
+  int            _count;
+
+ public:
+  nmethodBucketBatch() : _first(nullptr), _last(nullptr), _count(0) {}
+
+  void add(nmethodBucket* b) {
+    b->set_purge_list_next(_first);
+    if (_last == nullptr) {
+      _last = b;
+    }
+    _first = b;
+    _count++;
+  }
+};
+
 //
 // Utility class to manipulate nmethod dependency context.
 // Dependency context can be attached either to an InstanceKlass (_dep_context field)
@@ -76,7 +102,7 @@ class DependencyContext : public StackObj {
   static bool delete_on_release();
   void set_dependencies(nmethodBucket* b);
   nmethodBucket* dependencies();
-  nmethodBucket* dependencies_not_unloading();
+  nmethodBucket* dependencies_not_unloading(nmethodBucketBatch* released = nullptr);
 
   static PerfCounter*            _perf_total_buckets_allocated_count;
   static PerfCounter*            _perf_total_buckets_deallocated_count;
@@ -114,6 +140,8 @@ class DependencyContext : public StackObj {
   void clean_unloading_dependents();
   static void purge_dependency_contexts();
   static void release(nmethodBucket* b);
+  static void release(nmethodBucket* b, nmethodBucketBatch* released);
+  static void release(const nmethodBucketBatch& released);
   static void cleaning_start();
   static void cleaning_end();
 
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "code/codeCache.hpp"
+#include "code/compiledIC.hpp"
+#include "code/hotCodeGrouper.hpp"
+#include "code/nmethod.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomicAccess.hpp"
+#include "runtime/frame.inline.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/registerMap.hpp"
+#include "runtime/task.hpp"
+#include "utilities/align.hpp"
+#include "utilities/growableArray.hpp"
+
+volatile bool HotCodeGrouper::_sample_requested = false;
+uint HotCodeGrouper::_samples = 0;
+uint HotCodeGrouper::_total_relocated = 0;
+uint HotCodeGrouper::_total_evicted = 0;
+
+// Number of frames from the top of a stack that are sampled. Callers of the
+// executing method are included because returning into them executes their
+// code too.
+static const int sampled_frames = 4;
+
+// Upper bound of the nmethods relocated into the hot code heap in one round,
+// which bounds the time Compile_lock is held.
+static const int max_relocations_per_round = 128;
+
+class HotCodeSampleTask : public PeriodicTask {
+ public:
+  HotCodeSampleTask(size_t interval_time) : PeriodicTask(interval_time) {}
+  void task() { HotCodeGrouper::request_sample(); }
+};
+
+class HotCodeSampleClosure : public HandshakeClosure {
+ public:
+  HotCodeSampleClosure() : HandshakeClosure("HotCodeSample") {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    // Threads that are blocked or in native code are not running any
+    // compiled code, and would only skew the samples.
+    JavaThreadState state = jt->thread_state();
+    if (state == _thread_blocked || state == _thread_in_native || !jt->has_last_Java_frame()) {
+      return;
+    }
+    RegisterMap map(jt,
+                    RegisterMap::UpdateMap::skip,
+                    RegisterMap::ProcessFrames::skip,
+                    RegisterMap::WalkContinuation::skip);
+    frame fr = jt->last_frame();
+    for (int i = 0; i < sampled_frames && !fr.is_first_frame(); i++) {
+      CodeBlob* cb = fr.cb();
+      if (cb != nullptr && cb->is_nmethod()) {
+        cb->as_nmethod()->inc_hot_samples();
+      }
+      fr = fr.sender(&map);
+    }
+  }
+};
+
+void HotCodeGrouper::engage() {
+  if (!CodeCache::heap_available(CodeBlobType::MethodHot)) {
+    return;
+  }
+  size_t interval = align_down(HotCodeSampleInterval, (uint)PeriodicTask::interval_gran);
+  (new HotCodeSampleTask(interval))->enroll();
+}
+
+void HotCodeGrouper::request_sample() {
+  MonitorLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+  AtomicAccess::store(&_sample_requested, true);
+  ml.notify_all();
+}
+
+bool HotCodeGrouper::has_work() {
+  return AtomicAccess::load(&_sample_requested);
+}
+
+void HotCodeGrouper::do_work() {
+  AtomicAccess::store(&_sample_requested, false);
+  sample();
+  if (++_samples >= HotCodeGroupingSamples) {
+    _samples = 0;
+    group();
+  }
+}
+
+void HotCodeGrouper::sample() {
+  HotCodeSampleClosure cl;
+  Handshake::execute(&cl);
+}
+
+static int compare_hot_samples(nmethod** a, nmethod** b) {
+  uint sa = (*a)->hot_samples();
+  uint sb = (*b)->hot_samples();
+  return (sa > sb) ? -1 : ((sa < sb) ? 1 : 0);
+}
+
+void HotCodeGrouper::group() {
+  ResourceMark rm;
+  GrowableArray<nmethod*> hot;
+  GrowableArray<nmethod*> cold;
+  int relocated = 0;
+  int evicted = 0;
+
+  // Lock order and locks required by nmethod::relocate()
+  MutexLocker ml_Compile_lock(Compile_lock);
+  MutexLocker ml_CompiledIC_lock(CompiledIC_lock, Mutex::_no_safepoint_check_flag);
+  MutexLocker ml_CodeCache_lock(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+
+  NMethodIterator iter(NMethodIterator::not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    CodeBlobType type = CodeCache::get_code_blob_type(nm);
+    if (type == CodeBlobType::MethodHot) {
+      if (nm->hot_samples() == 0) {
+        cold.append(nm);
+      }
+    } else if (type == CodeBlobType::MethodNonProfiled) {
+      if (nm->hot_samples() >= HotCodeMinSamples) {
+        hot.append(nm);
+      }
+    }
+    nm->decay_hot_samples();
+  }
+
+  // Evict first to make room for the new hot nmethods
+  for (int i = 0; i < cold.length(); i++) {
+    nmethod* nm = cold.at(i);
+    if (nm->is_relocatable()) {
+      CompiledICLocker ic_locker(nm);
+      if (nm->relocate(CodeBlobType::MethodNonProfiled) != nullptr) {
+        evicted++;
+      }
+    }
+  }
+
+  hot.sort(compare_hot_samples);
+  for (int i = 0; i < hot.length() && relocated < max_relocations_per_round; i++) {
+    nmethod* nm = hot.at(i);
+    if ((size_t)nm->size() > CodeCache::unallocated_capacity(CodeBlobType::MethodHot)) {
+      continue;
+    }
+    if (nm->is_relocatable()) {
+      CompiledICLocker ic_locker(nm);
+      if (nm->relocate(CodeBlobType::MethodHot) != nullptr) {
+        relocated++;
+      }
+    }
+  }
+
+  _total_relocated += relocated;
+  _total_evicted += evicted;
+
+  size_t used = HotCodeHeapSize - CodeCache::unallocated_capacity(CodeBlobType::MethodHot);
+  log_debug(codecache)("Hot code heap: %d nmethods relocated in, %d evicted (total %u, %u), "
+                       "%d nmethods, %zuK of %zuK used (%.1f%%)",
+                       relocated, evicted, _total_relocated, _total_evicted,
+                       CodeCache::nmethod_count(CodeBlobType::MethodHot), used/K, HotCodeHeapSize/K,
+                       percent_of(used, HotCodeHeapSize));
+}
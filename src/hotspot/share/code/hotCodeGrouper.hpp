@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CODE_HOTCODEGROUPER_HPP
+#define SHARE_CODE_HOTCODEGROUPER_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+
+// The HotCodeGrouper keeps frequently executed nmethods together in the hot
+// code heap (CodeBlobType::MethodHot), so that the hot code of an application
+// is spread over as few pages, and thereby iTLB entries, as possible.
+//
+// Every HotCodeSampleInterval ms the service thread samples, in a handshake,
+// the top frames of all threads that are running code and counts the samples
+// in the nmethods found. Every HotCodeGroupingSamples samples, non-profiled
+// nmethods with at least HotCodeMinSamples samples are relocated into the hot
+// code heap, hottest first, and nmethods in the hot code heap that were not
+// sampled since the previous round are relocated back. The sample counts are
+// halved after each round so that they reflect recent execution.
+class HotCodeGrouper : AllStatic {
+  friend class HotCodeSampleTask;
+
+  static volatile bool _sample_requested;
+  static uint _samples;               // Samples taken since the last grouping round
+  static uint _total_relocated;       // nmethods relocated into the hot code heap
+  static uint _total_evicted;         // nmethods relocated out of the hot code heap
+
+  static void request_sample();
+  static void sample();
+  static void group();
+
+ public:
+  // Starts sampling if the hot code heap is available
+  static void engage();
+
+  // Called by the service thread
+  static bool has_work();
+  static void do_work();
+};
+
+#endif // SHARE_CODE_HOTCODEGROUPER_HPP
@@ -1233,6 +1233,7 @@ void nmethod::init_defaults(CodeBuffer *code_buffer, CodeOffsets* offsets) {
   _load_reported              = 0; // jvmti state
 
   _deoptimization_status      = not_marked;
+  _hot_samples                = 0;
 
   // SECT_CONSTS is first in code buffer so the offset should be 0.
   int consts_offset = code_buffer->total_offset_of(code_buffer->consts());
@@ -1467,6 +1468,7 @@ nmethod::nmethod(const nmethod &nm) : CodeBlob(nm._name, nm._kind, nm._size, nm.
   }
 
   _orig_pc_offset               = nm._orig_pc_offset;
+  _hot_samples                  = nm.hot_samples();
   _compile_id                   = nm._compile_id;
   _comp_level                   = nm._comp_level;
   _compiler_type                = nm._compiler_type;
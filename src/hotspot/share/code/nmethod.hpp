@@ -257,6 +257,10 @@ class nmethod : public CodeBlob {
   // pc during a deopt.
   int _orig_pc_offset;
 
+  // Number of times this nmethod was seen on a thread stack by the hot code
+  // sampler, halved after each grouping round (see HotCodeGrouper).
+  volatile uint _hot_samples;
+
   int          _compile_id;            // which compilation made this nmethod
   CompLevel    _comp_level;            // compilation level (s1)
   CompilerType _compiler_type;         // which compiler made this nmethod (u1)
@@ -904,6 +908,11 @@ class nmethod : public CodeBlob {
   void mark_as_maybe_on_stack();
   bool is_maybe_on_stack();
 
+  // Hot code heap support (see HotCodeGrouper)
+  uint hot_samples() const    { return AtomicAccess::load(&_hot_samples); }
+  void inc_hot_samples()      { AtomicAccess::inc(&_hot_samples); }
+  void decay_hot_samples()    { AtomicAccess::store(&_hot_samples, hot_samples() / 2); }
+
   // Evolution support. We make old (discarded) compiled methods point to new Method*s.
   void set_method(Method* method) { _method = method; }
 
@@ -169,6 +169,8 @@ class FootprintTimeline {
     int level;
     C<size_t, ssize_t> _bytes;
     C<unsigned, signed int> _live_nodes;
+    jlong _start_ticks;           // os::elapsed_counter() when the phase was last (re)started
+    jlong _ticks;                 // time spent in the phase
   };
   SimpleFifo<Entry, max_num_phases> _fifo;
   DEBUG_ONLY(bool _inbetween_phases;)
@@ -211,6 +213,9 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
   const bool _should_print_memstat;
   const bool _should_crash_on_memlimit;
 
+  // true if selected by CompilationMemStatSampleInterval rather than by directives
+  const bool _sampled;
+
   // Bytes total now
   size_t _current;
   // Bytes total at last global peak
@@ -245,7 +250,7 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
   int retrieve_live_node_count() const;
 
 public:
-  ArenaStatCounter(const CompileTask* task, size_t limit);
+  ArenaStatCounter(const CompileTask* task, size_t limit, bool sampled);
 
   void on_phase_start(PhaseInfo info);
   void on_phase_end();
@@ -267,6 +272,7 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
   const FullMethodName& fmn() const     { return _fmn; }
   bool should_print_memstat()           { return _should_print_memstat; };
   bool should_crash_on_memlimit() const { return _should_crash_on_memlimit; };
+  bool sampled() const                  { return _sampled; }
 
   CompilerType comp_type() const        { return _comp_type; }
   int comp_id() const                   { return _comp_id; }
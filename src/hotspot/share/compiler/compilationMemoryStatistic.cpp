@@ -40,6 +40,7 @@
 #include "runtime/atomicAccess.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/checkedCast.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -135,7 +136,7 @@ void FootprintTimeline::print_on(outputStream* st) const {
   const int start_indent = st->indentation();
   if (!_fifo.empty()) {
                // .123456789.123456789.123456789.123456789.123456789.123456789.123456789.123456789.123456789.123456789
-    st->print_cr("Phase seq. number                             Bytes                  Nodes");
+    st->print_cr("Phase seq. number                             Bytes                  Nodes      Time (ms)");
     unsigned from = 0;
     if (_fifo.lost() > 0) {
       st->print_cr("         (" UINT64_FORMAT " older entries lost)", _fifo.lost());
@@ -163,8 +164,10 @@ void FootprintTimeline::print_on(outputStream* st) const {
       col += 21; st->fill_to(col);
       os::snprintf_checked(tmp, sizeof(tmp), "%6u (%+d)", e._live_nodes.cur, e._live_nodes.end_delta());
       st->print("%s ", tmp); // end
+      col += 17; st->fill_to(col);
+      st->print("%10.3f", TimeHelper::counter_to_millis(e._ticks));
       if (e._bytes.temporary_peak_size() > significant_peak_threshold) {
-        col += 20; st->fill_to(col);
+        col += 13; st->fill_to(col);
         st->print(" significant temporary peak: %zu (%+zd)", e._bytes.peak, (ssize_t)e._bytes.peak - e._bytes.start); // peak
       }
       st->cr();
@@ -174,7 +177,8 @@ void FootprintTimeline::print_on(outputStream* st) const {
 }
 
 void FootprintTimeline::on_phase_end(size_t cur_abs, unsigned cur_nodes) {
-  const Entry& old = _fifo.current();
+  Entry& old = _fifo.current();
+  old._ticks += os::elapsed_counter() - old._start_ticks;
 
   // One last counter update in old phase:
   // We see all allocations, so cur_abs given should correspond to our topmost cur.
@@ -195,6 +199,7 @@ void FootprintTimeline::on_phase_start(PhaseInfo info, size_t cur_abs, unsigned
     // Two phases with the same id are collapsed if they were not interleaved by another phase
     _fifo.revert();
     // We now just continue bookkeeping into the last entry
+    _fifo.current()._start_ticks = os::elapsed_counter();
   } else {
     // seed current entry
     Entry& e = _fifo.current();
@@ -202,6 +207,8 @@ void FootprintTimeline::on_phase_start(PhaseInfo info, size_t cur_abs, unsigned
     e._live_nodes.init(cur_nodes);
     e.info = info;
     e.level = level;
+    e._start_ticks = os::elapsed_counter();
+    e._ticks = 0;
   }
   DEBUG_ONLY(_inbetween_phases = false;)
 }
@@ -253,10 +260,11 @@ bool FullMethodName::is_test_class() const {
 }
 #endif // ASSERT
 
-ArenaStatCounter::ArenaStatCounter(const CompileTask* task, size_t limit) :
+ArenaStatCounter::ArenaStatCounter(const CompileTask* task, size_t limit, bool sampled) :
     _fmn(task->method()),
     _should_print_memstat(task->directive()->should_print_memstat()),
     _should_crash_on_memlimit(task->directive()->should_crash_at_mem_limit()),
+    _sampled(sampled),
     _current(0), _peak(0), _live_nodes_current(0), _live_nodes_at_global_peak(0),
     _limit(limit), _hit_limit(false), _limit_in_process(false),
     _phase_counter(0), _comp_type(task->compiler()->type()), _comp_id(task->compile_id())
@@ -430,6 +438,8 @@ class MemStatEntry : public CHeapObj<mtCompiler> {
   bool _hit_limit;
   // result as reported by compiler
   const char* _result;
+  // true if picked by CompilationMemStatSampleInterval
+  bool _sampled;
 
   // Bytes total at global peak
   size_t _peak;
@@ -452,7 +462,7 @@ class MemStatEntry : public CHeapObj<mtCompiler> {
   MemStatEntry()
     : _comp_type(compiler_none), _comp_id(-1),
       _time(0), _thread(nullptr), _limit(0), _hit_limit(false),
-      _result(nullptr), _peak(0), _live_nodes_at_global_peak(0),
+      _result(nullptr), _sampled(false), _peak(0), _live_nodes_at_global_peak(0),
       _detail_stats(nullptr) {
   }
 
@@ -472,6 +482,7 @@ class MemStatEntry : public CHeapObj<mtCompiler> {
     _comp_id = state->comp_id();
     _limit = state->limit();
     _hit_limit = state->hit_limit();
+    _sampled = state->sampled();
     _peak = state->peak();
     _live_nodes_at_global_peak = state->live_nodes_at_global_peak();
     state->counters_at_global_peak().summarize(_peak_composition_per_arena_tag);
@@ -497,6 +508,7 @@ class MemStatEntry : public CHeapObj<mtCompiler> {
     _comp_type = CompilerType::compiler_none;
     _comp_id = -1;
     _limit = _peak = 0;
+    _sampled = false;
     _live_nodes_at_global_peak = 0;
     memset(_peak_composition_per_arena_tag, 0, sizeof(_peak_composition_per_arena_tag));
   }
@@ -620,6 +632,7 @@ class MemStatEntry : public CHeapObj<mtCompiler> {
     st->cr();
     st->print_cr("Thread              : " PTR_FORMAT, p2i(_thread));
     st->print_cr("Timestamp           : %.3f", _time);
+    st->print_cr("Selected by         : %s", _sampled ? "sampling" : "compile command");
 
     if (_detail_stats != nullptr) {
       st->cr();
@@ -749,6 +762,7 @@ class MemStatStore : public CHeapObj<mtCompiler> {
 };
 
 bool CompilationMemoryStatistic::_enabled = false;
+volatile uint CompilationMemoryStatistic::_sample_counter = 0;
 static MemStatStore* _the_store = nullptr;
 
 void CompilationMemoryStatistic::initialize() {
@@ -756,17 +770,30 @@ void CompilationMemoryStatistic::initialize() {
   _the_store = new MemStatStore;
   _enabled = true;
   log_info(compilation, alloc)("Compilation memory statistic enabled");
+  if (CompilationMemStatSampleInterval > 0) {
+    log_info(compilation, alloc)("Sampling every %u compilation(s)", CompilationMemStatSampleInterval);
+  }
+}
+
+bool CompilationMemoryStatistic::should_sample() {
+  // Compilations that are not picked pay one atomic increment. The store only
+  // keeps the most expensive compilations, so its footprint stays bounded.
+  const uint interval = CompilationMemStatSampleInterval;
+  if (interval == 0 || !enabled()) {
+    return false;
+  }
+  return (AtomicAccess::add(&_sample_counter, 1u) % interval) == 0;
 }
 
-void CompilationMemoryStatistic::on_start_compilation(const DirectiveSet* directive) {
+void CompilationMemoryStatistic::on_start_compilation(const DirectiveSet* directive, bool sampled) {
   assert(enabled(), "Not enabled?");
-  assert(directive->should_collect_memstat(), "Don't call if not needed");
+  assert(sampled || directive->should_collect_memstat(), "Don't call if not needed");
   CompilerThread* const th = Thread::current()->as_Compiler_thread();
   CompileTask* const task = th->task();
   const size_t limit = directive->mem_limit();
   // Create new ArenaStat object and hook it into the thread
   assert(th->arena_stat() == nullptr, "Sanity");
-  ArenaStatCounter* const arena_stat = new ArenaStatCounter(task, limit);
+  ArenaStatCounter* const arena_stat = new ArenaStatCounter(task, limit, sampled);
   th->set_arenastat(arena_stat);
   // Start a "root" phase
   PhaseInfo info;
@@ -797,7 +824,8 @@ void CompilationMemoryStatistic::on_end_compilation() {
   const Method* const m = th->task()->method();
 
   const DirectiveSet* directive = th->task()->directive();
-  assert(directive->should_collect_memstat(), "Should only be called if memstat is enabled for this method");
+  assert(arena_stat->sampled() || directive->should_collect_memstat(),
+         "Should only be called if memstat is enabled for this method");
   const bool print = directive->should_print_memstat();
 
   // Store memory used in task, for later processing by JFR
@@ -1030,6 +1058,10 @@ void CompilationMemoryStatistic::print_jcmd_report(outputStream* st, bool verbos
     return;
   }
   st->print_cr("Compiler Memory Statistic");
+  if (CompilationMemStatSampleInterval > 0) {
+    st->print_cr("(sampling every %u compilation(s), %u compilation(s) seen)",
+                 CompilationMemStatSampleInterval, AtomicAccess::load(&_sample_counter));
+  }
   StreamIndentor si(st, 4);
   print_all_by_size(st, verbose, legend, minsize, -1);
 }
@@ -1086,9 +1118,10 @@ void CompilationMemoryStatistic::do_test_allocations() {
 #endif // ASSERT
 
 CompilationMemoryStatisticMark::CompilationMemoryStatisticMark(const DirectiveSet* directive)
-  : _active(directive->should_collect_memstat()) {
+  : _sampled(!directive->should_collect_memstat() && CompilationMemoryStatistic::should_sample()),
+    _active(_sampled || directive->should_collect_memstat()) {
   if (_active) {
-    CompilationMemoryStatistic::on_start_compilation(directive);
+    CompilationMemoryStatistic::on_start_compilation(directive, _sampled);
   }
 }
 
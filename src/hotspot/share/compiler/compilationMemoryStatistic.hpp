@@ -36,9 +36,14 @@ class outputStream;
 class CompilationMemoryStatistic : public AllStatic {
   friend class CompilationMemoryStatisticMark;
   static bool _enabled; // set to true if memstat is active for any method.
+  static volatile uint _sample_counter; // compilations seen by should_sample()
+
+  // Private, should only be called via CompilationMemoryStatisticMark.
+  // True if the starting compilation is picked by CompilationMemStatSampleInterval.
+  static bool should_sample();
 
   // Private, should only be called via CompilationMemoryStatisticMark
-  static void on_start_compilation(const DirectiveSet* directive);
+  static void on_start_compilation(const DirectiveSet* directive, bool sampled);
 
   // Private, should only be called via CompilationMemoryStatisticMark
   static void on_end_compilation();
@@ -47,7 +52,8 @@ class CompilationMemoryStatistic : public AllStatic {
 
 public:
   static void initialize();
-  // true if CollectMemStat or PrintMemStat has been enabled for any method
+  // true if CollectMemStat or PrintMemStat has been enabled for any method,
+  // or if compilations are sampled (CompilationMemStatSampleInterval)
   static bool enabled() { return _enabled; }
   // true if we are in a fatal error inited by hitting the MemLimit
   static bool in_oom_crash();
@@ -69,6 +75,7 @@ class CompilationMemoryStatistic : public AllStatic {
 
 // RAII object to wrap one compilation
 class CompilationMemoryStatisticMark : public StackObj {
+  const bool _sampled;
   const bool _active;
 public:
   CompilationMemoryStatisticMark(const DirectiveSet* directive);
@@ -42,6 +42,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -755,69 +756,97 @@ void CompilationPolicy::handle_counter_overflow(const methodHandle& method) {
   }
 }
 
+// If a method was unloaded or has been stale for some time, remove it from the queue.
+// Blocking tasks and tasks submitted from whitebox API don't become stale.
+bool CompilationPolicy::remove_if_stale(CompileQueue* compile_queue, CompileTask* task, int64_t t, JavaThread* THREAD) {
+  if (task->is_unloaded()) {
+    compile_queue->remove_and_mark_stale(task);
+    return true;
+  }
+  Method* method = task->method();
+  methodHandle mh(THREAD, method);
+  if (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, mh) && !is_old(mh)) {
+    if (PrintTieredEvents) {
+      print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+    }
+    method->clear_queued_for_compilation();
+    compile_queue->remove_and_mark_stale(task);
+    return true;
+  }
+  return false;
+}
+
+// Set the priority of a queued task from the current rate of its method, and rank it.
+void CompilationPolicy::rank_task(CompileQueue* compile_queue, CompileTask* task, int64_t t, JavaThread* THREAD) {
+  Method* method = task->method();
+  if (task->is_blocking() && task->compile_reason() == CompileTask::Reason_Whitebox) {
+    // CTW tasks, submitted as blocking Whitebox requests, do not participate in rate
+    // selection and/or any level adjustments. Just return them in order.
+    task->set_rank(2, 0, 0.0);
+  } else {
+    methodHandle mh(THREAD, method);
+    update_rate(t, mh);
+    double w = weight(method);
+    if (TieredCompileTaskAgingPeriod > 0) {
+      // The weight doubles every aging period, so that a steady stream of hot
+      // methods cannot starve the colder ones forever.
+      double queued_ms = TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued());
+      w *= pow(2.0, MIN2(queued_ms / TieredCompileTaskAgingPeriod, 64.0));
+    }
+    // In blocking compilation mode, the CompileBroker will make
+    // compilations submitted by a JVMCI compiler thread non-blocking. These
+    // compilations should be scheduled after all blocking compilations
+    // to service non-compiler related compilations sooner and reduce the
+    // chance of such compilations timing out.
+    task->set_rank(task->is_blocking() ? 1 : 0, method->highest_comp_level(), w);
+  }
+  compile_queue->rank(task);
+}
+
 // Called with the queue locked and with at least one element
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThread* THREAD) {
-  CompileTask *max_blocking_task = nullptr;
-  CompileTask *max_task = nullptr;
-  Method* max_method = nullptr;
-
   int64_t t = nanos_to_millis(os::javaTimeNanos());
-  // Iterate through the queue and find a method with a maximum rate.
-  for (CompileTask* task = compile_queue->first(); task != nullptr;) {
-    CompileTask* next_task = task->next();
-    // If a method was unloaded or has been stale for some time, remove it from the queue.
-    // Blocking tasks and tasks submitted from whitebox API don't become stale
-    if (task->is_unloaded()) {
-      compile_queue->remove_and_mark_stale(task);
-      task = next_task;
-      continue;
-    }
-    if (task->is_blocking() && task->compile_reason() == CompileTask::Reason_Whitebox) {
-      // CTW tasks, submitted as blocking Whitebox requests, do not participate in rate
-      // selection and/or any level adjustments. Just return them in order.
-      return task;
-    }
-    Method* method = task->method();
-    methodHandle mh(THREAD, method);
-    if (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, mh) && !is_old(mh)) {
-      if (PrintTieredEvents) {
-        print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+  if (compile_queue->first_ranked() == nullptr ||
+      t - compile_queue->ranking_time_ms() >= TieredCompileQueueRankingInterval) {
+    // Update the rates of all queued methods and rank them again.
+    compile_queue->clear_ranking(t);
+    for (CompileTask* task = compile_queue->first(); task != nullptr;) {
+      CompileTask* next_task = task->next();
+      if (!remove_if_stale(compile_queue, task, t, THREAD)) {
+        rank_task(compile_queue, task, t, THREAD);
       }
-      method->clear_queued_for_compilation();
-      compile_queue->remove_and_mark_stale(task);
       task = next_task;
-      continue;
     }
-    update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
-      // Select a method with the highest rate
-      max_task = task;
-      max_method = method;
-    }
-
-    if (task->is_blocking()) {
-      if (max_blocking_task == nullptr || compare_methods(method, max_blocking_task->method())) {
-        max_blocking_task = task;
+  } else {
+    // Tasks are appended to the queue, so the ones added since
+    // it was last ranked are found at its end.
+    for (CompileTask* task = compile_queue->last(); task != nullptr && !task->is_ranked();) {
+      CompileTask* prev_task = task->prev();
+      if (!remove_if_stale(compile_queue, task, t, THREAD)) {
+        rank_task(compile_queue, task, t, THREAD);
       }
+      task = prev_task;
     }
-
-    task = next_task;
   }
 
-  if (max_blocking_task != nullptr) {
-    // In blocking compilation mode, the CompileBroker will make
-    // compilations submitted by a JVMCI compiler thread non-blocking. These
-    // compilations should be scheduled after all blocking compilations
-    // to service non-compiler related compilations sooner and reduce the
-    // chance of such compilations timing out.
-    max_task = max_blocking_task;
-    max_method = max_task->method();
+  // Priorities are only updated when the queue is ranked again, but make
+  // sure the selected task is still worth compiling.
+  CompileTask* max_task = compile_queue->first_ranked();
+  while (max_task != nullptr && remove_if_stale(compile_queue, max_task, t, THREAD)) {
+    max_task = compile_queue->first_ranked();
+  }
+  if (max_task == nullptr) {
+    return nullptr;
+  }
+  if (max_task->is_blocking() && max_task->compile_reason() == CompileTask::Reason_Whitebox) {
+    return max_task;
   }
+  Method* max_method = max_task->method();
 
   methodHandle max_method_h(THREAD, max_method);
 
-  if (max_task != nullptr && max_task->comp_level() == CompLevel_full_profile && TieredStopAtLevel > CompLevel_full_profile &&
-      max_method != nullptr && is_method_profiled(max_method_h) && !Arguments::is_compiler_only()) {
+  if (max_task->comp_level() == CompLevel_full_profile && TieredStopAtLevel > CompLevel_full_profile &&
+      is_method_profiled(max_method_h) && !Arguments::is_compiler_only()) {
     max_task->set_comp_level(CompLevel_limited_profile);
 
     if (CompileBroker::compilation_is_complete(max_method_h, max_task->osr_bci(), CompLevel_limited_profile)) {
@@ -300,6 +300,10 @@ class CompilationPolicy : AllStatic {
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(int64_t t, const methodHandle& method);
+  // Remove a queued task of an unloaded or stale method (see select_task()).
+  static bool remove_if_stale(CompileQueue* compile_queue, CompileTask* task, int64_t t, JavaThread* THREAD);
+  // Compute the priority of a queued task and insert it in the queue ranking.
+  static void rank_task(CompileQueue* compile_queue, CompileTask* task, int64_t t, JavaThread* THREAD);
   // Compute threshold scaling coefficient
   inline static double threshold_scale(CompLevel level, int feedback_k);
   // If a method is old enough and is still in the interpreter we would want to
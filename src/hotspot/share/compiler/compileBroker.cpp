@@ -389,6 +389,7 @@ void CompileQueue::delete_all() {
   }
   _first = nullptr;
   _last = nullptr;
+  clear_ranking(0);
 
   // Wake up all blocking task waiters to deal with remaining blocking
   // tasks. This is not a performance sensitive path, so we do this
@@ -465,6 +466,8 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_method = methodHandle(thread, task->method());
 
     remove(task);
+    _total_selected++;
+    _total_queue_time += os::elapsed_counter() - task->time_queued();
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
@@ -496,6 +499,9 @@ void CompileQueue::purge_stale_tasks() {
 
 void CompileQueue::remove(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  if (task->is_ranked()) {
+    unrank(task);
+  }
   if (task->prev() != nullptr) {
     task->prev()->set_next(task->next());
   } else {
@@ -527,6 +533,83 @@ void CompileQueue::remove_and_mark_stale(CompileTask* task) {
   _first_stale = task;
 }
 
+void CompileQueue::set_ranked(int index, CompileTask* task) {
+  _ranking.at_put(index, task);
+  task->set_rank_index(index);
+}
+
+void CompileQueue::sift_up(int index) {
+  CompileTask* task = _ranking.at(index);
+  while (index > 0) {
+    int parent = (index - 1) / 4;
+    CompileTask* parent_task = _ranking.at(parent);
+    if (!task->ranks_before(parent_task)) {
+      break;
+    }
+    set_ranked(index, parent_task);
+    index = parent;
+  }
+  set_ranked(index, task);
+}
+
+void CompileQueue::sift_down(int index) {
+  CompileTask* task = _ranking.at(index);
+  const int length = _ranking.length();
+  while (true) {
+    int first_child = 4 * index + 1;
+    if (first_child >= length) {
+      break;
+    }
+    int best = first_child;
+    int end = MIN2(first_child + 4, length);
+    for (int child = first_child + 1; child < end; child++) {
+      if (_ranking.at(child)->ranks_before(_ranking.at(best))) {
+        best = child;
+      }
+    }
+    CompileTask* best_task = _ranking.at(best);
+    if (!best_task->ranks_before(task)) {
+      break;
+    }
+    set_ranked(index, best_task);
+    index = best;
+  }
+  set_ranked(index, task);
+}
+
+// Insert a queued task, whose priority has been set, into the ranking.
+void CompileQueue::rank(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  assert(!task->is_ranked(), "already ranked");
+  _ranking.append(task);
+  sift_up(_ranking.length() - 1);
+}
+
+void CompileQueue::unrank(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  int index = task->rank_index();
+  assert(_ranking.at(index) == task, "not ranked here");
+  CompileTask* last = _ranking.pop();
+  task->set_rank_index(-1);
+  if (last != task) {
+    set_ranked(index, last);
+    if (index > 0 && last->ranks_before(_ranking.at((index - 1) / 4))) {
+      sift_up(index);
+    } else {
+      sift_down(index);
+    }
+  }
+}
+
+// Drop the ranking before all queued tasks are ranked again at 'time_ms'.
+void CompileQueue::clear_ranking(int64_t time_ms) {
+  for (int i = 0; i < _ranking.length(); i++) {
+    _ranking.at(i)->set_rank_index(-1);
+  }
+  _ranking.clear();
+  _ranking_time_ms = time_ms;
+}
+
 // methods in the compile queue need to be marked as used on the stack
 // so that they don't get reclaimed by Redefine Classes
 void CompileQueue::mark_on_stack() {
@@ -687,7 +770,7 @@ void CompileBroker::compilation_init(JavaThread* THREAD) {
    }
 #endif // INCLUDE_JVMCI
 
-  if (CompilerOracle::should_collect_memstat()) {
+  if (CompilerOracle::should_collect_memstat() || CompilationMemStatSampleInterval > 0) {
     CompilationMemoryStatistic::initialize();
   }
 
@@ -32,6 +32,7 @@
 #include "compiler/compileTask.hpp"
 #include "runtime/atomicAccess.hpp"
 #include "runtime/perfDataTypes.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmciCompiler.hpp"
@@ -107,18 +108,32 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int _peak_size;
   uint _total_added;
   uint _total_removed;
+  uint _total_selected;
+  jlong _total_queue_time;
+
+  // Queued tasks ordered by CompileTask::ranks_before() in a 4-ary heap,
+  // so that the next task need not be searched for in the whole queue.
+  GrowableArrayCHeap<CompileTask*, mtCompiler> _ranking;
+  int64_t _ranking_time_ms;
 
   void purge_stale_tasks();
+
+  void set_ranked(int index, CompileTask* task);
+  void sift_up(int index);
+  void sift_down(int index);
  public:
-  CompileQueue(const char* name) {
+  CompileQueue(const char* name) : _ranking(0) {
     _name = name;
     _first = nullptr;
     _last = nullptr;
     _size = 0;
     _total_added = 0;
     _total_removed = 0;
+    _total_selected = 0;
+    _total_queue_time = 0;
     _peak_size = 0;
     _first_stale = nullptr;
+    _ranking_time_ms = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -137,6 +152,19 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
+  // Tasks handed out to compiler threads, and the time they spent queued,
+  // in os::elapsed_counter() ticks.
+  uint        get_total_selected() const         { return _total_selected; }
+  jlong       get_total_queue_time() const       { return _total_queue_time; }
+
+  // Priority ranking of the queued tasks, maintained by CompilationPolicy.
+  // Tasks are ranked with their current priority, which is only updated
+  // when the whole queue is ranked again.
+  void         rank(CompileTask* task);
+  void         unrank(CompileTask* task);
+  void         clear_ranking(int64_t time_ms);
+  CompileTask* first_ranked() const              { return _ranking.is_empty() ? nullptr : _ranking.first(); }
+  int64_t      ranking_time_ms() const           { return _ranking_time_ms; }
 
   // Redefine Classes support
   void mark_on_stack();
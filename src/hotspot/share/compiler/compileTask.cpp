@@ -75,6 +75,10 @@ CompileTask::CompileTask(int compile_id,
 
   _next = nullptr;
   _prev = nullptr;
+  _rank_index = -1;
+  _rank_class = 0;
+  _rank_level = 0;
+  _rank_weight = 0.0;
 
   AtomicAccess::add(&_active_tasks, 1, memory_order_relaxed);
 }
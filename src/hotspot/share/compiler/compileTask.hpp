@@ -103,6 +103,11 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int                  _num_inlined_bytecodes;
   CompileTask*         _next;
   CompileTask*         _prev;
+  // Position and priority in the ranking of the queue, see CompileQueue::rank()
+  int                  _rank_index;
+  int                  _rank_class;
+  int                  _rank_level;
+  double               _rank_weight;
   // Fields used for logging why the compilation was initiated:
   jlong                _time_queued;  // time when task was enqueued
   jlong                _time_started; // time when compilation started
@@ -171,6 +176,31 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int          comp_level()                      { return _comp_level;}
   void         set_comp_level(int comp_level)    { _comp_level = comp_level;}
 
+  jlong        time_queued() const               { return _time_queued; }
+
+  bool         is_ranked() const                 { return _rank_index >= 0; }
+  int          rank_index() const                { return _rank_index; }
+  void         set_rank_index(int index)         { _rank_index = index; }
+  int          rank_class() const                { return _rank_class; }
+  void         set_rank(int rank_class, int level, double weight) {
+    _rank_class = rank_class;
+    _rank_level = level;
+    _rank_weight = weight;
+  }
+  // Should this task be compiled before 'other'? Ties go to the older task.
+  bool         ranks_before(const CompileTask* other) const {
+    if (_rank_class != other->_rank_class) {
+      return _rank_class > other->_rank_class;
+    }
+    if (_rank_level != other->_rank_level) {
+      return _rank_level > other->_rank_level;
+    }
+    if (_rank_weight != other->_rank_weight) {
+      return _rank_weight > other->_rank_weight;
+    }
+    return _compile_id < other->_compile_id;
+  }
+
   CompileReason compile_reason()                 { return _compile_reason; }
 
   AbstractCompiler* compiler() const;
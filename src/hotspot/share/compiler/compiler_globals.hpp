@@ -263,6 +263,17 @@
           "cache is filled by the specified percentage")                    \
           range(0, 99)                                                      \
                                                                             \
+  product(intx, TieredCompileQueueRankingInterval, 10, DIAGNOSTIC,          \
+          "Minimum interval in milliseconds between updates of the "        \
+          "priorities of all tasks in a compile queue. 0 updates them "     \
+          "on every selection")                                             \
+          range(0, max_intx)                                                \
+                                                                            \
+  product(intx, TieredCompileTaskAgingPeriod, 1000, DIAGNOSTIC,             \
+          "The priority of a compile task doubles every given number of "   \
+          "milliseconds it waits in the queue. 0 disables aging")           \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredRateUpdateMinTime, 1,                                 \
           "Minimum rate sampling interval (in milliseconds)")               \
           range(1, max_intx)                                                \
@@ -310,6 +321,13 @@
   product(ccstrlist, CompileCommand, "",                                    \
           "Prepend to .hotspot_compiler; e.g. log,java/lang/String.<init>") \
                                                                             \
+  product(uint, CompilationMemStatSampleInterval, 0,                        \
+          "Collect arena memory statistics for every Nth compilation, "     \
+          "in addition to the methods selected by the MemStat and "         \
+          "MemLimit compile commands. Results are reported by jcmd "        \
+          "Compiler.memory. 0 disables sampling")                           \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, ReplayCompiles, false, DIAGNOSTIC,                          \
           "Enable replay of compilations from ReplayDataFile")              \
                                                                             \
@@ -63,6 +63,10 @@ jint EpsilonHeap::initialize() {
   // Enable monitoring
   _monitoring_support = new EpsilonMonitoringSupport(this);
 
+  if (EpsilonClearReferences) {
+    _reference_clearing = new EpsilonReferenceClearing(_reserved);
+  }
+
   // Install barrier set
   BarrierSet::set_barrier_set(new EpsilonBarrierSet());
 
@@ -284,6 +288,14 @@ void EpsilonHeap::collect(GCCause::Cause cause) {
       MetaspaceGC::compute_new_size();
       print_metaspace_info();
       break;
+    case GCCause::_java_lang_system_gc:
+    case GCCause::_dcmd_gc_run:
+    case GCCause::_wb_full_gc:
+      if (_reference_clearing != nullptr) {
+        _reference_clearing->collect(cause);
+        break;
+      }
+      // Fall through
     default:
       log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
   }
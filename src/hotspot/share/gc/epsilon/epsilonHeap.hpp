@@ -28,6 +28,7 @@
 
 #include "gc/epsilon/epsilonBarrierSet.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
+#include "gc/epsilon/epsilonReferenceClearing.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/space.hpp"
 #include "memory/virtualspace.hpp"
@@ -38,6 +39,7 @@ class EpsilonHeap : public CollectedHeap {
   friend class VMStructs;
 private:
   EpsilonMonitoringSupport* _monitoring_support;
+  EpsilonReferenceClearing* _reference_clearing;
   MemoryPool* _pool;
   GCMemoryManager _memory_manager;
   ContiguousSpace* _space;
@@ -56,6 +58,7 @@ class EpsilonHeap : public CollectedHeap {
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
+          _reference_clearing(nullptr),
           _memory_manager("Epsilon Heap"),
           _space(nullptr) {};
 
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "classfile/classLoaderData.inline.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "code/codeCache.hpp"
+#include "gc/epsilon/epsilonHeap.hpp"
+#include "gc/epsilon/epsilonReferenceClearing.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.inline.hpp"
+#include "memory/memoryReserver.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/threads.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/align.hpp"
+#include "utilities/stack.inline.hpp"
+#include "utilities/ticks.hpp"
+
+class EpsilonMarkClosure : public BasicOopIterateClosure {
+private:
+  MarkBitMap* const       _bitmap;
+  Stack<oop, mtGC>* const _stack;
+
+  template <typename T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (!_bitmap->is_marked(obj)) {
+        _bitmap->mark(obj);
+        _stack->push(obj);
+      }
+    }
+  }
+
+public:
+  EpsilonMarkClosure(MarkBitMap* bitmap, Stack<oop, mtGC>* stack, ReferenceDiscoverer* rd) :
+      BasicOopIterateClosure(rd),
+      _bitmap(bitmap),
+      _stack(stack) {}
+
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class VM_EpsilonClearReferences : public VM_Operation {
+private:
+  EpsilonReferenceClearing* const _clearing;
+
+public:
+  VM_EpsilonClearReferences(EpsilonReferenceClearing* clearing) :
+      _clearing(clearing) {}
+
+  virtual VMOp_Type type() const {
+    return VMOp_EpsilonClearReferences;
+  }
+
+  virtual bool is_gc_operation() const {
+    return true;
+  }
+
+  virtual void doit() {
+    _clearing->work();
+  }
+};
+
+EpsilonReferenceClearing::EpsilonReferenceClearing(MemRegion heap) :
+    _bitmap(),
+    _bitmap_region(),
+    _bitmap_committed(0),
+    _discovered() {
+  // Reserve the bitmap for the whole heap, it is committed as the heap grows
+  const size_t bitmap_size = MarkBitMap::compute_size(heap.byte_size());
+  const ReservedSpace bitmap = MemoryReserver::reserve(bitmap_size, mtGC);
+  if (!bitmap.is_reserved()) {
+    vm_exit_during_initialization("Could not reserve enough space for mark bitmap");
+  }
+  _bitmap_region = MemRegion((HeapWord*)bitmap.base(), bitmap.size() / HeapWordSize);
+  _bitmap.initialize(heap, _bitmap_region);
+}
+
+void EpsilonReferenceClearing::commit_bitmap() {
+  const size_t needed = MIN2(MarkBitMap::compute_size(EpsilonHeap::heap()->capacity()),
+                             _bitmap_region.byte_size());
+  if (needed > _bitmap_committed) {
+    os::commit_memory_or_exit((char*)_bitmap_region.start() + _bitmap_committed,
+                              needed - _bitmap_committed, false,
+                              "Cannot commit mark bitmap memory");
+    _bitmap_committed = needed;
+  }
+}
+
+bool EpsilonReferenceClearing::discover_reference(oop reference, ReferenceType type) {
+  if (type != REF_WEAK) {
+    // Only WeakReferences are cleared
+    return false;
+  }
+
+  if (has_reference_queue(reference)) {
+    // Clearing would require enqueuing
+    return false;
+  }
+
+  // Marking is single-threaded and visits each reference once
+  _discovered.append(reference);
+  return true;
+}
+
+size_t EpsilonReferenceClearing::mark() {
+  Stack<oop, mtGC> stack;
+  EpsilonMarkClosure cl(&_bitmap, &stack, this);
+
+  // Nothing is ever unloaded, so all class loaders and nmethods are strong roots
+  CLDToOopClosure cld_cl(&cl, ClassLoaderData::_claim_none);
+  NMethodToOopClosure nm_cl(&cl, !NMethodToOopClosure::FixRelocations);
+  CodeCache::nmethods_do(&nm_cl);
+  ClassLoaderDataGraph::cld_do(&cld_cl);
+  Threads::oops_do(&cl, nullptr);
+  OopStorageSet::strong_oops_do(&cl);
+
+  size_t marked = 0;
+  while (!stack.is_empty()) {
+    oop obj = stack.pop();
+    obj->oop_iterate(&cl);
+    marked++;
+  }
+  return marked;
+}
+
+size_t EpsilonReferenceClearing::clear_referents() {
+  size_t cleared = 0;
+  for (int i = 0; i < _discovered.length(); i++) {
+    const oop reference = _discovered.at(i);
+    const oop referent = java_lang_ref_Reference::unknown_referent_no_keepalive(reference);
+    if (referent != nullptr && !_bitmap.is_marked(referent)) {
+      java_lang_ref_Reference::clear_referent_raw(reference);
+      cleared++;
+    }
+  }
+  return cleared;
+}
+
+void EpsilonReferenceClearing::work() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at safepoint");
+
+  EpsilonHeap* const heap = EpsilonHeap::heap();
+  const MemRegion used(heap->reserved_region().start(), heap->used() / HeapWordSize);
+
+  commit_bitmap();
+  _bitmap.clear_range_large(used);
+  _discovered.clear();
+
+  const Ticks start = Ticks::now();
+  const size_t marked = mark();
+  const Ticks marked_at = Ticks::now();
+  const size_t cleared = clear_referents();
+  const Ticks end = Ticks::now();
+
+  log_info(gc)("Reference clearing: marked %zu objects in %.3fms, "
+               "cleared %zu of %d discovered referents in %.3fms",
+               marked, (marked_at - start).seconds() * MILLIUNITS,
+               cleared, _discovered.length(), (end - marked_at).seconds() * MILLIUNITS);
+}
+
+void EpsilonReferenceClearing::collect(GCCause::Cause cause) {
+  assert(!SafepointSynchronize::is_at_safepoint(), "Must not be at safepoint");
+
+  // Resolved outside the safepoint, it may need to initialize ReferenceQueue
+  initialize_null_queue_handle();
+
+  log_info(gc)("GC request for \"%s\" is handled", GCCause::to_string(cause));
+  VM_EpsilonClearReferences op(this);
+  VMThread::execute(&op);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_EPSILON_EPSILONREFERENCECLEARING_HPP
+#define SHARE_GC_EPSILON_EPSILONREFERENCECLEARING_HPP
+
+#include "gc/shared/gcCause.hpp"
+#include "gc/shared/markBitMap.hpp"
+#include "gc/shared/referenceDiscoverer.hpp"
+#include "memory/allocation.hpp"
+#include "memory/memRegion.hpp"
+#include "utilities/growableArray.hpp"
+
+// Optional reference clearing for Epsilon, enabled by EpsilonClearReferences.
+//
+// On explicit GC requests, the heap is marked from the strong roots, and the
+// referents of unmarked WeakReferences created without a ReferenceQueue are
+// cleared. Such references never need to be enqueued, so this is the minimal
+// amount of reference processing any collector has to do. Nothing is ever
+// reclaimed, so this only exists to measure that cost in isolation.
+//
+// All other references are not discovered, and their referents are treated
+// as strongly reachable.
+class EpsilonReferenceClearing : public ReferenceDiscoverer {
+  friend class VM_EpsilonClearReferences;
+
+private:
+  MarkBitMap                    _bitmap;
+  MemRegion                     _bitmap_region;
+  size_t                        _bitmap_committed;
+  GrowableArrayCHeap<oop, mtGC> _discovered;
+
+  void commit_bitmap();
+  size_t mark();
+  size_t clear_referents();
+  void work();
+
+public:
+  EpsilonReferenceClearing(MemRegion heap);
+
+  virtual bool discover_reference(oop reference, ReferenceType type);
+
+  void collect(GCCause::Cause cause);
+};
+
+#endif // SHARE_GC_EPSILON_EPSILONREFERENCECLEARING_HPP
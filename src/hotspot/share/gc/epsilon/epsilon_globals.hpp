@@ -82,6 +82,12 @@
           "threads.")                                                       \
           range(1, max_intx)                                                \
                                                                             \
+  product(bool, EpsilonClearReferences, false, EXPERIMENTAL,                \
+          "On explicit GC requests, mark the heap and clear the referents " \
+          "of unmarked WeakReferences created without a ReferenceQueue, "   \
+          "and report the timings. Memory is still never reclaimed. This "  \
+          "gives a lower bound for the cost of reference processing.")      \
+                                                                            \
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
@@ -226,6 +226,18 @@ void G1BarrierSetC2::eliminate_gc_barrier_data(Node* node) const {
   }
 }
 
+bool G1BarrierSetC2::final_graph_reshaping(Compile* compile, Node* n, uint opcode, Unique_Node_List& dead_nodes) const {
+  if ((opcode == Op_LoadP || opcode == Op_LoadN) && ElideCompareOnlyKeepAlive) {
+    // A referent that is only compared does not need to be recorded in
+    // the SATB buffer, it does not escape to the application
+    MemNode* const load = n->as_Mem();
+    if ((load->barrier_data() & G1C2BarrierPre) != 0 && is_only_compared(load)) {
+      load->set_barrier_data(load->barrier_data() & ~G1C2BarrierPre);
+    }
+  }
+  return false;
+}
+
 static void refine_barrier_by_new_val_type(const Node* n) {
   if (n->Opcode() != Op_StoreP &&
       n->Opcode() != Op_StoreN) {
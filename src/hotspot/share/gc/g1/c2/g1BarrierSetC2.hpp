@@ -105,6 +105,7 @@ class G1BarrierSetC2: public CardTableBarrierSetC2 {
   virtual void emit_stubs(CodeBuffer& cb) const;
   virtual void elide_dominated_barrier(MachNode* mach) const;
   virtual void late_barrier_analysis() const;
+  virtual bool final_graph_reshaping(Compile* compile, Node* n, uint opcode, Unique_Node_List& dead_nodes) const;
 
 #ifndef PRODUCT
   virtual void dump_barrier_data(const MachNode* mach, outputStream* st) const;
@@ -80,6 +80,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _cost_per_card_scan_ms_seq(TruncatedSeqLength),
     _cost_per_card_merge_ms_seq(TruncatedSeqLength),
     _cost_per_code_root_ms_seq(TruncatedSeqLength),
+    _cost_per_discovered_ref_ms_seq(TruncatedSeqLength),
     _cost_per_byte_copied_ms_seq(TruncatedSeqLength),
     _pending_cards_seq(TruncatedSeqLength),
     _card_rs_length_seq(TruncatedSeqLength),
@@ -206,6 +207,10 @@ void G1Analytics::report_cost_per_code_root_scan_ms(double cost_per_code_root_ms
   _cost_per_code_root_ms_seq.add(cost_per_code_root_ms, for_young_only_phase);
 }
 
+void G1Analytics::report_cost_per_discovered_ref_ms(double cost_per_ref_ms, bool for_young_only_phase) {
+  _cost_per_discovered_ref_ms_seq.add(cost_per_ref_ms, for_young_only_phase);
+}
+
 void G1Analytics::report_card_merge_to_scan_ratio(double merge_to_scan_ratio, bool for_young_only_phase) {
   _card_merge_to_scan_ratio_seq.add(merge_to_scan_ratio, for_young_only_phase);
 }
@@ -270,6 +275,10 @@ double G1Analytics::predict_code_root_scan_time_ms(size_t code_root_num, bool fo
   return code_root_num * predict_zero_bounded(&_cost_per_code_root_ms_seq, for_young_only_phase);
 }
 
+double G1Analytics::predict_ref_processing_time_ms(size_t discovered_refs, bool for_young_only_phase) const {
+  return discovered_refs * predict_zero_bounded(&_cost_per_discovered_ref_ms_seq, for_young_only_phase);
+}
+
 double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_only_phase) const {
   return card_num * predict_zero_bounded(&_cost_per_card_scan_ms_seq, for_young_only_phase);
 }
@@ -66,6 +66,8 @@ class G1Analytics: public CHeapObj<mtGC> {
   G1PhaseDependentSeq _cost_per_card_merge_ms_seq;
   // The cost to scan entries in the code root remembered set in ms.
   G1PhaseDependentSeq _cost_per_code_root_ms_seq;
+  // Reference processing cost per discovered Reference.
+  G1PhaseDependentSeq _cost_per_discovered_ref_ms_seq;
   // The cost to copy a byte in ms.
   G1PhaseDependentSeq _cost_per_byte_copied_ms_seq;
 
@@ -153,6 +155,7 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_cost_per_card_scan_ms(double cost_per_remset_card_ms, bool for_young_only_phase);
   void report_cost_per_card_merge_ms(double cost_per_card_ms, bool for_young_only_phase);
   void report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase);
+  void report_cost_per_discovered_ref_ms(double cost_per_ref_ms, bool for_young_only_phase);
   void report_card_merge_to_scan_ratio(double merge_to_scan_ratio, bool for_young_only_phase);
   void report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase);
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
@@ -178,6 +181,8 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   double predict_code_root_scan_time_ms(size_t code_root_num, bool for_young_only_phase) const;
 
+  double predict_ref_processing_time_ms(size_t discovered_refs, bool for_young_only_phase) const;
+
   double predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_only_phase) const;
 
   double predict_merge_refinement_table_time_ms() const;
@@ -26,6 +26,7 @@
 #include "gc/g1/g1BarrierSetAssembler.hpp"
 #include "gc/g1/g1CardTable.inline.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1HeapRegion.hpp"
 #include "gc/g1/g1RegionPinCache.inline.hpp"
 #include "gc/g1/g1SATBMarkQueueSet.hpp"
@@ -88,6 +89,12 @@ G1BarrierSet::write_ref_array_pre_work(T* dst, size_t count) {
   G1SATBMarkQueueSet& queue_set = G1BarrierSet::satb_mark_queue_set();
   if (!queue_set.is_active()) return;
 
+  // Arrays allocated since marking start do not need their previous elements
+  // enqueued; this covers most large copies into freshly allocated arrays.
+  if (!G1CollectedHeap::heap()->concurrent_mark()->needs_pre_barrier_at(reinterpret_cast<HeapWord*>(dst))) {
+    return;
+  }
+
   SATBMarkQueue& queue = G1ThreadLocalData::satb_mark_queue(Thread::current());
 
   T* elem_ptr = dst;
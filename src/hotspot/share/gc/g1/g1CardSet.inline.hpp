@@ -53,7 +53,7 @@ inline void G1CardSet::iterate_cards_or_ranges_in_container(ContainerPtr const c
     }
     case ContainerArrayOfCards: {
       if (cl.start_iterate(G1GCPhaseTimes::MergeRSMergedArrayOfCards)) {
-        container_ptr<G1CardSetArray>(container)->iterate(cl);
+        container_ptr<G1CardSetArray>(container)->iterate_cards_or_ranges(cl);
       }
       return;
     }
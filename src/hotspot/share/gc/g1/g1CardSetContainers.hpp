@@ -213,6 +213,16 @@ class G1CardSetArray : public G1CardSetContainer {
   template <class CardVisitor>
   void iterate(CardVisitor& found);
 
+  // Maximum number of entries iterate_cards_or_ranges() sorts; larger arrays
+  // are iterated in insertion order.
+  static const EntryCountType MaxSortedIterationEntries = 512;
+
+  // Iterate over the cards in ascending order, passing runs of consecutive
+  // cards as a single range. Used when merging the array into the card table
+  // so that the card table is written sequentially.
+  template <class CardOrRangeVisitor>
+  void iterate_cards_or_ranges(CardOrRangeVisitor& found);
+
   size_t num_entries() const { return _num_entries.load_relaxed() & EntryMask; }
 
   static size_t header_size_in_bytes();
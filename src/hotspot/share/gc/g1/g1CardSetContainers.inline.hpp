@@ -31,6 +31,7 @@
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/checkedCast.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/spinYield.hpp"
 
 inline G1CardSetInlinePtr::ContainerPtr G1CardSetInlinePtr::merge(ContainerPtr orig_value, uint card_in_region, uint idx, uint bits_per_card) {
@@ -240,6 +241,39 @@ void G1CardSetArray::iterate(CardVisitor& found) {
   }
 }
 
+template <class CardOrRangeVisitor>
+void G1CardSetArray::iterate_cards_or_ranges(CardOrRangeVisitor& found) {
+  EntryCountType num_entries = _num_entries.load_acquire() & EntryMask;
+  if (num_entries > MaxSortedIterationEntries) {
+    iterate(found);
+    return;
+  }
+
+  // Sort a copy; concurrent adds may still append to the array.
+  EntryDataType cards[MaxSortedIterationEntries];
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    cards[idx] = at(idx);
+  }
+  QuickSort::sort(cards, num_entries, [] (EntryDataType a, EntryDataType b) {
+    return a < b ? -1 : (a > b ? 1 : 0);
+  });
+
+  EntryCountType idx = 0;
+  while (idx < num_entries) {
+    uint const start = cards[idx];
+    uint length = 1;
+    while (idx + length < num_entries && cards[idx + length] == start + length) {
+      length++;
+    }
+    if (length == 1) {
+      found(start);
+    } else {
+      found(start, length);
+    }
+    idx += length;
+  }
+}
+
 inline size_t G1CardSetArray::header_size_in_bytes() {
   return offset_of(G1CardSetArray, _data);
 }
@@ -358,7 +392,7 @@ inline void G1CardSetHowl::iterate_cardset(ContainerPtr const container, uint in
     }
     case G1CardSet::ContainerArrayOfCards: {
       if (found.start_iterate(G1GCPhaseTimes::MergeRSHowlArrayOfCards)) {
-        G1CardSet::container_ptr<G1CardSetArray>(container)->iterate(found);
+        G1CardSet::container_ptr<G1CardSetArray>(container)->iterate_cards_or_ranges(found);
       }
       return;
     }
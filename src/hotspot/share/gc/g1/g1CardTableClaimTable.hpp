@@ -105,8 +105,15 @@ class G1ChunkScanner {
   static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
   static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
 
+  // Number of words checked at once when skipping over runs of clean or
+  // dirty cards.
+  static const uint WordsPerBlock = 4;
+
   inline bool is_card_dirty(const CardValue* const card) const;
 
+  // Index of the first card in a word with the given ToScanMask bits set.
+  static inline uint first_card_with_bits(Word bits);
+
   inline bool is_word_aligned(const void* const addr) const;
 
   inline CardValue* find_first_dirty_card(CardValue* i_card) const;
@@ -29,6 +29,8 @@
 
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1HeapRegion.inline.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 
 bool G1CardTableClaimTable::has_unclaimed_cards(uint region) {
   assert(region < _max_reserved_regions, "Tried to access invalid region %u", region);
@@ -72,6 +74,13 @@ bool G1ChunkScanner::is_word_aligned(const void* const addr) const {
   return ((uintptr_t)addr) % sizeof(Word) == 0;
 }
 
+uint G1ChunkScanner::first_card_with_bits(Word bits) {
+  assert(bits != 0, "must have a card with the bits set");
+  // The first card is in the lowest addressed byte of the word.
+  uint const bit = LITTLE_ENDIAN_ONLY(count_trailing_zeros(bits)) BIG_ENDIAN_ONLY(count_leading_zeros(bits));
+  return bit / BitsPerByte;
+}
+
 G1CardTable::CardValue* G1ChunkScanner::find_first_dirty_card(CardValue* i_card) const {
   while (!is_word_aligned(i_card)) {
     if (is_card_dirty(i_card)) {
@@ -80,18 +89,21 @@ G1CardTable::CardValue* G1ChunkScanner::find_first_dirty_card(CardValue* i_card)
     i_card++;
   }
 
-  for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-    Word word_value = *reinterpret_cast<Word*>(i_card);
-    bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-    if (has_dirty_cards_in_word) {
-      for (uint i = 0; i < sizeof(Word); ++i) {
-        if (is_card_dirty(i_card)) {
-          return i_card;
-        }
-        i_card++;
-      }
-      ShouldNotReachHere();
+  const Word* i_word = reinterpret_cast<const Word*>(i_card);
+  const Word* const end_word = reinterpret_cast<const Word*>(_end_card);
+
+  // Skip blocks of clean cards. A card is dirty if its ToScanMask bit is not set.
+  for (/* empty */; i_word + WordsPerBlock <= end_word; i_word += WordsPerBlock) {
+    Word const all_words = i_word[0] & i_word[1] & i_word[2] & i_word[3];
+    if ((~all_words & ExpandedToScanMask) != 0) {
+      break;
+    }
+  }
+
+  for (/* empty */; i_word < end_word; ++i_word) {
+    Word const dirty_bits = ~*i_word & ExpandedToScanMask;
+    if (dirty_bits != 0) {
+      return (CardValue*)i_word + first_card_with_bits(dirty_bits);
     }
   }
 
@@ -106,18 +118,21 @@ G1CardTable::CardValue* G1ChunkScanner::find_first_non_dirty_card(CardValue* i_c
     i_card++;
   }
 
-  for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-    Word word_value = *reinterpret_cast<Word*>(i_card);
-    bool all_cards_dirty = (word_value & ExpandedToScanMask) == 0;
-
-    if (!all_cards_dirty) {
-      for (uint i = 0; i < sizeof(Word); ++i) {
-        if (!is_card_dirty(i_card)) {
-          return i_card;
-        }
-        i_card++;
-      }
-      ShouldNotReachHere();
+  const Word* i_word = reinterpret_cast<const Word*>(i_card);
+  const Word* const end_word = reinterpret_cast<const Word*>(_end_card);
+
+  // Skip blocks of dirty cards.
+  for (/* empty */; i_word + WordsPerBlock <= end_word; i_word += WordsPerBlock) {
+    Word const any_word = i_word[0] | i_word[1] | i_word[2] | i_word[3];
+    if ((any_word & ExpandedToScanMask) != 0) {
+      break;
+    }
+  }
+
+  for (/* empty */; i_word < end_word; ++i_word) {
+    Word const non_dirty_bits = *i_word & ExpandedToScanMask;
+    if (non_dirty_bits != 0) {
+      return (CardValue*)i_word + first_card_with_bits(non_dirty_bits);
     }
   }
 
@@ -165,12 +165,13 @@ class G1CodeRootSetHashTable : public CHeapObj<mtGC> {
     _table_scanner.do_safepoint_scan(do_value);
   }
 
-  // Removes entries as indicated by the given EVAL closure.
+  // Removes entries as indicated by the given EVAL closure. Returns the number
+  // of removed entries.
   template <class EVAL>
-  void clean(EVAL& eval) {
+  size_t clean(EVAL& eval) {
     // A lot of code root sets are typically empty.
     if (is_empty()) {
-      return;
+      return 0;
     }
 
     size_t num_deleted = 0;
@@ -185,15 +186,16 @@ class G1CodeRootSetHashTable : public CHeapObj<mtGC> {
       size_t current_size = _num_entries.sub_then_fetch(num_deleted);
       shrink_to_match(current_size);
     }
+    return num_deleted;
   }
 
   // Removes dead/unlinked entries.
-  void bulk_remove() {
+  size_t bulk_remove() {
     auto delete_check = [&] (nmethod** value) {
       return (*value)->is_unlinked();
     };
 
-    clean(delete_check);
+    return clean(delete_check);
   }
 
   // Calculate the log2 of the table size we want to shrink to.
@@ -264,9 +266,9 @@ bool G1CodeRootSet::remove(nmethod* method) {
   return _table->remove(method);
 }
 
-void G1CodeRootSet::bulk_remove() {
+size_t G1CodeRootSet::bulk_remove() {
   assert(!_is_iterating, "should not mutate while iterating the table");
-  _table->bulk_remove();
+  return _table->bulk_remove();
 }
 
 bool G1CodeRootSet::contains(nmethod* method) {
@@ -44,7 +44,8 @@ class G1CodeRootSet {
 
   void add(nmethod* method);
   bool remove(nmethod* method);
-  void bulk_remove();
+  // Remove all unlinked nmethods, returning the number of removed entries.
+  size_t bulk_remove();
   bool contains(nmethod* method);
   void clear();
 
@@ -1734,12 +1734,17 @@ void G1CollectedHeap::ref_processing_init() {
                            &_is_alive_closure_cm);                         // is alive closure
 
   // STW ref processor
+  //
+  // Discovery is exclusive: during evacuation a Reference is only scanned,
+  // and thereby discovered, by the thread that installed its forwarding
+  // pointer, and during full GC marking by the thread that marked it.
   _ref_processor_stw =
     new ReferenceProcessor(&_is_subject_to_discovery_stw,
                            ParallelGCThreads,                    // degree of mt processing
                            ParallelGCThreads,                    // degree of mt discovery
                            false,                                // Reference discovery is not concurrent
-                           &_is_alive_closure_stw);              // is alive closure
+                           &_is_alive_closure_stw,               // is alive closure
+                           true);                                // Reference discovery is exclusive
 }
 
 size_t G1CollectedHeap::capacity() const {
@@ -2767,7 +2772,7 @@ void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjec
                             false /* lock_nmethod_free_separately */);
   {
     CodeCache::UnlinkingScope scope(is_alive);
-    bool unloading_occurred = SystemDictionary::do_unloading(timer);
+    bool unloading_occurred = SystemDictionary::do_unloading(timer, workers());
     GCTraceTime(Debug, gc, phases) t("G1 Complete Cleaning", timer);
     complete_cleaning(unloading_occurred);
   }
@@ -2777,7 +2782,13 @@ void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjec
   }
   {
     GCTraceTime(Debug, gc, phases) ur("Unregister NMethods", timer);
-    G1CollectedHeap::heap()->bulk_unregister_nmethods();
+    // Nothing to remove from the code root sets if no nmethod has been unlinked;
+    // avoid visiting all regions.
+    size_t num_unlinked = ctx.num_unlinked_nmethods();
+    if (num_unlinked > 0) {
+      size_t num_removed = bulk_unregister_nmethods();
+      log_debug(gc, phases)("Unregistered %zu code root entries of %zu unlinked nmethods", num_removed, num_unlinked);
+    }
   }
   {
     GCTraceTime(Debug, gc, phases) t("Free Code Blobs", timer);
@@ -2792,30 +2803,42 @@ void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjec
 
 class G1BulkUnregisterNMethodTask : public WorkerTask {
   G1HeapRegionClaimer _hrclaimer;
+  Atomic<size_t> _num_removed;
 
   class UnregisterNMethodsHeapRegionClosure : public G1HeapRegionClosure {
+    size_t _num_removed;
+
   public:
+    UnregisterNMethodsHeapRegionClosure() : _num_removed(0) { }
 
     bool do_heap_region(G1HeapRegion* hr) {
-      hr->rem_set()->bulk_remove_code_roots();
+      _num_removed += hr->rem_set()->bulk_remove_code_roots();
       return false;
     }
-  } _cl;
+
+    size_t num_removed() const { return _num_removed; }
+  };
 
 public:
   G1BulkUnregisterNMethodTask(uint num_workers)
   : WorkerTask("G1 Remove Unlinked NMethods From Code Root Set Task"),
-    _hrclaimer(num_workers) { }
+    _hrclaimer(num_workers),
+    _num_removed(0) { }
 
   void work(uint worker_id) {
-    G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&_cl, &_hrclaimer, worker_id);
+    UnregisterNMethodsHeapRegionClosure cl;
+    G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&cl, &_hrclaimer, worker_id);
+    _num_removed.add_then_fetch(cl.num_removed());
   }
+
+  size_t num_removed() const { return _num_removed.load_relaxed(); }
 };
 
-void G1CollectedHeap::bulk_unregister_nmethods() {
+size_t G1CollectedHeap::bulk_unregister_nmethods() {
   uint num_workers = workers()->active_workers();
   G1BulkUnregisterNMethodTask t(num_workers);
   workers()->run_task(&t);
+  return t.num_removed();
 }
 
 bool G1STWSubjectToDiscoveryClosure::do_object_b(oop obj) {
@@ -1311,7 +1311,9 @@ class G1CollectedHeap : public CollectedHeap {
 
   void unload_classes_and_code(const char* description, BoolObjectClosure* cl, GCTimer* timer);
 
-  void bulk_unregister_nmethods();
+  // Remove the nmethods unlinked during class unloading from all code root
+  // sets. Returns the number of removed code root entries.
+  size_t bulk_unregister_nmethods();
 
   // Verification
 
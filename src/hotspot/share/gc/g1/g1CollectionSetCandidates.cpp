@@ -81,6 +81,7 @@ double G1CSetCandidateGroup::predict_group_total_time_ms() const {
 
   double predicted_copy_time_ms = 0.0;
   double predict_code_root_scan_time_ms = 0.0;
+  double predict_ref_processing_time_ms = 0.0;
   size_t predict_bytes_to_copy = 0.0;
 
   for (G1CollectionSetCandidateInfo ci : _candidates) {
@@ -90,6 +91,7 @@ double G1CSetCandidateGroup::predict_group_total_time_ms() const {
     predict_bytes_to_copy += p->predict_bytes_to_copy(r);
     predicted_copy_time_ms += p->predict_region_copy_time_ms(r, false /* for_young_only_phase */);
     predict_code_root_scan_time_ms += p->predict_region_code_root_scan_time(r, false /* for_young_only_phase */);
+    predict_ref_processing_time_ms += p->predict_region_ref_processing_time_ms(r, false /* for_young_only_phase */);
   }
 
   size_t card_rs_length = _card_set.occupied();
@@ -100,9 +102,10 @@ double G1CSetCandidateGroup::predict_group_total_time_ms() const {
   double total_time_ms = merge_scan_time_ms +
                          predict_code_root_scan_time_ms +
                          predicted_copy_time_ms +
+                         predict_ref_processing_time_ms +
                          non_young_other_time_ms;
 
-  log_trace(gc, ergo, cset) ("Prediction for group %u (%u regions): total_time %.2fms card_rs_length %zu merge_scan_time %.2fms code_root_scan_time_ms %.2fms evac_time_ms %.2fms other_time %.2fms bytes_to_copy %zu",
+  log_trace(gc, ergo, cset) ("Prediction for group %u (%u regions): total_time %.2fms card_rs_length %zu merge_scan_time %.2fms code_root_scan_time_ms %.2fms evac_time_ms %.2fms ref_proc_time_ms %.2fms other_time %.2fms bytes_to_copy %zu",
                              group_id(),
                              length(),
                              total_time_ms,
@@ -110,6 +113,7 @@ double G1CSetCandidateGroup::predict_group_total_time_ms() const {
                              merge_scan_time_ms,
                              predict_code_root_scan_time_ms,
                              predicted_copy_time_ms,
+                             predict_ref_processing_time_ms,
                              non_young_other_time_ms,
                              predict_bytes_to_copy);
 
@@ -2034,11 +2034,20 @@ static ReferenceProcessor* get_cm_oop_closure_ref_processor(G1CollectedHeap* g1h
 }
 
 G1CMOopClosure::G1CMOopClosure(G1CollectedHeap* g1h,
-                               G1CMTask* task)
-  : ClaimMetadataVisitingOopIterateClosure(ClassLoaderData::_claim_strong, get_cm_oop_closure_ref_processor(g1h)),
+                               G1CMTask* task,
+                               G1CMReferenceDiscoverer* rd)
+  : ClaimMetadataVisitingOopIterateClosure(ClassLoaderData::_claim_strong, rd),
     _g1h(g1h), _task(task)
 { }
 
+bool G1CMReferenceDiscoverer::discover_reference(oop obj, ReferenceType type) {
+  if (!_rp->discover_reference(obj, type)) {
+    return false;
+  }
+  _task->inc_discovered_refs(obj);
+  return true;
+}
+
 void G1CMTask::setup_for_region(G1HeapRegion* hr) {
   assert(hr != nullptr,
         "claim_region() should have filtered out null regions");
@@ -2786,7 +2795,8 @@ void G1CMTask::do_marking_step(double time_target_ms,
   // eventually called from this method, so it is OK to allocate these
   // statically.
   G1CMBitMapClosure bitmap_closure(this, _cm);
-  G1CMOopClosure cm_oop_closure(_g1h, this);
+  G1CMReferenceDiscoverer ref_discoverer(get_cm_oop_closure_ref_processor(_g1h), this);
+  G1CMOopClosure cm_oop_closure(_g1h, this, &ref_discoverer);
   set_cm_oop_closure(&cm_oop_closure);
 
   if (_cm->has_overflown()) {
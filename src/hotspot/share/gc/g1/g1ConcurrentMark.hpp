@@ -33,6 +33,7 @@
 #include "gc/shared/partialArraySplitter.hpp"
 #include "gc/shared/partialArrayState.hpp"
 #include "gc/shared/partialArrayTaskStats.hpp"
+#include "gc/shared/referenceDiscoverer.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/verifyOption.hpp"
@@ -84,6 +85,18 @@ class G1CMSubjectToDiscoveryClosure : public BoolObjectClosure {
   bool do_object_b(oop obj);
 };
 
+// Reference discoverer used by the marking tasks. Forwards discovery to the
+// concurrent mark reference processor, and records the References it
+// discovered in the region statistics of the task.
+class G1CMReferenceDiscoverer final : public ReferenceDiscoverer {
+  ReferenceDiscoverer* _rp;
+  G1CMTask* _task;
+
+public:
+  G1CMReferenceDiscoverer(ReferenceDiscoverer* rp, G1CMTask* task) : _rp(rp), _task(task) { }
+  bool discover_reference(oop obj, ReferenceType type) override;
+};
+
 // Represents the overflow mark stack used by concurrent marking.
 //
 // Stores oops in a huge buffer in virtual memory that is always fully committed.
@@ -537,6 +550,8 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   void set_live_bytes(uint region, size_t live_bytes) { _region_mark_stats[region]._live_words.store_relaxed(live_bytes / HeapWordSize); }
   // Approximate number of incoming references found during marking.
   size_t incoming_refs(uint region) const { return _region_mark_stats[region].incoming_refs(); }
+  // Number of References in the given region discovered during marking.
+  size_t discovered_refs(uint region) const { return _region_mark_stats[region].discovered_refs(); }
 
   // Update the TAMS for the given region to the current top.
   inline void update_top_at_mark_start(G1HeapRegion* r);
@@ -547,6 +562,11 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   inline HeapWord* top_at_mark_start(uint region) const;
   // Returns whether the given object been allocated since marking start (i.e. >= TAMS in that region).
   inline bool obj_allocated_since_mark_start(oop obj) const;
+  // Returns whether the SATB pre-barrier must record the previous values of the
+  // references at addr. Objects allocated since marking start are not scanned, so
+  // whatever they referred to at marking start is kept alive through other paths.
+  // This does not hold for the root regions until they have been scanned.
+  inline bool needs_pre_barrier_at(HeapWord* addr);
 
   // Sets the internal top_at_region_start for the given region to current top of the region.
   inline void update_top_at_rebuild_start(G1HeapRegion* r);
@@ -946,6 +966,8 @@ class G1CMTask : public TerminatorTerminator {
 
   inline void inc_incoming_refs(oop const obj);
 
+  inline void inc_discovered_refs(oop const obj);
+
   // Clear (without flushing) the mark cache entry for the given region.
   void clear_mark_stats_cache(uint region_idx);
   // Evict the whole statistics cache into the global statistics. Returns the
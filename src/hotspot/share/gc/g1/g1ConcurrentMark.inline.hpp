@@ -216,6 +216,15 @@ inline bool G1ConcurrentMark::obj_allocated_since_mark_start(oop obj) const {
   return cast_from_oop<HeapWord*>(obj) >= top_at_mark_start(region);
 }
 
+inline bool G1ConcurrentMark::needs_pre_barrier_at(HeapWord* addr) {
+  if (_root_regions.scan_in_progress()) {
+    return true;
+  }
+  uint const region = _g1h->addr_to_region(addr);
+  assert(region < _g1h->max_num_regions(), "addr " PTR_FORMAT " outside heap %u", p2i(addr), region);
+  return addr < top_at_mark_start(region);
+}
+
 inline HeapWord* G1ConcurrentMark::top_at_rebuild_start(G1HeapRegion* r) const {
   return _top_at_rebuild_starts[r->hrm_index()];
 }
@@ -239,6 +248,10 @@ inline void G1CMTask::inc_incoming_refs(oop const obj) {
   _mark_stats_cache.inc_incoming_refs(_g1h->addr_to_region(obj));
 }
 
+inline void G1CMTask::inc_discovered_refs(oop const obj) {
+  _mark_stats_cache.inc_discovered_refs(_g1h->addr_to_region(obj));
+}
+
 inline void G1ConcurrentMark::add_to_liveness(uint worker_id, oop const obj, size_t size) {
   task(worker_id)->update_liveness(obj, size);
 }
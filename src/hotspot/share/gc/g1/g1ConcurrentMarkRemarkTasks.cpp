@@ -111,7 +111,10 @@ struct G1UpdateRegionLivenessAndSelectForRebuildTask::G1OnRegionClosure : public
       }
     } else if (hr->is_old()) {
       uint region_idx = hr->hrm_index();
-      hr->note_end_of_marking(_cm->top_at_mark_start(hr), _cm->live_bytes(region_idx), _cm->incoming_refs(region_idx));
+      hr->note_end_of_marking(_cm->top_at_mark_start(hr),
+                              _cm->live_bytes(region_idx),
+                              _cm->incoming_refs(region_idx),
+                              _cm->discovered_refs(region_idx));
 
       const bool is_live = hr->live_bytes() != 0
                         || hr->has_pinned_objects();
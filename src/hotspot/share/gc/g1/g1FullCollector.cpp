@@ -23,6 +23,8 @@
  */
 
 #include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/stringTable.hpp"
+#include "gc/g1/g1BatchedTask.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1FullCollector.inline.hpp"
 #include "gc/g1/g1FullGCAdjustTask.hpp"
@@ -39,6 +41,7 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/referenceProcessor.hpp"
+#include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/verifyOption.hpp"
 #include "gc/shared/weakProcessor.inline.hpp"
 #include "gc/shared/workerPolicy.hpp"
@@ -123,6 +126,8 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap,
     _humongous_compaction_point(this, nullptr),
     _is_alive(this, heap->concurrent_mark()->mark_bitmap()),
     _is_alive_mutator(heap->ref_processor_stw(), &_is_alive),
+    _ref_phase_times(_scope.timer(), heap->ref_processor_stw()->max_num_queues()),
+    _defer_phantom_refs(G1FullGCOverlapPhantomRefs),
     _humongous_compaction_regions(8),
     _always_subject_to_discovery(),
     _is_subject_mutator(heap->ref_processor_stw(), &_always_subject_to_discovery),
@@ -140,6 +145,13 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap,
     ::new (&_compaction_tops[j]) Atomic<HeapWord*>{};
   }
 
+  _first_destinations = nullptr;
+  _last_destinations = nullptr;
+  if (G1FullGCRegionParallelCompaction) {
+    _first_destinations = NEW_C_HEAP_ARRAY(uint, _heap->max_num_regions(), mtGC);
+    _last_destinations = NEW_C_HEAP_ARRAY(uint, _heap->max_num_regions(), mtGC);
+  }
+
   _partial_array_state_manager = new PartialArrayStateManager(_num_workers);
 
   for (uint i = 0; i < _num_workers; i++) {
@@ -168,6 +180,8 @@ G1FullCollector::~G1FullCollector() {
   FREE_C_HEAP_ARRAY(G1FullGCMarker*, _markers);
   FREE_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _compaction_points);
   FREE_C_HEAP_ARRAY(Atomic<HeapWord*>, _compaction_tops);
+  FREE_C_HEAP_ARRAY(uint, _first_destinations);
+  FREE_C_HEAP_ARRAY(uint, _last_destinations);
   FREE_C_HEAP_ARRAY(G1RegionMarkStats, _live_stats);
 }
 
@@ -275,11 +289,34 @@ void G1FullCollector::before_marking_update_attribute_table(G1HeapRegion* hr) {
 
 class G1FullGCRefProcProxyTask : public RefProcProxyTask {
   G1FullCollector& _collector;
+  TaskTerminator _terminator;
+
+  // Completes the marking from the referents kept alive by a worker, and
+  // steals from the other workers until all of them are done. A single
+  // large graph kept alive by one worker is then marked by all of them.
+  class G1CompleteMarkingClosure : public VoidClosure {
+    G1FullGCMarker* _marker;
+    G1MarkTasksQueueSet* _task_queues;
+    TaskTerminator* _terminator;
+
+  public:
+    G1CompleteMarkingClosure(G1FullGCMarker* marker, G1MarkTasksQueueSet* task_queues, TaskTerminator* terminator)
+      : _marker(marker), _task_queues(task_queues), _terminator(terminator) { }
+
+    void do_void() override {
+      if (_terminator == nullptr) {
+        _marker->process_marking_stacks();
+      } else {
+        _marker->complete_marking(_task_queues, _terminator);
+      }
+    }
+  };
 
 public:
   G1FullGCRefProcProxyTask(G1FullCollector &collector, uint max_workers)
     : RefProcProxyTask("G1FullGCRefProcProxyTask", max_workers),
-      _collector(collector) {}
+      _collector(collector),
+      _terminator(max_workers, collector.marking_task_queues()) {}
 
   void work(uint worker_id) override {
     assert(worker_id < _max_workers, "sanity");
@@ -287,8 +324,16 @@ class G1FullGCRefProcProxyTask : public RefProcProxyTask {
     uint index = (_tm == RefProcThreadModel::Single) ? 0 : worker_id;
     G1FullKeepAliveClosure keep_alive(_collector.marker(index));
     BarrierEnqueueDiscoveredFieldClosure enqueue;
-    G1MarkStackClosure* complete_marking = _collector.marker(index)->stack_closure();
-    _rp_task->rp_work(worker_id, &is_alive, &keep_alive, &enqueue, complete_marking);
+    // Phases that do not mark oops alive push no work, so there is nothing to
+    // steal. Such phases may also be run with fewer workers than queues.
+    G1CompleteMarkingClosure complete_marking(_collector.marker(index),
+                                              _collector.marking_task_queues(),
+                                              (_tm == RefProcThreadModel::Single || !_marks_oops_alive) ? nullptr : &_terminator);
+    _rp_task->rp_work(worker_id, &is_alive, &keep_alive, &enqueue, &complete_marking);
+  }
+
+  void prepare_run_task_hook() override {
+    _terminator.reset_for_reuse(_queue_count);
   }
 };
 
@@ -304,12 +349,14 @@ void G1FullCollector::phase1_mark_live_objects() {
 
   {
     GCTraceTime(Debug, gc, phases) debug("Phase 1: Reference Processing", scope()->timer());
-    // Process reference objects found during marking.
-    ReferenceProcessorPhaseTimes pt(scope()->timer(), reference_processor()->max_num_queues());
+    // Process reference objects found during marking. PhantomReferences may be
+    // left for the weak processing below, see process_deferred_phantom_refs().
     G1FullGCRefProcProxyTask task(*this, reference_processor()->max_num_queues());
-    const ReferenceProcessorStats& stats = reference_processor()->process_discovered_references(task, _heap->workers(), pt);
+    const ReferenceProcessorStats& stats = reference_processor()->process_discovered_references(task, _heap->workers(), _ref_phase_times, _defer_phantom_refs);
     scope()->tracer()->report_gc_reference_stats(stats);
-    pt.print_all_references();
+    if (!_defer_phantom_refs) {
+      _ref_phase_times.print_all_references();
+    }
     assert(marker(0)->task_queue()->is_empty(), "Should be no oops on the stack");
   }
 
@@ -323,7 +370,11 @@ void G1FullCollector::phase1_mark_live_objects() {
   // Weak oops cleanup.
   {
     GCTraceTime(Debug, gc, phases) debug("Phase 1: Weak Processing", scope()->timer());
-    WeakProcessor::weak_oops_do(_heap->workers(), &_is_alive, &do_nothing_cl, 1);
+    if (_defer_phantom_refs) {
+      process_deferred_phantom_refs();
+    } else {
+      WeakProcessor::weak_oops_do(_heap->workers(), &_is_alive, &do_nothing_cl, 1);
+    }
   }
 
   // Class unloading and cleanup.
@@ -381,6 +432,77 @@ bool G1FullCollector::phase2b_forward_oops() {
   return task.has_free_compaction_targets();
 }
 
+// Processes the PhantomReferences deferred by reference processing together
+// with the weak oops cleanup. Workers done with their share of the references
+// continue with the weak OopStorages while others still process references.
+// Both only read the marking, which is complete at this point. This runs
+// before class unloading and before Phase 2 frees dead humongous regions or
+// forwards any object, so the referents and References are still intact.
+class G1FullGCWeakProcessingBatchTask : public G1BatchedTask {
+  class G1PhantomRefsTask : public G1AbstractSubTask {
+    RefProcDeferredPhantomPhase* _phantom_phase;
+
+  public:
+    G1PhantomRefsTask(RefProcDeferredPhantomPhase* phantom_phase) :
+      G1AbstractSubTask(G1GCPhaseTimes::FullGCPhantomRefs),
+      _phantom_phase(phantom_phase) { }
+
+    double worker_cost() const override { return AlmostNoWork; }
+    void do_work(uint worker_id) override { _phantom_phase->work(); }
+  };
+
+  class G1WeakOopsTask : public G1AbstractSubTask {
+    WeakProcessor::Task* _weak_proc_task;
+    G1IsAliveClosure* _is_alive;
+    uint _num_workers;
+
+  public:
+    G1WeakOopsTask(WeakProcessor::Task* weak_proc_task, G1IsAliveClosure* is_alive, uint num_workers) :
+      G1AbstractSubTask(G1GCPhaseTimes::FullGCWeakProcessing),
+      _weak_proc_task(weak_proc_task),
+      _is_alive(is_alive),
+      _num_workers(num_workers) { }
+
+    double worker_cost() const override { return _num_workers; }
+    void do_work(uint worker_id) override {
+      _weak_proc_task->work(worker_id, _is_alive, &do_nothing_cl);
+    }
+  };
+
+public:
+  G1FullGCWeakProcessingBatchTask(uint num_workers,
+                                  G1IsAliveClosure* is_alive,
+                                  RefProcDeferredPhantomPhase* phantom_phase,
+                                  WeakProcessor::Task* weak_proc_task) :
+    // Full GC does not record G1GCPhaseTimes.
+    G1BatchedTask("G1 Weak Processing Task", nullptr /* phase_times */) {
+    add_parallel_task(new G1PhantomRefsTask(phantom_phase));
+    add_parallel_task(new G1WeakOopsTask(weak_proc_task, is_alive, num_workers));
+  }
+};
+
+void G1FullCollector::process_deferred_phantom_refs() {
+  assert(_defer_phantom_refs, "must be");
+  {
+    G1FullGCRefProcProxyTask ref_task(*this, reference_processor()->max_num_queues());
+    RefProcDeferredPhantomPhase phantom_phase(*reference_processor(), ref_task, _heap->workers(), &_ref_phase_times);
+    WeakProcessor::Task weak_proc_task(workers());
+
+    G1FullGCWeakProcessingBatchTask task(workers(), &_is_alive, &phantom_phase, &weak_proc_task);
+    task.set_max_workers(workers());
+    run_task(&task);
+
+    weak_proc_task.report_num_dead();
+  }
+  // Remove the StringTable entries just found dead while the workers are
+  // at hand, as WeakProcessor::weak_oops_do() does.
+  StringTable::clean_dead_entries(_heap->workers(), workers());
+  _defer_phantom_refs = false;
+
+  _ref_phase_times.print_all_references();
+  assert(marker(0)->task_queue()->is_empty(), "Should be no oops on the stack");
+}
+
 uint G1FullCollector::truncate_parallel_cps() {
   uint lowest_current = UINT_MAX;
   for (uint i = 0; i < workers(); i++) {
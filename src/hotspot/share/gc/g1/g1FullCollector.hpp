@@ -35,6 +35,7 @@
 #include "gc/shared/gcTraceTime.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/referenceProcessor.hpp"
+#include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "memory/allocation.hpp"
 #include "oops/oopsHierarchy.hpp"
@@ -86,6 +87,10 @@ class G1FullCollector : StackObj {
   G1FullGCCompactionPoint   _humongous_compaction_point;
   G1IsAliveClosure          _is_alive;
   ReferenceProcessorIsAliveMutator _is_alive_mutator;
+  ReferenceProcessorPhaseTimes _ref_phase_times;
+  // Whether PhantomReferences are processed together with the weak oops
+  // cleanup instead of right after the other references.
+  bool                      _defer_phantom_refs;
   G1RegionMarkStats*        _live_stats;
   GrowableArrayCHeap<G1HeapRegion*, mtGC> _humongous_compaction_regions;
 
@@ -98,6 +103,11 @@ class G1FullCollector : StackObj {
 
   Atomic<HeapWord*>* _compaction_tops;
 
+  // First and last region the live objects of a compaction region are
+  // forwarded into. Only maintained for G1FullGCRegionParallelCompaction.
+  uint* _first_destinations;
+  uint* _last_destinations;
+
 public:
   G1FullCollector(G1CollectedHeap* heap,
                   bool clear_soft_refs,
@@ -142,6 +152,11 @@ class G1FullCollector : StackObj {
   inline void set_compaction_top(G1HeapRegion* r, HeapWord* value);
   inline HeapWord* compaction_top(G1HeapRegion* r) const;
 
+  inline bool records_destinations() const;
+  inline void set_destinations(G1HeapRegion* r, uint first_idx, uint last_idx);
+  inline uint first_destination(G1HeapRegion* r) const;
+  inline uint last_destination(G1HeapRegion* r) const;
+
   inline void set_has_compaction_targets();
   inline bool has_compaction_targets() const;
 
@@ -155,6 +170,9 @@ class G1FullCollector : StackObj {
 
 private:
   void phase1_mark_live_objects();
+  // Completes reference processing by processing the PhantomReferences left
+  // by it, together with the weak oops cleanup.
+  void process_deferred_phantom_refs();
   void phase2_prepare_compaction();
 
   void phase2a_determine_worklists();
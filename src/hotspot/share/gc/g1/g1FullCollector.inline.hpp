@@ -70,6 +70,24 @@ HeapWord* G1FullCollector::compaction_top(G1HeapRegion* r) const {
   return _compaction_tops[r->hrm_index()].load_relaxed();
 }
 
+bool G1FullCollector::records_destinations() const {
+  return _first_destinations != nullptr;
+}
+
+void G1FullCollector::set_destinations(G1HeapRegion* r, uint first_idx, uint last_idx) {
+  assert(first_idx <= last_idx && last_idx <= r->hrm_index(), "must only compact downwards");
+  _first_destinations[r->hrm_index()] = first_idx;
+  _last_destinations[r->hrm_index()] = last_idx;
+}
+
+uint G1FullCollector::first_destination(G1HeapRegion* r) const {
+  return _first_destinations[r->hrm_index()];
+}
+
+uint G1FullCollector::last_destination(G1HeapRegion* r) const {
+  return _last_destinations[r->hrm_index()];
+}
+
 void G1FullCollector::set_has_compaction_targets() {
   if (!_has_compaction_targets) {
     _has_compaction_targets = true;
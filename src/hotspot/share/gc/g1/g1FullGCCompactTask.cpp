@@ -28,12 +28,137 @@
 #include "gc/g1/g1FullGCCompactionPoint.hpp"
 #include "gc/g1/g1FullGCCompactTask.hpp"
 #include "gc/g1/g1HeapRegion.inline.hpp"
+#include "gc/g1/g1_globals.hpp"
 #include "gc/shared/fullGCForwarding.inline.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "utilities/spinYield.hpp"
 #include "utilities/ticks.hpp"
 
+G1FullGCCompactionSchedule::G1FullGCCompactionSchedule(G1FullCollector* collector) :
+  _num_regions(0),
+  _regions(nullptr),
+  _first_source(nullptr),
+  _last_source(nullptr),
+  _pending(nullptr),
+  _ready(nullptr),
+  _num_ready(0),
+  _num_claimed(0) {
+  assert(collector->records_destinations(), "must have recorded destinations");
+
+  for (uint i = 0; i < collector->workers(); i++) {
+    _num_regions += (uint)collector->compaction_point(i)->regions()->length();
+  }
+
+  _regions = NEW_C_HEAP_ARRAY(G1HeapRegion*, _num_regions, mtGC);
+  _first_source = NEW_C_HEAP_ARRAY(uint, _num_regions, mtGC);
+  _last_source = NEW_C_HEAP_ARRAY(uint, _num_regions, mtGC);
+  _pending = NEW_C_HEAP_ARRAY(Atomic<uint>, _num_regions, mtGC);
+  _ready = NEW_C_HEAP_ARRAY(Atomic<uint>, _num_regions, mtGC);
+
+  // Index into _regions of every region in the compaction queues.
+  uint max_num_regions = G1CollectedHeap::heap()->max_num_regions();
+  uint* index_of = NEW_C_HEAP_ARRAY(uint, max_num_regions, mtGC);
+
+  uint idx = 0;
+  for (uint i = 0; i < collector->workers(); i++) {
+    for (G1HeapRegion* hr : *collector->compaction_point(i)->regions()) {
+      _regions[idx] = hr;
+      index_of[hr->hrm_index()] = idx;
+      _first_source[idx] = UINT_MAX;
+      _last_source[idx] = 0;
+      ::new (&_pending[idx]) Atomic<uint>{};
+      ::new (&_ready[idx]) Atomic<uint>{};
+      idx++;
+    }
+  }
+
+  // Destinations are always in the same queue as their sources, and the
+  // destination ranges of the regions in a queue are monotonic. So the
+  // sources of a region form a contiguous range in _regions too.
+  for (idx = 0; idx < _num_regions; idx++) {
+    G1HeapRegion* hr = _regions[idx];
+    uint first = index_of[collector->first_destination(hr)];
+    uint last = index_of[collector->last_destination(hr)];
+    assert(first <= last && last <= idx, "must only compact downwards");
+
+    for (uint dest = first; dest <= last; dest++) {
+      if (dest != idx) {
+        _first_source[dest] = MIN2(_first_source[dest], idx);
+        _last_source[dest] = idx;
+      }
+    }
+
+    uint pending = last - first + (last == idx ? 0 : 1);
+    _pending[idx].store_relaxed(pending);
+    if (pending == 0) {
+      make_ready(idx);
+    }
+  }
+
+  FREE_C_HEAP_ARRAY(uint, index_of);
+}
+
+G1FullGCCompactionSchedule::~G1FullGCCompactionSchedule() {
+  FREE_C_HEAP_ARRAY(G1HeapRegion*, _regions);
+  FREE_C_HEAP_ARRAY(uint, _first_source);
+  FREE_C_HEAP_ARRAY(uint, _last_source);
+  FREE_C_HEAP_ARRAY(Atomic<uint>, _pending);
+  FREE_C_HEAP_ARRAY(Atomic<uint>, _ready);
+}
+
+void G1FullGCCompactionSchedule::make_ready(uint idx) {
+  uint slot = _num_ready.fetch_then_add(1u);
+  assert(slot < _num_regions, "region made ready twice");
+  _ready[slot].release_store(idx + 1);
+}
+
+bool G1FullGCCompactionSchedule::claim(uint& idx) {
+  uint slot = _num_claimed.fetch_then_add(1u);
+  if (slot >= _num_regions) {
+    return false;
+  }
+
+  // Every region is eventually made ready, as the first uncompacted region
+  // of each queue has no pending destinations.
+  SpinYield spin;
+  uint value;
+  while ((value = _ready[slot].load_acquire()) == 0) {
+    spin.wait();
+  }
+  idx = value - 1;
+  return true;
+}
+
+void G1FullGCCompactionSchedule::compacted(uint idx) {
+  if (_first_source[idx] == UINT_MAX) {
+    // Nothing is copied into this region.
+    return;
+  }
+
+  for (uint src = _first_source[idx]; src <= _last_source[idx]; src++) {
+    if (src != idx && _pending[src].sub_then_fetch(1u) == 0) {
+      make_ready(src);
+    }
+  }
+}
+
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+  G1FullGCTask("G1 Compact Task", collector),
+  _collector(collector),
+  _claimer(collector->workers()),
+  _g1h(G1CollectedHeap::heap()),
+  _schedule(nullptr) {
+  if (collector->records_destinations()) {
+    _schedule = new G1FullGCCompactionSchedule(collector);
+  }
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  delete _schedule;
+}
+
 void G1FullGCCompactTask::G1CompactRegionClosure::clear_in_bitmap(oop obj) {
   assert(_bitmap->is_marked(obj), "Should only compact marked objects");
   _bitmap->clear(obj);
@@ -85,8 +210,21 @@ void G1FullGCCompactTask::compact_region(G1HeapRegion* hr) {
   hr->reset_compacted_after_full_gc(_collector->compaction_top(hr));
 }
 
+void G1FullGCCompactTask::compact_scheduled_regions() {
+  uint idx;
+  while (_schedule->claim(idx)) {
+    compact_region(_schedule->region(idx));
+    _schedule->compacted(idx);
+  }
+}
+
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
+  if (_schedule != nullptr) {
+    compact_scheduled_regions();
+    return;
+  }
+
   GrowableArray<G1HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
   for (GrowableArrayIterator<G1HeapRegion*> it = compaction_queue->begin();
        it != compaction_queue->end();
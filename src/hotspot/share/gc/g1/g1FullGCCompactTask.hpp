@@ -30,28 +30,68 @@
 #include "gc/g1/g1FullGCTask.hpp"
 #include "gc/g1/g1HeapRegionManager.hpp"
 #include "gc/shared/referenceProcessor.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 
 class G1CollectedHeap;
 class G1CMBitMap;
 class G1FullCollector;
 
+// Order in which the regions of the parallel compaction queues may be
+// compacted by any worker. A region becomes ready once all other regions
+// its live objects are copied into have been compacted themselves, i.e.
+// their own live objects have been moved out of the way. Live objects are
+// only ever moved towards the front of a queue, so the first uncompacted
+// region of a queue is always ready.
+class G1FullGCCompactionSchedule : public CHeapObj<mtGC> {
+  uint _num_regions;
+  // All regions of the parallel compaction queues, queue by queue.
+  G1HeapRegion** _regions;
+  // First and last index into _regions of the regions that copy live
+  // objects into a region.
+  uint* _first_source;
+  uint* _last_source;
+  // Number of destination regions still to be compacted before a region
+  // can be compacted.
+  Atomic<uint>* _pending;
+  // Indexes into _regions plus one of the regions that are ready, in the
+  // order they became ready. Zero marks a slot that is claimed but not yet
+  // published.
+  Atomic<uint>* _ready;
+  Atomic<uint> _num_ready;
+  Atomic<uint> _num_claimed;
+
+  void make_ready(uint idx);
+
+public:
+  G1FullGCCompactionSchedule(G1FullCollector* collector);
+  ~G1FullGCCompactionSchedule();
+
+  // Claims the next ready region, waiting for it to become ready if needed.
+  // Returns false if all regions have been claimed.
+  bool claim(uint& idx);
+  G1HeapRegion* region(uint idx) const { return _regions[idx]; }
+  // Makes the regions whose last pending destination was the given region
+  // ready.
+  void compacted(uint idx);
+};
+
 class G1FullGCCompactTask : public G1FullGCTask {
   G1FullCollector* _collector;
   G1HeapRegionClaimer _claimer;
   G1CollectedHeap* _g1h;
+  G1FullGCCompactionSchedule* _schedule;
 
   void compact_region(G1HeapRegion* hr);
+  void compact_scheduled_regions();
   void compact_humongous_obj(G1HeapRegion* hr);
   void free_non_overlapping_regions(uint src_start_idx, uint dest_start_idx, uint num_regions);
 
   static void copy_object_to_new_location(oop obj);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _collector(collector),
-    _claimer(collector->workers()),
-    _g1h(G1CollectedHeap::heap()) { }
+  G1FullGCCompactTask(G1FullCollector* collector);
+  ~G1FullGCCompactTask();
 
   void work(uint worker_id);
   void serial_compaction();
@@ -75,7 +75,7 @@ void G1FullGCMarker::complete_marking(G1ScannerTasksQueueSet* task_queues,
   do {
     process_marking_stacks();
     ScannerTask stolen_task;
-    if (task_queues->steal(_worker_id, stolen_task)) {
+    if (task_queues->steal_batch(_worker_id, stolen_task, GCStealBatchSize)) {
       dispatch_task(stolen_task, true);
     }
   } while (!is_task_queue_empty() || !terminator->offer_termination());
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1FULLGCOOPCLOSURES_HPP
 #define SHARE_GC_G1_G1FULLGCOOPCLOSURES_HPP
 
+#include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/verifyOption.hpp"
 #include "memory/iterator.hpp"
 
@@ -63,7 +64,9 @@ class G1MarkAndPushClosure : public ClaimMetadataVisitingOopIterateClosure {
   uint _worker_id;
 
 public:
-  G1MarkAndPushClosure(uint worker_id, G1FullGCMarker* marker, int claim, ReferenceDiscoverer* ref) :
+  typedef ReferenceProcessor ReferenceDiscovererType;
+
+  G1MarkAndPushClosure(uint worker_id, G1FullGCMarker* marker, int claim, ReferenceProcessor* ref) :
     ClaimMetadataVisitingOopIterateClosure(claim, ref),
     _marker(marker),
     _worker_id(worker_id) { }
@@ -113,8 +113,16 @@ size_t G1FullGCPrepareTask::G1PrepareCompactLiveClosure::apply(oop object) {
 }
 
 void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(G1HeapRegion* hr) {
+  uint first_idx = _cp->current_region()->hrm_index();
   if (!_collector->is_free(hr->hrm_index())) {
     G1PrepareCompactLiveClosure prepare_compact(_cp);
     hr->apply_to_marked_objects(_bitmap, &prepare_compact);
   }
+  if (_collector->records_destinations()) {
+    // The compaction point only moves forward, so the live objects of this
+    // region end up somewhere between the current region before and after
+    // forwarding them. Free regions get that (empty) range too, which keeps
+    // the ranges of consecutive regions in a queue monotonic.
+    _collector->set_destinations(hr, first_idx, _cp->current_region()->hrm_index());
+  }
 }
@@ -126,6 +126,8 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
 
   _gc_par_phases[OptCodeRoots]->create_thread_work_items("Scanned Nmethods:", CodeRootsScannedNMethods);
 
+  _gc_par_phases[ObjCopy]->create_thread_work_items("Prefetched Tasks:", ObjCopyPrefetchedTasks);
+
   _gc_par_phases[MergePSS]->create_thread_work_items("Copied Bytes:", MergePSSCopiedBytes);
   _gc_par_phases[MergePSS]->create_thread_work_items("LAB Waste:", MergePSSLABWasteBytes);
   _gc_par_phases[MergePSS]->create_thread_work_items("LAB Undo Waste:", MergePSSLABUndoWasteBytes);
@@ -163,6 +165,9 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _gc_par_phases[ResetMarkingState] = new WorkerDataArray<double>("ResetMarkingState", "Reset Marking State (ms):", max_gc_threads);
   _gc_par_phases[NoteStartOfMark] = new WorkerDataArray<double>("NoteStartOfMark", "Note Start Of Mark (ms):", max_gc_threads);
 
+  _gc_par_phases[FullGCPhantomRefs] = new WorkerDataArray<double>("FullGCPhantomRefs", "Full GC Phantom References (ms):", max_gc_threads);
+  _gc_par_phases[FullGCWeakProcessing] = new WorkerDataArray<double>("FullGCWeakProcessing", "Full GC Weak Processing (ms):", max_gc_threads);
+
   reset();
 }
 
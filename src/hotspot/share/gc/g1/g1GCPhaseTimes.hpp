@@ -89,6 +89,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     ProcessEvacuationFailedRegions,
     ResetMarkingState,
     NoteStartOfMark,
+    FullGCPhantomRefs,
+    FullGCWeakProcessing,
     GCParPhasesSentinel
   };
 
@@ -134,6 +136,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     CodeRootsScannedNMethods
   };
 
+  enum GCObjCopyWorkItems {
+    ObjCopyPrefetchedTasks
+  };
+
   enum GCMergePSSWorkItems {
     MergePSSCopiedBytes,
     MergePSSLABSize,
@@ -395,6 +401,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     return _cur_merge_refinement_table_time_ms;
   }
 
+  double cur_ref_proc_time_ms() const {
+    return _cur_ref_proc_time_ms;
+  }
+
   double cur_resize_heap_time_ms() {
     return _cur_resize_heap_time_ms;
   }
@@ -134,6 +134,7 @@ void G1HeapRegion::hr_clear(bool clear_space) {
   _parsable_bottom.store_relaxed(bottom());
   _garbage_bytes.store_relaxed(0);
   _incoming_refs = 0;
+  _discovered_refs = 0;
 
   if (clear_space) clear(SpaceDecorator::Mangle);
 }
@@ -256,6 +257,7 @@ G1HeapRegion::G1HeapRegion(uint hrm_index,
   _parsable_bottom(nullptr),
   _garbage_bytes(0),
   _incoming_refs(0),
+  _discovered_refs(0),
   _young_index_in_cset(InvalidCSetIndex),
   _surv_rate_group(nullptr),
   _age_index(G1SurvRateGroup::InvalidAgeIndex),
@@ -296,6 +298,7 @@ void G1HeapRegion::report_region_type_change(G1HeapRegionTraceType::Type to) {
 
   _garbage_bytes.store_relaxed(0);
   _incoming_refs = 0;
+  _discovered_refs = 0;
 }
 
 void G1HeapRegion::note_self_forward_chunk_done(size_t garbage_bytes) {
@@ -241,6 +241,10 @@ class G1HeapRegion : public CHeapObj<mtGC> {
   // marking. We we do not mark through all objects, so this is an estimate.
   size_t _incoming_refs;
 
+  // Number of References in this region discovered by the last concurrent
+  // marking. Used to estimate the Reference processing cost of evacuating it.
+  size_t _discovered_refs;
+
   // Data for young region survivor prediction.
   uint  _young_index_in_cset;
   G1SurvRateGroup* _surv_rate_group;
@@ -345,6 +349,7 @@ class G1HeapRegion : public CHeapObj<mtGC> {
   }
 
   size_t incoming_refs() { return _incoming_refs; }
+  size_t discovered_refs() const { return _discovered_refs; }
 
   inline bool is_collection_set_candidate() const;
 
@@ -359,8 +364,9 @@ class G1HeapRegion : public CHeapObj<mtGC> {
   // marking the heap.
 
   // Notify the region that concurrent marking has finished. Passes TAMS, the number of
-  // bytes marked between bottom and TAMS, and the estimate for incoming references.
-  inline void note_end_of_marking(HeapWord* top_at_mark_start, size_t marked_bytes, size_t incoming_refs);
+  // bytes marked between bottom and TAMS, the estimate for incoming references and
+  // the number of discovered References.
+  inline void note_end_of_marking(HeapWord* top_at_mark_start, size_t marked_bytes, size_t incoming_refs, size_t discovered_refs);
 
   // Notify the region that scrubbing has completed.
   inline void note_end_of_scrubbing();
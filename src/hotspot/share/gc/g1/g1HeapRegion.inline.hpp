@@ -156,6 +156,7 @@ inline void G1HeapRegion::reset_after_full_gc_common() {
   _garbage_bytes.store_relaxed(0);
 
   _incoming_refs = 0;
+  _discovered_refs = 0;
 
   // Clear unused heap memory in debug builds.
   if (ZapUnusedHeapArea) {
@@ -266,12 +267,13 @@ inline void G1HeapRegion::reset_parsable_bottom() {
   _parsable_bottom.release_store(bottom());
 }
 
-inline void G1HeapRegion::note_end_of_marking(HeapWord* top_at_mark_start, size_t marked_bytes, size_t incoming_refs) {
+inline void G1HeapRegion::note_end_of_marking(HeapWord* top_at_mark_start, size_t marked_bytes, size_t incoming_refs, size_t discovered_refs) {
   assert_at_safepoint();
 
   if (top_at_mark_start != bottom()) {
     _garbage_bytes.store_relaxed(byte_size(bottom(), top_at_mark_start) - marked_bytes);
     _incoming_refs = incoming_refs;
+    _discovered_refs = discovered_refs;
   }
 
   if (needs_scrubbing()) {
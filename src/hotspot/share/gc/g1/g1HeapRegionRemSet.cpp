@@ -124,8 +124,8 @@ void G1HeapRegionRemSet::remove_code_root(nmethod* nm) {
   guarantee(!_code_roots.contains(nm), "duplicate entry found");
 }
 
-void G1HeapRegionRemSet::bulk_remove_code_roots() {
-  _code_roots.bulk_remove();
+size_t G1HeapRegionRemSet::bulk_remove_code_roots() {
+  return _code_roots.bulk_remove();
 }
 
 void G1HeapRegionRemSet::code_roots_do(NMethodClosure* blk) const {
@@ -180,7 +180,7 @@ class G1HeapRegionRemSet : public CHeapObj<mtGC> {
   // the heap region that owns this RSet.
   void add_code_root(nmethod* nm);
   void remove_code_root(nmethod* nm);
-  void bulk_remove_code_roots();
+  size_t bulk_remove_code_roots();
 
   // Applies blk->do_nmethod() to each of the entries in _code_roots
   void code_roots_do(NMethodClosure* blk) const;
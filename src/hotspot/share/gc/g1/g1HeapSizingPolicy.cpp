@@ -42,7 +42,10 @@ G1HeapSizingPolicy::G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analy
   // being 0.0, i.e. lower than any threshold.
   _gc_cpu_usage_deviation_counter((G1CPUUsageExpandThreshold / 2) + 1),
   _recent_cpu_usage_deltas(long_term_count_limit()),
-  _long_term_count(0) {
+  _long_term_count(0),
+  _controller_has_sample(false),
+  _controller_integral(0.0),
+  _controller_prev_error(0.0) {
 }
 
 void G1HeapSizingPolicy::reset_cpu_usage_tracking_data() {
@@ -180,35 +183,103 @@ size_t G1HeapSizingPolicy::young_collection_shrink_amount(double cpu_usage_delta
                                               max_scale_factor);
   assert(scale_factor <= max_scale_factor, "must be");
 
+  uint target_regions_to_shrink = shrinkable_regions(allocation_word_size);
+
+  size_t resize_bytes = (double)G1HeapRegion::GrainBytes * target_regions_to_shrink * scale_factor;
+
+  log_debug(gc, ergo, heap)("Shrink log: scale factor %1.2f%% "
+                            "total free regions %u "
+                            "base targeted for shrinking %u "
+                            "resize_bytes %zd ( %zu regions)",
+                            scale_factor * 100.0,
+                            _g1h->num_free_regions(),
+                            target_regions_to_shrink,
+                            resize_bytes,
+                            (resize_bytes / G1HeapRegion::GrainBytes));
+
+  return resize_bytes;
+}
+
+uint G1HeapSizingPolicy::shrinkable_regions(size_t allocation_word_size) const {
   // We are at the end of GC, so free regions are at maximum. Do not try to shrink
   // to have less than the reserve or the number of regions we are most certainly
   // going to use during this mutator phase.
-  uint target_regions_to_shrink = _g1h->num_free_regions();
+  uint free_regions = _g1h->num_free_regions();
 
   uint needed_for_allocation = _g1h->eden_target_length();
   if (_g1h->is_humongous(allocation_word_size)) {
     needed_for_allocation += (uint) _g1h->humongous_obj_size_in_regions(allocation_word_size);
   }
 
-  if (target_regions_to_shrink >= needed_for_allocation) {
-    target_regions_to_shrink -= needed_for_allocation;
+  return free_regions - MIN2(free_regions, needed_for_allocation);
+}
+
+size_t G1HeapSizingPolicy::controller_resize_amount(bool& expand, size_t allocation_word_size) {
+  // Limit the accumulated error so that a long period at a resize limit does
+  // not cause a large overshoot once the limit is lifted.
+  const double IntegralLimit = 4.0;
+
+  expand = false;
+
+  const double short_term_gc_cpu_usage = _analytics->short_term_gc_time_ratio();
+  const double gc_cpu_usage_target = scale_with_heap(1.0 / (1.0 + GCTimeRatio));
+
+  const size_t committed_bytes = _g1h->capacity();
+  const size_t ceiling_bytes = clamp((size_t)(_g1h->max_capacity() * (G1HeapSizingMaxCommittedPercent / 100.0)),
+                                     _g1h->min_capacity(),
+                                     _g1h->max_capacity());
+  const size_t max_shrink_bytes = (size_t)shrinkable_regions(allocation_word_size) * G1HeapRegion::GrainBytes *
+                                  G1ShrinkByPercentOfAvailable / 100;
+
+  // Ignore very first sample as it is garbage.
+  if (!_controller_has_sample) {
+    _controller_has_sample = true;
+    return 0;
+  }
+
+  // Bound the error so that a single outlier does not dominate the response.
+  const double error = clamp(rel_diff(short_term_gc_cpu_usage, gc_cpu_usage_target), -1.0, 1.0);
+  _controller_integral = clamp(_controller_integral + error, -IntegralLimit, IntegralLimit);
+  const double derivative = error - _controller_prev_error;
+  _controller_prev_error = error;
+
+  const double output = G1HeapSizingProportionalGain * error +
+                        G1HeapSizingIntegralGain * _controller_integral +
+                        G1HeapSizingDerivativeGain * derivative;
+
+  size_t resize_bytes = 0;
+  if (committed_bytes > ceiling_bytes) {
+    // Above the memory limit; shrink towards it regardless of GC CPU usage, and
+    // do not keep any accumulated need for expansion.
+    resize_bytes = MIN2(committed_bytes - ceiling_bytes, max_shrink_bytes);
+    _controller_integral = MIN2(_controller_integral, 0.0);
+  } else if (output > 0.0) {
+    expand = true;
+    resize_bytes = MIN2((size_t)(committed_bytes * output), ceiling_bytes - committed_bytes);
   } else {
-    target_regions_to_shrink = 0;
+    resize_bytes = MIN2((size_t)(committed_bytes * -output), max_shrink_bytes);
   }
 
-  size_t resize_bytes = (double)G1HeapRegion::GrainBytes * target_regions_to_shrink * scale_factor;
+  // Avoid resizing by less than a region.
+  if (resize_bytes < G1HeapRegion::GrainBytes) {
+    resize_bytes = 0;
+  }
 
-  log_debug(gc, ergo, heap)("Shrink log: scale factor %1.2f%% "
-                            "total free regions %u "
-                            "needed for alloc %u "
-                            "base targeted for shrinking %u "
-                            "resize_bytes %zd ( %zu regions)",
-                            scale_factor * 100.0,
-                            _g1h->num_free_regions(),
-                            needed_for_allocation,
-                            target_regions_to_shrink,
+  log_debug(gc, ergo, heap)("Heap resize controller: "
+                            "short term GC CPU usage %1.2f%% GC CPU usage target %1.2f%% "
+                            "error %1.2f integral %1.2f derivative %1.2f output %1.2f "
+                            "committed %zuB ceiling %zuB max shrink %zuB resize by %zuB expand %s",
+                            short_term_gc_cpu_usage * 100.0,
+                            gc_cpu_usage_target * 100.0,
+                            error,
+                            _controller_integral,
+                            derivative,
+                            output,
+                            committed_bytes,
+                            ceiling_bytes,
+                            max_shrink_bytes,
                             resize_bytes,
-                            (resize_bytes / G1HeapRegion::GrainBytes));
+                            BOOL_TO_STR(expand));
 
   return resize_bytes;
 }
@@ -217,6 +288,10 @@ size_t G1HeapSizingPolicy::young_collection_resize_amount(bool& expand, size_t a
   assert(GCTimeRatio > 0, "must be");
   expand = false;
 
+  if (G1UseHeapSizingController) {
+    return controller_resize_amount(expand, allocation_word_size);
+  }
+
   const double long_term_gc_cpu_usage = _analytics->long_term_gc_time_ratio();
   const double short_term_gc_cpu_usage = _analytics->short_term_gc_time_ratio();
 
@@ -63,6 +63,15 @@ class G1CollectedHeap;
 // The mechanism is meant to filter out short term events because heap resizing
 // has some overhead.
 //
+// Alternatively, with G1UseHeapSizingController, young collections resize the
+// heap using a PID controller. Its error is the relative deviation of the
+// short-term GC CPU usage from the target, and its output is the fraction of
+// the committed heap to expand (positive) or shrink (negative) by. Expansion
+// is limited by G1HeapSizingMaxCommittedPercent of the maximum heap size, and
+// a committed heap above that limit is shrunk towards it. Shrinking is limited
+// by the regions that are free right after the collection, and the regions
+// themselves are uncommitted concurrently afterwards.
+//
 // For full collections, we base resize decisions only on Min/MaxHeapFreeRatio.
 //
 class G1HeapSizingPolicy: public CHeapObj<mtGC> {
@@ -77,6 +86,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   TruncatedSeq _recent_cpu_usage_deltas;
   uint _long_term_count;
 
+  // State of the heap sizing controller.
+  bool _controller_has_sample;
+  double _controller_integral;
+  double _controller_prev_error;
+
   // Clear GC CPU usage tracking data used by young_collection_resize_amount().
   void reset_cpu_usage_tracking_data();
   // Decay (move towards "no changes") GC CPU usage tracking data.
@@ -92,6 +106,13 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   size_t young_collection_expand_amount(double cpu_usage_delta) const;
   size_t young_collection_shrink_amount(double cpu_usage_delta, size_t allocation_word_size) const;
 
+  // Number of free regions that may be uncommitted without affecting the
+  // upcoming mutator phase.
+  uint shrinkable_regions(size_t allocation_word_size) const;
+
+  // Resize amount as determined by the heap sizing controller.
+  size_t controller_resize_amount(bool& expand, size_t allocation_word_size);
+
   G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 public:
 
@@ -253,6 +253,14 @@ void G1NUMA::copy_statistics(G1NUMAStats::NodeDataItems phase,
   _stats->copy(phase, requested_node_index, allocated_stat);
 }
 
+void G1NUMA::add_copied_bytes_statistics(size_t copied_bytes, size_t remote_copied_bytes) {
+  if (_stats == nullptr) {
+    return;
+  }
+
+  _stats->add_copied_bytes(copied_bytes, remote_copied_bytes);
+}
+
 void G1NUMA::print_statistics() const {
   if (_stats == nullptr) {
     return;
@@ -123,6 +123,10 @@ class G1NUMA: public CHeapObj<mtGC> {
   // Precondition: allocated_stat should have same length of active nodes.
   void copy_statistics(G1NUMAStats::NodeDataItems phase, uint requested_node_index, size_t* allocated_stat);
 
+  // Add the number of bytes copied during evacuation, and how many of them were
+  // copied by a worker on another node than the destination.
+  void add_copied_bytes_statistics(size_t copied_bytes, size_t remote_copied_bytes);
+
   // Print all statistics.
   void print_statistics() const;
 };
@@ -119,7 +119,8 @@ void G1NUMAStats::NodeDataArray::copy(uint req_index, size_t* stat) {
 }
 
 G1NUMAStats::G1NUMAStats(const uint* node_ids, uint num_node_ids) :
-  _node_ids(node_ids), _num_node_ids(num_node_ids), _node_data() {
+  _node_ids(node_ids), _num_node_ids(num_node_ids), _node_data(),
+  _copied_bytes(0), _remote_copied_bytes(0) {
 
   assert(_num_node_ids > 1, "Should have at least one node id: %u", _num_node_ids);
 
@@ -150,6 +151,11 @@ void G1NUMAStats::copy(G1NUMAStats::NodeDataItems phase,
   _node_data[phase]->copy(requested_node_index, allocated_stat);
 }
 
+void G1NUMAStats::add_copied_bytes(size_t copied_bytes, size_t remote_copied_bytes) {
+  _copied_bytes += copied_bytes;
+  _remote_copied_bytes += remote_copied_bytes;
+}
+
 static const char* phase_to_explanatory_string(G1NUMAStats::NodeDataItems phase) {
   switch(phase) {
     case G1NUMAStats::NewRegionAlloc:
@@ -221,9 +227,20 @@ void G1NUMAStats::print_mutator_alloc_stat_debug() {
   }
 }
 
+void G1NUMAStats::print_copied_bytes() {
+  LogTarget(Info, gc, heap, numa) lt;
+
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    double rate = _copied_bytes == 0 ? 0.0 : (double)_remote_copied_bytes / _copied_bytes * 100;
+    ls.print_cr("Remote copy ratio: " RATE_TOTAL_FORMAT " bytes", rate, _remote_copied_bytes, _copied_bytes);
+  }
+}
+
 void G1NUMAStats::print_statistics() {
   print_info(NewRegionAlloc);
   print_mutator_alloc_stat_debug();
 
   print_info(LocalObjProcessAtCopyToSurv);
+  print_copied_bytes();
 }
@@ -96,8 +96,15 @@ class G1NUMAStats : public CHeapObj<mtGC> {
 
   NodeDataArray* _node_data[NodeDataItemsSentinel];
 
+  // Bytes copied during evacuation, and the part of them copied by a worker
+  // running on another node than the one of the destination.
+  size_t _copied_bytes;
+  size_t _remote_copied_bytes;
+
   void print_info(G1NUMAStats::NodeDataItems phase);
 
+  void print_copied_bytes();
+
   void print_mutator_alloc_stat_debug();
 
 public:
@@ -113,6 +120,8 @@ class G1NUMAStats : public CHeapObj<mtGC> {
   // Precondition: allocated_stat should have same length of active nodes.
   void copy(G1NUMAStats::NodeDataItems phase, uint requested_node_index, size_t* allocated_stat);
 
+  void add_copied_bytes(size_t copied_bytes, size_t remote_copied_bytes);
+
   void print_statistics();
 };
 
@@ -27,6 +27,7 @@
 
 #include "classfile/classLoaderData.hpp"
 #include "gc/g1/g1HeapRegionAttr.hpp"
+#include "gc/shared/referenceProcessor.hpp"
 #include "memory/iterator.hpp"
 #include "oops/markWord.hpp"
 
@@ -36,8 +37,8 @@ class G1ConcurrentMark;
 class G1CMBitMap;
 class G1ParScanThreadState;
 class G1ScanEvacuatedObjClosure;
+class G1CMReferenceDiscoverer;
 class G1CMTask;
-class ReferenceProcessor;
 
 class G1ScanClosureBase : public BasicOopIterateClosure {
 protected:
@@ -104,7 +105,9 @@ class G1ScanEvacuatedObjClosure : public G1ScanClosureBase {
   virtual void do_oop(oop* p)          { do_oop_work(p); }
   virtual void do_oop(narrowOop* p)    { do_oop_work(p); }
 
-  void set_ref_discoverer(ReferenceDiscoverer* rd) {
+  typedef ReferenceProcessor ReferenceDiscovererType;
+
+  void set_ref_discoverer(ReferenceProcessor* rd) {
     set_ref_discoverer_internal(rd);
   }
 
@@ -183,7 +186,9 @@ class G1CMOopClosure : public ClaimMetadataVisitingOopIterateClosure {
   G1CollectedHeap*   _g1h;
   G1CMTask*          _task;
 public:
-  G1CMOopClosure(G1CollectedHeap* g1h,G1CMTask* task);
+  typedef G1CMReferenceDiscoverer ReferenceDiscovererType;
+
+  G1CMOopClosure(G1CollectedHeap* g1h, G1CMTask* task, G1CMReferenceDiscoverer* rd);
   template <class T> void do_oop_work(T* p);
   virtual void do_oop(      oop* p) { do_oop_work(p); }
   virtual void do_oop(narrowOop* p) { do_oop_work(p); }
@@ -59,7 +59,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
                                            uint worker_id,
                                            uint num_workers,
                                            G1CollectionSet* collection_set,
-                                           G1EvacFailureRegions* evac_failure_regions)
+                                           G1EvacFailureRegions* evac_failure_regions,
+                                           Atomic<uint>* worker_node_indexes)
   : _g1h(g1h),
     _task_queue(g1h->task_queue(worker_id)),
     _ct(g1h->refinement_table()),
@@ -69,6 +70,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _tenuring_threshold(g1h->policy()->tenuring_threshold()),
     _scanner(g1h, this),
     _worker_id(worker_id),
+    _prefetch_distance(G1EvacPrefetchDistance),
+    _num_prefetched_tasks(0),
     _num_cards_marked_dirty(0),
     _num_cards_marked_to_cset(0),
     _stack_trim_upper_threshold(GCDrainStackTargetSize * 2 + 1),
@@ -83,11 +86,17 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _max_num_optional_regions(collection_set->num_optional_regions()),
     _numa(g1h->numa()),
     _obj_alloc_stat(nullptr),
+    _copied_bytes(0),
+    _remote_copied_bytes(0),
+    _node_index(G1NUMA::UnknownNodeIndex),
+    _worker_node_indexes(worker_node_indexes),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _evacuation_failed_info(),
     _evac_failure_regions(evac_failure_regions),
     _num_cards_from_evac_failure(0)
 {
+  assert(_prefetch_distance <= PrefetchRingMax, "invariant");
+
   // We allocate number of young gen regions in the collection set plus one
   // entries, since entry 0 keeps track of surviving bytes for non-young regions.
   // We also add a few elements at the beginning and at the end in
@@ -279,6 +288,11 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task, bool stolen) {
 // inlining into steal_and_trim_queue.
 ATTRIBUTE_FLATTEN NOINLINE
 void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
+  if (_prefetch_distance > 0) {
+    trim_queue_to_threshold_prefetch(threshold);
+    return;
+  }
+
   ScannerTask task;
   do {
     while (_task_queue->pop_overflow(task)) {
@@ -292,10 +306,121 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
   } while (!_task_queue->overflow_empty());
 }
 
+inline bool G1ParScanThreadState::prefetch_task(ScannerTask task) const {
+  oop obj;
+  if (task.is_narrow_oop_ptr()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_narrow_oop_ptr());
+  } else if (task.is_oop_ptr()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_oop_ptr());
+  } else {
+    // Partial array tasks refer to an already copied array
+    return false;
+  }
+
+  // Prefetch the header, which is read for the forwarding check, and the
+  // rest of the first cache line of the object, which is copied first.
+  Prefetch::read(obj, 0);
+  Prefetch::read(obj, DEFAULT_CACHE_LINE_SIZE);
+  return true;
+}
+
+// Same as trim_queue_to_threshold(), but a popped task is held back in a
+// small ring while the object it refers to is prefetched, and processed
+// when _prefetch_distance more tasks have been popped. This overlaps the
+// cache misses on the object headers with the copying of other objects.
+ATTRIBUTE_FLATTEN NOINLINE
+void G1ParScanThreadState::trim_queue_to_threshold_prefetch(uint threshold) {
+  ScannerTask ring[PrefetchRingMax];
+  uint head = 0;
+  uint count = 0;
+
+  ScannerTask task;
+  do {
+    while (_task_queue->pop_overflow(task)) {
+      if (!_task_queue->try_push_to_taskqueue(task)) {
+        dispatch_task(task, false);
+      }
+    }
+    while (_task_queue->pop_local(task, threshold)) {
+      if (!prefetch_task(task)) {
+        dispatch_task(task, false);
+        continue;
+      }
+
+      _num_prefetched_tasks++;
+
+      if (count < _prefetch_distance) {
+        // Fill the ring
+        ring[(head + count) % _prefetch_distance] = task;
+        count++;
+        continue;
+      }
+
+      // Process the oldest prefetched task, and replace it with the new one
+      const ScannerTask oldest = ring[head];
+      ring[head] = task;
+      head = (head + 1) % _prefetch_distance;
+      dispatch_task(oldest, false);
+    }
+
+    // Process the remaining prefetched tasks, which may push new tasks
+    for (; count > 0; count--) {
+      dispatch_task(ring[head], false);
+      head = (head + 1) % _prefetch_distance;
+    }
+  } while (!_task_queue->overflow_empty() || _task_queue->size() > threshold);
+}
+
+void G1ParScanThreadState::record_node_index() {
+  _node_index = _numa->index_of_current_thread();
+  if (_worker_node_indexes != nullptr) {
+    _worker_node_indexes[_worker_id].store_relaxed(_node_index);
+  }
+}
+
+bool G1ParScanThreadState::steal_node_affine(G1ScannerTasksQueueSet* task_queues, ScannerTask& t) {
+  uint const num_queues = task_queues->size();
+  uint remote_queue = _worker_id;
+  uint remote_queue_size = 0;
+
+  // Try the queues of the workers on the same node first, remembering the
+  // largest queue on another node.
+  for (uint i = 1; i < num_queues; i++) {
+    uint const queue_id = (_worker_id + i) % num_queues;
+    G1ScannerTasksQueue* const queue = task_queues->queue(queue_id);
+    uint const size = queue->size();
+    if (size == 0) {
+      continue;
+    }
+    if (_worker_node_indexes[queue_id].load_relaxed() == _node_index) {
+      if (queue->pop_global(t) == G1ScannerTasksQueue::PopResult::Success) {
+        return true;
+      }
+    } else if (size > remote_queue_size) {
+      remote_queue = queue_id;
+      remote_queue_size = size;
+    }
+  }
+
+  // Only take work from another node if its worker is sufficiently behind;
+  // smaller amounts of work are left to be drained by their owner.
+  if (remote_queue_size >= G1NUMARemoteStealThreshold) {
+    return task_queues->queue(remote_queue)->pop_global(t) == G1ScannerTasksQueue::PopResult::Success;
+  }
+  return false;
+}
+
+bool G1ParScanThreadState::steal(G1ScannerTasksQueueSet* task_queues, ScannerTask& t) {
+  if (_worker_node_indexes != nullptr && _node_index != G1NUMA::UnknownNodeIndex) {
+    return steal_node_affine(task_queues, t);
+  }
+  return task_queues->steal_batch(_worker_id, t, GCStealBatchSize);
+}
+
 ATTRIBUTE_FLATTEN
 void G1ParScanThreadState::steal_and_trim_queue(G1ScannerTasksQueueSet* task_queues) {
   ScannerTask stolen_task;
-  while (task_queues->steal(_worker_id, stolen_task)) {
+  while (steal(task_queues, stolen_task)) {
     dispatch_task(stolen_task, true);
     // Processing stolen task may have added tasks to our queue.
     trim_queue();
@@ -535,6 +660,8 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
       _surviving_young_words[young_index] += word_sz;
     }
 
+    update_numa_copy_stats(node_index, word_sz);
+
     if (dest_attr.is_young()) {
       if (age < markWord::max_age) {
         age++;
@@ -578,7 +705,8 @@ G1ParScanThreadState* G1ParScanThreadStateSet::state_for_worker(uint worker_id)
                                worker_id,
                                _num_workers,
                                _collection_set,
-                               _evac_failure_regions);
+                               _evac_failure_regions,
+                               _worker_node_indexes);
   }
   return _states[worker_id];
 }
@@ -605,6 +733,7 @@ void G1ParScanThreadStateSet::flush_stats() {
     size_t to_young_gen_cards = pss->num_cards_marked() - pss->num_cards_pending();
     size_t evac_failure_cards = pss->num_cards_from_evac_failure();
     size_t marked_cards = pss->num_cards_marked();
+    size_t prefetched_tasks = pss->num_prefetched_tasks();
 
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, copied_bytes, G1GCPhaseTimes::MergePSSCopiedBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_waste_bytes, G1GCPhaseTimes::MergePSSLABWasteBytes);
@@ -613,6 +742,7 @@ void G1ParScanThreadStateSet::flush_stats() {
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, to_young_gen_cards, G1GCPhaseTimes::MergePSSToYoungGenCards);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, evac_failure_cards, G1GCPhaseTimes::MergePSSEvacFail);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, marked_cards, G1GCPhaseTimes::MergePSSMarked);
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::ObjCopy, worker_id, prefetched_tasks, G1GCPhaseTimes::ObjCopyPrefetchedTasks);
 
     delete pss;
     _states[worker_id] = nullptr;
@@ -693,6 +823,7 @@ void G1ParScanThreadState::flush_numa_stats() {
   if (_obj_alloc_stat != nullptr) {
     uint node_index = _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
+    _numa->add_copied_bytes_statistics(_copied_bytes, _remote_copied_bytes);
   }
 }
 
@@ -702,6 +833,16 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+void G1ParScanThreadState::update_numa_copy_stats(uint node_index, size_t word_sz) {
+  if (_obj_alloc_stat != nullptr) {
+    size_t const byte_sz = word_sz * HeapWordSize;
+    _copied_bytes += byte_sz;
+    if (node_index != _node_index) {
+      _remote_copied_bytes += byte_sz;
+    }
+  }
+}
+
 #if TASKQUEUE_STATS
 
 PartialArrayTaskStats* G1ParScanThreadState::partial_array_task_stats() {
@@ -720,11 +861,18 @@ G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
     _surviving_young_words_total(NEW_C_HEAP_ARRAY(size_t, collection_set->young_region_length() + 1, mtGC)),
     _num_workers(num_workers),
     _flushed(false),
-    _evac_failure_regions(evac_failure_regions)
+    _evac_failure_regions(evac_failure_regions),
+    _worker_node_indexes(nullptr)
 {
   for (uint i = 0; i < num_workers; ++i) {
     _states[i] = nullptr;
   }
+  if (G1NUMAAffineEvacuation && g1h->numa()->num_active_nodes() > 1) {
+    _worker_node_indexes = NEW_C_HEAP_ARRAY(Atomic<uint>, num_workers, mtGC);
+    for (uint i = 0; i < num_workers; ++i) {
+      _worker_node_indexes[i].store_relaxed(G1NUMA::UnknownNodeIndex);
+    }
+  }
   memset(_surviving_young_words_total, 0, (collection_set->young_region_length() + 1) * sizeof(size_t));
 }
 
@@ -732,6 +880,7 @@ G1ParScanThreadStateSet::~G1ParScanThreadStateSet() {
   assert(_flushed, "thread local state from the per thread states should have been flushed");
   FREE_C_HEAP_ARRAY(G1ParScanThreadState*, _states);
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_total);
+  FREE_C_HEAP_ARRAY(Atomic<uint>, _worker_node_indexes);
 }
 
 #if TASKQUEUE_STATS
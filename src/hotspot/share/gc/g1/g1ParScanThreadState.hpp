@@ -37,6 +37,7 @@
 #include "gc/shared/taskqueue.hpp"
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/ticks.hpp"
 
 class G1CardTable;
@@ -63,6 +64,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
 
   uint _worker_id;
 
+  // Max number of tasks held back while their objects are being prefetched
+  static const uint PrefetchRingMax = 16;
+  uint const _prefetch_distance;
+  size_t _num_prefetched_tasks;
+
   size_t _num_cards_marked_dirty;
   size_t _num_cards_marked_to_cset;
 
@@ -95,6 +101,16 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Bytes copied, and bytes copied to another node than the one of this worker.
+  // Recorded together with _obj_alloc_stat.
+  size_t _copied_bytes;
+  size_t _remote_copied_bytes;
+
+  // Index of the NUMA node this worker runs on during evacuation.
+  uint _node_index;
+  // Node indexes of all workers, shared by the states of a G1ParScanThreadStateSet.
+  // Only set if G1NUMAAffineEvacuation is enabled on a multi-node system.
+  Atomic<uint>* _worker_node_indexes;
 
   // Per-thread evacuation failure data structures.
   ALLOCATION_FAILURE_INJECTOR_ONLY(size_t _allocation_failure_inject_counter;)
@@ -117,10 +133,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                        uint worker_id,
                        uint num_workers,
                        G1CollectionSet* collection_set,
-                       G1EvacFailureRegions* evac_failure_regions);
+                       G1EvacFailureRegions* evac_failure_regions,
+                       Atomic<uint>* worker_node_indexes);
   virtual ~G1ParScanThreadState();
 
-  void set_ref_discoverer(ReferenceDiscoverer* rd) { _scanner.set_ref_discoverer(rd); }
+  void set_ref_discoverer(ReferenceProcessor* rd) { _scanner.set_ref_discoverer(rd); }
 
 #ifdef ASSERT
   bool queue_is_empty() const { return _task_queue->is_empty(); }
@@ -163,6 +180,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // into the next collection set (e.g. survivors).
   size_t num_cards_marked() const;
 
+  // Number of tasks that were prefetched before being processed.
+  size_t num_prefetched_tasks() const { return _num_prefetched_tasks; }
+
   // Pass locally gathered statistics to global state. Returns the total number of
   // HeapWords copied.
   size_t flush_stats(size_t* surviving_young_words, uint num_workers);
@@ -222,12 +242,23 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
 
   void trim_queue_to_threshold(uint threshold);
 
+  // Prefetch the object referenced by task. Returns false for tasks that
+  // are not prefetched, and should be processed right away.
+  inline bool prefetch_task(ScannerTask task) const;
+  void trim_queue_to_threshold_prefetch(uint threshold);
+
   inline bool needs_partial_trimming() const;
 
   // NUMA statistics related methods.
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  inline void update_numa_copy_stats(uint node_index, size_t word_sz);
+
+  // Steal a task, preferring workers on the same NUMA node if
+  // G1NUMAAffineEvacuation is enabled.
+  bool steal(G1ScannerTasksQueueSet* task_queues, ScannerTask& t);
+  bool steal_node_affine(G1ScannerTasksQueueSet* task_queues, ScannerTask& t);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
@@ -236,6 +267,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   inline void trim_queue_partially();
   void steal_and_trim_queue(G1ScannerTasksQueueSet *task_queues);
 
+  // Record the NUMA node the current worker thread runs on. Must be called
+  // by the worker before it starts evacuating.
+  void record_node_index();
+
   Tickspan trim_ticks() const;
   void reset_trim_ticks();
 
@@ -259,6 +294,7 @@ class G1ParScanThreadStateSet : public StackObj {
   uint _num_workers;
   bool _flushed;
   G1EvacFailureRegions* _evac_failure_regions;
+  Atomic<uint>* _worker_node_indexes;
 
  public:
   G1ParScanThreadStateSet(G1CollectedHeap* g1h,
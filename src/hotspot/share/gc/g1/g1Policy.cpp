@@ -901,6 +901,17 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
       _analytics->report_cost_per_code_root_scan_ms(avg_time_code_root_scan / total_code_roots_scanned, is_young_only_pause);
     }
 
+    // Update prediction for Reference processing cost
+    size_t total_discovered_refs = 0;
+    for (int ref_type = REF_SOFT; ref_type <= REF_PHANTOM; ref_type++) {
+      total_discovered_refs += p->ref_phase_times()->ref_discovered((ReferenceType)ref_type);
+    }
+
+    if (total_discovered_refs >= G1NumReferencesCostSampleThreshold) {
+      double cost_per_ref_ms = p->cur_ref_proc_time_ms() / total_discovered_refs;
+      _analytics->report_cost_per_discovered_ref_ms(cost_per_ref_ms, is_young_only_pause);
+    }
+
     // Update prediction for copy cost per byte
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
 
@@ -1124,7 +1135,8 @@ double G1Policy::predict_gc_efficiency(G1HeapRegion* hr) {
 
   double total_based_on_incoming_refs_ms = predict_merge_scan_time(hr->incoming_refs()) + // We use the number of incoming references as an estimate for remset cards.
                                            predict_non_young_other_time_ms(1) +
-                                           predict_region_copy_time_ms(hr, false /* for_young_only_phase */);
+                                           predict_region_copy_time_ms(hr, false /* for_young_only_phase */) +
+                                           predict_region_ref_processing_time_ms(hr, false /* for_young_only_phase */);
 
   return hr->reclaimable_bytes() / total_based_on_incoming_refs_ms;
 }
@@ -1153,6 +1165,10 @@ double G1Policy::predict_region_copy_time_ms(G1HeapRegion* hr, bool for_young_on
   return _analytics->predict_object_copy_time_ms(bytes_to_copy, for_young_only_phase);
 }
 
+double G1Policy::predict_region_ref_processing_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const {
+  return _analytics->predict_ref_processing_time_ms(hr->discovered_refs(), for_young_only_phase);
+}
+
 double G1Policy::predict_merge_scan_time(size_t card_rs_length) const {
   size_t scan_card_num = _analytics->predict_scan_card_num(card_rs_length, false);
 
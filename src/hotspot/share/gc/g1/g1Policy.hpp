@@ -151,6 +151,9 @@ class G1Policy: public CHeapObj<mtGC> {
   double predict_region_copy_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const;
   // Code root scan time prediction for the given region.
   double predict_region_code_root_scan_time(G1HeapRegion* hr, bool for_young_only_phase) const;
+  // Predict the Reference processing time for the References discovered in this
+  // region during the last marking.
+  double predict_region_ref_processing_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const;
 
   double predict_merge_scan_time(size_t card_rs_length) const;
   // Predict other time for count young regions.
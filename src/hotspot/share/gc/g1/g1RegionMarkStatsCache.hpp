@@ -40,24 +40,29 @@
 //   between tams and top.
 // * the number of incoming references found during marking. This is an approximate
 //   value because we do not mark through all objects.
+// * the number of java.lang.ref.Reference instances discovered during marking.
 struct G1RegionMarkStats {
   Atomic<size_t> _live_words;
   Atomic<size_t> _incoming_refs;
+  Atomic<size_t> _discovered_refs;
 
   // Clear all members.
   void clear() {
     _live_words.store_relaxed(0);
     _incoming_refs.store_relaxed(0);
+    _discovered_refs.store_relaxed(0);
   }
   // Clear all members after a marking overflow. Only needs to clear the number of
-  // incoming references as all objects will be rescanned, while the live words are
-  // gathered whenever a thread can mark an object, which is synchronized.
+  // incoming and discovered references as all objects will be rescanned, while the
+  // live words are gathered whenever a thread can mark an object, which is synchronized.
   void clear_during_overflow() {
     _incoming_refs.store_relaxed(0);
+    _discovered_refs.store_relaxed(0);
   }
 
   size_t live_words() const { return _live_words.load_relaxed(); }
   size_t incoming_refs() const { return _incoming_refs.load_relaxed(); }
+  size_t discovered_refs() const { return _discovered_refs.load_relaxed(); }
 };
 
 // Per-marking thread cache for the region mark statistics.
@@ -128,6 +133,13 @@ class G1RegionMarkStatsCache {
     cur->_stats._incoming_refs.store_relaxed(cur->_stats.incoming_refs() + 1u);
   }
 
+  void inc_discovered_refs(uint region_idx) {
+    G1RegionMarkStatsCacheEntry* const cur = find_for_add(region_idx);
+    // This method is only ever called single-threaded, so we do not need atomic
+    // update here.
+    cur->_stats._discovered_refs.store_relaxed(cur->_stats.discovered_refs() + 1u);
+  }
+
   void reset(uint region_idx) {
     uint const cache_idx = hash(region_idx);
     G1RegionMarkStatsCacheEntry* cur = &_cache[cache_idx];
@@ -52,6 +52,10 @@ inline void G1RegionMarkStatsCache::evict(uint idx) {
     _target[cur->_region_idx]._incoming_refs.add_then_fetch(cur->_stats.incoming_refs());
   }
 
+  if (cur->_stats.discovered_refs() != 0) {
+    _target[cur->_region_idx]._discovered_refs.add_then_fetch(cur->_stats.discovered_refs());
+  }
+
   cur->clear();
 }
 
@@ -722,6 +722,7 @@ class G1EvacuateRegionsBaseTask : public WorkerTask {
       ResourceMark rm;
 
       G1ParScanThreadState* pss = _per_thread_states->state_for_worker(worker_id);
+      pss->record_node_index();
       pss->set_ref_discoverer(_g1h->ref_processor_stw());
 
       if (_pinned_regions_recorded.compare_set(false, true)) {
@@ -976,13 +977,22 @@ class G1STWRefProcProxyTask : public RefProcProxyTask {
     }
   };
 
+  // The pending list segments are spliced after all workers are done, so
+  // the cards can be recorded in the state of any worker.
+  G1EnqueueDiscoveredFieldClosure _splice_enqueue;
+
 public:
   G1STWRefProcProxyTask(uint max_workers, G1CollectedHeap& g1h, G1ParScanThreadStateSet& pss, G1ScannerTasksQueueSet& task_queues)
     : RefProcProxyTask("G1STWRefProcProxyTask", max_workers),
       _g1h(g1h),
       _pss(pss),
       _terminator(max_workers, &task_queues),
-      _task_queues(task_queues) {}
+      _task_queues(task_queues),
+      _splice_enqueue(&g1h, pss.state_for_worker(0)) {}
+
+  EnqueueDiscoveredFieldClosure* splice_enqueue() override {
+    return &_splice_enqueue;
+  }
 
   void work(uint worker_id) override {
     assert(worker_id < _max_workers, "sanity");
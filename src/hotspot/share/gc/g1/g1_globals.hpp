@@ -128,6 +128,23 @@
           "in milliseconds.")                                               \
           range(1.0, DBL_MAX)                                               \
                                                                             \
+  product(uint, G1EvacPrefetchDistance, 0, EXPERIMENTAL,                    \
+          "Number of popped evacuation tasks whose referenced objects "     \
+          "are prefetched before the tasks are processed. 0 processes "     \
+          "tasks as soon as they are popped.")                              \
+          range(0, 16)                                                      \
+                                                                            \
+  product(bool, G1FullGCOverlapPhantomRefs, false, EXPERIMENTAL,            \
+          "Process PhantomReferences during Full GC in the same parallel "  \
+          "task as the weak oops cleanup, instead of right after the "      \
+          "other references.")                                              \
+                                                                            \
+  product(bool, G1FullGCRegionParallelCompaction, false, EXPERIMENTAL,      \
+          "Let any worker compact any region during Full GC once the "      \
+          "regions its live objects are copied into have been "             \
+          "compacted, instead of compacting the regions of each "           \
+          "compaction queue in order by a single worker.")                  \
+                                                                            \
   product(uint, G1RefProcDrainInterval, 1000,                               \
           "The number of discovered reference objects to process before "   \
           "draining concurrent marking work queues.")                       \
@@ -193,6 +210,31 @@
           "bound of acceptable deviation range.")                           \
           constraint(G1CPUUsageShrinkConstraintFunc, AfterErgo)             \
                                                                             \
+  product(bool, G1UseHeapSizingController, false, EXPERIMENTAL,             \
+          "Resize the heap after young collections using a PID controller " \
+          "on the relative deviation of the GC CPU usage from its target, " \
+          "limited by G1HeapSizingMaxCommittedPercent, instead of the "     \
+          "threshold based heuristics.")                                    \
+                                                                            \
+  product(double, G1HeapSizingProportionalGain, 0.2, EXPERIMENTAL,          \
+          "Proportional gain of the heap sizing controller, as fraction "   \
+          "of the committed heap per relative GC CPU usage deviation.")     \
+          range(0.0, 10.0)                                                  \
+                                                                            \
+  product(double, G1HeapSizingIntegralGain, 0.05, EXPERIMENTAL,             \
+          "Integral gain of the heap sizing controller.")                   \
+          range(0.0, 10.0)                                                  \
+                                                                            \
+  product(double, G1HeapSizingDerivativeGain, 0.0, EXPERIMENTAL,            \
+          "Derivative gain of the heap sizing controller.")                 \
+          range(0.0, 10.0)                                                  \
+                                                                            \
+  product(uint, G1HeapSizingMaxCommittedPercent, 100, EXPERIMENTAL,         \
+          "Maximum committed heap size the heap sizing controller expands " \
+          "to, in percent of the maximum heap size. If the committed heap " \
+          "is larger, the controller shrinks it towards this limit.")       \
+          range(1, 100)                                                     \
+                                                                            \
   product(uint, G1RSetUpdatingPauseTimePercent, 10,                         \
           "A target percentage of time that is allowed to be spend on "     \
           "processing remembered set update buffers during the collection " \
@@ -352,6 +394,17 @@
           "percentage of the currently used memory.")                       \
           range(0.0, 1.0)                                                   \
                                                                             \
+  product(bool, G1NUMAAffineEvacuation, false, EXPERIMENTAL,                \
+          "With UseNUMA, evacuation workers steal tasks from workers on "   \
+          "their own NUMA node first. Tasks of workers on other nodes "     \
+          "are only stolen if their queue holds at least "                  \
+          "G1NUMARemoteStealThreshold tasks.")                              \
+                                                                            \
+  product(uint, G1NUMARemoteStealThreshold, 64, EXPERIMENTAL,               \
+          "Minimum number of tasks in the queue of a worker on another "    \
+          "NUMA node before G1NUMAAffineEvacuation steals from it.")        \
+          range(1, UINT_MAX)                                                \
+                                                                            \
   product(uint, G1RestoreRetainedRegionChunksPerWorker, 16, DIAGNOSTIC,     \
           "The number of chunks assigned per worker thread for "            \
           "retained region restore purposes.")                              \
@@ -371,6 +424,12 @@
           "scan cost related prediction samples. A sample must involve "    \
           "the same or more than this number of code roots to be used.")    \
                                                                             \
+  product(uint, G1NumReferencesCostSampleThreshold, 1000, DIAGNOSTIC,       \
+          "Threshold for the number of discovered References when "         \
+          "reporting Reference processing cost related prediction "         \
+          "samples. A sample must involve the same or more than this "      \
+          "number of References to be used.")                               \
+                                                                            \
   develop(bool, G1ForceOptionalEvacuation, false,                           \
           "Force optional evacuation for all GCs where there are old gen "  \
           "collection set candidates."                                      \
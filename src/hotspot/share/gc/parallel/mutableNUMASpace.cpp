@@ -470,6 +470,15 @@ MutableNUMASpace::LGRPSpace *MutableNUMASpace::lgrp_space_for_current_thread() c
   return lgrp_spaces()->at(lgrp_spaces_index);
 }
 
+int MutableNUMASpace::lgrp_space_index_containing(const void* p) const {
+  if (!contains(p)) {
+    return -1;
+  }
+  return lgrp_spaces()->find_if([&](LGRPSpace* space) {
+    return space->space()->contains(p);
+  });
+}
+
 HeapWord* MutableNUMASpace::cas_allocate(size_t size) {
   LGRPSpace *ls = lgrp_space_for_current_thread();
   MutableSpace *s = ls->space();
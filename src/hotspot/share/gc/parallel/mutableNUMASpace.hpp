@@ -144,6 +144,11 @@ class MutableNUMASpace : public MutableSpace {
 
 public:
   GrowableArray<LGRPSpace*>* lgrp_spaces() const     { return _lgrp_spaces;       }
+  int lgrp_spaces_count() const                      { return _lgrp_spaces->length(); }
+  uint lgrp_id_at(int i) const                       { return _lgrp_spaces->at(i)->lgrp_id(); }
+  // Index of the lgrp space that contains p, or -1 if p is outside this space.
+  int lgrp_space_index_containing(const void* p) const;
+
   MutableNUMASpace(size_t page_size);
   virtual ~MutableNUMASpace();
   // Space initialization.
@@ -85,6 +85,9 @@ jint ParallelScavengeHeap::initialize() {
   card_table->initialize(old_rs.base(), young_rs.base());
 
   CardTableBarrierSet* const barrier_set = new CardTableBarrierSet(card_table);
+  if (UseFilteredCardMark) {
+    barrier_set->set_young_boundary((HeapWord*)young_rs.base(), false /* young_below_boundary */);
+  }
   BarrierSet::set_barrier_set(barrier_set);
 
   // Set up WorkerThreads
@@ -33,7 +33,38 @@
                           constraint)                                       \
   product(bool, UseMaximumCompactionOnSystemGC, true,                       \
           "Use maximum compaction in the Parallel Old garbage collector "   \
-          "for a system GC")
+          "for a system GC")                                                \
+                                                                            \
+  product(uint, ParallelArrayChunksPerWorker, 0, EXPERIMENTAL,              \
+          "Split large object arrays into at most about this many "         \
+          "chunks per GC thread when scavenging and marking, growing "      \
+          "the chunk size beyond ParGCArrayScanChunk or "                   \
+          "ObjArrayMarkingStride as needed. 0 keeps a fixed chunk size.")   \
+                                                                            \
+  product(bool, ParallelNUMAOldPromotion, false, EXPERIMENTAL,              \
+          "With UseNUMA, promote objects from the eden chunk of a NUMA "    \
+          "node into old generation PLABs of their own, backed by "         \
+          "memory bound to that node, instead of the interleaved "          \
+          "memory of the rest of the old generation. Ignored with "         \
+          "large pages.")                                                   \
+                                                                            \
+  product(bool, ParallelCostBasedDensePrefix, false, EXPERIMENTAL,          \
+          "Choose the dense prefix of the old generation in a full GC by "  \
+          "comparing the estimated cost of moving the live objects of "     \
+          "each region, from their words, number and reference fields, "    \
+          "with the space moving them reclaims. The dead space left in "    \
+          "the prefix is still bounded by MarkSweepDeadRatio.")             \
+                                                                            \
+  product(uint, ParallelCompactObjectMoveCost, 4, EXPERIMENTAL,             \
+          "Cost, in copied words, of moving one object in a full GC. "      \
+          "Used by ParallelCostBasedDensePrefix.")                          \
+          range(0, 1024)                                                    \
+                                                                            \
+  product(uint, ParallelCompactReferenceMoveCost, 2, EXPERIMENTAL,          \
+          "Cost, in copied words, of adjusting one reference field of a "   \
+          "moved object in a full GC. Used by "                             \
+          "ParallelCostBasedDensePrefix.")                                  \
+          range(0, 1024)
 
 // end of GC_PARALLEL_FLAGS
 
@@ -49,6 +49,8 @@ class PCMarkAndPushClosure: public ClaimMetadataVisitingOopIterateClosure {
 
   template <typename T> void do_oop_work(T* p);
 public:
+  typedef ReferenceProcessor ReferenceDiscovererType;
+
   PCMarkAndPushClosure(ParCompactionManager* cm, ReferenceProcessor* rp) :
     ClaimMetadataVisitingOopIterateClosure(ClassLoaderData::_claim_stw_fullgc_mark, rp),
     _compaction_manager(cm) { }
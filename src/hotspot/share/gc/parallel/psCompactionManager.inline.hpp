@@ -49,7 +49,7 @@ inline void PCMarkAndPushClosure::do_oop_work(T* p) {
 }
 
 inline bool ParCompactionManager::steal(int queue_num, ScannerTask& t) {
-  return marking_stacks()->steal(queue_num, t);
+  return marking_stacks()->steal_batch(queue_num, t, GCStealBatchSize);
 }
 
 inline bool ParCompactionManager::steal(int queue_num, size_t& region) {
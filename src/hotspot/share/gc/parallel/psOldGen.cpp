@@ -35,6 +35,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 
 PSOldGen::PSOldGen(ReservedSpace rs, size_t initial_size, size_t min_size,
@@ -308,6 +309,17 @@ void PSOldGen::shrink(size_t bytes) {
   }
 }
 
+void PSOldGen::reset_numa_free_pages() {
+  assert(UseNUMA, "Only with NUMA");
+  char* const start = align_up((char*)object_space()->top(), virtual_space()->page_size());
+  char* const end = (char*)object_space()->end();
+  if (start < end) {
+    // Prefer page reallocation to migration
+    os::disclaim_memory(start, pointer_delta(end, start, 1));
+    os::numa_make_global(start, pointer_delta(end, start, 1));
+  }
+}
+
 void PSOldGen::complete_loaded_archive_space(MemRegion archive_space) {
   HeapWord* cur = archive_space.start();
   while (cur < archive_space.end()) {
@@ -108,6 +108,10 @@ class PSOldGen : public CHeapObj<mtGC> {
 
   void shrink(size_t bytes);
 
+  // Releases the committed pages above top and makes them interleaved again,
+  // so that NUMA node LABs (see ParallelNUMAOldPromotion) get to place them.
+  void reset_numa_free_pages();
+
   // Used by GC-workers during GC or for CDS at startup.
   HeapWord* allocate(size_t word_size) {
     HeapWord* res;
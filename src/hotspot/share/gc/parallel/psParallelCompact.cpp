@@ -536,6 +536,11 @@ class PCAdjustPointerClosure: public BasicOopIterateClosure {
   virtual void do_oop(oop* p)                { do_oop_work(p); }
   virtual void do_oop(narrowOop* p)          { do_oop_work(p); }
 
+  // The referent and discovered fields are adjusted like any other field.
+  // Reference processing has already nulled the discovered field of every
+  // dropped reference and the referent of every cleared one, and adjusting
+  // a null field is a single load, so tracking those references on the side
+  // would not save any work here.
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS; }
 };
 
@@ -698,6 +703,12 @@ void PSParallelCompact::post_compact()
   ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
   bool eden_empty = eden_space->is_empty();
 
+  if (PSPromotionManager::uses_old_node_labs()) {
+    // Sliding moved objects away from the node bound pages they were promoted
+    // into. Let the free part of the old gen be placed afresh by the node LABs.
+    heap->old_gen()->reset_numa_free_pages();
+  }
+
   // Update heap occupancy information which is used as input to the soft ref
   // clearing policy at the next gc.
   Universe::heap()->update_capacity_and_used_at_gc();
@@ -723,6 +734,49 @@ void PSParallelCompact::post_compact()
   Universe::heap()->record_whole_heap_examined_timestamp();
 }
 
+class PCCountReferencesClosure : public BasicOopIterateClosure {
+  size_t _count;
+
+public:
+  PCCountReferencesClosure() : _count(0) {}
+
+  virtual void do_oop(oop* p)       { _count++; }
+  virtual void do_oop(narrowOop* p) { _count++; }
+
+  size_t count() const { return _count; }
+};
+
+// Estimated cost, in copied words, of moving the live objects starting in
+// [region_start, region_end). Objects are found in the mark bitmap and their
+// reference fields counted by iterating over them, so this is only used for
+// regions where the live words alone do not settle the decision.
+static size_t region_move_cost(const ParMarkBitMap* bitmap,
+                               HeapWord* region_start,
+                               HeapWord* region_end,
+                               size_t live_words,
+                               size_t* obj_count,
+                               size_t* ref_count) {
+  PCCountReferencesClosure cl;
+  size_t objs = 0;
+
+  for (HeapWord* cur_addr = region_start; cur_addr < region_end; /* empty */) {
+    cur_addr = bitmap->find_obj_beg(cur_addr, region_end);
+    if (cur_addr >= region_end) {
+      break;
+    }
+    oop obj = cast_to_oop(cur_addr);
+    obj->oop_iterate(&cl);
+    objs++;
+    cur_addr += obj->size();
+  }
+
+  *obj_count = objs;
+  *ref_count = cl.count();
+  return live_words
+       + objs * ParallelCompactObjectMoveCost
+       + cl.count() * ParallelCompactReferenceMoveCost;
+}
+
 HeapWord* PSParallelCompact::compute_dense_prefix_for_old_space(MutableSpace* old_space,
                                                                 HeapWord* full_region_prefix_end) {
   const size_t region_size = ParallelCompactData::RegionSize;
@@ -746,6 +800,10 @@ HeapWord* PSParallelCompact::compute_dense_prefix_for_old_space(MutableSpace* ol
     max_waste -= dead_size;
   }
 
+  if (ParallelCostBasedDensePrefix) {
+    cur_region = cost_based_dense_prefix_end(start_region, cur_region);
+  }
+
   HeapWord* const prefix_end = sd.region_to_addr(cur_region);
   assert(sd.is_region_aligned(prefix_end), "postcondition");
   assert(prefix_end >= full_region_prefix_end, "in-range");
@@ -753,6 +811,70 @@ HeapWord* PSParallelCompact::compute_dense_prefix_for_old_space(MutableSpace* ol
   return prefix_end;
 }
 
+// Select the dense prefix end among the regions in [start_region,
+// end_region), which all fit within the dead wood allowed by
+// MarkSweepDeadRatio. Keeping a region in the dense prefix saves the cost of
+// moving its live objects, and gives up the dead space compaction would have
+// reclaimed. The prefix end is placed where the accumulated savings net of
+// the given up space are largest, so a region cheap to move is still kept in
+// the prefix if the regions after it are expensive enough.
+PSParallelCompact::RegionData*
+PSParallelCompact::cost_based_dense_prefix_end(const RegionData* start_region,
+                                               const RegionData* end_region) {
+  const size_t region_size = ParallelCompactData::RegionSize;
+  const ParallelCompactData& sd = summary_data();
+
+  // Net savings are signed; cost is in copied words, as is the dead space.
+  intx net_savings = 0;
+  intx best_net_savings = 0;
+  const RegionData* best_end = start_region;
+
+  size_t measured_regions = 0;
+  size_t total_objs = 0;
+  size_t total_refs = 0;
+  size_t total_dead = 0;
+  size_t best_dead = 0;
+
+  for (const RegionData* cur_region = start_region; cur_region < end_region; ++cur_region) {
+    const size_t live_size = cur_region->data_size();
+    const size_t dead_size = region_size - live_size;
+
+    // The live words are a lower bound of the move cost. Only count objects
+    // and references when the bound is below the space moving reclaims.
+    size_t move_cost = live_size;
+    if (move_cost < dead_size) {
+      HeapWord* const region_start = sd.region_to_addr(cur_region);
+      size_t objs;
+      size_t refs;
+      move_cost = region_move_cost(mark_bitmap(),
+                                   region_start + cur_region->partial_obj_size(),
+                                   region_start + region_size,
+                                   live_size, &objs, &refs);
+      measured_regions++;
+      total_objs += objs;
+      total_refs += refs;
+      log_trace(gc, compaction)("Dense prefix candidate region %zu: live %zu dead %zu objs %zu refs %zu move cost %zu",
+                                sd.region(cur_region), live_size, dead_size, objs, refs, move_cost);
+    }
+
+    net_savings += (intx)move_cost - (intx)dead_size;
+    total_dead += dead_size;
+    if (net_savings > best_net_savings) {
+      best_net_savings = net_savings;
+      best_end = cur_region + 1;
+      best_dead = total_dead;
+    }
+  }
+
+  log_debug(gc, compaction)("Dense prefix: %zu of %zu candidate regions kept, %zu dead words kept, "
+                            "%zd saved; %zu regions measured: %zu objs %zu refs",
+                            pointer_delta(best_end, start_region, sizeof(RegionData)),
+                            pointer_delta(end_region, start_region, sizeof(RegionData)),
+                            best_dead, best_net_savings, measured_regions, total_objs, total_refs);
+
+  return const_cast<RegionData*>(best_end);
+}
+
 void PSParallelCompact::fill_dense_prefix_end(SpaceId id) {
   // Comparing two sizes to decide if filling is required:
   //
@@ -1261,7 +1383,7 @@ void PSParallelCompact::marking_phase(ParallelOldTracer *gc_tracer) {
       CodeCache::UnlinkingScope scope(is_alive_closure());
 
       // Follow system dictionary roots and unload classes.
-      bool unloading_occurred = SystemDictionary::do_unloading(&_gc_timer);
+      bool unloading_occurred = SystemDictionary::do_unloading(&_gc_timer, &ParallelScavengeHeap::heap()->workers());
 
       PSParallelCleaningTask task{unloading_occurred};
       ParallelScavengeHeap::heap()->workers().run_task(&task);
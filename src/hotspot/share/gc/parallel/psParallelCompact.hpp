@@ -734,6 +734,10 @@ class PSParallelCompact : AllStatic {
   static HeapWord* compute_dense_prefix_for_old_space(MutableSpace* old_space,
                                                       HeapWord* full_region_prefix_end);
 
+  // Cost-based end of the dense prefix, see ParallelCostBasedDensePrefix.
+  static RegionData* cost_based_dense_prefix_end(const RegionData* start_region,
+                                                 const RegionData* end_region);
+
   // Create a filler obj (if needed) right before the dense-prefix-boundary to
   // make the heap parsable.
   static void fill_dense_prefix_end(SpaceId id);
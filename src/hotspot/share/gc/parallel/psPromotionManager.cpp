@@ -43,6 +43,8 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/checkedCast.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = nullptr;
@@ -50,6 +52,8 @@ PSPromotionManager::PSScannerTasksQueueSet* PSPromotionManager::_stack_array_dep
 PreservedMarksSet*             PSPromotionManager::_preserved_marks_set = nullptr;
 PSOldGen*                      PSPromotionManager::_old_gen = nullptr;
 MutableSpace*                  PSPromotionManager::_young_space = nullptr;
+MutableNUMASpace*              PSPromotionManager::_numa_eden = nullptr;
+size_t                         PSPromotionManager::_old_node_lab_size = 0;
 PartialArrayStateManager*      PSPromotionManager::_partial_array_state_manager = nullptr;
 
 void PSPromotionManager::initialize() {
@@ -58,6 +62,16 @@ void PSPromotionManager::initialize() {
   _old_gen = heap->old_gen();
   _young_space = heap->young_gen()->to_space();
 
+  if (ParallelNUMAOldPromotion && UseNUMA) {
+    if (_old_gen->virtual_space()->page_size() > os::vm_page_size()) {
+      log_info(gc, heap)("ParallelNUMAOldPromotion is ignored with large pages");
+    } else {
+      _numa_eden = static_cast<MutableNUMASpace*>(heap->young_gen()->eden_space());
+      // A few pages, so that most of each LAB can be bound to its node
+      _old_node_lab_size = MAX2((size_t)OldPLABSize, 4 * os::vm_page_size() / HeapWordSize);
+    }
+  }
+
   const uint promotion_manager_num = ParallelGCThreads;
 
   assert(_partial_array_state_manager == nullptr, "Attempt to initialize twice");
@@ -157,11 +171,22 @@ PartialArrayTaskStats* PSPromotionManager::partial_array_task_stats() {
 
 // Most members are initialized either by initialize() or reset().
 PSPromotionManager::PSPromotionManager()
-  : _partial_array_splitter(_partial_array_state_manager, ParallelGCThreads, ParGCArrayScanChunk)
+  : _partial_array_splitter(_partial_array_state_manager, ParallelGCThreads, ParGCArrayScanChunk,
+                            ParallelArrayChunksPerWorker)
 {
   // We set the old lab's start array.
   _old_lab.set_start_array(old_gen()->start_array());
 
+  if (_numa_eden != nullptr) {
+    const int num_nodes = _numa_eden->lgrp_spaces_count();
+    _old_node_labs = new PSOldPromotionLAB[num_nodes];
+    for (int i = 0; i < num_nodes; i++) {
+      _old_node_labs[i].set_start_array(old_gen()->start_array());
+    }
+  } else {
+    _old_node_labs = nullptr;
+  }
+
   if (ParallelGCThreads == 1) {
     _target_stack_size = 0;
   } else {
@@ -189,11 +214,29 @@ void PSPromotionManager::reset() {
 
   lab_base = old_gen()->object_space()->top();
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
+  if (_old_node_labs != nullptr) {
+    for (int i = 0; i < _numa_eden->lgrp_spaces_count(); i++) {
+      _old_node_labs[i].initialize(MemRegion(lab_base, (size_t)0));
+    }
+  }
   _old_gen_is_full = false;
 
   _promotion_failed_info.reset();
 }
 
+// Binds the pages that lie completely within the given node LAB to its node.
+// Pages that have been touched before keep their placement.
+void PSPromotionManager::bind_old_node_lab(PSOldPromotionLAB* lab) {
+  const int index = checked_cast<int>(lab - _old_node_labs);
+  assert(index >= 0 && index < _numa_eden->lgrp_spaces_count(), "Not a node LAB");
+
+  char* const start = align_up((char*)lab->bottom(), os::vm_page_size());
+  char* const end = align_down((char*)lab->end(), os::vm_page_size());
+  if (start < end) {
+    os::numa_make_local(start, pointer_delta(end, start, 1), (int)_numa_eden->lgrp_id_at(index));
+  }
+}
+
 void PSPromotionManager::register_preserved_marks(PreservedMarks* preserved_marks) {
   assert(_preserved_marks == nullptr, "do not set it twice");
   _preserved_marks = preserved_marks;
@@ -242,6 +285,15 @@ void PSPromotionManager::flush_labs() {
   if (!_old_lab.is_flushed())
     _old_lab.flush();
 
+  if (_old_node_labs != nullptr) {
+    for (int i = 0; i < _numa_eden->lgrp_spaces_count(); i++) {
+      assert(!_old_node_labs[i].is_flushed() || _old_gen_is_full, "Sanity");
+      if (!_old_node_labs[i].is_flushed()) {
+        _old_node_labs[i].flush();
+      }
+    }
+  }
+
   // Let PSScavenge know if we overflowed
   if (_young_gen_is_full || _young_gen_has_alloc_failure) {
     PSScavenge::set_survivor_overflow(true);
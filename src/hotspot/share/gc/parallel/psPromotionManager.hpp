@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_PARALLEL_PSPROMOTIONMANAGER_HPP
 #define SHARE_GC_PARALLEL_PSPROMOTIONMANAGER_HPP
 
+#include "gc/parallel/mutableNUMASpace.hpp"
 #include "gc/parallel/psPromotionLAB.hpp"
 #include "gc/shared/copyFailedInfo.hpp"
 #include "gc/shared/gcTrace.hpp"
@@ -56,6 +57,7 @@ class ParCompactionManager;
 class PSPromotionManager {
   friend class PSScavenge;
   friend class ScavengeRootsTask;
+  friend class ParallelScavengeRefProcProxyTask;
 
  private:
   typedef OverflowTaskQueue<ScannerTask, mtGC>           PSScannerTasksQueue;
@@ -66,6 +68,8 @@ class PSPromotionManager {
   static PreservedMarksSet*             _preserved_marks_set;
   static PSOldGen*                      _old_gen;
   static MutableSpace*                  _young_space;
+  static MutableNUMASpace*              _numa_eden;
+  static size_t                         _old_node_lab_size;
 
 #if TASKQUEUE_STATS
   static void print_and_reset_taskqueue_stats();
@@ -74,6 +78,9 @@ class PSPromotionManager {
 
   PSYoungPromotionLAB                 _young_lab;
   PSOldPromotionLAB                   _old_lab;
+  // Old LABs for objects promoted from the eden chunk of each NUMA node,
+  // null unless ParallelNUMAOldPromotion is in effect.
+  PSOldPromotionLAB*                  _old_node_labs;
   bool                                _young_gen_has_alloc_failure;
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
@@ -114,14 +121,20 @@ class PSPromotionManager {
   inline HeapWord* allocate_in_young_gen(Klass* klass,
                                          size_t obj_size,
                                          uint age);
+  inline PSOldPromotionLAB* old_lab_for(oop o);
   inline HeapWord* allocate_in_old_gen(Klass* klass,
                                        size_t obj_size,
-                                       uint age);
+                                       uint age,
+                                       PSOldPromotionLAB* lab);
+  void bind_old_node_lab(PSOldPromotionLAB* lab);
 
  public:
   // Static
   static void initialize();
 
+  // Whether objects promoted from eden go to LABs bound to their NUMA node.
+  static bool uses_old_node_labs() { return _numa_eden != nullptr; }
+
   static void pre_scavenge();
   static bool post_scavenge(YoungGCTracer& gc_tracer);
 
@@ -185,37 +185,54 @@ inline HeapWord* PSPromotionManager::allocate_in_young_gen(Klass* klass,
   return result;
 }
 
+inline PSOldPromotionLAB* PSPromotionManager::old_lab_for(oop o) {
+  if (_old_node_labs != nullptr) {
+    const int index = _numa_eden->lgrp_space_index_containing(cast_from_oop<HeapWord*>(o));
+    if (index >= 0) {
+      return &_old_node_labs[index];
+    }
+  }
+  // Not from eden, or no node LABs
+  return &_old_lab;
+}
+
 inline HeapWord* PSPromotionManager::allocate_in_old_gen(Klass* klass,
                                                          size_t obj_size,
-                                                         uint age) {
+                                                         uint age,
+                                                         PSOldPromotionLAB* lab) {
 #ifndef PRODUCT
   if (ParallelScavengeHeap::heap()->promotion_should_fail()) {
     return nullptr;
   }
 #endif  // #ifndef PRODUCT
 
-  HeapWord* result = _old_lab.allocate(obj_size);
+  HeapWord* result = lab->allocate(obj_size);
   if (result != nullptr) {
     return result;
   }
   if (_old_gen_is_full) {
     return nullptr;
   }
+  const bool is_node_lab = (lab != &_old_lab);
+  const size_t lab_size = is_node_lab ? _old_node_lab_size : OldPLABSize;
   // Do we allocate directly, or flush and refill?
-  if (obj_size > (OldPLABSize / 2)) {
+  if (obj_size > (lab_size / 2)) {
     // Allocate this object directly
     result = old_gen()->allocate(obj_size);
     promotion_trace_event(cast_to_oop(result), klass, obj_size, age, true, nullptr);
   } else {
     // Flush and fill
-    _old_lab.flush();
+    lab->flush();
 
-    HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+    HeapWord* lab_base = old_gen()->allocate(lab_size);
     if (lab_base != nullptr) {
-      _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+      lab->initialize(MemRegion(lab_base, lab_size));
+      if (is_node_lab) {
+        bind_old_node_lab(lab);
+      }
       // Try the old lab allocation again.
-      result = _old_lab.allocate(obj_size);
-      promotion_trace_event(cast_to_oop(result), klass, obj_size, age, true, &_old_lab);
+      result = lab->allocate(obj_size);
+      promotion_trace_event(cast_to_oop(result), klass, obj_size, age, true, lab);
     }
   }
   if (result == nullptr) {
@@ -260,8 +277,10 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
   }
 
   // Otherwise try allocating obj tenured
+  PSOldPromotionLAB* old_lab = nullptr;
   if (new_obj_addr == nullptr) {
-    new_obj_addr = allocate_in_old_gen(klass, new_obj_size, age);
+    old_lab = old_lab_for(o);
+    new_obj_addr = allocate_in_old_gen(klass, new_obj_size, age, old_lab);
     if (new_obj_addr == nullptr) {
       return oop_promotion_failed(o, test_mark);
     }
@@ -317,7 +336,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     assert(o->forwardee() == forwardee, "invariant");
 
     if (new_obj_is_tenured) {
-      _old_lab.unallocate_object(new_obj_addr, new_obj_size);
+      old_lab->unallocate_object(new_obj_addr, new_obj_size);
     } else {
       _young_lab.unallocate_object(new_obj_addr, new_obj_size);
     }
@@ -355,7 +374,7 @@ inline void PSPromotionManager::process_popped_location_depth(ScannerTask task,
 }
 
 inline bool PSPromotionManager::steal_depth(int queue_num, ScannerTask& t) {
-  return stack_array_depth()->steal(queue_num, t);
+  return stack_array_depth()->steal_batch(queue_num, t, GCStealBatchSize);
 }
 
 #endif // SHARE_GC_PARALLEL_PSPROMOTIONMANAGER_INLINE_HPP
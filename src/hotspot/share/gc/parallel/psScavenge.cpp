@@ -29,7 +29,6 @@
 #include "gc/parallel/parallelScavengeHeap.hpp"
 #include "gc/parallel/psAdaptiveSizePolicy.hpp"
 #include "gc/parallel/psClosure.inline.hpp"
-#include "gc/parallel/psCompactionManager.hpp"
 #include "gc/parallel/psParallelCompact.inline.hpp"
 #include "gc/parallel/psPromotionManager.inline.hpp"
 #include "gc/parallel/psRootType.hpp"
@@ -92,7 +91,7 @@ static void scavenge_roots_work(ParallelRootType::Value root_type, uint worker_i
     case ParallelRootType::class_loader_data:
       {
         PSScavengeCLDClosure cld_closure(pm);
-        ClassLoaderDataGraph::cld_do(&cld_closure);
+        ClassLoaderDataGraph::modified_cld_do(&cld_closure);
       }
       break;
 
@@ -197,7 +196,7 @@ class ParallelScavengeRefProcProxyTask : public RefProcProxyTask {
 public:
   ParallelScavengeRefProcProxyTask(uint max_workers)
     : RefProcProxyTask("ParallelScavengeRefProcProxyTask", max_workers),
-      _terminator(max_workers, ParCompactionManager::marking_stacks()) {}
+      _terminator(max_workers, PSPromotionManager::stack_array_depth()) {}
 
   void work(uint worker_id) override {
     assert(worker_id < _max_workers, "sanity");
@@ -618,9 +618,9 @@ bool DefNewGeneration::collect(bool clear_all_soft_refs) {
     // of roots.
     _old_gen->scan_old_to_young_refs();
 
-    // 2. CLD; visit all (strong+weak) clds with the same closure, because we
-    // don't perform class unloading during young-gc.
-    ClassLoaderDataGraph::cld_do(&cld_closure);
+    // 2. CLD; visit the (strong+weak) clds with modified oops with the same
+    // closure, because we don't perform class unloading during young-gc.
+    ClassLoaderDataGraph::modified_cld_do(&cld_closure);
 
     // 3. Threads stack frames and nmethods.
     // Only nmethods that contain pointers into-young need to be processed
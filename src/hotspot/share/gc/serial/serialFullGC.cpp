@@ -69,6 +69,7 @@
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/events.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/stack.inline.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
@@ -164,12 +165,27 @@ class Compacter {
     }
   };
 
+  // A run of adjacent live objects that is moved to adjacent addresses, and
+  // so can be copied in one go. Objects are still forwarded one by one, for
+  // adjusting pointers.
+  struct MoveBlock {
+    HeapWord* _src;
+    HeapWord* _dest;
+    size_t _words;
+  };
+
   CompactionSpace _spaces[max_num_spaces];
   // The num of spaces to be compacted, i.e. containing live objs.
   uint _num_spaces;
 
   uint _index;
 
+  // Move blocks of more than one object, in the order of phase2.
+  GrowableArrayCHeap<MoveBlock, mtGC> _blocks;
+  // The block being built by phase2.
+  MoveBlock _cur_block;
+  uint _cur_block_objs;
+
   // Used for BOT update
   TenuredGeneration* _old_gen;
 
@@ -267,6 +283,51 @@ class Compacter {
     return obj_size;
   }
 
+  void end_block() {
+    if (_cur_block_objs > 1) {
+      _blocks.append(_cur_block);
+    }
+    _cur_block_objs = 0;
+  }
+
+  // Add an object forwarded from addr to new_addr to the current block, or
+  // start a new block if it is not adjacent to the current one.
+  void add_to_block(HeapWord* addr, HeapWord* new_addr, size_t obj_size) {
+    if (_cur_block_objs > 0 &&
+        _cur_block._src + _cur_block._words == addr &&
+        _cur_block._dest + _cur_block._words == new_addr) {
+      _cur_block._words += obj_size;
+      _cur_block_objs++;
+      return;
+    }
+    end_block();
+    _cur_block._src = addr;
+    _cur_block._dest = new_addr;
+    _cur_block._words = obj_size;
+    _cur_block_objs = 1;
+  }
+
+  static size_t relocate_block(const MoveBlock& block) {
+    prefetch_read_scan(block._src);
+    prefetch_write_copy(block._dest);
+
+    // Reset the marks before the copy, while the objects are still at their
+    // old addresses; all objects in the block are forwarded.
+    HeapWord* const end = block._src + block._words;
+    for (HeapWord* addr = block._src; addr < end; /* empty */) {
+      oop obj = cast_to_oop(addr);
+      assert(FullGCForwarding::is_forwarded(obj), "inv");
+      assert(cast_from_oop<HeapWord*>(FullGCForwarding::forwardee(obj)) ==
+             block._dest + pointer_delta(addr, block._src), "must be moved with the block");
+      addr += obj->size();
+      obj->init_mark();
+    }
+
+    Copy::aligned_conjoint_words(block._src, block._dest, block._words);
+
+    return block._words;
+  }
+
 public:
   explicit Compacter(SerialHeap* heap) {
     // In this order so that heap is compacted towards old-gen.
@@ -283,6 +344,7 @@ class Compacter {
     }
     _index = 0;
     _old_gen = heap->old_gen();
+    _cur_block_objs = 0;
   }
 
   void phase2_calculate_new_addr() {
@@ -301,8 +363,12 @@ class Compacter {
         if (obj->is_gc_marked()) {
           HeapWord* new_addr = alloc(obj_size);
           forward_obj(obj, new_addr);
+          if (new_addr != cur_addr) {
+            add_to_block(cur_addr, new_addr, obj_size);
+          }
           cur_addr += obj_size;
         } else {
+          end_block();
           // Skipping the current known-unmarked obj
           HeapWord* next_live_addr = find_next_live_addr(cur_addr + obj_size, top);
           if (dead_spacer.insert_deadspace(cur_addr, next_live_addr)) {
@@ -322,7 +388,10 @@ class Compacter {
       if (!record_first_dead_done) {
         record_first_dead(i, top);
       }
+      end_block();
     }
+
+    log_debug(gc, compaction)("Move blocks: %d", _blocks.length());
   }
 
   void phase3_adjust_pointers() {
@@ -346,6 +415,7 @@ class Compacter {
   }
 
   void phase4_compact() {
+    int next_block = 0;
     for (uint i = 0; i < _num_spaces; ++i) {
       ContiguousSpace* space = get_space(i);
       HeapWord* cur_addr = space->bottom();
@@ -362,6 +432,11 @@ class Compacter {
           cur_addr = *(HeapWord**) cur_addr;
           continue;
         }
+        if (next_block < _blocks.length() && _blocks.at(next_block)._src == cur_addr) {
+          cur_addr += relocate_block(_blocks.at(next_block));
+          next_block++;
+          continue;
+        }
         cur_addr += relocate(cur_addr);
       }
 
@@ -372,6 +447,7 @@ class Compacter {
         space->mangle_unused_area(MemRegion(new_top, top));
       }
     }
+    assert(next_block == _blocks.length(), "all blocks must be moved");
   }
 };
 
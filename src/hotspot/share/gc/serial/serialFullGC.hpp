@@ -158,13 +158,15 @@ class SerialFullGC : AllStatic {
 
 class MarkAndPushClosure: public ClaimMetadataVisitingOopIterateClosure {
 public:
+  typedef ReferenceProcessor ReferenceDiscovererType;
+
   MarkAndPushClosure(int claim) : ClaimMetadataVisitingOopIterateClosure(claim) {}
 
   template <typename T> void do_oop_work(T* p);
   virtual void do_oop(      oop* p);
   virtual void do_oop(narrowOop* p);
 
-  void set_ref_discoverer(ReferenceDiscoverer* rd) {
+  void set_ref_discoverer(ReferenceProcessor* rd) {
     set_ref_discoverer_internal(rd);
   }
 };
@@ -187,6 +187,9 @@ jint SerialHeap::initialize() {
   _rem_set->initialize(young_rs.base(), old_rs.base());
 
   CardTableBarrierSet *bs = new CardTableBarrierSet(_rem_set);
+  if (UseFilteredCardMark) {
+    bs->set_young_boundary((HeapWord*)old_rs.base(), true /* young_below_boundary */);
+  }
   BarrierSet::set_barrier_set(bs);
 
   _young_gen = new DefNewGeneration(young_rs, NewSize, MinNewSize, MaxNewSize);
@@ -63,6 +63,9 @@ class ScavengeHelper {
 
 class InHeapScanClosure : public BasicOopIterateClosure {
   ScavengeHelper _helper;
+public:
+  typedef ReferenceProcessor ReferenceDiscovererType;
+
 protected:
   bool is_in_young_gen(void* p) const {
     return _helper.is_in_young_gen(p);
@@ -107,6 +107,12 @@ void CardTableBarrierSetC1::post_barrier(LIRAccess& access, LIR_Opr addr, LIR_Op
   CardTableBarrierSet* ctbs = barrier_set_cast<CardTableBarrierSet>(BarrierSet::barrier_set());
   LIR_Const* card_table_base = new LIR_Const(ctbs->card_table_base_const());
 
+  if (ctbs->filter_card_marks() && new_val->is_constant() &&
+      new_val->as_constant_ptr()->as_jobject() == nullptr) {
+    // No card mark for storing null.
+    return;
+  }
+
   if (addr->is_address()) {
     LIR_Address* address = addr->as_address_ptr();
     // ptr cannot be an object because we use this barrier for array card marks
@@ -125,6 +131,14 @@ void CardTableBarrierSetC1::post_barrier(LIRAccess& access, LIR_Opr addr, LIR_Op
 #ifdef CARDTABLEBARRIERSET_POST_BARRIER_HELPER
   gen->CardTableBarrierSet_post_barrier_helper(addr, card_table_base);
 #else
+  LabelObj* L_filtered = nullptr;
+  if (ctbs->filter_card_marks() && new_val->is_register()) {
+    // Storing null needs no card mark.
+    L_filtered = new LabelObj();
+    __ cmp(lir_cond_equal, new_val, LIR_OprFact::oopConst(nullptr));
+    __ branch(lir_cond_equal, L_filtered->label());
+  }
+
   LIR_Opr tmp = gen->new_pointer_register();
   if (two_operand_lir_form) {
     LIR_Opr addr_opr = LIR_OprFact::address(new LIR_Address(addr, addr->type()));
@@ -134,6 +148,19 @@ void CardTableBarrierSetC1::post_barrier(LIRAccess& access, LIR_Opr addr, LIR_Op
     __ unsigned_shift_right(addr, CardTable::card_shift(), tmp);
   }
 
+  if (ctbs->filter_card_marks()) {
+    // Neither do stores into the young generation. Card indices are never
+    // negative, so a signed comparison suffices.
+    if (L_filtered == nullptr) {
+      L_filtered = new LabelObj();
+    }
+    LIR_Opr young_boundary = gen->new_pointer_register();
+    __ move(LIR_OprFact::intptrConst(ctbs->young_boundary_card_index()), young_boundary);
+    const LIR_Condition young = ctbs->young_below_boundary() ? lir_cond_less : lir_cond_greaterEqual;
+    __ cmp(young, tmp, young_boundary);
+    __ branch(young, L_filtered->label());
+  }
+
   LIR_Address* card_addr;
   if (gen->can_inline_as_constant(card_table_base)) {
     card_addr = new LIR_Address(tmp, card_table_base->as_jint(), T_BYTE);
@@ -154,5 +181,9 @@ void CardTableBarrierSetC1::post_barrier(LIRAccess& access, LIR_Opr addr, LIR_Op
   } else {
     __ move(dirty, card_addr);
   }
+
+  if (L_filtered != nullptr) {
+    __ branch_destination(L_filtered->label());
+  }
 #endif
 }
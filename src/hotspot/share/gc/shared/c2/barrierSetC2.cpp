@@ -1027,6 +1027,31 @@ static bool is_array_allocation(const Node* phi) {
   ShouldNotReachHere();
 }
 
+bool BarrierSetC2::is_only_compared(const Node* load) {
+  assert(load->is_Load(), "expected load node");
+  if (load->outcnt() == 0) {
+    return false;
+  }
+  for (DUIterator_Fast imax, i = load->fast_outs(imax); i < imax; i++) {
+    const Node* const use = load->fast_out(i);
+    if (use->Opcode() == Op_CmpP || use->Opcode() == Op_CmpN) {
+      continue;
+    }
+    if (use->Opcode() == Op_DecodeN && use->outcnt() > 0) {
+      for (DUIterator_Fast jmax, j = use->fast_outs(jmax); j < jmax; j++) {
+        if (use->fast_out(j)->Opcode() != Op_CmpP) {
+          return false;
+        }
+      }
+      continue;
+    }
+    // Any other use, including debug info at a safepoint, might
+    // let the referent escape
+    return false;
+  }
+  return true;
+}
+
 bool BarrierSetC2::is_allocation(const Node* node) {
   assert(node->is_Phi(), "expected phi node");
   if (node->req() != 3) {
@@ -366,6 +366,10 @@ class BarrierSetC2: public CHeapObj<mtGC> {
 
   // Whether the given phi node joins OOPs from fast and slow allocation paths.
   static bool is_allocation(const Node* node);
+  // Whether the loaded oop is only used by pointer compares, e.g. the result of
+  // Reference.get() in "ref.get() == obj". Such a load does not need to keep
+  // the referent alive, like Reference.refersTo().
+  static bool is_only_compared(const Node* load);
   // Elide GC barriers from a Mach node according to elide_dominated_barriers().
   virtual void elide_dominated_barrier(MachNode* mach) const { }
   // Elide GC barriers from instructions in 'accesses' if they are dominated by
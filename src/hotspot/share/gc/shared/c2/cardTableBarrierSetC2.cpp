@@ -167,6 +167,15 @@ void CardTableBarrierSetC2::post_barrier(GraphKit* kit,
   // Divide by card size
   Node* card_offset = __ URShiftX(cast, __ ConI(CardTable::card_shift()));
 
+  // Stores into the young generation need no card mark. Card indices are
+  // never negative, so a signed comparison suffices.
+  CardTableBarrierSet* ctbs = barrier_set_cast<CardTableBarrierSet>(BarrierSet::barrier_set());
+  const bool filter_young = ctbs->filter_card_marks();
+  if (filter_young) {
+    Node* young_boundary = kit->MakeConX((intptr_t)ctbs->young_boundary_card_index());
+    __ if_then(card_offset, ctbs->young_below_boundary() ? BoolTest::ge : BoolTest::lt, young_boundary);
+  }
+
   // Combine card table base and card offset
   Node* card_adr = __ AddP(__ top(), byte_map_base_node(kit), card_offset);
 
@@ -195,6 +204,10 @@ void CardTableBarrierSetC2::post_barrier(GraphKit* kit,
     __ end_if();
   }
 
+  if (filter_young) {
+    __ end_if();
+  }
+
   // Final sync IdealKit and GraphKit.
   kit->final_sync(ideal);
 }
@@ -206,7 +219,25 @@ bool CardTableBarrierSetC2::use_ReduceInitialCardMarks() {
 void CardTableBarrierSetC2::eliminate_gc_barrier(PhaseMacroExpand* macro, Node* node) const {
   assert(node->Opcode() == Op_CastP2X, "ConvP2XNode required");
   Node *shift = node->unique_out();
-  Node *addp = shift->unique_out();
+  Node *addp = nullptr;
+  Node *young_check = nullptr;
+  for (DUIterator_Fast imax, i = shift->fast_outs(imax); i < imax; i++) {
+    Node* use = shift->fast_out(i);
+    if (use->is_Cmp()) {
+      assert(young_check == nullptr, "only one young generation check");
+      young_check = use;
+    } else {
+      assert(addp == nullptr, "only one card address");
+      addp = use;
+    }
+  }
+  if (young_check != nullptr) {
+    // The UseFilteredCardMark check of the card index. Compare the boundary
+    // with itself instead to fold the test, as the card mark goes away.
+    assert(young_check->in(1) == shift, "unexpected code shape");
+    macro->igvn().replace_input_of(young_check, 1, young_check->in(2));
+  }
+  assert(addp != nullptr, "card address required");
   for (DUIterator_Last jmin, j = addp->last_outs(jmin); j >= jmin; --j) {
     Node *mem = addp->last_out(j);
     if (UseCondCardMark && mem->is_Load()) {
@@ -59,7 +59,9 @@ CardTableBarrierSet::CardTableBarrierSet(BarrierSetAssembler* barrier_set_assemb
              nullptr /* barrier_set_nmethod */,
              nullptr /* barrier_set_stack_chunk */,
              fake_rtti.add_tag(BarrierSet::CardTableBarrierSet)),
-  _card_table(card_table)
+  _card_table(card_table),
+  _young_boundary(nullptr),
+  _young_below_boundary(false)
 {}
 
 CardTableBarrierSet::CardTableBarrierSet(CardTable* card_table) :
@@ -69,7 +71,9 @@ CardTableBarrierSet::CardTableBarrierSet(CardTable* card_table) :
              nullptr /* barrier_set_nmethod */,
              nullptr /* barrier_set_stack_chunk */,
              BarrierSet::FakeRtti(BarrierSet::CardTableBarrierSet)),
-  _card_table(card_table)
+  _card_table(card_table),
+  _young_boundary(nullptr),
+  _young_below_boundary(false)
 {}
 
 CardTableBarrierSet::~CardTableBarrierSet() {
@@ -80,6 +84,13 @@ void CardTableBarrierSet::write_region(MemRegion mr) {
   card_table()->dirty_MemRegion(mr);
 }
 
+void CardTableBarrierSet::set_young_boundary(HeapWord* boundary, bool young_below_boundary) {
+  assert(UseSerialGC || UseParallelGC, "Only these GCs scan all of the young generation");
+  assert(is_aligned(boundary, CardTable::card_size()), "boundary must be card aligned");
+  _young_boundary = boundary;
+  _young_below_boundary = young_below_boundary;
+}
+
 void CardTableBarrierSet::print_on(outputStream* st) const {
   card_table()->print_on(st);
 }
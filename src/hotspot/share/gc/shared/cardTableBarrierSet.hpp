@@ -52,6 +52,13 @@ class CardTableBarrierSet: public BarrierSet {
   typedef CardTable::CardValue CardValue;
   Atomic<CardTable*> _card_table;
 
+  // With UseFilteredCardMark, stores into the young generation do not dirty
+  // cards, as young collections scan all of the young generation anyway. The
+  // young generation is reserved at one end of the heap, either below or at
+  // and above _young_boundary. Null if stores are not filtered.
+  HeapWord* _young_boundary;
+  bool      _young_below_boundary;
+
   CardTableBarrierSet(BarrierSetAssembler* barrier_set_assembler,
                       BarrierSetC1* barrier_set_c1,
                       BarrierSetC2* barrier_set_c2,
@@ -79,6 +86,22 @@ class CardTableBarrierSet: public BarrierSet {
   // Causes all refs in "mr" to be assumed to be modified (by this JavaThread).
   virtual void write_region(MemRegion mr);
 
+  // Enable UseFilteredCardMark for a young generation reserved below or at
+  // and above boundary. Must be called before any code is generated.
+  void set_young_boundary(HeapWord* boundary, bool young_below_boundary);
+
+  bool filter_card_marks() const                 { return _young_boundary != nullptr; }
+  HeapWord* young_boundary() const               { return _young_boundary; }
+  bool young_below_boundary() const              { return _young_below_boundary; }
+  // Card index of the young boundary, to compare with card indices of stores.
+  uintptr_t young_boundary_card_index() const    { return uintptr_t(_young_boundary) >> CardTable::card_shift(); }
+
+  bool is_filtered_store(const void* addr) const {
+    return filter_card_marks() &&
+           (_young_below_boundary ? addr < (const void*)_young_boundary
+                                  : addr >= (const void*)_young_boundary);
+  }
+
   // Operations on arrays, or general regions (e.g., for "clone") may be
   // optimized by some barriers.
 
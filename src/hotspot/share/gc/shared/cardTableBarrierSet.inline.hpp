@@ -35,6 +35,9 @@
 
 template <DecoratorSet decorators, typename T>
 inline void CardTableBarrierSet::write_ref_field_post(T* field) {
+  if (is_filtered_store(field)) {
+    return;
+  }
   volatile CardValue* byte = card_table()->byte_for(field);
   *byte = CardTable::dirty_card_val();
 }
@@ -70,7 +73,9 @@ oop_store_in_heap(T* addr, oop value) {
   BarrierSetT *bs = barrier_set_cast<BarrierSetT>(barrier_set());
   bs->template write_ref_field_pre<decorators>(addr);
   Raw::oop_store(addr, value);
-  bs->template write_ref_field_post<decorators>(addr);
+  if (value != nullptr || !bs->filter_card_marks()) {
+    bs->template write_ref_field_post<decorators>(addr);
+  }
 }
 
 template <DecoratorSet decorators, typename BarrierSetT>
@@ -80,7 +85,7 @@ oop_atomic_cmpxchg_in_heap(T* addr, oop compare_value, oop new_value) {
   BarrierSetT *bs = barrier_set_cast<BarrierSetT>(barrier_set());
   bs->template write_ref_field_pre<decorators>(addr);
   oop result = Raw::oop_atomic_cmpxchg(addr, compare_value, new_value);
-  if (result == compare_value) {
+  if (result == compare_value && (new_value != nullptr || !bs->filter_card_marks())) {
     bs->template write_ref_field_post<decorators>(addr);
   }
   return result;
@@ -93,7 +98,9 @@ oop_atomic_xchg_in_heap(T* addr, oop new_value) {
   BarrierSetT *bs = barrier_set_cast<BarrierSetT>(barrier_set());
   bs->template write_ref_field_pre<decorators>(addr);
   oop result = Raw::oop_atomic_xchg(addr, new_value);
-  bs->template write_ref_field_post<decorators>(addr);
+  if (new_value != nullptr || !bs->filter_card_marks()) {
+    bs->template write_ref_field_post<decorators>(addr);
+  }
   return result;
 }
 
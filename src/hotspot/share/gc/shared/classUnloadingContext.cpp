@@ -105,6 +105,14 @@ void ClassUnloadingContext::register_unlinked_nmethod(nmethod* nm) {
   nm->set_is_unlinked();
 }
 
+size_t ClassUnloadingContext::num_unlinked_nmethods() const {
+  size_t result = 0;
+  for (uint i = 0; i < _num_nmethod_unlink_workers; ++i) {
+    result += _unlinked_nmethods[i]->length();
+  }
+  return result;
+}
+
 void ClassUnloadingContext::purge_nmethods() {
   assert(_context != nullptr, "no context set");
 
@@ -70,6 +70,8 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
 
   // Register unloading nmethods, potentially in parallel.
   void register_unlinked_nmethod(nmethod* nm);
+  // Number of nmethods registered as unlinked in this context.
+  size_t num_unlinked_nmethods() const;
   void purge_nmethods();
   void free_nmethods();
 
@@ -35,6 +35,10 @@ class ContinuationGCSupport : public AllStatic {
   // Relativize and transform to use a bitmap for future oop iteration for the
   // given oop if it is a stack chunk.
   static void transform_stack_chunk(oop obj);
+  // Whether an empty stack chunk can be handed out again for a new freeze
+  // without barriers, i.e. the GC has not transformed it and does not require
+  // barriers for accessing it.
+  static bool can_recycle_stack_chunk(stackChunkOop chunk);
 };
 
 #endif // SHARE_GC_SHARED_CONTINUATIONGCSUPPORT_HPP
@@ -53,4 +53,8 @@ inline void ContinuationGCSupport::transform_stack_chunk(oop obj) {
   }
 }
 
+inline bool ContinuationGCSupport::can_recycle_stack_chunk(stackChunkOop chunk) {
+  return !chunk->is_gc_mode() && !chunk->requires_barriers();
+}
+
 #endif // SHARE_GC_SHARED_CONTINUATIONGCSUPPORT_INLINE_HPP
@@ -203,19 +203,28 @@ void VM_GC_HeapInspection::doit() {
       log_warning(gc)("GC locker is held; pre-dump GC was skipped");
     }
   }
-  HeapInspection inspect;
   WorkerThreads* workers = Universe::heap()->safepoint_workers();
   if (workers != nullptr) {
     // The GC provided a WorkerThreads to be used during a safepoint.
     // Can't run with more threads than provided by the WorkerThreads.
     const uint capped_parallel_thread_num = MIN2(_parallel_thread_num, workers->max_workers());
     WithActiveWorkers with_active_workers(workers, capped_parallel_thread_num);
-    inspect.heap_inspection(_out, workers);
+    inspect(workers);
   } else {
-    inspect.heap_inspection(_out, nullptr);
+    inspect(nullptr);
   }
 }
 
+void VM_GC_HeapInspection::inspect(WorkerThreads* workers) {
+  HeapInspection inspect;
+  inspect.heap_inspection(_out, workers, _print_references);
+}
+
+void VM_GC_ReferenceStats::inspect(WorkerThreads* workers) {
+  HeapInspection inspect;
+  inspect.reference_stats(_out, workers);
+}
+
 VM_CollectForMetadataAllocation::VM_CollectForMetadataAllocation(ClassLoaderData* loader_data,
                                                                  size_t size,
                                                                  Metaspace::MetadataType mdtype,
@@ -173,19 +173,23 @@ class VM_GC_Collect_Operation : public VM_GC_Operation {
 
 
 class VM_GC_HeapInspection : public VM_GC_Service_Operation {
- private:
+ protected:
   outputStream* _out;
+ private:
   bool _full_gc;
   uint _parallel_thread_num;
+  bool _print_references;
 
  public:
   VM_GC_HeapInspection(outputStream* out, bool request_full_gc,
-                       uint parallel_thread_num = 1) :
+                       uint parallel_thread_num = 1,
+                       bool print_references = false) :
     VM_GC_Service_Operation(0 /* total collections,      dummy, ignored */,
                             GCCause::_heap_inspection /* GC Cause */,
                             0 /* total full collections, dummy, ignored */,
                             request_full_gc), _out(out), _full_gc(request_full_gc),
-                            _parallel_thread_num(parallel_thread_num) {}
+                            _parallel_thread_num(parallel_thread_num),
+                            _print_references(print_references) {}
 
   ~VM_GC_HeapInspection() {}
   virtual VMOp_Type type() const { return VMOp_GC_HeapInspection; }
@@ -195,6 +199,18 @@ class VM_GC_HeapInspection : public VM_GC_Service_Operation {
 
  protected:
   bool collect();
+  virtual void inspect(WorkerThreads* workers);
+};
+
+// Prints the statistics of java.lang.ref.Reference instances by class,
+// instead of the class histogram.
+class VM_GC_ReferenceStats : public VM_GC_HeapInspection {
+ public:
+  VM_GC_ReferenceStats(outputStream* out, bool request_full_gc, uint parallel_thread_num) :
+    VM_GC_HeapInspection(out, request_full_gc, parallel_thread_num) {}
+
+ protected:
+  virtual void inspect(WorkerThreads* workers);
 };
 
 class VM_CollectForAllocation : public VM_GC_Collect_Operation {
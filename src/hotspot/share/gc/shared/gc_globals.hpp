@@ -211,6 +211,40 @@
                "ParallelRefProcEnabled is true. Specify 0 to disable and "  \
                "use all threads.")                                          \
                                                                             \
+  product(uint, ReferenceProcessingTimePerThread, 0, EXPERIMENTAL,          \
+          "Ergonomically start one thread for this amount of estimated "    \
+          "reference processing time (in microseconds), based on the "      \
+          "cost per reference measured in earlier collections, if "         \
+          "ParallelRefProcEnabled is true. Specify 0 to only use "          \
+          "ReferencesPerThread.")                                           \
+                                                                            \
+  product(bool, UseDiscoveredReferenceArrays, true, DIAGNOSTIC,             \
+          "Record discovered Weak and PhantomReferences without "           \
+          "ReferenceQueue in arrays instead of linking them through the "   \
+          "discovered field")                                               \
+                                                                            \
+  product(bool, WeakProcessorSkipClearedEntries, false, DIAGNOSTIC,         \
+          "Skip OopStorage entries that an earlier weak processing has "    \
+          "cleared, and that have not been reallocated since")              \
+                                                                            \
+  product(bool, StringTableCleanDuringGC, false, DIAGNOSTIC,                \
+          "Remove dead StringTable entries on the GC worker threads right " \
+          "after parallel weak oop processing, instead of later on the "    \
+          "service thread")                                                 \
+                                                                            \
+  product(uint, ReferentLivenessPrediction, 0, EXPERIMENTAL,                \
+          "Treat a Reference as strong, without discovering it, once its "  \
+          "referent has been found alive this many collections in a row. "  \
+          "Such references are still discovered every "                     \
+          "ReferentLivenessRevalidationInterval collections. 0 disables "   \
+          "the prediction. (Serial, Parallel and G1 only)")                 \
+          range(0, 255)                                                     \
+                                                                            \
+  product(uint, ReferentLivenessRevalidationInterval, 8, EXPERIMENTAL,      \
+          "Number of collections between discoveries of References whose "  \
+          "referents are predicted alive by ReferentLivenessPrediction")    \
+          range(1, max_juint)                                               \
+                                                                            \
   product(uint, InitiatingHeapOccupancyPercent, 45,                         \
           "The percent occupancy (IHOP) of the current old generation "     \
           "capacity above which a concurrent mark cycle will be initiated " \
@@ -424,6 +458,10 @@
   product(bool, UseCondCardMark, false,                                     \
           "Check for already marked card before updating card table")       \
                                                                             \
+  product(bool, UseFilteredCardMark, false, EXPERIMENTAL,                   \
+          "Do not dirty cards for reference stores of null or into objects "\
+          "in the young generation. Serial and Parallel GC only")           \
+                                                                            \
   product(bool, DisableExplicitGC, false,                                   \
           "Ignore calls to System.gc()")                                    \
                                                                             \
@@ -543,6 +581,29 @@
           "during parallel gc")                                             \
           range(0, 8 * 1024)                                                \
                                                                             \
+  product(bool, BindGCWorkersToCPUs, false, EXPERIMENTAL,                   \
+          "Bind each GC worker thread to a processor, spreading the "       \
+          "workers of a group across physical cores before using a "        \
+          "second hardware thread of a core. Only supported on Linux.")     \
+                                                                            \
+  product(bool, UseCPUQuotaForGCWorkers, false, EXPERIMENTAL,               \
+          "With UseDynamicNumberOfGCThreads, do not activate more GC "      \
+          "worker threads than the whole CPUs of the container CPU "        \
+          "quota, to avoid CPU throttling during parallel GC phases")       \
+                                                                            \
+  product(bool, SATBBufferDeduplication, false, EXPERIMENTAL,               \
+          "When filtering a full SATB buffer, also remove entries that "    \
+          "repeat a recently kept entry of the same buffer, so that "       \
+          "repeatedly overwritten or loaded references are handed to "      \
+          "concurrent marking only once")                                   \
+                                                                            \
+  product(uint, GCStealBatchSize, 1, EXPERIMENTAL,                          \
+          "Maximum number of tasks a GC thread takes from the task queue "  \
+          "of another thread in one successful steal, up to half of the "   \
+          "tasks in that queue. Used by the evacuation and marking of "     \
+          "G1 and Parallel GC.")                                            \
+          range(1, 1024)                                                    \
+                                                                            \
   product(uint, GCCardSizeInBytes, 512,                                     \
           "Card table entry size (in bytes) for card based collectors")     \
           range(128, NOT_LP64(512) LP64_ONLY(1024))                         \
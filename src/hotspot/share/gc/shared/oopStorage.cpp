@@ -216,6 +216,7 @@ const unsigned block_alignment = sizeof(oop) * section_size;
 OopStorage::Block::Block(const OopStorage* owner, void* memory) :
   _data(),
   _allocated_bitmask(0),
+  _cleared_bitmask(0),
   _owner_address(reinterpret_cast<intptr_t>(owner)),
   _memory(memory),
   _active_index(0),
@@ -332,6 +333,8 @@ oop* OopStorage::Block::allocate() {
   uintx allocated = allocated_bitmask();
   assert(!is_full_bitmask(allocated), "attempt to allocate from full block");
   unsigned index = count_trailing_zeros(~allocated);
+  // The entry is about to get a new value, weak processing must look at it.
+  _cleared_bitmask.fetch_then_and(~bitmask_for_index(index), memory_order_relaxed);
   // Use atomic update because release may change bitmask.
   atomic_add_allocated(bitmask_for_index(index));
   return get_pointer(index);
@@ -340,6 +343,7 @@ oop* OopStorage::Block::allocate() {
 uintx OopStorage::Block::allocate_all() {
   uintx new_allocated = ~allocated_bitmask();
   assert(new_allocated != 0, "attempt to allocate from full block");
+  _cleared_bitmask.fetch_then_and(~new_allocated, memory_order_relaxed);
   // Use atomic update because release may change bitmask.
   atomic_add_allocated(new_allocated);
   return new_allocated;
@@ -785,6 +789,12 @@ void OopStorage::release(const oop* ptr) {
   _allocation_count.sub_then_fetch(1u);
 }
 
+void OopStorage::reset_cleared(const oop* ptr) {
+  Block* block = block_for_ptr(ptr);
+  assert(block != nullptr, "%s: invalid entry " PTR_FORMAT, name(), p2i(ptr));
+  block->reset_cleared(block->bitmask_for_entry(ptr));
+}
+
 void OopStorage::release(const oop* const* ptrs, size_t size) {
   size_t i = 0;
   while (i < size) {
@@ -812,6 +822,50 @@ void OopStorage::release(const oop* const* ptrs, size_t size) {
   }
 }
 
+OopStorageAllocationCache::OopStorageAllocationCache(OopStorage* storage) :
+  _storage(storage),
+  _count(0),
+  _entries()
+{}
+
+OopStorageAllocationCache::~OopStorageAllocationCache() {
+  flush();
+}
+
+oop* OopStorageAllocationCache::allocate() {
+  if (_count == 0) {
+    _count = _storage->allocate(_entries, capacity);
+    if (_count == 0) return nullptr; // Block allocation failed.
+  }
+  oop* result = _entries[--_count];
+  assert(*result == nullptr, "cached entry must be null");
+  // The entry may have been cleared by weak processing before it was
+  // released to the cache.
+  _storage->reset_cleared(result);
+  return result;
+}
+
+void OopStorageAllocationCache::release(oop* ptr) {
+  check_release_entry(ptr);
+  if (_count == capacity) {
+    // Keep the most recently released half for reuse.
+    const size_t half = capacity / 2;
+    _storage->release(_entries, half);
+    for (size_t i = half; i < capacity; ++i) {
+      _entries[i - half] = _entries[i];
+    }
+    _count -= half;
+  }
+  _entries[_count++] = ptr;
+}
+
+void OopStorageAllocationCache::flush() {
+  if (_count > 0) {
+    _storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
 OopStorage* OopStorage::create(const char* name, MemTag mem_tag) {
   return new (mem_tag) OopStorage(name, mem_tag);
 }
@@ -834,6 +888,7 @@ OopStorage::OopStorage(const char* name, MemTag mem_tag) :
   _allocation_mutex(make_oopstorage_mutex(name, "alloc", Mutex::oopstorage)),
   _active_mutex(make_oopstorage_mutex(name, "active", Mutex::oopstorage - 1)),
   _num_dead_callback(nullptr),
+  _dead_entries_callback(nullptr),
   _allocation_count(0),
   _concurrent_iteration_count(0),
   _mem_tag(mem_tag),
@@ -887,6 +942,21 @@ bool OopStorage::should_report_num_dead() const {
   return _num_dead_callback != nullptr;
 }
 
+void OopStorage::register_dead_entries_callback(DeadEntriesCallback f) {
+  assert(_dead_entries_callback == nullptr, "Only one callback function supported");
+  _dead_entries_callback = f;
+}
+
+void OopStorage::report_dead_entries(oop* const* entries, size_t count) const {
+  if (_dead_entries_callback != nullptr && count > 0) {
+    _dead_entries_callback(entries, count);
+  }
+}
+
+bool OopStorage::should_report_dead_entries() const {
+  return _dead_entries_callback != nullptr;
+}
+
 // Managing service thread notifications.
 
 // When a release operation changes a block's state to empty, it records the
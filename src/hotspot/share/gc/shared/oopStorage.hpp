@@ -135,6 +135,12 @@ class OopStorage : public CHeapObjBase {
   // precondition: *ptrs[i] == nullptr, for i in [0,size).
   void release(const oop* const* ptrs, size_t size);
 
+  // Makes weak processing visit ptr again after it has cleared it. For
+  // entries that are handed out again without going through allocate(),
+  // see OopStorageAllocationCache.
+  // precondition: ptr is a valid allocated entry.
+  void reset_cleared(const oop* ptr);
+
   // Applies f to each allocated entry's location.  f must be a function or
   // function object.  Assume p is either a const oop* or an oop*, depending
   // on whether the associated storage is const or non-const, respectively.
@@ -189,6 +195,21 @@ class OopStorage : public CHeapObjBase {
   // Used by the GC to test whether a callback function has been registered.
   bool should_report_num_dead() const;
 
+  typedef void (*DeadEntriesCallback)(oop* const* entries, size_t count);
+
+  // Used by a client to register a callback function with the GC.
+  // precondition: No more than one registration per storage object.
+  void register_dead_entries_callback(DeadEntriesCallback f);
+
+  // Called by the GC with a batch of entries cleared by an iteration.
+  // This calls the registered callback function, if any.  Several GC worker
+  // threads may call this in parallel, and entries that were already null
+  // are not reported.
+  void report_dead_entries(oop* const* entries, size_t count) const;
+
+  // Used by the GC to test whether a callback function has been registered.
+  bool should_report_dead_entries() const;
+
   // Service thread cleanup support.
 
   // Called by the service thread to process any pending cleanups for this
@@ -265,6 +286,7 @@ class OopStorage : public CHeapObjBase {
   Mutex* _allocation_mutex;
   Mutex* _active_mutex;
   NumDeadCallback _num_dead_callback;
+  DeadEntriesCallback _dead_entries_callback;
 
   // Atomic for racy unlocked accesses.
   Atomic<size_t> _allocation_count;
@@ -324,4 +346,35 @@ class OopStorage : public CHeapObjBase {
   template<typename F> static SkipNullFn<F> skip_null_fn(F f);
 };
 
+// A cache of entries of one OopStorage, for use by a single thread. Entries
+// are obtained from the storage in bulk, and released entries are kept for
+// reuse, so allocation and release from the cache usually don't take the
+// _allocation_mutex. Allocation from the cache resets the entry's cleared
+// state, so weak processing visits it again. Entries in the cache are null,
+// and count as allocated entries of the storage until the cache is flushed.
+class OopStorageAllocationCache {
+  static const size_t capacity = 16;
+
+  OopStorage* const _storage;
+  size_t _count;
+  oop* _entries[capacity];
+
+  NONCOPYABLE(OopStorageAllocationCache);
+
+public:
+  explicit OopStorageAllocationCache(OopStorage* storage);
+  ~OopStorageAllocationCache();
+
+  OopStorage* storage() const { return _storage; }
+
+  // Same contract as OopStorage::allocate().
+  oop* allocate();
+
+  // Same contract as OopStorage::release(const oop*).
+  void release(oop* ptr);
+
+  // Releases all cached entries to the storage.
+  void flush();
+};
+
 #endif // SHARE_GC_SHARED_OOPSTORAGE_HPP
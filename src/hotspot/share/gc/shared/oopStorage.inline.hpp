@@ -137,6 +137,7 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   static const unsigned _data_pos = 0; // Position of _data.
 
   Atomic<uintx> _allocated_bitmask; // One bit per _data element.
+  Atomic<uintx> _cleared_bitmask;   // Entries cleared by weak processing.
   intptr_t _owner_address;
   void* _memory;              // Unaligned storage containing block.
   size_t _active_index;
@@ -173,6 +174,13 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   bool is_empty() const;
   uintx allocated_bitmask() const;
 
+  // Entries that weak processing has set to null, and that have not been
+  // reallocated since. Such entries stay null, so later weak processing
+  // can skip them. Bits of unallocated entries are meaningless.
+  uintx cleared_bitmask() const;
+  void record_cleared(uintx cleared);
+  void reset_cleared(uintx bitmask);
+
   bool is_safe_to_delete() const;
 
   Block* deferred_updates_next() const;
@@ -326,6 +334,18 @@ inline uintx OopStorage::Block::allocated_bitmask() const {
   return _allocated_bitmask.load_relaxed();
 }
 
+inline uintx OopStorage::Block::cleared_bitmask() const {
+  return _cleared_bitmask.load_relaxed();
+}
+
+inline void OopStorage::Block::record_cleared(uintx cleared) {
+  _cleared_bitmask.fetch_then_or(cleared, memory_order_relaxed);
+}
+
+inline void OopStorage::Block::reset_cleared(uintx bitmask) {
+  _cleared_bitmask.fetch_then_and(~bitmask, memory_order_relaxed);
+}
+
 inline uintx OopStorage::Block::bitmask_for_index(unsigned index) const {
   check_index(index);
   return uintx(1) << index;
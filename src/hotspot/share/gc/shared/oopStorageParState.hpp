@@ -127,6 +127,14 @@
 //   If *p == nullptr then neither is_alive nor cl will be invoked for p.
 //   If is_alive->do_object_b(*p) is false, then cl will not be
 //   invoked on p.
+//
+// template<typename F> size_t iterate_uncleared(F f)
+//   Like iterate, but skips entries that an earlier iteration has cleared,
+//   if they have not been reallocated since.  Assume p is of type oop*.
+//   Then f(p) must return true if it set *p to null, so that later
+//   iterations skip the entry.  Returns the number of skipped entries.
+//   Only for weak storages, whose entries are never set from null to
+//   non-null after being allocated.
 
 class OopStorage::BasicParState {
   const OopStorage* _storage;
@@ -157,6 +165,7 @@ class OopStorage::BasicParState {
   const OopStorage* storage() const { return _storage; }
 
   template<bool is_const, typename F> void iterate(F f);
+  template<typename F> size_t iterate_uncleared(F f);
 
   static uint default_estimated_thread_count(bool concurrent);
 
@@ -198,6 +207,7 @@ class OopStorage::ParState<false, false> {
 
   const OopStorage* storage() const { return _basic_state.storage(); }
   template<typename F> void iterate(F f);
+  template<typename F> size_t iterate_uncleared(F f);
   template<typename Closure> void oops_do(Closure* cl);
   template<typename Closure> void weak_oops_do(Closure* cl);
   template<typename IsAliveClosure, typename Closure>
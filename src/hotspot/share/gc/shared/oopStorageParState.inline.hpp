@@ -29,7 +29,9 @@
 
 #include "cppstdlib/type_traits.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/population_count.hpp"
 
 template<typename F>
 class OopStorage::BasicParState::AlwaysTrueFn {
@@ -65,6 +67,35 @@ inline void OopStorage::BasicParState::iterate(F f) {
   }
 }
 
+template<typename F>
+inline size_t OopStorage::BasicParState::iterate_uncleared(F f) {
+  assert(!_concurrent, "entries might change while iterating");
+  size_t skipped = 0;
+  IterationData data = {};      // zero initialize.
+  while (claim_next_segment(&data)) {
+    assert(data._segment_start < data._segment_end, "invariant");
+    assert(data._segment_end <= _block_count, "invariant");
+    size_t i = data._segment_start;
+    do {
+      Block* block = _active_array->at(i);
+      const uintx allocated = block->allocated_bitmask();
+      const uintx uncleared = allocated & ~block->cleared_bitmask();
+      skipped += population_count(allocated ^ uncleared);
+      uintx cleared = 0;
+      for (uintx bitmask = uncleared; bitmask != 0; bitmask &= bitmask - 1) {
+        unsigned index = count_trailing_zeros(bitmask);
+        if (f(block->get_pointer(index))) {
+          cleared |= block->bitmask_for_index(index);
+        }
+      }
+      if (cleared != 0) {
+        block->record_cleared(cleared);
+      }
+    } while (++i < data._segment_end);
+  }
+  return skipped;
+}
+
 template<bool concurrent, bool is_const>
 template<typename F>
 inline void OopStorage::ParState<concurrent, is_const>::iterate(F f) {
@@ -82,6 +113,11 @@ inline void OopStorage::ParState<false, false>::iterate(F f) {
   _basic_state.template iterate<false>(f);
 }
 
+template<typename F>
+inline size_t OopStorage::ParState<false, false>::iterate_uncleared(F f) {
+  return _basic_state.iterate_uncleared(f);
+}
+
 template<typename Closure>
 inline void OopStorage::ParState<false, false>::oops_do(Closure* cl) {
   this->iterate(oop_fn(cl));
@@ -29,9 +29,10 @@
 
 PartialArraySplitter::PartialArraySplitter(PartialArrayStateManager* manager,
                                            uint num_workers,
-                                           size_t chunk_size)
+                                           size_t chunk_size,
+                                           uint chunks_per_worker)
   : _allocator(manager),
-    _stepper(num_workers, chunk_size)
+    _stepper(num_workers, chunk_size, chunks_per_worker)
     TASKQUEUE_STATS_ONLY(COMMA _stats())
 {}
 
@@ -37,6 +37,9 @@ class outputStream;
 // Helper class for splitting the processing of a large objArray into multiple
 // tasks, to permit multiple threads to work on different pieces of the array
 // in parallel.
+//
+// chunks_per_worker is passed on to the PartialArrayTaskStepper, with 0 for
+// a fixed chunk size.
 class PartialArraySplitter {
   PartialArrayStateAllocator _allocator;
   PartialArrayTaskStepper _stepper;
@@ -45,7 +48,8 @@ class PartialArraySplitter {
 public:
   PartialArraySplitter(PartialArrayStateManager* manager,
                        uint num_workers,
-                       size_t chunk_size);
+                       size_t chunk_size,
+                       uint chunks_per_worker = 0);
   ~PartialArraySplitter() = default;
 
   NONCOPYABLE(PartialArraySplitter);
@@ -66,6 +66,7 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
 
   // Claim a chunk and get number of additional tasks to enqueue.
   PartialArrayTaskStepper::Step step = _stepper.next(state);
+  const size_t chunk_size = _stepper.chunk_size(state->length());
   // Push additional tasks.
   if (step._ncreate > 0) {
     TASKQUEUE_STATS_ONLY(_stats.inc_pushed(step._ncreate);)
@@ -77,7 +78,7 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
   }
   // Release state, decrementing refcount, now that we're done with it.
   _allocator.release(state);
-  return Claim{step._index, step._index + _stepper.chunk_size()};
+  return Claim{step._index, step._index + chunk_size};
 }
 
 #endif // SHARE_GC_SHARED_PARTIALARRAYSPLITTER_INLINE_HPP
@@ -38,9 +38,14 @@ class PartialArrayState;
 // can enqueue multiple tasks at the same time.  We want to enqueue enough
 // tasks to benefit from the available parallelism, while not so many as to
 // substantially expand the task queues.
+//
+// The chunk size is either fixed, or adapted to the length of each array so
+// that an array is split into no more than about chunks_per_worker chunks for
+// each worker.  This bounds the number of claims and task queue operations
+// needed for arrays that are very large compared to the fixed chunk size.
 class PartialArrayTaskStepper {
 public:
-  PartialArrayTaskStepper(uint n_workers, size_t chunk_size);
+  PartialArrayTaskStepper(uint n_workers, size_t chunk_size, uint chunks_per_worker = 0);
 
   struct Step {
     size_t _index;              // Array index for the step.
@@ -60,14 +65,18 @@ class PartialArrayTaskStepper {
   // to enqueue.
   inline Step next(PartialArrayState* state) const;
 
-  // The size of chunks to claim for each task.
-  inline size_t chunk_size() const;
+  // The size of chunks to claim for each task of an array of the given length.
+  inline size_t chunk_size(size_t length) const;
 
   class TestSupport;            // For unit tests
 
 private:
-  // Size (number of elements) of a chunk to process.
+  // Size (number of elements) of a chunk to process, or the minimum
+  // size if adapted to the array length.
   size_t _chunk_size;
+  // Maximum number of chunks to split an array into, or 0 if the chunk
+  // size is fixed.
+  size_t _max_chunks;
   // Limit on the number of partial array tasks to create for a given array.
   uint _task_limit;
   // Maximum number of new tasks to create when processing an existing task.
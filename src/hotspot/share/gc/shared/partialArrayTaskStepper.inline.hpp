@@ -31,13 +31,16 @@
 #include "utilities/checkedCast.hpp"
 #include "utilities/debug.hpp"
 
-size_t PartialArrayTaskStepper::chunk_size() const {
-  return _chunk_size;
+size_t PartialArrayTaskStepper::chunk_size(size_t length) const {
+  if (_max_chunks == 0) {
+    return _chunk_size;
+  }
+  return MAX2(_chunk_size, length / _max_chunks);
 }
 
 PartialArrayTaskStepper::Step
 PartialArrayTaskStepper::start(size_t length) const {
-  size_t end = length % _chunk_size; // End of initial chunk.
+  size_t end = length % chunk_size(length); // End of initial chunk.
   // If the initial chunk is the complete array, then don't need any partial
   // tasks.  Otherwise, start with just one partial task; see new task
   // calculation in next().
@@ -51,18 +54,19 @@ PartialArrayTaskStepper::next_impl(size_t length, Atomic<size_t>* index_addr) co
   // Because we limit the number of enqueued tasks to being no more than the
   // number of remaining chunks to process, we can use an atomic add for the
   // claim, rather than a CAS loop.
-  size_t start = index_addr->fetch_then_add(_chunk_size, memory_order_relaxed);
+  const size_t chunk = chunk_size(length);
+  size_t start = index_addr->fetch_then_add(chunk, memory_order_relaxed);
 
   assert(start < length, "invariant: start %zu, length %zu", start, length);
-  assert(((length - start) % _chunk_size) == 0,
+  assert(((length - start) % chunk) == 0,
          "invariant: start %zu, length %zu, chunk size %zu",
-         start, length, _chunk_size);
+         start, length, chunk);
 
   // Determine the number of new tasks to create.
   // Zero-based index for this partial task.  The initial task isn't counted.
-  uint task_num = checked_cast<uint>(start / _chunk_size);
+  uint task_num = checked_cast<uint>(start / chunk);
   // Number of tasks left to process, including this one.
-  uint remaining_tasks = checked_cast<uint>((length - start) / _chunk_size);
+  uint remaining_tasks = checked_cast<uint>((length - start) / chunk);
   assert(remaining_tasks > 0, "invariant");
   // Compute number of pending tasks, including this one.  The maximum number
   // of tasks is a function of task_num (N) and _task_fanout (F).
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "classfile/javaClasses.inline.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "gc/shared/referenceDiscoverer.hpp"
+#include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/oopHandle.inline.hpp"
+#include "runtime/atomicAccess.hpp"
+#include "runtime/fieldDescriptor.inline.hpp"
+
+OopHandle ReferenceDiscoverer::_null_queue_handle;
+volatile bool ReferenceDiscoverer::_null_queue_handle_initialized = false;
+
+void ReferenceDiscoverer::initialize_null_queue_handle() {
+  if (is_null_queue_handle_initialized()) {
+    // Already initialized
+    return;
+  }
+
+  EXCEPTION_MARK;
+  TempNewSymbol class_name = SymbolTable::new_symbol("java/lang/ref/ReferenceQueue");
+  Klass* k = SystemDictionary::resolve_or_fail(class_name, true, CHECK);
+  InstanceKlass* ik = InstanceKlass::cast(k);
+  ik->initialize(CHECK);
+  fieldDescriptor fd;
+  bool found = ik->find_local_field(SymbolTable::new_symbol("NULL_QUEUE"),
+                                    vmSymbols::referencequeue_signature(), &fd);
+  assert(found && fd.is_static(), "ReferenceQueue.NULL_QUEUE missing");
+  oop null_q = ik->java_mirror()->obj_field(fd.offset());
+  _null_queue_handle = OopHandle(Universe::vm_global(), null_q);
+
+  // Publish to concurrent discovery
+  AtomicAccess::release_store(&_null_queue_handle_initialized, true);
+}
+
+bool ReferenceDiscoverer::is_null_queue_handle_initialized() {
+  return AtomicAccess::load_acquire(&_null_queue_handle_initialized);
+}
+
+bool ReferenceDiscoverer::has_reference_queue(oop reference) {
+  const java_lang_ref_Reference::QueueState state = java_lang_ref_Reference::queue_state(reference);
+  if (state != java_lang_ref_Reference::queue_unknown) {
+    return state == java_lang_ref_Reference::queue_present;
+  }
+
+  if (!is_null_queue_handle_initialized()) {
+    // Not yet known which queue is the null queue
+    return true;
+  }
+
+  oop ref_queue = reference->obj_field_access<AS_NO_KEEPALIVE>(java_lang_ref_Reference::queue_offset());
+  bool result = ref_queue != _null_queue_handle.resolve();
+  java_lang_ref_Reference::set_queue_state(reference, result ? java_lang_ref_Reference::queue_present
+                                                             : java_lang_ref_Reference::queue_none);
+  return result;
+}
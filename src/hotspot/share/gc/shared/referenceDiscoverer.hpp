@@ -27,11 +27,29 @@
 
 #include "memory/allocation.hpp"
 #include "memory/referenceType.hpp"
+#include "oops/oopHandle.hpp"
 #include "oops/oopsHierarchy.hpp"
 
 class ReferenceDiscoverer : public CHeapObj<mtGC> {
+protected:
+  // Handle to ReferenceQueue.NULL_QUEUE, shared by all reference processors
+  static OopHandle     _null_queue_handle;
+  static volatile bool _null_queue_handle_initialized;
+
 public:
   virtual bool discover_reference(oop obj, ReferenceType type) = 0;
+
+  // ReferenceQueue.NULL_QUEUE support. The handle is initialized when a
+  // reference processor first prepares for discovery, and stays valid
+  // for the lifetime of the VM.
+  static void initialize_null_queue_handle();
+  static bool is_null_queue_handle_initialized();
+
+  // Returns true if the reference was created with a ReferenceQueue, or if
+  // that is not yet known because the handle is uninitialized. The answer
+  // is cached in the reference, where it holds as long as the reference
+  // is active, so later calls avoid the queue load and handle resolve.
+  static bool has_reference_queue(oop reference);
 };
 
 #endif // SHARE_GC_SHARED_REFERENCEDISCOVERER_HPP
@@ -26,6 +26,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/referencePolicy.hpp"
+#include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "runtime/globals.hpp"
 
@@ -84,3 +85,55 @@ bool LRUMaxHeapPolicy::should_clear_reference(oop p,
 
   return true;
 }
+
+/////////////////////// TargetOccupancy //////////////////////
+
+LRUTargetOccupancyPolicy::LRUTargetOccupancyPolicy() :
+  _max_interval(max_max_interval()),
+  _last_used_at_gc(0) {
+  setup();
+}
+
+size_t LRUTargetOccupancyPolicy::target_occupancy() {
+  return MaxHeapSize / 100 * SoftRefTargetOccupancy;
+}
+
+// The interval LRUMaxHeapPolicy would use with the whole target free
+jlong LRUTargetOccupancyPolicy::max_max_interval() {
+  return (jlong)(target_occupancy() / M) * SoftRefLRUPolicyMSPerMB;
+}
+
+// Capture state (of-the-VM) information needed to evaluate the policy
+void LRUTargetOccupancyPolicy::setup() {
+  const size_t used = Universe::heap()->used_at_last_gc();
+  if (used == 0 || used == _last_used_at_gc) {
+    // No new live size estimate since the last adjustment
+    return;
+  }
+  _last_used_at_gc = used;
+
+  const size_t target = target_occupancy();
+  // Start over from the smallest step if everything was cleared
+  const double interval = (double)MAX2(_max_interval, (jlong)SoftRefLRUPolicyMSPerMB);
+  const double factor = MIN2((double)target / (double)used, 2.0);
+
+  _max_interval = clamp((jlong)(interval * factor), (jlong)0, max_max_interval());
+  log_debug(gc, ref)("SoftReference target occupancy %zuM, live %zuM, max interval " JLONG_FORMAT "ms",
+                     target / M, used / M, _max_interval);
+  assert(_max_interval >= 0,"Sanity check");
+}
+
+// The oop passed in is the SoftReference object, and not
+// the object the SoftReference points to.
+bool LRUTargetOccupancyPolicy::should_clear_reference(oop p,
+                                                      jlong timestamp_clock) {
+  jlong interval = timestamp_clock - java_lang_ref_SoftReference::timestamp(p);
+  assert(interval >= 0, "Sanity check");
+
+  // The interval will be zero if the ref was accessed since the last scavenge/gc.
+  if(interval <= _max_interval) {
+    return false;
+  }
+
+  return true;
+}
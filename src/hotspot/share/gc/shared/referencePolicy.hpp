@@ -80,4 +80,26 @@ class LRUMaxHeapPolicy : public ReferencePolicy {
   virtual bool should_clear_reference(oop p, jlong timestamp_clock);
 };
 
+// Used with SoftRefTargetOccupancy. The maximum interval since the last
+// access is adjusted once per new live size estimate of the collector
+// (CollectedHeap::used_at_last_gc()), in proportion to how far the live
+// size is from the target. Above the target, the interval shrinks and the
+// least recently used SoftReferences are cleared. Below it, the interval
+// grows back, at most doubling per estimate.
+class LRUTargetOccupancyPolicy : public ReferencePolicy {
+ private:
+  jlong  _max_interval;
+  size_t _last_used_at_gc;
+
+  static size_t target_occupancy();
+  static jlong max_max_interval();
+
+ public:
+  LRUTargetOccupancyPolicy();
+
+  // Capture state (of-the-VM) information needed to evaluate the policy
+  void setup();
+  virtual bool should_clear_reference(oop p, jlong timestamp_clock);
+};
+
 #endif // SHARE_GC_SHARED_REFERENCEPOLICY_HPP
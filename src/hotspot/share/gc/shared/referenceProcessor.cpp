@@ -28,6 +28,7 @@
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcUtil.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.inline.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
@@ -39,17 +40,16 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/nonJavaThread.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
 
-#include "classfile/symbolTable.hpp"
-#include "classfile/systemDictionary.hpp"
-#include "oops/oopHandle.inline.hpp"
-#include "runtime/fieldDescriptor.inline.hpp"
-
 ReferencePolicy* ReferenceProcessor::_always_clear_soft_ref_policy = nullptr;
 ReferencePolicy* ReferenceProcessor::_default_soft_ref_policy      = nullptr;
 jlong            ReferenceProcessor::_soft_ref_timestamp_clock = 0;
 
+// Weight of the most recent sample of the cost per reference of a phase
+static const unsigned RefProcPhaseCostWeight = 30;
+
 void referenceProcessor_init() {
   ReferenceProcessor::init_statics();
 }
@@ -65,7 +65,9 @@ void ReferenceProcessor::init_statics() {
   java_lang_ref_SoftReference::set_clock(_soft_ref_timestamp_clock);
 
   _always_clear_soft_ref_policy = new AlwaysClearPolicy();
-  if (CompilerConfig::is_c2_or_jvmci_compiler_enabled()) {
+  if (SoftRefTargetOccupancy > 0) {
+    _default_soft_ref_policy = new LRUTargetOccupancyPolicy();
+  } else if (CompilerConfig::is_c2_or_jvmci_compiler_enabled()) {
     _default_soft_ref_policy = new LRUMaxHeapPolicy();
   } else {
     _default_soft_ref_policy = new LRUCurrentHeapPolicy();
@@ -82,16 +84,25 @@ void ReferenceProcessor::enable_discovery() {
 #endif // ASSERT
 
   _discovering_refs = true;
+
+  // Periodically discover the references predicted to have live
+  // referents, so that the ones that did die are eventually cleared
+  _discovery_cycles++;
+  _revalidate_survivors = (_discovery_cycles % ReferentLivenessRevalidationInterval) == 0;
 }
 
 ReferenceProcessor::ReferenceProcessor(BoolObjectClosure* is_subject_to_discovery,
                                        uint      mt_processing_degree,
                                        uint      mt_discovery_degree,
                                        bool      concurrent_discovery,
-                                       BoolObjectClosure* is_alive_non_header)  :
+                                       BoolObjectClosure* is_alive_non_header,
+                                       bool      exclusive_discovery)  :
   _is_subject_to_discovery(is_subject_to_discovery),
   _discovering_refs(false),
+  _discovery_is_exclusive(exclusive_discovery),
   _next_id(0),
+  _discovery_cycles(0),
+  _revalidate_survivors(false),
   _is_alive_non_header(is_alive_non_header)
 {
   assert(is_subject_to_discovery != nullptr, "must be set");
@@ -110,7 +121,26 @@ ReferenceProcessor::ReferenceProcessor(BoolObjectClosure* is_subject_to_discover
 
   // Initialize all entries to null
   for (uint i = 0; i < _max_num_queues * number_of_subclasses_of_ref(); i++) {
-    _discovered_refs[i].clear();
+    ::new (&_discovered_refs[i]) DiscoveredList();
+  }
+
+  _discovered_ref_arrays = NEW_C_HEAP_ARRAY(DiscoveredArray,
+            _max_num_queues * number_of_ref_arrays(), mtGC);
+
+  _discoveredWeakRefArrays    = &_discovered_ref_arrays[0];
+  _discoveredPhantomRefArrays = &_discoveredWeakRefArrays[_max_num_queues];
+
+  for (uint i = 0; i < _max_num_queues * number_of_ref_arrays(); i++) {
+    ::new (&_discovered_ref_arrays[i]) DiscoveredArray();
+  }
+
+  _pending_segments = NEW_C_HEAP_ARRAY(PendingListSegment, _max_num_queues, mtGC);
+  for (uint i = 0; i < _max_num_queues; i++) {
+    ::new (&_pending_segments[i]) PendingListSegment();
+  }
+
+  for (uint i = 0; i < RefPhaseMax; i++) {
+    _phase_ns_per_ref[i] = new AdaptiveWeightedAverage(RefProcPhaseCostWeight);
   }
 
   setup_policy(false /* default soft ref policy */);
@@ -123,6 +153,14 @@ void ReferenceProcessor::verify_no_references_recorded() {
     guarantee(_discovered_refs[i].is_empty(),
               "Found non-empty discovered list at %u", i);
   }
+  for (uint i = 0; i < _max_num_queues * number_of_ref_arrays(); i++) {
+    guarantee(_discovered_ref_arrays[i].is_empty(),
+              "Found non-empty discovered array at %u", i);
+  }
+  for (uint i = 0; i < _max_num_queues; i++) {
+    guarantee(_pending_segments[i].is_empty(),
+              "Found non-empty pending list segment at %u", i);
+  }
 }
 #endif
 
@@ -138,6 +176,12 @@ void ReferenceProcessor::weak_oops_do(OopClosure* f) {
       f->do_oop((oop*)_discovered_refs[i].adr_head());
     }
   }
+  for (uint i = 0; i < _max_num_queues * number_of_ref_arrays(); i++) {
+    DiscoveredArray& refs_array = _discovered_ref_arrays[i];
+    for (size_t j = 0; j < refs_array.length(); j++) {
+      f->do_oop(refs_array.adr_at(j));
+    }
+  }
 }
 
 void ReferenceProcessor::update_soft_ref_master_clock() {
@@ -175,16 +219,38 @@ size_t ReferenceProcessor::total_count(DiscoveredList lists[]) const {
   return total;
 }
 
+size_t ReferenceProcessor::total_count(DiscoveredArray arrays[]) const {
+  size_t total = 0;
+  for (uint i = 0; i < _max_num_queues; ++i) {
+    total += arrays[i].length();
+  }
+  return total;
+}
+
+size_t ReferenceProcessor::total_weak_count() const {
+  return total_count(_discoveredWeakRefs) + total_count(_discoveredWeakRefArrays);
+}
+
+size_t ReferenceProcessor::total_phantom_count() const {
+  return total_count(_discoveredPhantomRefs) + total_count(_discoveredPhantomRefArrays);
+}
+
 #ifdef ASSERT
 void ReferenceProcessor::verify_total_count_zero(DiscoveredList lists[], const char* type) {
   size_t count = total_count(lists);
   assert(count == 0, "%ss must be empty but has %zu elements", type, count);
 }
+
+void ReferenceProcessor::verify_total_count_zero(DiscoveredArray arrays[], const char* type) {
+  size_t count = total_count(arrays);
+  assert(count == 0, "%s arrays must be empty but have %zu elements", type, count);
+}
 #endif
 
 ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefProcProxyTask& proxy_task,
                                                                           WorkerThreads* workers,
-                                                                          ReferenceProcessorPhaseTimes& phase_times) {
+                                                                          ReferenceProcessorPhaseTimes& phase_times,
+                                                                          bool defer_phantom_refs) {
 
   double start_time = os::elapsedTime();
 
@@ -192,9 +258,9 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
   disable_discovery();
 
   phase_times.set_ref_discovered(REF_SOFT, total_count(_discoveredSoftRefs));
-  phase_times.set_ref_discovered(REF_WEAK, total_count(_discoveredWeakRefs));
+  phase_times.set_ref_discovered(REF_WEAK, total_weak_count());
   phase_times.set_ref_discovered(REF_FINAL, total_count(_discoveredFinalRefs));
-  phase_times.set_ref_discovered(REF_PHANTOM, total_count(_discoveredPhantomRefs));
+  phase_times.set_ref_discovered(REF_PHANTOM, total_phantom_count());
 
   update_soft_ref_master_clock();
 
@@ -210,15 +276,24 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
     process_final_keep_alive(proxy_task, workers, phase_times);
   }
 
-  {
+  if (!defer_phantom_refs) {
     RefProcTotalPhaseTimesTracker tt(PhantomRefsPhase, &phase_times);
     process_phantom_refs(proxy_task, workers, phase_times);
   }
 
+  if (!defer_phantom_refs) {
+    phase_times.set_ref_enqueued(splice_pending_list(proxy_task.splice_enqueue()));
+  }
+
   phase_times.set_total_time_ms((os::elapsedTime() - start_time) * 1000);
 
-  // Elements on discovered lists were pushed to the pending list.
-  verify_no_references_recorded();
+  if (!defer_phantom_refs) {
+    update_phase_ns_per_ref(phase_times);
+    phase_times.publish_last_stats();
+
+    // Elements on discovered lists were pushed to the pending list.
+    verify_no_references_recorded();
+  }
 
   ReferenceProcessorStats stats(phase_times.ref_discovered(REF_SOFT),
                                 phase_times.ref_discovered(REF_WEAK),
@@ -227,20 +302,65 @@ ReferenceProcessorStats ReferenceProcessor::process_discovered_references(RefPro
   return stats;
 }
 
-void ReferenceProcessor::initialize_null_queue_handle() {
-  EXCEPTION_MARK;
-  TempNewSymbol class_name = SymbolTable::new_symbol("java/lang/ref/ReferenceQueue");
-  Klass* k = SystemDictionary::resolve_or_fail(class_name, true, CHECK);
-  InstanceKlass* ik = InstanceKlass::cast(k);
-  ik->initialize(CHECK);
-  fieldDescriptor fd;
-  bool found = ik->find_local_field(SymbolTable::new_symbol("NULL_QUEUE"),
-                                    vmSymbols::referencequeue_signature(), &fd);
-  assert(found && fd.is_static(), "ReferenceQueue.NULL_QUEUE missing");
-  oop null_q = ik->java_mirror()->obj_field(fd.offset());
-  _null_queue_handle = OopHandle(Universe::vm_global(), null_q);
+size_t ReferenceProcessor::splice_pending_list(EnqueueDiscoveredFieldClosure* enqueue) {
+  oop head = nullptr;
+  oop tail = nullptr;
+  size_t enqueued = 0;
+
+  for (uint i = 0; i < _max_num_queues; i++) {
+    PendingListSegment& segment = _pending_segments[i];
+    if (segment.is_empty()) {
+      continue;
+    }
+    if (head == nullptr) {
+      head = segment.head();
+    } else {
+      enqueue->enqueue(java_lang_ref_Reference::discovered_addr_raw(tail), segment.head());
+    }
+    tail = segment.tail();
+    enqueued += segment.length();
+    segment.clear();
+  }
+
+  if (head != nullptr) {
+    // Swap the spliced segments into the pending list and set the
+    // last discovered to what we read from the pending list.
+    oop old = Universe::swap_reference_pending_list(head);
+    enqueue->enqueue(java_lang_ref_Reference::discovered_addr_raw(tail), old);
+  }
+
+  log_debug(gc, ref)("Enqueued %zu References on the pending list", enqueued);
+  return enqueued;
 }
-  
+
+void ReferenceProcessor::update_phase_ns_per_ref(ReferenceProcessorPhaseTimes& phase_times) {
+  for (uint i = 0; i < RefPhaseMax; i++) {
+    RefProcPhases phase = static_cast<RefProcPhases>(i);
+    double ns_per_ref = phase_times.phase_ns_per_ref(phase);
+    if (ns_per_ref < 0.0) {
+      // Phase did not process any references
+      continue;
+    }
+    _phase_ns_per_ref[i]->sample((float)ns_per_ref);
+    log_debug(gc, ref)("Phase %u cost: %.1fns/ref (avg: %.1fns/ref)",
+                       i, ns_per_ref, _phase_ns_per_ref[i]->average());
+  }
+}
+
+void DiscoveredArray::grow(size_t min_capacity) {
+  const size_t new_capacity = MAX3(min_capacity, _capacity * 2, (size_t)64);
+  _refs = REALLOC_C_HEAP_ARRAY(oop, _refs, new_capacity, mtGC);
+  _capacity = new_capacity;
+}
+
+void DiscoveredArray::move_to(DiscoveredArray& other, size_t count) {
+  assert(count <= _length, "Moving %zu out of %zu references", count, _length);
+  for (size_t i = _length - count; i < _length; i++) {
+    other.append(_refs[i]);
+  }
+  _length -= count;
+}
+
 
 void BarrierEnqueueDiscoveredFieldClosure::enqueue(HeapWord* discovered_field_addr, oop value) {
   assert(Universe::heap()->is_in(discovered_field_addr), PTR_FORMAT " not in heap", p2i(discovered_field_addr));
@@ -254,6 +374,10 @@ void DiscoveredListIterator::load_ptrs(DEBUG_ONLY(bool allow_null_referent)) {
   assert(_current_discovered_addr && oopDesc::is_oop_or_null(discovered),
          "Expected an oop or null for discovered field at " PTR_FORMAT, p2i(discovered));
   _next_discovered = discovered;
+  if (_next_discovered != _current_discovered) {
+    // Start loading the fields of the next reference while this one is processed
+    Prefetch::read(_next_discovered, java_lang_ref_Reference::referent_offset());
+  }
   _referent = java_lang_ref_Reference::unknown_referent_no_keepalive(_current_discovered);
   assert(Universe::heap()->is_in_or_null(_referent),
          "Wrong oop found in java.lang.Reference object");
@@ -265,6 +389,40 @@ void DiscoveredListIterator::load_ptrs(DEBUG_ONLY(bool allow_null_referent)) {
          p2i(_referent));
 }
 
+oop DiscoveredList::ref_at(size_t pos) const {
+  assert(pos < _len, "out of bounds");
+
+  // Start from the closest recorded reference at or before the position,
+  // there are at most SegmentLength - 1 references to walk from there.
+  const size_t distance = _len - 1 - pos;
+  const size_t segment = (distance + 1 + SegmentLength - 1) / SegmentLength - 1;
+
+  oop ref;
+  size_t steps;
+  if (segment < _segments.length()) {
+    ref = _segments.at(segment);
+    steps = (segment + 1) * SegmentLength - 1 - distance;
+  } else {
+    ref = head();
+    steps = pos;
+  }
+
+  for (; steps > 0; steps--) {
+    ref = java_lang_ref_Reference::discovered(ref);
+  }
+
+  return ref;
+}
+
+void DiscoveredList::remove_head_segment(size_t count, oop new_head) {
+  assert(count <= _len, "out of bounds");
+  set_head(new_head);
+  dec_length(count);
+
+  // Drop the recorded references that were part of the removed segment
+  _segments.truncate(MIN2(_segments.length(), _len / SegmentLength));
+}
+
 void DiscoveredListIterator::remove() {
   assert(oopDesc::is_oop(_current_discovered), "Dropping a bad reference");
   RawAccess<>::oop_store(_current_discovered_addr, oop(nullptr));
@@ -284,6 +442,7 @@ void DiscoveredListIterator::remove() {
   RawAccess<>::oop_store(_prev_discovered_addr, new_next);
   _removed++;
   _refs_list.dec_length(1);
+  _refs_list.invalidate_segments();
 }
 
 void DiscoveredListIterator::make_referent_alive() {
@@ -307,19 +466,18 @@ void DiscoveredListIterator::enqueue() {
   }
 }
 
-void DiscoveredListIterator::complete_enqueue() {
+void DiscoveredListIterator::complete_enqueue(PendingListSegment* segment) {
   if (_prev_discovered != nullptr) {
     // This is the last object.
-    // Swap refs_list into pending list and set obj's
-    // discovered to what we read from the pending list.
-    oop old = Universe::swap_reference_pending_list(_refs_list.head());
-    _enqueue->enqueue(java_lang_ref_Reference::discovered_addr_raw(_prev_discovered), old);
+    // Link refs_list in front of the segment; the pending list
+    // itself is only updated once all segments are complete.
+    _enqueue->enqueue(java_lang_ref_Reference::discovered_addr_raw(_prev_discovered), segment->head());
+    segment->prepend(_refs_list.head(), _prev_discovered, _processed - _removed);
   }
 }
 
 bool DiscoveredListIterator::has_reference_queue() const {
-  oop ref_queue = _current_discovered->obj_field_access<AS_NO_KEEPALIVE>(java_lang_ref_Reference::queue_offset());
-  return ref_queue != _null_queue.resolve();
+  return ReferenceDiscoverer::has_reference_queue(_current_discovered);
 }
 
 inline void log_preclean_ref(const DiscoveredListIterator& iter, const char* reason) {
@@ -349,12 +507,25 @@ inline void log_enqueued_ref(const DiscoveredListIterator& iter, const char* rea
   assert(oopDesc::is_oop(iter.obj()), "Adding a bad reference");
 }
 
+// Called for a discovered reference whose referent was found alive.
+static void record_referent_survival(oop obj) {
+  if (ReferentLivenessPrediction > 0) {
+    const jint survivals = java_lang_ref_Reference::referent_survivals(obj);
+    if (survivals < (jint)ReferentLivenessPrediction) {
+      java_lang_ref_Reference::set_referent_survivals(obj, survivals + 1);
+    }
+  }
+}
+
 size_t ReferenceProcessor::process_discovered_list_work(DiscoveredList&    refs_list,
                                                         BoolObjectClosure* is_alive,
                                                         OopClosure*        keep_alive,
                                                         EnqueueDiscoveredFieldClosure* enqueue,
-                                                        bool               do_enqueue_and_clear) {
-  DiscoveredListIterator iter(refs_list, keep_alive, is_alive, enqueue, _null_queue_handle);
+                                                        PendingListSegment* segment,
+                                                        bool               do_enqueue_and_clear,
+                                                        size_t*            cleared_without_queue) {
+  DiscoveredListIterator iter(refs_list, keep_alive, is_alive, enqueue);
+  size_t cleared_count = 0;
   while (iter.has_next()) {
     iter.load_ptrs(DEBUG_ONLY(discovery_is_concurrent() /* allow_null_referent */));
     if (iter.referent() == nullptr) {
@@ -368,6 +539,7 @@ size_t ReferenceProcessor::process_discovered_list_work(DiscoveredList&    refs_
       // The referent is reachable after all.
       // Remove reference from list.
       log_dropped_ref(iter, "reachable");
+      record_referent_survival(iter.obj());
       iter.remove();
       // Update the referent pointer as necessary.  Note that this
       // should not entail any recursive marking because the
@@ -380,6 +552,7 @@ size_t ReferenceProcessor::process_discovered_list_work(DiscoveredList&    refs_
         if (!iter.has_reference_queue()) {
           iter.remove();
           iter.move_to_next();
+          cleared_count++;
           log_enqueued_ref(iter, "cleared and dropped (no ReferenceQueue)");
           continue;
         }
@@ -391,9 +564,10 @@ size_t ReferenceProcessor::process_discovered_list_work(DiscoveredList&    refs_
     }
   }
   if (do_enqueue_and_clear) {
-    iter.complete_enqueue();
+    iter.complete_enqueue(segment);
     refs_list.clear();
   }
+  *cleared_without_queue += cleared_count;
 
   log_develop_trace(gc, ref)(" Dropped %zu active Refs out of %zu"
                              " Refs in discovered list " PTR_FORMAT,
@@ -401,10 +575,82 @@ size_t ReferenceProcessor::process_discovered_list_work(DiscoveredList&    refs_
   return iter.removed();
 }
 
+// Distance, in references, at which the referents of the references in a
+// DiscoveredArray are prefetched while the array is processed. The references
+// themselves are prefetched twice as far ahead, so that their referent field
+// is in the cache when it is loaded to prefetch the referent.
+static const size_t RefArrayPrefetchDistance = 8;
+
+static void prefetch_refarray(DiscoveredArray& refs_array, size_t i) {
+  const size_t length = refs_array.length();
+
+  if (i + 2 * RefArrayPrefetchDistance < length) {
+    Prefetch::read(refs_array.at(i + 2 * RefArrayPrefetchDistance), java_lang_ref_Reference::referent_offset());
+  }
+
+  if (i + RefArrayPrefetchDistance < length) {
+    // The referent is only used as a prefetch address, a raw load will do.
+    HeapWord* const referent_addr = java_lang_ref_Reference::referent_addr_raw(refs_array.at(i + RefArrayPrefetchDistance));
+    const oop referent = UseCompressedOops ? RawAccess<>::oop_load((narrowOop*)referent_addr)
+                                           : RawAccess<>::oop_load((oop*)referent_addr);
+    if (referent != nullptr) {
+      // Copying collectors check the mark word of the referent for forwarding
+      Prefetch::read(referent, oopDesc::mark_offset_in_bytes());
+    }
+  }
+}
+
+size_t ReferenceProcessor::process_discovered_array_work(DiscoveredArray&   refs_array,
+                                                         BoolObjectClosure* is_alive,
+                                                         OopClosure*        keep_alive,
+                                                         size_t*            cleared_without_queue) {
+  size_t cleared_count = 0;
+  for (size_t i = 0; i < refs_array.length(); i++) {
+    prefetch_refarray(refs_array, i);
+
+    const oop obj = refs_array.at(i);
+    const oop referent = java_lang_ref_Reference::unknown_referent_no_keepalive(obj);
+    assert(discovery_is_concurrent() ? oopDesc::is_oop_or_null(referent) : oopDesc::is_oop(referent),
+           "Expected an oop for referent field of " PTR_FORMAT, p2i(obj));
+
+    // Drop the reference, nothing is linked through the discovered field
+    assert(java_lang_ref_Reference::discovered(obj) == obj, "Should be self-looped");
+    java_lang_ref_Reference::set_discovered_raw(obj, nullptr);
+
+    if (referent == nullptr) {
+      // Cleared since discovery; only possible if discovery is concurrent
+      log_develop_trace(gc, ref)("Dropping cleared reference " PTR_FORMAT, p2i(obj));
+    } else if (is_alive->do_object_b(referent)) {
+      // The referent is reachable after all, update the referent pointer
+      log_develop_trace(gc, ref)("Dropping reachable reference " PTR_FORMAT, p2i(obj));
+      record_referent_survival(obj);
+      HeapWord* const referent_addr = java_lang_ref_Reference::referent_addr_raw(obj);
+      if (UseCompressedOops) {
+        keep_alive->do_oop((narrowOop*)referent_addr);
+      } else {
+        keep_alive->do_oop((oop*)referent_addr);
+      }
+    } else {
+      log_develop_trace(gc, ref)("Clearing and dropping reference " PTR_FORMAT " (no ReferenceQueue)", p2i(obj));
+      java_lang_ref_Reference::clear_referent_raw(obj);
+      cleared_count++;
+    }
+  }
+  *cleared_without_queue += cleared_count;
+
+  const size_t removed = refs_array.length();
+  refs_array.clear();
+
+  log_develop_trace(gc, ref)(" Dropped %zu Refs in discovered array " PTR_FORMAT,
+                             removed, p2i(&refs_array));
+  return removed;
+}
+
 size_t ReferenceProcessor::process_final_keep_alive_work(DiscoveredList& refs_list,
                                                          OopClosure*     keep_alive,
-                                                         EnqueueDiscoveredFieldClosure* enqueue) {
-  DiscoveredListIterator iter(refs_list, keep_alive, nullptr, enqueue, _null_queue_handle);
+                                                         EnqueueDiscoveredFieldClosure* enqueue,
+                                                         PendingListSegment* segment) {
+  DiscoveredListIterator iter(refs_list, keep_alive, nullptr, enqueue);
   while (iter.has_next()) {
     iter.load_ptrs(DEBUG_ONLY(false /* allow_null_referent */));
     // keep the referent and followers around
@@ -418,7 +664,7 @@ size_t ReferenceProcessor::process_final_keep_alive_work(DiscoveredList& refs_li
     log_enqueued_ref(iter, "Final");
     iter.next();
   }
-  iter.complete_enqueue();
+  iter.complete_enqueue(segment);
   refs_list.clear();
 
   assert(iter.removed() == 0, "This phase does not remove anything.");
@@ -437,6 +683,14 @@ ReferenceProcessor::clear_discovered_references(DiscoveredList& refs_list) {
   refs_list.clear();
 }
 
+void
+ReferenceProcessor::clear_discovered_references(DiscoveredArray& refs_array) {
+  for (size_t i = 0; i < refs_array.length(); i++) {
+    java_lang_ref_Reference::set_discovered_raw(refs_array.at(i), nullptr);
+  }
+  refs_array.clear();
+}
+
 void ReferenceProcessor::abandon_partial_discovery() {
   // loop over the lists
   for (uint i = 0; i < _max_num_queues * number_of_subclasses_of_ref(); i++) {
@@ -445,6 +699,11 @@ void ReferenceProcessor::abandon_partial_discovery() {
     }
     clear_discovered_references(_discovered_refs[i]);
   }
+  // and over the arrays
+  log_develop_trace(gc, ref)("Abandoning discovered arrays");
+  for (uint i = 0; i < _max_num_queues * number_of_ref_arrays(); i++) {
+    clear_discovered_references(_discovered_ref_arrays[i]);
+  }
 }
 
 size_t ReferenceProcessor::total_reference_count(ReferenceType type) const {
@@ -455,14 +714,12 @@ size_t ReferenceProcessor::total_reference_count(ReferenceType type) const {
       list = _discoveredSoftRefs;
       break;
     case REF_WEAK:
-      list = _discoveredWeakRefs;
-      break;
+      return total_weak_count();
     case REF_FINAL:
       list = _discoveredFinalRefs;
       break;
     case REF_PHANTOM:
-      list = _discoveredPhantomRefs;
-      break;
+      return total_phantom_count();
     case REF_NONE:
     default:
       ShouldNotReachHere();
@@ -477,6 +734,7 @@ void RefProcTask::process_discovered_list(uint worker_id,
                                           EnqueueDiscoveredFieldClosure* enqueue) {
   ReferenceProcessor::RefProcSubPhases subphase;
   DiscoveredList* dl;
+  DiscoveredArray* da = nullptr;
   switch (ref_type) {
     case ReferenceType::REF_SOFT:
       subphase = ReferenceProcessor::ProcessSoftRefSubPhase;
@@ -485,6 +743,7 @@ void RefProcTask::process_discovered_list(uint worker_id,
     case ReferenceType::REF_WEAK:
       subphase = ReferenceProcessor::ProcessWeakRefSubPhase;
       dl = _ref_processor._discoveredWeakRefs;
+      da = _ref_processor._discoveredWeakRefArrays;
       break;
     case ReferenceType::REF_FINAL:
       subphase = ReferenceProcessor::ProcessFinalRefSubPhase;
@@ -493,6 +752,7 @@ void RefProcTask::process_discovered_list(uint worker_id,
     case ReferenceType::REF_PHANTOM:
       subphase = ReferenceProcessor::ProcessPhantomRefsSubPhase;
       dl = _ref_processor._discoveredPhantomRefs;
+      da = _ref_processor._discoveredPhantomRefArrays;
       break;
     default:
       ShouldNotReachHere();
@@ -503,12 +763,24 @@ void RefProcTask::process_discovered_list(uint worker_id,
 
   {
     RefProcSubPhasesWorkerTimeTracker tt(subphase, _phase_times, tracker_id(worker_id));
-    size_t const removed = _ref_processor.process_discovered_list_work(dl[worker_id],
-                                                                       is_alive,
-                                                                       keep_alive,
-                                                                       enqueue,
-                                                                       do_enqueue_and_clear);
+    size_t cleared_without_queue = 0;
+    size_t removed = _ref_processor.process_discovered_list_work(dl[worker_id],
+                                                                 is_alive,
+                                                                 keep_alive,
+                                                                 enqueue,
+                                                                 &_ref_processor._pending_segments[worker_id],
+                                                                 do_enqueue_and_clear,
+                                                                 &cleared_without_queue);
+
+    if (da != nullptr) {
+      removed += _ref_processor.process_discovered_array_work(da[worker_id],
+                                                              is_alive,
+                                                              keep_alive,
+                                                              &cleared_without_queue);
+    }
     _phase_times->add_ref_dropped(ref_type, removed);
+    _phase_times->add_ref_cleared_without_queue(ref_type, cleared_without_queue);
+    _phase_times->record_sub_phase_work(subphase, tracker_id(worker_id), removed, cleared_without_queue);
   }
 }
 
@@ -551,31 +823,26 @@ class RefProcKeepAliveFinalPhaseTask: public RefProcTask {
                EnqueueDiscoveredFieldClosure* enqueue,
                VoidClosure* complete_gc) override {
     RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::KeepAliveFinalRefsSubPhase, _phase_times, tracker_id(worker_id));
-    _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], keep_alive, enqueue);
+    _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id],
+                                                 keep_alive,
+                                                 enqueue,
+                                                 &_ref_processor._pending_segments[worker_id]);
     // Close the reachable set
     complete_gc->do_void();
   }
 };
 
-class RefProcPhantomPhaseTask: public RefProcTask {
-public:
-  RefProcPhantomPhaseTask(ReferenceProcessor& ref_processor,
-                          ReferenceProcessorPhaseTimes* phase_times)
-    : RefProcTask(ref_processor,
-                  phase_times) {}
-
-  void rp_work(uint worker_id,
-               BoolObjectClosure* is_alive,
-               OopClosure* keep_alive,
-               EnqueueDiscoveredFieldClosure* enqueue,
-               VoidClosure* complete_gc) override {
-    process_discovered_list(worker_id, REF_PHANTOM, is_alive, keep_alive, enqueue);
+void RefProcPhantomPhaseTask::rp_work(uint worker_id,
+                                      BoolObjectClosure* is_alive,
+                                      OopClosure* keep_alive,
+                                      EnqueueDiscoveredFieldClosure* enqueue,
+                                      VoidClosure* complete_gc) {
+  process_discovered_list(worker_id, REF_PHANTOM, is_alive, keep_alive, enqueue);
 
-    // Close the reachable set; needed for collectors which keep_alive_closure do
-    // not immediately complete their work.
-    complete_gc->do_void();
-  }
-};
+  // Close the reachable set; needed for collectors which keep_alive_closure do
+  // not immediately complete their work.
+  complete_gc->do_void();
+}
 
 void ReferenceProcessor::log_reflist(const char* prefix, DiscoveredList list[], uint num_active_queues) {
   LogTarget(Trace, gc, ref) lt;
@@ -595,6 +862,24 @@ void ReferenceProcessor::log_reflist(const char* prefix, DiscoveredList list[],
   ls.print_cr("(%zu)", total);
 }
 
+void ReferenceProcessor::log_refarray(const char* prefix, DiscoveredArray arrays[], uint num_active_queues) {
+  LogTarget(Trace, gc, ref) lt;
+
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  size_t total = 0;
+
+  LogStream ls(lt);
+  ls.print("%s", prefix);
+  for (uint i = 0; i < num_active_queues; i++) {
+    ls.print("%zu ", arrays[i].length());
+    total += arrays[i].length();
+  }
+  ls.print_cr("(%zu)", total);
+}
+
 #ifndef PRODUCT
 void ReferenceProcessor::log_reflist_counts(DiscoveredList ref_lists[], uint num_active_queues) {
   if (!log_is_enabled(Trace, gc, ref)) {
@@ -689,13 +974,9 @@ void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[]) {
       assert(refs_to_move > 0, "otherwise the code below will fail");
 
       oop move_head = ref_lists[from_idx].head();
-      oop move_tail = move_head;
-      oop new_head  = move_head;
       // find an element to split the list on
-      for (size_t j = 0; j < refs_to_move; ++j) {
-        move_tail = new_head;
-        new_head = java_lang_ref_Reference::discovered(new_head);
-      }
+      oop move_tail = ref_lists[from_idx].ref_at(refs_to_move - 1);
+      oop new_head  = java_lang_ref_Reference::discovered(move_tail);
 
       // Add the chain to the to list.
       if (ref_lists[to_idx].head() == nullptr) {
@@ -710,15 +991,21 @@ void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[]) {
       // Remove the chain from the from list.
       if (move_tail == new_head) {
         // We found the end of the from list.
-        ref_lists[from_idx].set_head(nullptr);
+        ref_lists[from_idx].remove_head_segment(refs_to_move, nullptr);
       } else {
-        ref_lists[from_idx].set_head(new_head);
+        ref_lists[from_idx].remove_head_segment(refs_to_move, new_head);
       }
-      ref_lists[from_idx].dec_length(refs_to_move);
 
       remaining_to_move -= refs_to_move;
     }
   }
+
+  // The chains moved to the head of a list have no recorded references, so
+  // add_as_head() would never record any again. Drop the bookkeeping, later
+  // balancing falls back to walking the lists.
+  for (uint i = 0; i < _max_num_queues; ++i) {
+    ref_lists[i].invalidate_segments();
+  }
 #ifdef ASSERT
   log_reflist_counts(ref_lists, _num_queues);
   size_t balanced_total_refs = 0;
@@ -729,6 +1016,75 @@ void ReferenceProcessor::balance_queues(DiscoveredList ref_lists[]) {
 #endif
 }
 
+bool ReferenceProcessor::need_balance_queues(DiscoveredArray refs_arrays[]) {
+  assert(processing_is_mt(), "why balance non-mt processing?");
+  // See need_balance_queues() for the lists.
+  if (ParallelRefProcBalancingEnabled) {
+    return true;
+  } else {
+    for (uint i = _num_queues; i < _max_num_queues; ++i) {
+      if (!refs_arrays[i].is_empty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+}
+
+void ReferenceProcessor::maybe_balance_queues(DiscoveredArray refs_arrays[]) {
+  assert(processing_is_mt(), "Should not call this otherwise");
+  if (need_balance_queues(refs_arrays)) {
+    balance_queues(refs_arrays);
+  }
+}
+
+// Balances arrays of discovered references the same way as the lists,
+// but moves the references in bulk from the end of the arrays.
+void ReferenceProcessor::balance_queues(DiscoveredArray refs_arrays[]) {
+  log_develop_trace(gc, ref)("Balance ref_arrays ");
+
+  log_refarray("", refs_arrays, _max_num_queues);
+
+  const size_t total_refs = total_count(refs_arrays);
+  const size_t avg_refs = total_refs / _num_queues + 1;
+  uint to_idx = 0;
+  for (uint from_idx = 0; from_idx < _max_num_queues; from_idx++) {
+    const size_t from_len = refs_arrays[from_idx].length();
+
+    size_t remaining_to_move;
+    if (from_idx >= _num_queues) {
+      // Move all
+      remaining_to_move = from_len;
+    } else {
+      // Move those above avg_refs
+      remaining_to_move = from_len > avg_refs
+                        ? from_len - avg_refs
+                        : 0;
+    }
+
+    while (remaining_to_move > 0) {
+      assert(to_idx < _num_queues, "Sanity Check!");
+
+      const size_t to_len = refs_arrays[to_idx].length();
+      if (to_len >= avg_refs) {
+        // this array is full enough; move on to next
+        to_idx++;
+        continue;
+      }
+      const size_t refs_to_move = MIN2(remaining_to_move, avg_refs - to_len);
+      refs_arrays[from_idx].move_to(refs_arrays[to_idx], refs_to_move);
+      remaining_to_move -= refs_to_move;
+    }
+  }
+#ifdef ASSERT
+  size_t balanced_total_refs = 0;
+  for (uint i = 0; i < _num_queues; ++i) {
+    balanced_total_refs += refs_arrays[i].length();
+  }
+  assert(total_refs == balanced_total_refs, "Balancing was incomplete");
+#endif
+}
+
 void ReferenceProcessor::run_task(RefProcTask& task, RefProcProxyTask& proxy_task, WorkerThreads* workers, bool marks_oops_alive) {
   log_debug(gc, ref)("ReferenceProcessor::execute queues: %d, %s, marks_oops_alive: %s",
                      num_queues(),
@@ -768,16 +1124,19 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
   }
 
   RefProcMTDegreeAdjuster a(this, SoftWeakFinalRefsPhase, num_active_workers(workers), num_total_refs);
+  phase_times.set_phase_work(SoftWeakFinalRefsPhase, num_total_refs, processing_is_mt() ? _num_queues : 1);
 
   if (processing_is_mt()) {
     RefProcBalanceQueuesTimeTracker tt(SoftWeakFinalRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredSoftRefs);
     maybe_balance_queues(_discoveredWeakRefs);
+    maybe_balance_queues(_discoveredWeakRefArrays);
     maybe_balance_queues(_discoveredFinalRefs);
   }
 
   log_reflist("SoftWeakFinalRefsPhase Soft before", _discoveredSoftRefs, _max_num_queues);
   log_reflist("SoftWeakFinalRefsPhase Weak before", _discoveredWeakRefs, _max_num_queues);
+  log_refarray("SoftWeakFinalRefsPhase Weak array before", _discoveredWeakRefArrays, _max_num_queues);
   log_reflist("SoftWeakFinalRefsPhase Final before", _discoveredFinalRefs, _max_num_queues);
 
   RefProcSoftWeakFinalPhaseTask phase_task(*this, &phase_times);
@@ -785,6 +1144,7 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
 
   verify_total_count_zero(_discoveredSoftRefs, "SoftReference");
   verify_total_count_zero(_discoveredWeakRefs, "WeakReference");
+  verify_total_count_zero(_discoveredWeakRefArrays, "WeakReference");
   log_reflist("SoftWeakFinalRefsPhase Final after", _discoveredFinalRefs, _max_num_queues);
 }
 
@@ -800,6 +1160,7 @@ void ReferenceProcessor::process_final_keep_alive(RefProcProxyTask& proxy_task,
   }
 
   RefProcMTDegreeAdjuster a(this, KeepAliveFinalRefsPhase, num_active_workers(workers), num_final_refs);
+  phase_times.set_phase_work(KeepAliveFinalRefsPhase, num_final_refs, processing_is_mt() ? _num_queues : 1);
 
   if (processing_is_mt()) {
     RefProcBalanceQueuesTimeTracker tt(KeepAliveFinalRefsPhase, &phase_times);
@@ -825,21 +1186,99 @@ void ReferenceProcessor::process_phantom_refs(RefProcProxyTask& proxy_task,
   }
 
   RefProcMTDegreeAdjuster a(this, PhantomRefsPhase, num_active_workers(workers), num_phantom_refs);
+  phase_times.set_phase_work(PhantomRefsPhase, num_phantom_refs, processing_is_mt() ? _num_queues : 1);
 
   if (processing_is_mt()) {
     RefProcBalanceQueuesTimeTracker tt(PhantomRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredPhantomRefs);
+    maybe_balance_queues(_discoveredPhantomRefArrays);
   }
 
   log_reflist("PhantomRefsPhase Phantom before", _discoveredPhantomRefs, _max_num_queues);
+  log_refarray("PhantomRefsPhase Phantom array before", _discoveredPhantomRefArrays, _max_num_queues);
 
   RefProcPhantomPhaseTask phase_task(*this, &phase_times);
   run_task(phase_task, proxy_task, workers, false);
 
   verify_total_count_zero(_discoveredPhantomRefs, "PhantomReference");
+  verify_total_count_zero(_discoveredPhantomRefArrays, "PhantomReference");
 }
 
-inline DiscoveredList* ReferenceProcessor::get_discovered_list(ReferenceType rt) {
+RefProcDeferredPhantomPhase::RefProcDeferredPhantomPhase(ReferenceProcessor& rp,
+                                                         RefProcProxyTask& proxy_task,
+                                                         WorkerThreads* workers,
+                                                         ReferenceProcessorPhaseTimes* phase_times) :
+  _rp(rp),
+  _proxy_task(proxy_task),
+  _phase_times(phase_times),
+  _start_time(os::elapsedTime()),
+  _degree_adjuster(&rp, ReferenceProcessor::PhantomRefsPhase, num_active_workers(workers), phase_times->ref_discovered(REF_PHANTOM)),
+  _phase_task(rp, phase_times),
+  _num_claims(0),
+  _next_claim(0) {
+
+  size_t const num_phantom_refs = phase_times->ref_discovered(REF_PHANTOM);
+
+  if (num_phantom_refs == 0) {
+    log_debug(gc, ref)("Skipped PhantomRefsPhase of Reference Processing: no references");
+    return;
+  }
+
+  bool const is_mt = _rp.processing_is_mt();
+  phase_times->set_phase_work(ReferenceProcessor::PhantomRefsPhase, num_phantom_refs, is_mt ? _rp._num_queues : 1);
+
+  if (is_mt) {
+    RefProcBalanceQueuesTimeTracker tt(ReferenceProcessor::PhantomRefsPhase, phase_times);
+    _rp.maybe_balance_queues(_rp._discoveredPhantomRefs);
+    _rp.maybe_balance_queues(_rp._discoveredPhantomRefArrays);
+  }
+
+  _rp.log_reflist("PhantomRefsPhase Phantom before", _rp._discoveredPhantomRefs, _rp._max_num_queues);
+  _rp.log_refarray("PhantomRefsPhase Phantom array before", _rp._discoveredPhantomRefArrays, _rp._max_num_queues);
+
+  log_debug(gc, ref)("ReferenceProcessor::deferred phantom queues: %d, %s",
+                     _rp.num_queues(),
+                     is_mt ? "RefProcThreadModel::Multi" : "RefProcThreadModel::Single");
+
+  _proxy_task.prepare_run_task(_phase_task, _rp.num_queues(), is_mt ? RefProcThreadModel::Multi : RefProcThreadModel::Single, false);
+  // Single threaded processing goes through all queues in one claim
+  _num_claims = is_mt ? _rp.num_queues() : 1;
+}
+
+RefProcDeferredPhantomPhase::~RefProcDeferredPhantomPhase() {
+  if (_num_claims > 0) {
+    assert(_next_claim.load_relaxed() >= _num_claims, "Only %u of %u queues claimed", _next_claim.load_relaxed(), _num_claims);
+    _rp.verify_total_count_zero(_rp._discoveredPhantomRefs, "PhantomReference");
+    _rp.verify_total_count_zero(_rp._discoveredPhantomRefArrays, "PhantomReference");
+
+    double const elapsed_ms = (os::elapsedTime() - _start_time) * 1000;
+    _phase_times->set_phase_time_ms(ReferenceProcessor::PhantomRefsPhase, elapsed_ms);
+  }
+
+  // All workers are done, the segments of earlier phases are spliced as well
+  _phase_times->set_ref_enqueued(_rp.splice_pending_list(_proxy_task.splice_enqueue()));
+  _phase_times->set_total_time_ms(_phase_times->total_time_ms() + (os::elapsedTime() - _start_time) * 1000);
+
+  _rp.update_phase_ns_per_ref(*_phase_times);
+  _phase_times->publish_last_stats();
+
+  // Elements on discovered lists were pushed to the pending list.
+  _rp.verify_no_references_recorded();
+}
+
+void RefProcDeferredPhantomPhase::work() {
+  for (uint claim = _next_claim.fetch_then_add(1u); claim < _num_claims; claim = _next_claim.fetch_then_add(1u)) {
+    if (_rp.processing_is_mt()) {
+      _proxy_task.work(claim);
+    } else {
+      for (uint i = 0; i < _rp.max_num_queues(); ++i) {
+        _proxy_task.work(i);
+      }
+    }
+  }
+}
+
+inline uint ReferenceProcessor::get_discovered_queue_id() {
   uint id = 0;
   // Determine the queue index to use for this object.
   if (_discovery_is_mt) {
@@ -854,7 +1293,10 @@ inline DiscoveredList* ReferenceProcessor::get_discovered_list(ReferenceType rt)
     }
   }
   assert(id < _max_num_queues, "Id is out of bounds id %u and max id %u)", id, _max_num_queues);
+  return id;
+}
 
+inline DiscoveredList* ReferenceProcessor::get_discovered_list(ReferenceType rt, uint id) {
   // Get the discovered queue to which we will add
   DiscoveredList* list = nullptr;
   switch (rt) {
@@ -880,8 +1322,34 @@ inline DiscoveredList* ReferenceProcessor::get_discovered_list(ReferenceType rt)
 }
 
 inline bool ReferenceProcessor::set_discovered_link(HeapWord* discovered_addr, oop next_discovered) {
-  return discovery_is_mt() ? set_discovered_link_mt(discovered_addr, next_discovered)
-                           : set_discovered_link_st(discovered_addr, next_discovered);
+  // With exclusive discovery no other thread can race to discover the same
+  // Reference, so a plain store is enough even if discovery is MT.
+  return (discovery_is_mt() && !discovery_is_exclusive()) ? set_discovered_link_mt(discovered_addr, next_discovered)
+                                                          : set_discovered_link_st(discovered_addr, next_discovered);
+}
+
+inline DiscoveredArray* ReferenceProcessor::get_discovered_array(ReferenceType rt, oop obj, uint id) {
+  if (!UseDiscoveredReferenceArrays) {
+    return nullptr;
+  }
+
+  // Soft references are kept on the lists, the soft reference policy
+  // is applied to them with a separate pass in the first phase, and
+  // Final references always need to be enqueued.
+  DiscoveredArray* array = nullptr;
+  switch (rt) {
+    case REF_WEAK:
+      array = &_discoveredWeakRefArrays[id];
+      break;
+    case REF_PHANTOM:
+      array = &_discoveredPhantomRefArrays[id];
+      break;
+    default:
+      return nullptr;
+  }
+
+  // Check the queue last, it requires an extra load
+  return has_reference_queue(obj) ? nullptr : array;
 }
 
 inline void ReferenceProcessor::add_to_discovered_list(DiscoveredList& refs_list,
@@ -905,9 +1373,27 @@ inline void ReferenceProcessor::add_to_discovered_list(DiscoveredList& refs_list
   }
 }
 
+inline void ReferenceProcessor::add_to_discovered_array(DiscoveredArray& refs_array,
+                                                        oop obj,
+                                                        HeapWord* discovered_addr) {
+  // Nothing is linked through the discovered field of references in an array.
+  // Self-loop it, to claim the reference when discovery is MT, and to tell
+  // that the reference is discovered.
+  bool added = set_discovered_link(discovered_addr, obj);
+  if (added) {
+    // Every thread has its own array.
+    refs_array.append(obj);
+    log_develop_trace(gc, ref)("Discovered reference without queue (%s) (" PTR_FORMAT ": %s)",
+                               discovery_is_mt() ? "mt" : "st", p2i(obj), obj->klass()->internal_name());
+  } else {
+    log_develop_trace(gc, ref)("Already discovered reference (mt) (" PTR_FORMAT ": %s)",
+                               p2i(obj), obj->klass()->internal_name());
+  }
+}
+
 inline bool ReferenceProcessor::set_discovered_link_st(HeapWord* discovered_addr,
                                                        oop next_discovered) {
-  assert(!discovery_is_mt(), "must be");
+  assert(!discovery_is_mt() || discovery_is_exclusive(), "must be");
 
   if (discovery_is_stw()) {
     // Do a raw store here: the field will be visited later when processing
@@ -922,7 +1408,7 @@ inline bool ReferenceProcessor::set_discovered_link_st(HeapWord* discovered_addr
 
 inline bool ReferenceProcessor::set_discovered_link_mt(HeapWord* discovered_addr,
                                                        oop next_discovered) {
-  assert(discovery_is_mt(), "must be");
+  assert(discovery_is_mt() && !discovery_is_exclusive(), "must be");
 
   // We must make sure this object is only enqueued once. Try to CAS into the discovered_addr.
   oop retest;
@@ -981,6 +1467,14 @@ bool ReferenceProcessor::discover_reference(oop obj, ReferenceType rt) {
     return false;
   }
 
+  if (ReferentLivenessPrediction > 0 && !_revalidate_survivors &&
+      java_lang_ref_Reference::referent_survivals(obj) >= (jint)ReferentLivenessPrediction) {
+    // The referent was alive the last ReferentLivenessPrediction times
+    // the reference was discovered. Predict that it still is, and treat
+    // the reference as strong until the next revalidation.
+    return false;
+  }
+
   // We only discover references whose referents are not (yet)
   // known to be strongly reachable.
   if (is_alive_non_header() != nullptr) {
@@ -1022,9 +1516,16 @@ bool ReferenceProcessor::discover_reference(oop obj, ReferenceType rt) {
     return true;
   }
 
-  // Get the right type of discovered queue head.
-  DiscoveredList* list = get_discovered_list(rt);
-  add_to_discovered_list(*list, obj, discovered_addr);
+  const uint id = get_discovered_queue_id();
+  DiscoveredArray* const array = get_discovered_array(rt, obj, id);
+  if (array != nullptr) {
+    // References without queue are never enqueued, record them in an array.
+    add_to_discovered_array(*array, obj, discovered_addr);
+  } else {
+    // Get the right type of discovered queue head.
+    DiscoveredList* list = get_discovered_list(rt, id);
+    add_to_discovered_list(*list, obj, discovered_addr);
+  }
 
   assert(oopDesc::is_oop(obj), "Discovered a bad reference");
   verify_referent(obj);
@@ -1069,6 +1570,18 @@ void ReferenceProcessor::preclean_discovered_references(BoolObjectClosure* is_al
       }
     }
     log_reflist("WeakRef after: ", _discoveredWeakRefs, _max_num_queues);
+
+    log_refarray("WeakRef array before: ", _discoveredWeakRefArrays, _max_num_queues);
+    for (uint i = 0; i < _max_num_queues; i++) {
+      if (yield->should_return()) {
+        return;
+      }
+      if (preclean_discovered_refarray(_discoveredWeakRefArrays[i], is_alive, yield)) {
+        log_refarray("WeakRef array abort: ", _discoveredWeakRefArrays, _max_num_queues);
+        return;
+      }
+    }
+    log_refarray("WeakRef array after: ", _discoveredWeakRefArrays, _max_num_queues);
   }
 
   // Final references
@@ -1103,6 +1616,18 @@ void ReferenceProcessor::preclean_discovered_references(BoolObjectClosure* is_al
       }
     }
     log_reflist("PhantomRef after: ", _discoveredPhantomRefs, _max_num_queues);
+
+    log_refarray("PhantomRef array before: ", _discoveredPhantomRefArrays, _max_num_queues);
+    for (uint i = 0; i < _max_num_queues; i++) {
+      if (yield->should_return()) {
+        return;
+      }
+      if (preclean_discovered_refarray(_discoveredPhantomRefArrays[i], is_alive, yield)) {
+        log_refarray("PhantomRef array abort: ", _discoveredPhantomRefArrays, _max_num_queues);
+        return;
+      }
+    }
+    log_refarray("PhantomRef array after: ", _discoveredPhantomRefArrays, _max_num_queues);
   }
 }
 
@@ -1110,7 +1635,7 @@ bool ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_lis
                                                      BoolObjectClosure* is_alive,
                                                      EnqueueDiscoveredFieldClosure* enqueue,
                                                      YieldClosure*      yield) {
-  DiscoveredListIterator iter(refs_list, nullptr /* keep_alive */, is_alive, enqueue, _null_queue_handle);
+  DiscoveredListIterator iter(refs_list, nullptr /* keep_alive */, is_alive, enqueue);
   while (iter.has_next()) {
     if (yield->should_return_fine_grain()) {
       return true;
@@ -1122,6 +1647,7 @@ bool ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_lis
       iter.move_to_next();
     } else if (iter.is_referent_alive()) {
       log_preclean_ref(iter, "reachable");
+      record_referent_survival(iter.obj());
       iter.remove();
       iter.move_to_next();
     } else {
@@ -1136,6 +1662,55 @@ bool ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_lis
   return false;
 }
 
+bool ReferenceProcessor::preclean_discovered_refarray(DiscoveredArray&   refs_array,
+                                                      BoolObjectClosure* is_alive,
+                                                      YieldClosure*      yield) {
+  // Compact the array in place, keeping the references with unreachable referents.
+  //
+  // A referent that is unreachable here can not be cleared yet, even though
+  // the reference has no queue. Until the pause that processes the arrays,
+  // the referent may still be marked, by entries in SATB buffers not yet
+  // drained, or by Reference.get() applying the keep-alive barrier. Clearing it
+  // concurrently would also race with Reference.get() returning it. So the
+  // outcome for these is left to the pause, which then only looks at the
+  // references that were unreachable when precleaning ran.
+  const size_t length = refs_array.length();
+  size_t kept = 0;
+  size_t i = 0;
+  bool aborted = false;
+
+  for (; i < length; i++) {
+    if (yield->should_return_fine_grain()) {
+      aborted = true;
+      break;
+    }
+    const oop obj = refs_array.at(i);
+    const oop referent = java_lang_ref_Reference::unknown_referent_no_keepalive(obj);
+    if (referent == nullptr || is_alive->do_object_b(referent)) {
+      log_develop_trace(gc, ref)("Precleaning %s reference " PTR_FORMAT,
+                                 referent == nullptr ? "cleared" : "reachable", p2i(obj));
+      if (referent != nullptr) {
+        record_referent_survival(obj);
+      }
+      RawAccess<>::oop_store(java_lang_ref_Reference::discovered_addr_raw(obj), oop(nullptr));
+    } else {
+      *refs_array.adr_at(kept++) = obj;
+    }
+  }
+
+  // Keep the references not yet looked at when aborting
+  for (; i < length; i++) {
+    *refs_array.adr_at(kept++) = refs_array.at(i);
+  }
+  refs_array.truncate(kept);
+
+  if (length > 0) {
+    log_develop_trace(gc, ref)(" Dropped %zu Refs out of %zu Refs in discovered array " PTR_FORMAT,
+                               length - kept, length, p2i(&refs_array));
+  }
+  return aborted;
+}
+
 const char* ReferenceProcessor::list_name(uint i) {
    assert(i <= _max_num_queues * number_of_subclasses_of_ref(),
           "Out of bounds index");
@@ -1160,7 +1735,16 @@ uint RefProcMTDegreeAdjuster::ergo_proc_thread_count(size_t ref_count,
     return max_threads;
   }
 
-  size_t thread_count = 1 + (ref_count / ReferencesPerThread);
+  size_t thread_count;
+  const AdaptiveWeightedAverage* ns_per_ref = _rp->_phase_ns_per_ref[phase];
+  if (ReferenceProcessingTimePerThread > 0 && ns_per_ref->count() > 0) {
+    // Estimate the work from the cost per reference in earlier collections,
+    // which differs a lot between phases and applications.
+    double estimated_ns = (double)ns_per_ref->average() * (double)ref_count;
+    thread_count = 1 + (size_t)(estimated_ns / ((double)ReferenceProcessingTimePerThread * NANOUNITS / MICROUNITS));
+  } else {
+    thread_count = 1 + (ref_count / ReferencesPerThread);
+  }
   return (uint)MIN3(thread_count,
                     static_cast<size_t>(max_threads),
                     (size_t)os::active_processor_count());
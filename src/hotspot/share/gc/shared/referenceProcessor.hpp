@@ -32,7 +32,9 @@
 #include "memory/allocation.hpp"
 #include "memory/referenceType.hpp"
 #include "oops/instanceRefKlass.hpp"
+#include "runtime/atomic.hpp"
 
+class AdaptiveWeightedAverage;
 class GCTimer;
 class ReferencePolicy;
 class ReferenceProcessorPhaseTimes;
@@ -60,10 +62,75 @@ class BarrierEnqueueDiscoveredFieldClosure : public EnqueueDiscoveredFieldClosur
   void enqueue(HeapWord* discovered_field_addr, oop value) override;
 };
 
+// Array of discovered references. Used instead of a DiscoveredList for
+// Weak and PhantomReferences without a ReferenceQueue. Such references are never
+// enqueued, so processing them is a linear scan over the array that only
+// writes to the Reference being processed, instead of unlinking it from
+// its predecessor in the list.
+class DiscoveredArray {
+public:
+  DiscoveredArray() : _refs(nullptr), _length(0), _capacity(0) { }
+
+  size_t length() const         { return _length; }
+  bool   is_empty() const       { return _length == 0; }
+  oop    at(size_t i) const     { assert(i < _length, "out of bounds"); return _refs[i]; }
+  oop*   adr_at(size_t i)       { assert(i < _length, "out of bounds"); return &_refs[i]; }
+
+  inline void append(oop o);
+
+  // Move the last count references to the other array
+  void move_to(DiscoveredArray& other, size_t count);
+
+  // Drop all references, but keep the storage for the next discovery
+  void clear()                  { _length = 0; }
+  void truncate(size_t length)  { assert(length <= _length, "invalid length"); _length = length; }
+
+private:
+  oop*   _refs;
+  size_t _length;
+  size_t _capacity;
+
+  void grow(size_t min_capacity);
+};
+
+// References enqueued from the discovered lists of one queue, linked through
+// their discovered fields. The segments of all queues are spliced into the
+// reference pending list at once when reference processing is done.
+class PendingListSegment {
+public:
+  PendingListSegment() : _head(nullptr), _tail(nullptr), _length(0) { }
+
+  oop    head() const     { return _head; }
+  oop    tail() const     { return _tail; }
+  size_t length() const   { return _length; }
+  bool   is_empty() const { return _head == nullptr; }
+
+  // Add a list of length references, already linked to the current head,
+  // in front of the segment.
+  void prepend(oop head, oop tail, size_t length) {
+    if (is_empty()) {
+      _tail = tail;
+    }
+    _head = head;
+    _length += length;
+  }
+
+  void clear() {
+    _head = nullptr;
+    _tail = nullptr;
+    _length = 0;
+  }
+
+private:
+  oop    _head;
+  oop    _tail;
+  size_t _length;
+};
+
 // List of discovered references.
 class DiscoveredList {
 public:
-  DiscoveredList() : _oop_head(nullptr), _compressed_head(narrowOop::null), _len(0) { }
+  DiscoveredList() : _oop_head(nullptr), _compressed_head(narrowOop::null), _len(0), _segments() { }
   inline oop head() const;
   HeapWord* adr_head() {
     return UseCompressedOops ? (HeapWord*)&_compressed_head :
@@ -77,6 +144,17 @@ class DiscoveredList {
   void   inc_length(size_t inc) { _len += inc; assert(_len > 0, "Error"); }
   void   dec_length(size_t dec) { _len -= dec; }
 
+  // Returns the reference at the given position, counted from the head.
+  oop    ref_at(size_t pos) const;
+
+  // Removes the first count references. The caller is responsible
+  // for linking them into another list.
+  void   remove_head_segment(size_t count, oop new_head);
+
+  // Drops the recorded references, after a reference was unlinked from the
+  // middle of the list or references were moved between lists.
+  void   invalidate_segments()  { _segments.clear(); }
+
   inline void clear();
 private:
   // Set value depending on UseCompressedOops. This could be a template class
@@ -84,6 +162,15 @@ class DiscoveredList {
   oop       _oop_head;
   narrowOop _compressed_head;
   size_t _len;
+
+  // Every SegmentLength:th reference added to the list, used to find the
+  // reference at a given position without walking the whole list. Entry i
+  // is the reference at distance (i + 1) * SegmentLength - 1 from the end of
+  // the list. Adding and removing references at the head does not change
+  // the distance of the other references from the end, so the entries stay
+  // valid until a reference is unlinked from the middle of the list.
+  static const size_t SegmentLength = 256;
+  DiscoveredArray _segments;
 };
 
 // Iterator for the list of discovered references.
@@ -107,15 +194,12 @@ class DiscoveredListIterator {
 
   size_t             _processed;
   size_t             _removed;
-  
-  OopHandle          _null_queue;
 
 public:
   inline DiscoveredListIterator(DiscoveredList&    refs_list,
                                 OopClosure*        keep_alive,
                                 BoolObjectClosure* is_alive,
-                                EnqueueDiscoveredFieldClosure* enqueue,
-                                OopHandle          null_queue);
+                                EnqueueDiscoveredFieldClosure* enqueue);
 
   // End Of List.
   inline bool has_next() const { return _current_discovered != nullptr; }
@@ -154,8 +238,8 @@ class DiscoveredListIterator {
   // Do enqueuing work, i.e. notifying the GC about the changed discovered pointers.
   void enqueue();
 
-  // Move enqueued references to the reference pending list.
-  void complete_enqueue();
+  // Move enqueued references to the given pending list segment.
+  void complete_enqueue(PendingListSegment* segment);
 
   // null out referent pointer.
   void clear_referent();
@@ -188,10 +272,12 @@ class DiscoveredListIterator {
 // subject to this ReferenceProcessor's discovery, thus allowing its use in a
 // straightforward manner in a general, non-generational, non-contiguous generation
 // (or heap) setting.
-class ReferenceProcessor : public ReferenceDiscoverer {
+class ReferenceProcessor final : public ReferenceDiscoverer {
   friend class RefProcTask;
   friend class RefProcKeepAliveFinalPhaseTask;
   friend class RefProcMTDegreeAdjuster;
+  friend class RefProcDeferredPhantomPhase;
+  friend class ReferenceProcessorPerfTest; // Testing
 public:
   // Names of sub-phases of reference processing. Indicates the type of the reference
   // processed and the associated phase number at the end.
@@ -212,14 +298,14 @@ class ReferenceProcessor : public ReferenceDiscoverer {
     RefPhaseMax
   };
 
-  OopHandle  _null_queue_handle;
-  
-  private:
-
-  void initialize_null_queue_handle();
+private:
 
   size_t total_count(DiscoveredList lists[]) const;
+  size_t total_count(DiscoveredArray arrays[]) const;
+  size_t total_weak_count() const;
+  size_t total_phantom_count() const;
   void verify_total_count_zero(DiscoveredList lists[], const char* type) NOT_DEBUG_RETURN;
+  void verify_total_count_zero(DiscoveredArray arrays[], const char* type) NOT_DEBUG_RETURN;
 
   // The SoftReference master timestamp clock
   static jlong _soft_ref_timestamp_clock;
@@ -231,10 +317,16 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   bool        _discovering_refs;        // true when discovery enabled
   bool        _discovery_is_concurrent; // if discovery is concurrent to the mutator
   bool        _discovery_is_mt;         // true if reference discovery is MT.
+  bool        _discovery_is_exclusive;  // true if every Reference is only ever
+                                        // discovered by a single thread
 
   uint        _next_id;                 // round-robin mod _num_queues counter in
                                         // support of work distribution
 
+  uint        _discovery_cycles;        // number of times discovery was enabled
+  bool        _revalidate_survivors;    // true if this discovery ignores the
+                                        // ReferentLivenessPrediction
+
   // For collectors that do not keep GC liveness information
   // in the object header, this field holds a closure that
   // helps the reference processor determine the reachability
@@ -265,7 +357,26 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   DiscoveredList* _discoveredFinalRefs;
   DiscoveredList* _discoveredPhantomRefs;
 
-  
+  // Master array of discovered references without ReferenceQueue
+  DiscoveredArray* _discovered_ref_arrays;
+
+  // Arrays of references without ReferenceQueue, one per thread
+  // (pointers into master array above)
+  DiscoveredArray* _discoveredWeakRefArrays;
+  DiscoveredArray* _discoveredPhantomRefArrays;
+
+  // References enqueued during processing, one segment per queue
+  PendingListSegment* _pending_segments;
+
+  // Link the segments of all queues and move them to the reference
+  // pending list. Returns the number of references enqueued.
+  size_t splice_pending_list(EnqueueDiscoveredFieldClosure* enqueue);
+
+  // Decaying average of the thread time spent per reference in each
+  // phase, in nanoseconds, used to pick the number of threads to use.
+  AdaptiveWeightedAverage* _phase_ns_per_ref[RefPhaseMax];
+
+  void update_phase_ns_per_ref(ReferenceProcessorPhaseTimes& phase_times);
 
   void run_task(RefProcTask& task, RefProcProxyTask& proxy_task, WorkerThreads* threads, bool marks_oops_alive);
 
@@ -290,18 +401,31 @@ class ReferenceProcessor : public ReferenceDiscoverer {
 
   // Traverse the list and remove any Refs whose referents are alive,
   // or null if discovery is concurrent. Enqueue and clear the reference for
-  // others if do_enqueue_and_clear is set.
+  // others if do_enqueue_and_clear is set. References that are cleared and
+  // removed because they have no ReferenceQueue are added to
+  // cleared_without_queue.
   size_t process_discovered_list_work(DiscoveredList&    refs_list,
                                       BoolObjectClosure* is_alive,
                                       OopClosure*        keep_alive,
                                       EnqueueDiscoveredFieldClosure* enqueue,
-                                      bool               do_enqueue_and_clear);
+                                      PendingListSegment* segment,
+                                      bool               do_enqueue_and_clear,
+                                      size_t*            cleared_without_queue);
+
+  // Clear or keep alive the referents of WeakReferences without ReferenceQueue,
+  // and drop all of them from discovery. The number of cleared referents is
+  // added to cleared_without_queue.
+  size_t process_discovered_array_work(DiscoveredArray&   refs_array,
+                                       BoolObjectClosure* is_alive,
+                                       OopClosure*        keep_alive,
+                                       size_t*            cleared_without_queue);
 
   // Keep alive followers of referents for FinalReferences. Must only be called for
   // those.
   size_t process_final_keep_alive_work(DiscoveredList& refs_list,
                                        OopClosure* keep_alive,
-                                       EnqueueDiscoveredFieldClosure* enqueue);
+                                       EnqueueDiscoveredFieldClosure* enqueue,
+                                       PendingListSegment* segment);
 
 
   void setup_policy(bool always_clear) {
@@ -314,6 +438,8 @@ class ReferenceProcessor : public ReferenceDiscoverer {
 
 public:
   static int number_of_subclasses_of_ref() { return (REF_PHANTOM - REF_NONE); }
+  // Weak and Phantom references without ReferenceQueue
+  static int number_of_ref_arrays()        { return 2; }
 
   uint num_queues() const                  { return _num_queues; }
   uint max_num_queues() const              { return _max_num_queues; }
@@ -353,6 +479,9 @@ class ReferenceProcessor : public ReferenceDiscoverer {
                                    BoolObjectClosure* is_alive,
                                    EnqueueDiscoveredFieldClosure* enqueue,
                                    YieldClosure*      yield);
+  bool preclean_discovered_refarray(DiscoveredArray&   refs_array,
+                                    BoolObjectClosure* is_alive,
+                                    YieldClosure*      yield);
 
   // round-robin mod _num_queues (not: _not_ mod _max_num_queues)
   uint next_id() {
@@ -364,18 +493,25 @@ class ReferenceProcessor : public ReferenceDiscoverer {
     assert(_next_id < _num_queues, "_next_id %u _num_queues %u _max_num_queues %u", _next_id, _num_queues, _max_num_queues);
     return id;
   }
-  DiscoveredList* get_discovered_list(ReferenceType rt);
+  uint get_discovered_queue_id();
+  DiscoveredList* get_discovered_list(ReferenceType rt, uint id);
+  // Returns the array to record a reference without queue in, or null
+  DiscoveredArray* get_discovered_array(ReferenceType rt, oop obj, uint id);
   inline bool set_discovered_link(HeapWord* discovered_addr, oop next_discovered);
   inline void add_to_discovered_list(DiscoveredList& refs_list, oop obj,
                                      HeapWord* discovered_addr);
+  inline void add_to_discovered_array(DiscoveredArray& refs_array, oop obj,
+                                      HeapWord* discovered_addr);
   inline bool set_discovered_link_st(HeapWord* discovered_addr,
                                      oop next_discovered);
   inline bool set_discovered_link_mt(HeapWord* discovered_addr,
                                      oop next_discovered);
 
   void clear_discovered_references(DiscoveredList& refs_list);
+  void clear_discovered_references(DiscoveredArray& refs_array);
 
   void log_reflist(const char* prefix, DiscoveredList list[], uint num_active_queues);
+  void log_refarray(const char* prefix, DiscoveredArray arrays[], uint num_active_queues);
   void log_reflist_counts(DiscoveredList ref_lists[], uint num_active_queues) PRODUCT_RETURN;
 
   // Balances reference queues.
@@ -385,6 +521,11 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   // If there is need to balance the given queue, do it.
   void maybe_balance_queues(DiscoveredList refs_lists[]);
 
+  // Same as above, for the arrays of discovered references.
+  void balance_queues(DiscoveredArray refs_arrays[]);
+  bool need_balance_queues(DiscoveredArray refs_arrays[]);
+  void maybe_balance_queues(DiscoveredArray refs_arrays[]);
+
   // Update (advance) the soft ref master clock field.
   void update_soft_ref_master_clock();
 
@@ -396,7 +537,8 @@ class ReferenceProcessor : public ReferenceDiscoverer {
                      uint mt_processing_degree = 1,
                      uint mt_discovery_degree  = 1,
                      bool concurrent_discovery = false,
-                     BoolObjectClosure* is_alive_non_header = nullptr);
+                     BoolObjectClosure* is_alive_non_header = nullptr,
+                     bool exclusive_discovery  = false);
 
   static void init_statics();
 
@@ -424,6 +566,11 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   bool discovery_is_mt() const { return _discovery_is_mt; }
   void set_mt_discovery(bool mt) { _discovery_is_mt = mt; }
 
+  // whether each Reference is discovered by the one thread that already owns
+  // it, e.g. the thread that copied or marked it in an stw pause. MT discovery
+  // then needs no atomic update of the discovered field.
+  bool discovery_is_exclusive() const { return _discovery_is_exclusive; }
+
   // Whether we are in a phase when _processing_ is MT.
   bool processing_is_mt() const;
 
@@ -433,11 +580,15 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   // Discover a Reference object, using appropriate discovery criteria
   virtual bool discover_reference(oop obj, ReferenceType rt);
 
-  // Process references found during GC (called by the garbage collector)
+  // Process references found during GC (called by the garbage collector).
+  // If defer_phantom_refs is set, the PhantomReferences are left for a
+  // RefProcDeferredPhantomPhase, which must complete before the discovered
+  // lists are used again.
   ReferenceProcessorStats
   process_discovered_references(RefProcProxyTask& proxy_task,
                                 WorkerThreads* workers,
-                                ReferenceProcessorPhaseTimes& phase_times);
+                                ReferenceProcessorPhaseTimes& phase_times,
+                                bool defer_phantom_refs = false);
 
   // If a discovery is in process that is being superseded, abandon it: all
   // the discovered lists will be empty, and all the objects on them will
@@ -577,6 +728,7 @@ class RefProcProxyTask : public WorkerTask {
   RefProcThreadModel _tm;
   uint _queue_count;
   bool _marks_oops_alive;
+  BarrierEnqueueDiscoveredFieldClosure _barrier_enqueue;
 
 public:
   RefProcProxyTask(const char* name, uint max_workers) : WorkerTask(name), _max_workers(max_workers), _rp_task(nullptr),_tm(RefProcThreadModel::Single), _queue_count(0), _marks_oops_alive(false) {}
@@ -590,6 +742,10 @@ class RefProcProxyTask : public WorkerTask {
   }
 
   virtual void prepare_run_task_hook() {}
+
+  // Closure used by the thread calling process_discovered_references() to
+  // link the pending list segments of the queues once all workers are done.
+  virtual EnqueueDiscoveredFieldClosure* splice_enqueue() { return &_barrier_enqueue; }
 };
 
 // Temporarily change the number of workers based on given reference count.
@@ -615,4 +771,44 @@ class RefProcMTDegreeAdjuster : public StackObj {
   ~RefProcMTDegreeAdjuster();
 };
 
+class RefProcPhantomPhaseTask: public RefProcTask {
+public:
+  RefProcPhantomPhaseTask(ReferenceProcessor& ref_processor,
+                          ReferenceProcessorPhaseTimes* phase_times)
+    : RefProcTask(ref_processor,
+                  phase_times) {}
+
+  void rp_work(uint worker_id,
+               BoolObjectClosure* is_alive,
+               OopClosure* keep_alive,
+               EnqueueDiscoveredFieldClosure* enqueue,
+               VoidClosure* complete_gc) override;
+};
+
+// Processes the PhantomReferences left by process_discovered_references()
+// with defer_phantom_refs set. Referent liveness is final once FinalReferences
+// have been kept alive, so the collector may do this as part of another
+// parallel task that only reads the marking. Every worker calling work()
+// claims discovered queues until there are none left; the phase is complete
+// when the instance is destroyed.
+class RefProcDeferredPhantomPhase : public StackObj {
+  ReferenceProcessor&           _rp;
+  RefProcProxyTask&             _proxy_task;
+  ReferenceProcessorPhaseTimes* _phase_times;
+  double                        _start_time;
+  RefProcMTDegreeAdjuster       _degree_adjuster;
+  RefProcPhantomPhaseTask       _phase_task;
+  uint                          _num_claims;
+  Atomic<uint>                  _next_claim;
+
+public:
+  RefProcDeferredPhantomPhase(ReferenceProcessor& rp,
+                              RefProcProxyTask& proxy_task,
+                              WorkerThreads* workers,
+                              ReferenceProcessorPhaseTimes* phase_times);
+  ~RefProcDeferredPhantomPhase();
+
+  void work();
+};
+
 #endif // SHARE_GC_SHARED_REFERENCEPROCESSOR_HPP
@@ -38,6 +38,9 @@ oop DiscoveredList::head() const {
 void DiscoveredList::add_as_head(oop o) {
   set_head(o);
   inc_length(1);
+  if (_len % SegmentLength == 0 && _segments.length() == _len / SegmentLength - 1) {
+    _segments.append(o);
+  }
 }
 
 void DiscoveredList::set_head(oop o) {
@@ -56,13 +59,20 @@ bool DiscoveredList::is_empty() const {
 void DiscoveredList::clear() {
   set_head(nullptr);
   set_length(0);
+  _segments.clear();
+}
+
+void DiscoveredArray::append(oop o) {
+  if (_length == _capacity) {
+    grow(_length + 1);
+  }
+  _refs[_length++] = o;
 }
 
 DiscoveredListIterator::DiscoveredListIterator(DiscoveredList&    refs_list,
                                                OopClosure*        keep_alive,
                                                BoolObjectClosure* is_alive,
-                                               EnqueueDiscoveredFieldClosure* enqueue,
-                                               OopHandle          null_queue):
+                                               EnqueueDiscoveredFieldClosure* enqueue):
   _refs_list(refs_list),
   _prev_discovered_addr(refs_list.adr_head()),
   _prev_discovered(nullptr),
@@ -77,8 +87,7 @@ DiscoveredListIterator::DiscoveredListIterator(DiscoveredList&    refs_list,
   _first_seen(refs_list.head()),
 #endif
   _processed(0),
-  _removed(0),
-  _null_queue(null_queue) {
+  _removed(0) {
 }
 
 #endif // SHARE_GC_SHARED_REFERENCEPROCESSOR_INLINE_HPP
@@ -22,14 +22,17 @@
  *
  */
 
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/referenceProcessor.inline.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "gc/shared/workerDataArray.inline.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/safepoint.hpp"
 
 #define ASSERT_REF_TYPE(ref_type) assert((ref_type) >= REF_SOFT && (ref_type) <= REF_PHANTOM, \
                                          "Invariant (%d)", (int)ref_type)
@@ -62,6 +65,14 @@ static const char* SubPhasesSerWorkTitle[ReferenceProcessor::RefSubPhaseMax] = {
 
 static const char* SoftWeakFinalRefsPhaseSerWorkTitle = "Total:";
 
+static const char* SubPhaseNames[ReferenceProcessor::RefSubPhaseMax] = {
+       "SoftRef",
+       "WeakRef",
+       "FinalRef",
+       "FinalRef Keep Alive",
+       "PhantomRef"
+       };
+
 static const char* Indents[6] = {"", "  ", "    ", "      ", "        ", "          "};
 
 static const char* PhaseNames[ReferenceProcessor::RefPhaseMax] = {
@@ -149,6 +160,7 @@ RefProcTotalPhaseTimesTracker::RefProcTotalPhaseTimesTracker(ReferenceProcessor:
 RefProcTotalPhaseTimesTracker::~RefProcTotalPhaseTimesTracker() {
   double elapsed = elapsed_time();
   phase_times()->set_phase_time_ms(_phase_number, elapsed);
+  phase_times()->send_phase_events(_phase_number);
 }
 
 ReferenceProcessorPhaseTimes::ReferenceProcessorPhaseTimes(GCTimer* gc_timer, uint max_gc_threads) :
@@ -156,6 +168,8 @@ ReferenceProcessorPhaseTimes::ReferenceProcessorPhaseTimes(GCTimer* gc_timer, ui
   assert(gc_timer != nullptr, "pre-condition");
   for (uint i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
     _sub_phases_worker_time_sec[i] = new WorkerDataArray<double>(nullptr, SubPhasesParWorkTitle[i], max_gc_threads);
+    _sub_phases_worker_time_sec[i]->create_thread_work_items("Dropped:", DroppedRefs);
+    _sub_phases_worker_time_sec[i]->create_thread_work_items("Cleared Without Queue:", ClearedWithoutQueueRefs);
   }
   _soft_weak_final_refs_phase_worker_time_sec = new WorkerDataArray<double>(nullptr, SoftWeakFinalRefsPhaseParWorkTitle, max_gc_threads);
 
@@ -166,6 +180,49 @@ inline int ref_type_2_index(ReferenceType ref_type) {
   return ref_type - REF_SOFT;
 }
 
+jlong  ReferenceProcessorPhaseTimes::_last_stats[ReferenceProcessorPhaseTimes::NumLastStats] = {};
+size_t ReferenceProcessorPhaseTimes::_num_completed = 0;
+
+static jlong time_ms_to_stat(double time_ms) {
+  return time_ms < 0.0 ? -1 : (jlong)(time_ms * NANOSECS_PER_MILLISEC);
+}
+
+void ReferenceProcessorPhaseTimes::publish_last_stats() const {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+
+  _last_stats[TotalTimeStat] = time_ms_to_stat(_total_time_ms);
+  for (int i = 0; i < ReferenceProcessor::RefPhaseMax; i++) {
+    _last_stats[PhaseTimeStat + i] = time_ms_to_stat(_phases_time_ms[i]);
+  }
+  for (int i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
+    WorkerDataArray<double>* const worker_time = _sub_phases_worker_time_sec[i];
+    double max_sec = 0.0;
+    for (uint worker = 0; worker < worker_time->length(); worker++) {
+      const double sec = worker_time->get(worker);
+      if (sec != WorkerDataArray<double>::uninitialized()) {
+        max_sec = MAX2(max_sec, sec);
+      }
+    }
+    _last_stats[SubPhaseSumTimeStat + i] = (jlong)(worker_time->sum() * NANOSECS_PER_SEC);
+    _last_stats[SubPhaseMaxTimeStat + i] = (jlong)(max_sec * NANOSECS_PER_SEC);
+  }
+  for (int i = 0; i < number_of_subclasses_of_ref; i++) {
+    _last_stats[DiscoveredStat + i] = (jlong)_ref_discovered[i];
+    _last_stats[DroppedStat + i] = (jlong)_ref_dropped[i].load_relaxed();
+    _last_stats[ClearedWithoutQueueStat + i] = (jlong)_ref_cleared_without_queue[i].load_relaxed();
+  }
+  _last_stats[EnqueuedStat] = (jlong)_ref_enqueued;
+  _num_completed++;
+}
+
+size_t ReferenceProcessorPhaseTimes::last_stats(jlong* stats) {
+  assert(!SafepointSynchronize::is_at_safepoint(), "must not be at safepoint");
+  for (int i = 0; i < NumLastStats; i++) {
+    stats[i] = _last_stats[i];
+  }
+  return _num_completed;
+}
+
 WorkerDataArray<double>* ReferenceProcessorPhaseTimes::sub_phase_worker_time_sec(ReferenceProcessor::RefProcSubPhases sub_phase) const {
   ASSERT_SUB_PHASE(sub_phase);
   return _sub_phases_worker_time_sec[sub_phase];
@@ -182,6 +239,22 @@ void ReferenceProcessorPhaseTimes::set_phase_time_ms(ReferenceProcessor::RefProc
   _phases_time_ms[phase] = phase_time_ms;
 }
 
+void ReferenceProcessorPhaseTimes::set_phase_work(ReferenceProcessor::RefProcPhases phase,
+                                                  size_t ref_count,
+                                                  uint num_threads) {
+  ASSERT_PHASE(phase);
+  _phase_ref_count[phase] = ref_count;
+  _phase_num_threads[phase] = num_threads;
+}
+
+double ReferenceProcessorPhaseTimes::phase_ns_per_ref(ReferenceProcessor::RefProcPhases phase) const {
+  ASSERT_PHASE(phase);
+  if (_phase_ref_count[phase] == 0 || _phases_time_ms[phase] == uninitialized()) {
+    return uninitialized();
+  }
+  return _phases_time_ms[phase] * NANOSECS_PER_MILLISEC * _phase_num_threads[phase] / _phase_ref_count[phase];
+}
+
 void ReferenceProcessorPhaseTimes::reset() {
   for (int i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
     _sub_phases_worker_time_sec[i]->reset();
@@ -190,14 +263,18 @@ void ReferenceProcessorPhaseTimes::reset() {
   for (int i = 0; i < ReferenceProcessor::RefPhaseMax; i++) {
     _phases_time_ms[i] = uninitialized();
     _balance_queues_time_ms[i] = uninitialized();
+    _phase_ref_count[i] = 0;
+    _phase_num_threads[i] = 0;
   }
 
   _soft_weak_final_refs_phase_worker_time_sec->reset();
 
   for (int i = 0; i < number_of_subclasses_of_ref; i++) {
     _ref_dropped[i].store_relaxed(0);
+    _ref_cleared_without_queue[i].store_relaxed(0);
     _ref_discovered[i] = 0;
   }
+  _ref_enqueued = 0;
 
   _total_time_ms = uninitialized();
 
@@ -216,6 +293,20 @@ void ReferenceProcessorPhaseTimes::add_ref_dropped(ReferenceType ref_type, size_
   _ref_dropped[ref_type_2_index(ref_type)].add_then_fetch(count, memory_order_relaxed);
 }
 
+void ReferenceProcessorPhaseTimes::add_ref_cleared_without_queue(ReferenceType ref_type, size_t count) {
+  ASSERT_REF_TYPE(ref_type);
+  _ref_cleared_without_queue[ref_type_2_index(ref_type)].add_then_fetch(count, memory_order_relaxed);
+}
+
+void ReferenceProcessorPhaseTimes::record_sub_phase_work(ReferenceProcessor::RefProcSubPhases sub_phase,
+                                                         uint worker_id,
+                                                         size_t dropped,
+                                                         size_t cleared_without_queue) {
+  WorkerDataArray<double>* worker_time = sub_phase_worker_time_sec(sub_phase);
+  worker_time->set_or_add_thread_work_item(worker_id, dropped, DroppedRefs);
+  worker_time->set_or_add_thread_work_item(worker_id, cleared_without_queue, ClearedWithoutQueueRefs);
+}
+
 void ReferenceProcessorPhaseTimes::set_ref_discovered(ReferenceType ref_type, size_t count) {
   ASSERT_REF_TYPE(ref_type);
   _ref_discovered[ref_type_2_index(ref_type)] = count;
@@ -259,6 +350,11 @@ void ReferenceProcessorPhaseTimes::print_all_references(uint base_indent, bool p
   print_reference(REF_FINAL, next_indent);
   print_reference(REF_PHANTOM, next_indent);
 
+  LogTarget(Debug, gc, phases, ref) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print_cr("%sEnqueued: %zu", Indents[next_indent], _ref_enqueued);
+  }
 }
 
 void ReferenceProcessorPhaseTimes::print_reference(ReferenceType ref_type, uint base_indent) const {
@@ -357,6 +453,77 @@ void ReferenceProcessorPhaseTimes::print_worker_time(LogStream* ls, WorkerDataAr
   }
 }
 
+void ReferenceProcessorPhaseTimes::send_phase_events(ReferenceProcessor::RefProcPhases phase) const {
+  ASSERT_PHASE(phase);
+  EventGCReferenceProcessingPhase e;
+  if (e.should_commit()) {
+    const double balance_time = balance_queues_time_ms(phase);
+    e.set_gcId(GCId::current());
+    e.set_name(phase_enum_2_phase_string(phase));
+    e.set_time((s8)(phase_time_ms(phase) * NANOSECS_PER_MILLISEC));
+    e.set_balanceQueuesTime(balance_time == uninitialized() ? 0 : (s8)(balance_time * NANOSECS_PER_MILLISEC));
+    e.set_threads(_processing_is_mt ? _phase_num_threads[phase] : 1);
+    e.set_references(_phase_ref_count[phase]);
+    e.commit();
+  }
+
+  switch (phase) {
+    case ReferenceProcessor::SoftWeakFinalRefsPhase:
+      send_sub_phase_events(ReferenceProcessor::ProcessSoftRefSubPhase);
+      send_sub_phase_events(ReferenceProcessor::ProcessWeakRefSubPhase);
+      send_sub_phase_events(ReferenceProcessor::ProcessFinalRefSubPhase);
+      send_reference_event(REF_SOFT);
+      send_reference_event(REF_WEAK);
+      send_reference_event(REF_FINAL);
+      break;
+    case ReferenceProcessor::KeepAliveFinalRefsPhase:
+      send_sub_phase_events(ReferenceProcessor::KeepAliveFinalRefsSubPhase);
+      break;
+    case ReferenceProcessor::PhantomRefsPhase:
+      send_sub_phase_events(ReferenceProcessor::ProcessPhantomRefsSubPhase);
+      send_reference_event(REF_PHANTOM);
+      break;
+    default:
+      ShouldNotReachHere();
+  }
+}
+
+void ReferenceProcessorPhaseTimes::send_sub_phase_events(ReferenceProcessor::RefProcSubPhases sub_phase) const {
+  if (!EventGCReferenceProcessingWorker::is_enabled()) {
+    return;
+  }
+  WorkerDataArray<double>* worker_time = _sub_phases_worker_time_sec[sub_phase];
+  WorkerDataArray<size_t>* dropped = worker_time->thread_work_items(DroppedRefs);
+  WorkerDataArray<size_t>* cleared = worker_time->thread_work_items(ClearedWithoutQueueRefs);
+  for (uint i = 0; i < worker_time->length(); i++) {
+    const double time_sec = worker_time->get(i);
+    if (time_sec == WorkerDataArray<double>::uninitialized()) {
+      continue;
+    }
+    EventGCReferenceProcessingWorker e;
+    e.set_gcId(GCId::current());
+    e.set_gcWorkerId(i);
+    e.set_name(SubPhaseNames[sub_phase]);
+    e.set_time((s8)(time_sec * NANOSECS_PER_SEC));
+    e.set_dropped(dropped->get(i) == WorkerDataArray<size_t>::uninitialized() ? 0 : dropped->get(i));
+    e.set_clearedWithoutQueue(cleared->get(i) == WorkerDataArray<size_t>::uninitialized() ? 0 : cleared->get(i));
+    e.commit();
+  }
+}
+
+void ReferenceProcessorPhaseTimes::send_reference_event(ReferenceType ref_type) const {
+  EventGCReferenceProcessingStatistics e;
+  if (e.should_commit()) {
+    const int index = ref_type_2_index(ref_type);
+    e.set_gcId(GCId::current());
+    e.set_type((u1)ref_type);
+    e.set_discovered(_ref_discovered[index]);
+    e.set_dropped(_ref_dropped[index].load_relaxed());
+    e.set_clearedWithoutQueue(_ref_cleared_without_queue[index].load_relaxed());
+    e.commit();
+  }
+}
+
 #undef ASSERT_REF_TYPE
 #undef ASSERT_SUB_PHASE
 #undef ASSERT_PHASE
@@ -38,6 +38,14 @@ class GCTimer;
 class LogStream;
 
 class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
+public:
+  // Per worker counts recorded with the sub phase times.
+  enum RefProcSubPhaseWorkItems {
+    DroppedRefs,
+    ClearedWithoutQueueRefs
+  };
+
+private:
   static const int number_of_subclasses_of_ref = REF_PHANTOM - REF_NONE; // 4 - 0 = 4
 
   // Records per thread time information of each sub phase.
@@ -47,6 +55,9 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   double                   _phases_time_ms[ReferenceProcessor::RefPhaseMax];
   // Records total queue balancing for each phase.
   double                   _balance_queues_time_ms[ReferenceProcessor::RefPhaseMax];
+  // Records the number of references and threads for each phase.
+  size_t                   _phase_ref_count[ReferenceProcessor::RefPhaseMax];
+  uint                     _phase_num_threads[ReferenceProcessor::RefPhaseMax];
 
   WorkerDataArray<double>* _soft_weak_final_refs_phase_worker_time_sec;
 
@@ -54,7 +65,12 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   double                   _total_time_ms;
 
   Atomic<size_t>           _ref_dropped[number_of_subclasses_of_ref];
+  // Subset of the dropped references that were cleared without being enqueued
+  // because they have no ReferenceQueue.
+  Atomic<size_t>           _ref_cleared_without_queue[number_of_subclasses_of_ref];
   size_t                   _ref_discovered[number_of_subclasses_of_ref];
+  // Number of references moved to the pending list
+  size_t                   _ref_enqueued;
 
   bool                     _processing_is_mt;
 
@@ -62,8 +78,6 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
 
   double phase_time_ms(ReferenceProcessor::RefProcPhases phase) const;
 
-  double total_time_ms() const { return _total_time_ms; }
-
   double balance_queues_time_ms(ReferenceProcessor::RefProcPhases phase) const;
 
   void print_reference(ReferenceType ref_type, uint base_indent) const;
@@ -73,7 +87,32 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   void print_sub_phase(LogStream* ls, ReferenceProcessor::RefProcSubPhases sub_phase, uint indent) const;
   void print_worker_time(LogStream* ls, WorkerDataArray<double>* worker_time, const char* ser_title, uint indent) const;
 
+  void send_sub_phase_events(ReferenceProcessor::RefProcSubPhases sub_phase) const;
+  void send_reference_event(ReferenceType ref_type) const;
+
   static double uninitialized() { return -1.0; }
+
+public:
+  // Layout of the statistics of the last completed reference processing, as
+  // copied out by last_stats(). Times are in nanoseconds, -1 if a phase did
+  // not run. Per type counts are in Soft, Weak, Final, Phantom order.
+  enum LastStat {
+    TotalTimeStat,
+    PhaseTimeStat,
+    SubPhaseSumTimeStat = PhaseTimeStat + ReferenceProcessor::RefPhaseMax,
+    SubPhaseMaxTimeStat = SubPhaseSumTimeStat + ReferenceProcessor::RefSubPhaseMax,
+    DiscoveredStat      = SubPhaseMaxTimeStat + ReferenceProcessor::RefSubPhaseMax,
+    DroppedStat         = DiscoveredStat + number_of_subclasses_of_ref,
+    // Subset of the dropped references, cleared without queue
+    ClearedWithoutQueueStat = DroppedStat + number_of_subclasses_of_ref,
+    EnqueuedStat        = ClearedWithoutQueueStat + number_of_subclasses_of_ref,
+    NumLastStats
+  };
+
+private:
+  static jlong  _last_stats[NumLastStats];
+  static size_t _num_completed;
+
 public:
   ReferenceProcessorPhaseTimes(GCTimer* gc_timer, uint max_gc_threads);
   ~ReferenceProcessorPhaseTimes();
@@ -82,11 +121,22 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   WorkerDataArray<double>* sub_phase_worker_time_sec(ReferenceProcessor::RefProcSubPhases phase) const;
   void set_phase_time_ms(ReferenceProcessor::RefProcPhases phase, double par_phase_time_ms);
 
+  void set_phase_work(ReferenceProcessor::RefProcPhases phase, size_t ref_count, uint num_threads);
+  // Thread time spent per reference in the given phase, in nanoseconds.
+  // Negative if the phase did not process any references.
+  double phase_ns_per_ref(ReferenceProcessor::RefProcPhases phase) const;
+
+  double total_time_ms() const { return _total_time_ms; }
   void set_total_time_ms(double total_time_ms) { _total_time_ms = total_time_ms; }
 
   void add_ref_dropped(ReferenceType ref_type, size_t count);
+  void add_ref_cleared_without_queue(ReferenceType ref_type, size_t count);
+  void record_sub_phase_work(ReferenceProcessor::RefProcSubPhases sub_phase, uint worker_id,
+                             size_t dropped, size_t cleared_without_queue);
   void set_ref_discovered(ReferenceType ref_type, size_t count);
   size_t ref_discovered(ReferenceType ref_type);
+  void set_ref_enqueued(size_t count) { _ref_enqueued = count; }
+  size_t ref_enqueued() const { return _ref_enqueued; }
 
   void set_balance_queues_time_ms(ReferenceProcessor::RefProcPhases phase, double time_ms);
 
@@ -98,6 +148,19 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   void reset();
 
   void print_all_references(uint base_indent = 0, bool print_total = true) const;
+
+  // Record the statistics of a completed reference processing as the last
+  // ones. Called at a safepoint.
+  void publish_last_stats() const;
+  // Copy the statistics of the last completed reference processing to stats,
+  // which has NumLastStats entries. Returns the number of reference
+  // processings completed so far, 0 if there was none yet. Must not be
+  // called at a safepoint, so that the statistics do not change meanwhile.
+  static size_t last_stats(jlong* stats);
+
+  // Send the JFR events for a completed phase, with its per-worker times and
+  // counts, and the statistics of the reference types it processed.
+  void send_phase_events(ReferenceProcessor::RefProcPhases phase) const;
 };
 
 class RefProcWorkerTimeTracker : public StackObj {
@@ -26,6 +26,7 @@
 #define SHARE_GC_SHARED_SATBMARKQUEUE_HPP
 
 #include "gc/shared/bufferNode.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "oops/oopsHierarchy.hpp"
@@ -261,13 +262,44 @@ class SATBMarkQueueSet {
   void abandon_partial_marking();
 };
 
+// Lossy set of recently retained entries of a buffer, for removing duplicate
+// entries when filtering. Each entry has one slot, found by hashing, that
+// keeps the last retained entry mapped to it. Only entries equal to the one
+// in their slot are reported as duplicates, so a retained copy of each entry
+// filtered out always remains in the buffer.
+class SATBBufferDedup : public StackObj {
+  static const uint log_table_size = 6;
+  static const size_t table_size = size_t(1) << log_table_size;
+
+  void* _table[table_size];
+
+  static size_t index_for(void* entry) {
+    const uintptr_t multiplier = LP64_ONLY(UCONST64(0x9E3779B97F4A7C15)) NOT_LP64(0x9E3779B9);
+    return (reinterpret_cast<uintptr_t>(entry) * multiplier) >> (BitsPerWord - log_table_size);
+  }
+
+public:
+  SATBBufferDedup() : _table() {}
+
+  // Returns true if entry was recorded before, otherwise records it.
+  bool is_duplicate(void* entry) {
+    void** slot = &_table[index_for(entry)];
+    if (*slot == entry) {
+      return true;
+    }
+    *slot = entry;
+    return false;
+  }
+};
+
 // Removes entries from queue's buffer that are no longer needed, as
 // determined by filter. If e is a void* entry in queue's buffer,
 // filter_out(e) must be a valid expression whose value is convertible
 // to bool. Entries are removed (filtered out) if the result is true,
-// retained if false.
+// retained if false. With SATBBufferDeduplication, duplicates of other
+// retained entries are removed as well.
 template<typename Filter>
-inline void SATBMarkQueueSet::apply_filter(Filter filter_out, SATBMarkQueue& queue) {
+inline void SATBMarkQueueSet::apply_filter(Filter filter, SATBMarkQueue& queue) {
   void** buf = queue.buffer();
 
   if (buf == nullptr) {
@@ -275,6 +307,15 @@ inline void SATBMarkQueueSet::apply_filter(Filter filter_out, SATBMarkQueue& que
     return;
   }
 
+  // The compaction below passes each entry to filter_out exactly once and
+  // retains every entry for which it returns false, so the occurrence of an
+  // entry recorded by dedup is always among the retained ones.
+  const bool dedup_enabled = SATBBufferDeduplication;
+  SATBBufferDedup dedup;
+  auto filter_out = [&](void* entry) {
+    return filter(entry) || (dedup_enabled && dedup.is_duplicate(entry));
+  };
+
   // Two-fingered compaction toward the end.
   void** src = buf + queue.index();
   void** dst = buf + queue.current_capacity();
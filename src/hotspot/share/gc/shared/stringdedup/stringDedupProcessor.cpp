@@ -39,6 +39,7 @@
 #include "runtime/cpuTimeCounters.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -103,7 +104,11 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 
 void StringDedup::Processor::yield() const {
   assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+  // Transitioning for every request is expensive compared to deduplicating
+  // a short string, so only do it when there is something to yield to.
+  if (SafepointMechanism::should_process(_thread)) {
+    ThreadBlockInVM tbivm(_thread);
+  }
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
@@ -167,7 +172,7 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
 };
 
 void StringDedup::Processor::process_requests() const {
-  _cur_stat.report_process_start();
+  _cur_stat.report_process_start(_storage_for_processing->storage()->allocation_count());
   OopStorage::ParState<true, false> par_state{_storage_for_processing->storage(), 1};
   ProcessRequest processor{_storage_for_processing->storage()};
   par_state.oops_do(&processor);
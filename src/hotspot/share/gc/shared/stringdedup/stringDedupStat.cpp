@@ -40,6 +40,8 @@ StringDedup::Stat::Stat() :
   _skipped_dead(0),
   _skipped_incomplete(0),
   _skipped_shared(0),
+  _queued(0),
+  _max_queued(0),
   _active(0),
   _idle(0),
   _process(0),
@@ -67,6 +69,8 @@ void StringDedup::Stat::add(const Stat* const stat) {
   _skipped_dead        += stat->_skipped_dead;
   _skipped_incomplete  += stat->_skipped_incomplete;
   _skipped_shared      += stat->_skipped_shared;
+  _queued              += stat->_queued;
+  _max_queued          =  MAX2(_max_queued, stat->_max_queued);
   _active              += stat->_active;
   _idle                += stat->_idle;
   _process             += stat->_process;
@@ -141,9 +145,11 @@ void StringDedup::Stat::report_idle_end() {
   report_phase_end("Idle", &_idle_elapsed);
 }
 
-void StringDedup::Stat::report_process_start() {
+void StringDedup::Stat::report_process_start(size_t queued) {
   report_phase_start("Process");
   _process++;
+  _queued += queued;
+  _max_queued = MAX2(_max_queued, queued);
 }
 
 void StringDedup::Stat::report_process_pause() {
@@ -194,6 +200,10 @@ void StringDedup::Stat::log_times(const char* prefix) const {
     prefix,
     _process, strdedup_elapsed_param_ms(_process_elapsed),
     _idle, strdedup_elapsed_param_ms(_idle_elapsed));
+  log_debug(stringdedup)(
+    "  %s Queued: %zu (max %zu), Throughput: %.1f/ms",
+    prefix, _queued, _max_queued,
+    _process_elapsed.seconds() > 0.0 ? _inspected / strdedup_elapsed_param_ms(_process_elapsed) : 0.0);
   if (_resize_table > 0) {
     log_debug(stringdedup)(
       "  %s Resize Table: %zu/" STRDEDUP_ELAPSED_FORMAT_MS,
@@ -49,6 +49,10 @@ class StringDedup::Stat {
   size_t _skipped_incomplete;
   size_t _skipped_shared;
 
+  // Requests waiting when processing started
+  size_t _queued;
+  size_t _max_queued;
+
   // Phase counters for deduplication thread
   size_t _active;
   size_t _idle;
@@ -132,7 +136,7 @@ class StringDedup::Stat {
   void report_idle_start();
   void report_idle_end();
 
-  void report_process_start();
+  void report_process_start(size_t queued);
   void report_process_pause();
   void report_process_resume();
   void report_process_end();
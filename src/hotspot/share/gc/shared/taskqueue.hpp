@@ -50,6 +50,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batched,    // subset of successful steals taken along with another steal
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -71,6 +72,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batched(uint n) { _stats[steal_batched] += n; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -504,6 +506,12 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
 
+  // Like steal(), but after a successful steal also moves up to
+  // max_batch - 1 further tasks, and at most half of the remaining ones,
+  // from the same victim queue to the queue of queue_num. This saves
+  // selecting a victim again for each task when few queues have work.
+  bool steal_batch(uint queue_num, E& t, uint max_batch);
+
   DEBUG_ONLY(virtual void assert_empty() const;)
 
   virtual uint tasks() const;
@@ -391,6 +391,46 @@ bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   return false;
 }
 
+template<class T, MemTag MT>
+bool GenericTaskQueueSet<T, MT>::steal_batch(uint queue_num, E& t, uint max_batch) {
+  if (!steal(queue_num, t)) {
+    return false;
+  }
+  if (max_batch <= 1) {
+    return true;
+  }
+
+  T* const local_queue = queue(queue_num);
+  uint victim_num;
+  if (_n == 2) {
+    victim_num = (queue_num + 1) % 2;
+  } else {
+    // Set by the successful steal_best_of_2.
+    assert(local_queue->is_last_stolen_queue_id_valid(), "must be");
+    victim_num = local_queue->last_stolen_queue_id();
+  }
+  T* const victim = queue(victim_num);
+
+  // Leave at least half of the tasks to the victim, and stop before the
+  // local queue would overflow. Only the owner of queue_num pushes to it,
+  // so its size cannot grow behind our back.
+  const uint batch = MIN2(max_batch - 1, victim->size() / 2);
+  uint stolen = 0;
+  while (stolen < batch && local_queue->size() + 1 < local_queue->max_elems()) {
+    E task;
+    PopResult res = victim->pop_global(task);
+    TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res != PopResult::Success) {
+      break;
+    }
+    bool pushed = local_queue->push(task);
+    assert(pushed, "must have room");
+    stolen++;
+  }
+  TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_batched(stolen);)
+  return true;
+}
+
 template<class E, MemTag MT, unsigned int N>
 template<class Fn>
 inline void GenericTaskQueue<E, MT, N>::iterate(Fn fn) {
@@ -24,8 +24,11 @@
 
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -81,6 +84,7 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   _allocated_before_last_gc = total_allocated;
 
   print_stats("gc");
+  send_statistics_event();
 
   if (_number_of_refills > 0) {
     // Update allocation history if a reasonable amount of eden was allocated.
@@ -113,6 +117,24 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   reset_statistics();
 }
 
+void ThreadLocalAllocBuffer::send_statistics_event() {
+  if (_number_of_refills == 0 && _slow_allocations == 0) {
+    return;
+  }
+  EventTLABStatistics event;
+  if (event.should_commit()) {
+    event.set_gcId(GCId::current_or_undefined());
+    event.set_thread(JFR_JVM_THREAD_ID(thread()));
+    event.set_refills(_number_of_refills);
+    event.set_allocated(_allocated_size * HeapWordSize);
+    event.set_refillWaste((u8)_refill_waste * HeapWordSize);
+    event.set_gcWaste((u8)_gc_waste * HeapWordSize);
+    event.set_slowAllocations(_slow_allocations);
+    event.set_desiredSize(_desired_size * HeapWordSize);
+    event.commit();
+  }
+}
+
 void ThreadLocalAllocBuffer::insert_filler() {
   assert(end() != nullptr, "Must not be retired");
   if (top() < hard_end()) {
@@ -163,6 +185,25 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+// The desired size is chosen at GC so that the thread needs target_refills()
+// refills until the next GC. A thread that has already used up that many
+// allocates faster than its history suggests, so double the size for the
+// rest of the cycle rather than keep refilling small TLABs. The next resize()
+// goes back to the averaged allocation fraction.
+void ThreadLocalAllocBuffer::adapt_to_refill_rate() {
+  if ((_number_of_refills % target_refills()) != 0 || desired_size() >= max_size()) {
+    return;
+  }
+  size_t new_size = align_object_size(MIN2(desired_size() * 2, max_size()));
+
+  log_trace(gc, tlab)("TLAB adapt size: thread: " PTR_FORMAT " [id: %2d]"
+                      " refills %d desired_size: %zu -> %zu",
+                      p2i(thread()), thread()->osthread()->thread_id(),
+                      _number_of_refills, desired_size(), new_size);
+
+  set_desired_size(new_size);
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _refill_waste      = 0;
@@ -177,6 +218,9 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   _number_of_refills++;
   _allocated_size += new_size;
   print_stats("fill");
+  if (TLABAdaptiveRefillSizing && ResizeTLAB) {
+    adapt_to_refill_rate();
+  }
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
   initialize(start, top, start + new_size - alignment_reserve());
@@ -93,6 +93,9 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   void insert_filler();
 
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
+  void send_statistics_event();
+
+  void adapt_to_refill_rate();
 
   void print_stats(const char* tag);
 
@@ -62,6 +62,11 @@
           "Size of old gen promotion LAB's (in HeapWords)")                 \
           constraint(OldPLABSizeConstraintFunc,AfterMemoryInit)             \
                                                                             \
+  product(bool, TLABAdaptiveRefillSizing, false, EXPERIMENTAL,              \
+          "Grow the desired TLAB size of a thread within a GC cycle each "  \
+          "time it has refilled its TLAB as often as expected for a whole " \
+          "cycle")                                                          \
+                                                                            \
   product(uintx, TLABAllocationWeight, 35,                                  \
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
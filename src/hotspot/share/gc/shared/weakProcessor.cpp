@@ -45,8 +45,9 @@ static void notify_jvmti_tagmaps() {
   // Notify JVMTI tagmaps that a STW weak reference processing might be
   // clearing entries, so the tagmaps need cleaning.  Doing this here allows
   // the tagmap's oopstorage notification handler to not care whether it's
-  // invoked by STW or concurrent reference processing.
-  JvmtiTagMap::set_needs_cleaning();
+  // invoked by STW or concurrent reference processing.  The cleared
+  // entries are reported, so the tagmaps don't need to scan for them.
+  JvmtiTagMap::set_needs_cleaning(true /* reports_dead_handles */);
 #endif // INCLUDE_JVMTI
 }
 
@@ -56,8 +57,9 @@ void WeakProcessor::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_a
 
   for (OopStorage* storage : OopStorageSet::Range<OopStorageSet::WeakId>()) {
     if (storage->should_report_num_dead()) {
-      CountingClosure<BoolObjectClosure, OopClosure> cl(is_alive, keep_alive);
+      CountingClosure<BoolObjectClosure, OopClosure> cl(is_alive, keep_alive, storage);
       storage->oops_do(&cl);
+      cl.flush_dead_entries();
       storage->report_num_dead(cl.dead());
     } else {
       storage->weak_oops_do(is_alive, keep_alive);
@@ -28,6 +28,7 @@
 #include "gc/shared/weakProcessor.hpp"
 
 #include "classfile/stringTable.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
@@ -42,22 +43,42 @@ class OopClosure;
 
 template <typename IsAlive, typename KeepAlive>
 class WeakProcessor::CountingClosure : public Closure {
+  static const size_t DeadEntriesBufferSize = 256;
+
   IsAlive* _is_alive;
   KeepAlive* _keep_alive;
   size_t _old_dead;
   size_t _new_dead;
   size_t _live;
+  // Storage to report cleared entries to, or null if not requested.
+  const OopStorage* _report_storage;
+  size_t _dead_entries_count;
+  oop* _dead_entries[DeadEntriesBufferSize];
+
+  void record_dead_entry(oop* p) {
+    _dead_entries[_dead_entries_count++] = p;
+    if (_dead_entries_count == DeadEntriesBufferSize) {
+      flush_dead_entries();
+    }
+  }
 
 public:
-  CountingClosure(IsAlive* is_alive, KeepAlive* keep_alive) :
+  CountingClosure(IsAlive* is_alive, KeepAlive* keep_alive, const OopStorage* storage) :
     _is_alive(is_alive),
     _keep_alive(keep_alive),
     _old_dead(0),
     _new_dead(0),
-    _live(0)
+    _live(0),
+    _report_storage(storage->should_report_dead_entries() ? storage : nullptr),
+    _dead_entries_count(0)
   {}
 
-  void do_oop(oop* p) {
+  ~CountingClosure() {
+    assert(_dead_entries_count == 0, "dead entries not flushed");
+  }
+
+  // Returns true if the entry was cleared.
+  bool do_entry(oop* p) {
     oop obj = *p;
     if (obj == nullptr) {
       ++_old_dead;
@@ -67,6 +88,26 @@ class WeakProcessor::CountingClosure : public Closure {
     } else {
       *p = nullptr;
       ++_new_dead;
+      if (_report_storage != nullptr) {
+        record_dead_entry(p);
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void do_oop(oop* p) {
+    do_entry(p);
+  }
+
+  // Entries skipped because they were cleared by an earlier processing
+  void add_skipped(size_t skipped) { _old_dead += skipped; }
+
+  // Report the buffered cleared entries to the storage.
+  void flush_dead_entries() {
+    if (_dead_entries_count > 0) {
+      _report_storage->report_dead_entries(_dead_entries, _dead_entries_count);
+      _dead_entries_count = 0;
     }
   }
 
@@ -84,14 +125,21 @@ void WeakProcessor::Task::work(uint worker_id,
          worker_id, _nworkers);
 
   for (auto id : EnumRange<OopStorageSet::WeakId>()) {
-    CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
     WeakProcessorParTimeTracker pt(_times, id, worker_id);
     StorageState* cur_state = _storage_states.par_state(id);
     assert(cur_state->storage() == OopStorageSet::storage(id), "invariant");
-    cur_state->oops_do(&cl);
+    CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive, cur_state->storage());
+    size_t skipped = 0;
+    if (WeakProcessorSkipClearedEntries) {
+      skipped = cur_state->iterate_uncleared([&](oop* p) { return cl.do_entry(p); });
+      cl.add_skipped(skipped);
+    } else {
+      cur_state->oops_do(&cl);
+    }
+    cl.flush_dead_entries();
     cur_state->increment_num_dead(cl.dead());
     if (_times != nullptr) {
-      _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total());
+      _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total(), skipped);
     }
   }
 }
@@ -140,6 +188,9 @@ void WeakProcessor::weak_oops_do(WorkerThreads* workers,
   WeakOopsDoTask task("Weak Processor", is_alive, keep_alive, times, nworkers);
   workers->run_task(&task, nworkers);
   task.report_num_dead();
+  // Remove the StringTable entries just found dead while the workers are
+  // at hand, rather than leaving them to the service thread.
+  StringTable::clean_dead_entries(workers, nworkers);
 }
 
 template<typename IsAlive, typename KeepAlive>
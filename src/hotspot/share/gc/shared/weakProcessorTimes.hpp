@@ -35,7 +35,8 @@ template<typename T> class WorkerDataArray;
 class WeakProcessorTimes {
   enum {
     DeadItems,
-    TotalItems
+    TotalItems,
+    SkippedItems
   };
   uint _max_threads;
   uint _active_workers;
@@ -69,7 +70,8 @@ class WeakProcessorTimes {
   void record_worker_items(uint worker_id,
                            OopStorageSet::WeakId id,
                            size_t num_dead,
-                           size_t num_total);
+                           size_t num_total,
+                           size_t num_skipped);
 
   void reset();
 
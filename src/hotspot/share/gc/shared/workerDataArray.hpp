@@ -66,6 +66,8 @@ class WorkerDataArray  : public CHeapObj<mtGC> {
 
   static T uninitialized();
 
+  uint length() const { return _length; }
+
   void set(uint worker_i, T value);
   void set_or_add(uint worker_i, T value);
   T get(uint worker_i) const;
@@ -30,6 +30,17 @@
 #include "runtime/os.hpp"
 #include "runtime/vm_version.hpp"
 
+// The number of whole CPUs of the container CPU quota, or the active
+// processor count if there is no quota. Running more workers than that at
+// the same time makes the process hit the quota and get throttled.
+static uint cpu_quota_workers() {
+  double quota;
+  if (os::is_containerized() && os::Container::processor_count(quota)) {
+    return MAX2((uint)quota, 1u);
+  }
+  return (uint)os::active_processor_count();
+}
+
 uint WorkerPolicy::_parallel_worker_threads = 0;
 bool WorkerPolicy::_parallel_worker_threads_initialized = false;
 
@@ -123,6 +134,11 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  // The CPU quota is a hard limit, it may change at any time.
+  if (UseCPUQuotaForGCWorkers) {
+    new_active_workers = MIN2(new_active_workers, MAX2((uintx) cpu_quota_workers(), min_workers));
+  }
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
@@ -132,6 +132,8 @@ class WorkerThread : public NamedThread {
   static THREAD_LOCAL uint _worker_id;
 
   WorkerTaskDispatcher* const _dispatcher;
+  // Index of the thread within its WorkerThreads
+  const uint _which;
 
   static void set_worker_id(uint worker_id) { _worker_id = worker_id; }
 
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shared/collectedHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahAllocRequest.hpp"
+#include "gc/shenandoah/shenandoahCPUAllocBuffers.hpp"
+#include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahHeapRegion.hpp"
+#include "gc/shenandoah/shenandoah_globals.hpp"
+#include "runtime/atomicAccess.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+
+static size_t refill_words() {
+  size_t words = ShenandoahPerCPUAllocBufferSize / HeapWordSize;
+  if (words == 0) {
+    words = ShenandoahHeapRegion::max_tlab_size_words();
+  }
+  words = clamp(words, ThreadLocalAllocBuffer::min_size(), ShenandoahHeapRegion::max_tlab_size_words());
+  return align_down(words, MinObjAlignment);
+}
+
+ShenandoahCPUAllocBuffers::ShenandoahCPUAllocBuffers(ShenandoahHeap* heap) :
+  _heap(heap),
+  _num_buffers((uint)os::processor_count()),
+  _refill_words(refill_words()),
+  _buffers(NEW_C_HEAP_ARRAY(Buffer, _num_buffers, mtGC)),
+  _retired_words(0) {
+  for (uint i = 0; i < _num_buffers; i++) {
+    Buffer* buffer = ::new (&_buffers[i]) Buffer();
+    buffer->_top = nullptr;
+    buffer->_end = nullptr;
+    buffer->_allocs = 0;
+    buffer->_refills = 0;
+  }
+}
+
+ShenandoahCPUAllocBuffers::~ShenandoahCPUAllocBuffers() {
+  FREE_C_HEAP_ARRAY(Buffer, _buffers);
+}
+
+ShenandoahCPUAllocBuffers::Buffer* ShenandoahCPUAllocBuffers::current_buffer() const {
+  return &_buffers[(uint)os::processor_id() % _num_buffers];
+}
+
+HeapWord* ShenandoahCPUAllocBuffers::carve(Buffer* buffer, size_t min_size, size_t requested_size, size_t* actual_size) {
+  const size_t available = pointer_delta(buffer->_end, buffer->_top);
+  size_t size = MIN2(requested_size, available);
+  const size_t remainder = available - size;
+  if (remainder > 0 && remainder < CollectedHeap::min_fill_size()) {
+    // Leave room for the filler object that retires the buffer
+    size -= MIN2(size, CollectedHeap::min_fill_size() - remainder);
+  }
+  if (size < min_size) {
+    return nullptr;
+  }
+
+  HeapWord* result = buffer->_top;
+  buffer->_top += size;
+  buffer->_allocs++;
+  *actual_size = size;
+  return result;
+}
+
+HeapWord* ShenandoahCPUAllocBuffers::allocate_tlab(size_t min_size, size_t requested_size, size_t* actual_size) {
+  Buffer* buffer = current_buffer();
+  {
+    ShenandoahLocker locker(&buffer->_lock);
+    HeapWord* result = carve(buffer, min_size, requested_size, actual_size);
+    if (result != nullptr) {
+      return result;
+    }
+  }
+
+  // Refill without holding the buffer lock, the heap allocation may have to
+  // wait for a collection. The thread may be running on another CPU by the
+  // time the batch is allocated, which is fine, any buffer will do.
+  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_tlab(min_size, MAX2(requested_size, _refill_words));
+  HeapWord* batch = _heap->allocate_memory(req);
+  if (batch == nullptr) {
+    *actual_size = 0;
+    return nullptr;
+  }
+
+  // This thread gets the front of the batch
+  Buffer fresh;
+  fresh._top = batch;
+  fresh._end = batch + req.actual_size();
+  fresh._allocs = 0;
+  fresh._refills = 0;
+  HeapWord* result = carve(&fresh, min_size, requested_size, actual_size);
+  assert(result == batch, "batch holds at least min_size words");
+
+  ShenandoahLocker locker(&buffer->_lock);
+  buffer->_refills++;
+  buffer->_allocs++;
+  if (pointer_delta(fresh._end, fresh._top) > pointer_delta(buffer->_end, buffer->_top)) {
+    // Keep the larger of the two remainders for the threads on this CPU
+    retire(buffer);
+    buffer->_top = fresh._top;
+    buffer->_end = fresh._end;
+  } else {
+    retire(&fresh);
+  }
+  return result;
+}
+
+void ShenandoahCPUAllocBuffers::retire(Buffer* buffer) {
+  if (buffer->_top < buffer->_end) {
+    const size_t words = pointer_delta(buffer->_end, buffer->_top);
+    CollectedHeap::fill_with_object(buffer->_top, words);
+    AtomicAccess::add(&_retired_words, words, memory_order_relaxed);
+  }
+  buffer->_top = nullptr;
+  buffer->_end = nullptr;
+}
+
+void ShenandoahCPUAllocBuffers::retire_all() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+  // No thread can be inside a buffer critical section at a safepoint, they
+  // do not block while holding the buffer lock.
+  for (uint i = 0; i < _num_buffers; i++) {
+    retire(&_buffers[i]);
+  }
+}
+
+size_t ShenandoahCPUAllocBuffers::allocs() const {
+  size_t allocs = 0;
+  for (uint i = 0; i < _num_buffers; i++) {
+    allocs += _buffers[i]._allocs;
+  }
+  return allocs;
+}
+
+size_t ShenandoahCPUAllocBuffers::refills() const {
+  size_t refills = 0;
+  for (uint i = 0; i < _num_buffers; i++) {
+    refills += _buffers[i]._refills;
+  }
+  return refills;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_GC_SHENANDOAH_SHENANDOAHCPUALLOCBUFFERS_HPP
+#define SHARE_GC_SHENANDOAH_SHENANDOAHCPUALLOCBUFFERS_HPP
+
+#include "gc/shenandoah/shenandoahLock.hpp"
+#include "gc/shenandoah/shenandoahPadding.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ShenandoahHeap;
+
+// Per-CPU buffers that mutator TLABs are carved from.
+//
+// Every mutator TLAB refill normally takes the heap lock. With these buffers,
+// a thread carves its new TLAB from the buffer of the CPU it runs on, under
+// a lock that is only shared with the other threads running on that CPU.
+// The heap lock is only taken to refill a buffer, which allocates a batch of
+// memory from the mutator partition of the free set, the same way a large
+// TLAB is allocated. The free set accounting thus stays exactly the same: a
+// buffer is simply memory that has been allocated by a mutator.
+//
+// Like TLABs, the buffers must not be allocated from across the pauses that
+// capture TAMS or prepare for evacuation, so they are retired, and their
+// remainders filled, at these pauses.
+class ShenandoahCPUAllocBuffers : public CHeapObj<mtGC> {
+private:
+  struct Buffer {
+    shenandoah_padding(0);
+    ShenandoahLock _lock;
+    HeapWord*      _top;
+    HeapWord*      _end;
+    size_t         _allocs;
+    size_t         _refills;
+    shenandoah_padding(1);
+  };
+
+  ShenandoahHeap* const _heap;
+  const uint            _num_buffers;
+  const size_t          _refill_words;
+  Buffer*               _buffers;
+  size_t                _retired_words;
+
+  Buffer* current_buffer() const;
+
+  // Carves a TLAB of at most requested_size words from the buffer, leaving
+  // a remainder that is either empty or large enough for a filler object.
+  static HeapWord* carve(Buffer* buffer, size_t min_size, size_t requested_size, size_t* actual_size);
+
+  void retire(Buffer* buffer);
+
+public:
+  ShenandoahCPUAllocBuffers(ShenandoahHeap* heap);
+  ~ShenandoahCPUAllocBuffers();
+
+  HeapWord* allocate_tlab(size_t min_size, size_t requested_size, size_t* actual_size);
+
+  // Fills the remainders of all buffers. Called at a safepoint.
+  void retire_all();
+
+  size_t allocs() const;
+  size_t refills() const;
+  size_t retired_words() const { return _retired_words; }
+};
+
+#endif // SHARE_GC_SHENANDOAH_SHENANDOAHCPUALLOCBUFFERS_HPP
@@ -27,6 +27,7 @@
 
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shenandoah/shenandoahNumberSeq.hpp"
+#include "runtime/os.hpp"
 
 enum CardStatType {
   DIRTY_RUN,
@@ -37,6 +38,7 @@ enum CardStatType {
   MAX_CLEAN_RUN,
   DIRTY_SCAN_OBJS,
   ALTERNATIONS,
+  CARDS_PER_NS,
   MAX_CARD_STAT_TYPE
 };
 
@@ -61,6 +63,8 @@ class ShenandoahCardStats: public CHeapObj<mtGC> {
 
   size_t _alternation_cnt;
 
+  jlong _start_ns;
+
 public:
   ShenandoahCardStats(size_t cards_in_cluster, HdrSeq* card_stats) :
     _cards_in_cluster(cards_in_cluster),
@@ -70,7 +74,8 @@ class ShenandoahCardStats: public CHeapObj<mtGC> {
     _max_dirty_run(0),
     _max_clean_run(0),
     _dirty_scan_obj_cnt(0),
-    _alternation_cnt(0)
+    _alternation_cnt(0),
+    _start_ns(ShenandoahEnableCardStats ? os::javaTimeNanos() : 0)
   { }
 
   ~ShenandoahCardStats() {
@@ -92,6 +97,12 @@ class ShenandoahCardStats: public CHeapObj<mtGC> {
 
       // Update global stats for alternation counts
       _local_card_stats[ALTERNATIONS].add(_alternation_cnt);
+
+      // Update global stats for scan throughput, covering the card walk and the object scans
+      const jlong elapsed_ns = os::javaTimeNanos() - _start_ns;
+      if (elapsed_ns > 0) {
+        _local_card_stats[CARDS_PER_NS].add((double)_cards_in_cluster / (double)elapsed_ns);
+      }
     }
   }
 
@@ -46,6 +46,8 @@ class ShenandoahSuperClosure : public MetadataVisitingOopIterateClosure {
   ShenandoahHeap* const _heap;
 
 public:
+  typedef ShenandoahReferenceProcessor ReferenceDiscovererType;
+
   inline ShenandoahSuperClosure();
   inline ShenandoahSuperClosure(ShenandoahReferenceProcessor* rp);
   inline void do_nmethod(nmethod* nm);
@@ -115,6 +115,12 @@ void ShenandoahCollectionSet::add_region(ShenandoahHeapRegion* r) {
   _garbage += garbage;
   _used += r->used();
   _live += live;
+
+  if (ShenandoahBatchEvacuation && !ShenandoahHeap::heap()->mode()->is_generational() &&
+      live * 100 >= ShenandoahBatchEvacLiveThreshold * ShenandoahHeapRegion::region_size_bytes()) {
+    r->set_batch_evac_pending();
+  }
+
   // Update the region status too. State transition would be checked internally.
   r->make_cset();
 }
@@ -124,6 +130,13 @@ void ShenandoahCollectionSet::clear() {
 
   Copy::zero_to_bytes(_cset_map, _map_size);
 
+  if (ShenandoahBatchEvacuation) {
+    // Regions can be left pending by a cycle that was upgraded to a full GC
+    for (size_t index = 0; index < _heap->num_regions(); index++) {
+      _heap->get_region(index)->reset_batch_evac();
+    }
+  }
+
 #ifdef ASSERT
   for (size_t index = 0; index < _heap->num_regions(); index ++) {
     assert (!_heap->get_region(index)->is_cset(), "should have been cleared before");
@@ -466,7 +466,7 @@ void ShenandoahConcurrentGC::entry_thread_roots() {
 void ShenandoahConcurrentGC::entry_weak_refs() {
   ShenandoahHeap* const heap = ShenandoahHeap::heap();
   const char* msg = conc_weak_refs_event_message();
-  ShenandoahConcurrentPhase gc_phase(msg, ShenandoahPhaseTimings::conc_weak_refs);
+  ShenandoahConcurrentPhase gc_phase(msg, conc_weak_refs_phase());
   EventMark em("%s", msg);
 
   ShenandoahWorkerScope scope(heap->workers(),
@@ -672,6 +672,10 @@ void ShenandoahConcurrentGC::op_init_mark() {
   assert(!_generation->is_mark_complete(), "should not be complete");
   assert(!heap->has_forwarded_objects(), "No forwarded objects on this path");
 
+  // Memory in the CPU allocation buffers is below TAMS, and must not be
+  // handed out as TLABs during marking.
+  heap->retire_cpu_alloc_buffers();
+
   if (heap->mode()->is_generational()) {
     if (_generation->is_global()) {
       heap->old_generation()->cancel_gc();
@@ -777,6 +781,9 @@ void ShenandoahConcurrentGC::op_final_mark() {
         heap->verifier()->verify_before_evacuation(_generation);
       }
 
+      // New TLABs must come from the new free set, outside of the collection set.
+      heap->retire_cpu_alloc_buffers();
+
       heap->set_evacuation_in_progress(true);
       // From here on, we need to update references.
       heap->set_has_forwarded_objects(true);
@@ -850,11 +857,12 @@ void ShenandoahConcurrentGC::op_weak_refs() {
   ShenandoahHeap* const heap = ShenandoahHeap::heap();
   assert(heap->is_concurrent_weak_root_in_progress(), "Only during this phase");
   // Concurrent weak refs processing
-  ShenandoahGCWorkerPhase worker_phase(ShenandoahPhaseTimings::conc_weak_refs);
+  const ShenandoahPhaseTimings::Phase phase = conc_weak_refs_phase();
+  ShenandoahGCWorkerPhase worker_phase(phase);
   if (heap->gc_cause() == GCCause::_wb_breakpoint) {
     ShenandoahBreakpoint::at_after_reference_processing_started();
   }
-  _generation->ref_processor()->process_references(ShenandoahPhaseTimings::conc_weak_refs, heap->workers(), true /* concurrent */);
+  _generation->ref_processor()->process_references(phase, heap->workers(), true /* concurrent */);
 }
 
 class ShenandoahEvacUpdateCleanupOopStorageRootsClosure : public BasicOopIterateClosure {
@@ -1348,6 +1356,10 @@ const char* ShenandoahConcurrentGC::conc_final_roots_event_message() const {
   }
 }
 
+ShenandoahPhaseTimings::Phase ShenandoahConcurrentGC::conc_weak_refs_phase() const {
+  return _generation->is_old() ? ShenandoahPhaseTimings::conc_weak_refs_old : ShenandoahPhaseTimings::conc_weak_refs;
+}
+
 const char* ShenandoahConcurrentGC::conc_weak_refs_event_message() const {
   if (ShenandoahHeap::heap()->unload_classes()) {
     SHENANDOAH_RETURN_EVENT_MESSAGE(_generation->type(), "Concurrent weak references", " (unload classes)");
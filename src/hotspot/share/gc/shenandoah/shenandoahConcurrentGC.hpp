@@ -149,6 +149,7 @@ class ShenandoahConcurrentGC : public ShenandoahGC {
   const char* conc_reset_event_message() const;
   const char* conc_reset_after_collect_event_message() const;
   const char* conc_weak_refs_event_message() const;
+  ShenandoahPhaseTimings::Phase conc_weak_refs_phase() const;
   const char* conc_weak_roots_event_message() const;
   const char* conc_cleanup_event_message() const;
   const char* conc_init_update_refs_event_message() const;
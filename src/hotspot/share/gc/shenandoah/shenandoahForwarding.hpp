@@ -62,6 +62,12 @@ class ShenandoahForwarding {
    */
   static inline oop try_update_forwardee(oop obj, oop update);
 
+  /* Installs $update as forwardee of $holder with a releasing store.
+   * Only for objects that no other thread can be evacuating, see
+   * ShenandoahBatchEvacuation.
+   */
+  static inline void set_forwardee_exclusive(oop obj, oop update);
+
   static inline size_t size(oop obj);
   static inline Klass* klass(oop obj);
 };
@@ -90,6 +90,11 @@ inline oop ShenandoahForwarding::try_update_forwardee(oop obj, oop update) {
   }
 }
 
+inline void ShenandoahForwarding::set_forwardee_exclusive(oop obj, oop update) {
+  assert(!obj->mark().is_marked(), "Already forwarded");
+  obj->release_set_mark(markWord::encode_pointer_as_mark(update));
+}
+
 inline Klass* ShenandoahForwarding::klass(oop obj) {
   if (UseCompactObjectHeaders) {
     markWord mark = obj->mark();
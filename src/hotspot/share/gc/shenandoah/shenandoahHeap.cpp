@@ -50,6 +50,7 @@
 #include "gc/shenandoah/shenandoahCollectorPolicy.hpp"
 #include "gc/shenandoah/shenandoahConcurrentMark.hpp"
 #include "gc/shenandoah/shenandoahControlThread.hpp"
+#include "gc/shenandoah/shenandoahCPUAllocBuffers.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahGenerationalEvacuationTask.hpp"
 #include "gc/shenandoah/shenandoahGenerationalHeap.hpp"
@@ -98,6 +99,7 @@
 #include "utilities/events.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
+#include "utilities/spinYield.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
 #endif
@@ -487,6 +489,10 @@ jint ShenandoahHeap::initialize() {
     satbqs.set_buffer_enqueue_threshold_percentage(60); // G1SATBBufferEnqueueingThresholdPercent
   }
 
+  if (ShenandoahPerCPUAllocBuffers && UseTLAB) {
+    _cpu_alloc_buffers = new ShenandoahCPUAllocBuffers(this);
+  }
+
   _monitoring_support = new ShenandoahMonitoringSupport(this);
   _phase_timings = new ShenandoahPhaseTimings(max_workers());
   ShenandoahCodeRoots::initialize();
@@ -585,6 +591,7 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _cycle_memory_manager("Shenandoah Cycles"),
   _gc_timer(new ConcurrentGCTimer()),
   _log_min_obj_alignment_in_bytes(LogMinObjAlignmentInBytes),
+  _cpu_alloc_buffers(nullptr),
   _marking_context(nullptr),
   _bitmap_size(0),
   _bitmap_regions_per_slice(0),
@@ -895,6 +902,10 @@ HeapWord* ShenandoahHeap::allocate_from_gclab_slow(Thread* thread, size_t size)
 HeapWord* ShenandoahHeap::allocate_new_tlab(size_t min_size,
                                             size_t requested_size,
                                             size_t* actual_size) {
+  if (_cpu_alloc_buffers != nullptr) {
+    return _cpu_alloc_buffers->allocate_tlab(min_size, requested_size, actual_size);
+  }
+
   ShenandoahAllocRequest req = ShenandoahAllocRequest::for_tlab(min_size, requested_size);
   HeapWord* res = allocate_memory(req);
   if (res != nullptr) {
@@ -1113,6 +1124,89 @@ class ShenandoahConcurrentEvacuateRegionObjectClosure : public ObjectClosure {
   }
 };
 
+// Evacuates the live objects of a region claimed for batch evacuation. Runs of live
+// objects that are adjacent in the region, and get adjacent copies in the GCLAB, are
+// copied at once. Their forwarding pointers are then installed with releasing stores:
+// no other thread evacuates objects of a claimed region, so there is no race to
+// settle with a CAS.
+class ShenandoahBatchEvacuateRegionObjectClosure : public ObjectClosure {
+private:
+  ShenandoahHeap* const _heap;
+  Thread* const _thread;
+  ShenandoahHeapRegion* const _region;
+  bool _claimed;
+
+  // The current run of source objects, and the copy of its first object
+  HeapWord* _run_start;
+  HeapWord* _run_end;
+  HeapWord* _run_copy;
+
+  void flush_run() {
+    if (_run_start == _run_end) {
+      return;
+    }
+
+    Copy::aligned_disjoint_words(_run_start, _run_copy, pointer_delta(_run_end, _run_start));
+
+    for (HeapWord* src = _run_start; src < _run_end;) {
+      const oop copy_val = cast_to_oop(_run_copy + pointer_delta(src, _run_start));
+      const size_t size = copy_val->size();
+      if (ShenandoahEvacTracking) {
+        _heap->evac_tracker()->begin_evacuation(_thread, size * HeapWordSize, _region->affiliation(), _region->affiliation());
+      }
+      ContinuationGCSupport::relativize_stack_chunk(copy_val);
+      ShenandoahForwarding::set_forwardee_exclusive(cast_to_oop(src), copy_val);
+      shenandoah_assert_correct(nullptr, copy_val);
+      if (ShenandoahEvacTracking) {
+        _heap->evac_tracker()->end_evacuation(_thread, size * HeapWordSize, _region->affiliation(), _region->affiliation());
+      }
+      src += size;
+    }
+
+    _run_start = _run_end = nullptr;
+  }
+
+public:
+  ShenandoahBatchEvacuateRegionObjectClosure(ShenandoahHeap* heap, ShenandoahHeapRegion* region) :
+    _heap(heap), _thread(Thread::current()), _region(region), _claimed(true),
+    _run_start(nullptr), _run_end(nullptr), _run_copy(nullptr) {
+    assert(region->batch_evac_state() == ShenandoahHeapRegion::BatchEvacClaimed, "Must be claimed");
+  }
+
+  void do_object(oop p) {
+    shenandoah_assert_marked(nullptr, p);
+    if (_claimed) {
+      assert(!p->is_forwarded(), "Objects in a claimed region are only forwarded by the claiming worker");
+      HeapWord* const src = cast_from_oop<HeapWord*>(p);
+      const size_t size = p->size();
+      HeapWord* const copy = _heap->allocate_from_gclab(_thread, size);
+      if (copy != nullptr) {
+        if (src != _run_end || copy != _run_copy + pointer_delta(_run_end, _run_start)) {
+          flush_run();
+          _run_start = src;
+          _run_copy = copy;
+        }
+        _run_end = src + size;
+        return;
+      }
+      // Out of GCLAB memory, the shared path deals with the rest of the region
+      release();
+    }
+
+    if (!p->is_forwarded()) {
+      _heap->evacuate_object(p, _thread);
+    }
+  }
+
+  void release() {
+    if (_claimed) {
+      flush_run();
+      _region->reset_batch_evac();
+      _claimed = false;
+    }
+  }
+};
+
 class ShenandoahEvacuationTask : public WorkerTask {
 private:
   ShenandoahHeap* const _sh;
@@ -1147,7 +1241,14 @@ class ShenandoahEvacuationTask : public WorkerTask {
     ShenandoahHeapRegion* r;
     while ((r =_cs->claim_next()) != nullptr) {
       assert(r->has_live(), "Region %zu should have been reclaimed early", r->index());
-      _sh->marked_object_iterate(r, &cl);
+      if (UseTLAB && r->batch_evac_state() == ShenandoahHeapRegion::BatchEvacPending &&
+          r->try_leave_batch_evac_pending(ShenandoahHeapRegion::BatchEvacClaimed) == ShenandoahHeapRegion::BatchEvacClaimed) {
+        ShenandoahBatchEvacuateRegionObjectClosure batch_cl(_sh, r);
+        _sh->marked_object_iterate(r, &batch_cl);
+        batch_cl.release();
+      } else {
+        _sh->marked_object_iterate(r, &cl);
+      }
 
       if (_sh->check_cancelled_gc_and_yield(_concurrent)) {
         break;
@@ -1295,10 +1396,37 @@ oop ShenandoahHeap::evacuate_object(oop p, Thread* thread) {
   ShenandoahHeapRegion* r = heap_region_containing(p);
   assert(!r->is_humongous(), "never evacuate humongous objects");
 
+  if (r->batch_evac_state() != ShenandoahHeapRegion::BatchEvacShared) {
+    oop fwd = wait_for_batch_evacuation(p, r);
+    if (fwd != nullptr) {
+      return fwd;
+    }
+  }
+
   ShenandoahAffiliation target_gen = r->affiliation();
   return try_evacuate_object(p, thread, r, target_gen);
 }
 
+oop ShenandoahHeap::wait_for_batch_evacuation(oop p, ShenandoahHeapRegion* r) {
+  uint state = r->batch_evac_state();
+  if (state == ShenandoahHeapRegion::BatchEvacPending) {
+    // Rather than wait for a worker to get to the region, evacuate its objects the shared way
+    state = r->try_leave_batch_evac_pending(ShenandoahHeapRegion::BatchEvacShared);
+  }
+
+  if (state == ShenandoahHeapRegion::BatchEvacClaimed) {
+    // The claiming worker either forwards the object, or gives up the claim
+    // before it goes through the OOM during evac protocol. This thread is
+    // thus never keeping the worker from making progress.
+    SpinYield spin;
+    while (!p->is_forwarded() && r->batch_evac_state() == ShenandoahHeapRegion::BatchEvacClaimed) {
+      spin.wait();
+    }
+  }
+
+  return p->is_forwarded() ? ShenandoahForwarding::get_forwardee(p) : nullptr;
+}
+
 oop ShenandoahHeap::try_evacuate_object(oop p, Thread* thread, ShenandoahHeapRegion* from_region,
                                                ShenandoahAffiliation target_gen) {
   assert(target_gen == YOUNG_GENERATION, "Only expect evacuations to young in this mode");
@@ -1460,9 +1588,17 @@ class ShenandoahCheckCleanGCLABClosure : public ThreadClosure {
   }
 };
 
+void ShenandoahHeap::retire_cpu_alloc_buffers() {
+  if (_cpu_alloc_buffers != nullptr) {
+    _cpu_alloc_buffers->retire_all();
+  }
+}
+
 void ShenandoahHeap::labs_make_parsable() {
   assert(UseTLAB, "Only call with UseTLAB");
 
+  retire_cpu_alloc_buffers();
+
   ShenandoahRetireGCLABClosure cl(false);
 
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *t = jtiwh.next(); ) {
@@ -1485,6 +1621,8 @@ void ShenandoahHeap::tlabs_retire(bool resize) {
   assert(UseTLAB, "Only call with UseTLAB");
   assert(!resize || ResizeTLAB, "Only call for resize when ResizeTLAB is enabled");
 
+  retire_cpu_alloc_buffers();
+
   ThreadLocalAllocStats stats;
 
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *t = jtiwh.next(); ) {
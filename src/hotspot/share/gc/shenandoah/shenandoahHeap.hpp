@@ -62,6 +62,7 @@ class ShenandoahHeap;
 class ShenandoahHeapRegion;
 class ShenandoahHeapRegionClosure;
 class ShenandoahCollectionSet;
+class ShenandoahCPUAllocBuffers;
 class ShenandoahFreeSet;
 class ShenandoahConcurrentMark;
 class ShenandoahFullGC;
@@ -127,6 +128,7 @@ typedef Stack<oop, mtGC>  ShenandoahScanObjectStack;
 //
 class ShenandoahHeap : public CollectedHeap {
   friend class ShenandoahAsserts;
+  friend class ShenandoahBatchEvacuateRegionObjectClosure;
   friend class VMStructs;
   friend class ShenandoahGCSession;
   friend class ShenandoahGCStateResetter;
@@ -681,6 +683,8 @@ class ShenandoahHeap : public CollectedHeap {
   inline HeapWord* allocate_from_gclab(Thread* thread, size_t size);
 
 private:
+  ShenandoahCPUAllocBuffers* _cpu_alloc_buffers;
+
   HeapWord* allocate_memory_under_lock(ShenandoahAllocRequest& request, bool& in_new_region);
   HeapWord* allocate_from_gclab_slow(Thread* thread, size_t size);
   HeapWord* allocate_new_gclab(size_t min_size, size_t word_size, size_t* actual_size);
@@ -696,6 +700,9 @@ class ShenandoahHeap : public CollectedHeap {
                                                Metaspace::MetadataType mdtype) override;
 
   HeapWord* allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size) override;
+
+  ShenandoahCPUAllocBuffers* cpu_alloc_buffers() const { return _cpu_alloc_buffers; }
+  void retire_cpu_alloc_buffers();
   size_t tlab_capacity() const override;
   size_t unsafe_max_tlab_alloc() const override;
   size_t max_tlab_size() const override;
@@ -778,6 +785,11 @@ class ShenandoahHeap : public CollectedHeap {
 
   oop try_evacuate_object(oop src, Thread* thread, ShenandoahHeapRegion* from_region, ShenandoahAffiliation target_gen);
 
+  // Makes sure no worker claims the batch evacuation of region r, or waits for the
+  // worker that did to forward src. Returns the forwardee, or null if src still
+  // needs to be evacuated.
+  oop wait_for_batch_evacuation(oop src, ShenandoahHeapRegion* r);
+
 protected:
   // Used primarily to look for failed evacuation attempts.
   ShenandoahEvacuationTracker*  _evac_tracker;
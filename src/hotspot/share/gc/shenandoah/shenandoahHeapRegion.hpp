@@ -224,6 +224,24 @@ class ShenandoahHeapRegion {
   void record_unpin();
   size_t pin_count() const;
 
+  // Batch evacuation states of collection set regions, see ShenandoahBatchEvacuation.
+  // A pending region is evacuated by the first worker that claims it, unless another
+  // thread needs to evacuate one of its objects first, which makes the region shared.
+  // Objects in a claimed region are only ever evacuated by the claiming worker.
+  static const uint BatchEvacShared  = 0;
+  static const uint BatchEvacPending = 1;
+  static const uint BatchEvacClaimed = 2;
+
+  uint batch_evac_state() const { return AtomicAccess::load_acquire(&_batch_evac_state); }
+  void set_batch_evac_pending() { AtomicAccess::store(&_batch_evac_state, BatchEvacPending); }
+  void reset_batch_evac()       { AtomicAccess::release_store(&_batch_evac_state, BatchEvacShared); }
+
+  // Moves a pending region to the given state. Returns the resulting state.
+  uint try_leave_batch_evac_pending(uint new_state) {
+    const uint prev = AtomicAccess::cmpxchg(&_batch_evac_state, BatchEvacPending, new_state);
+    return prev == BatchEvacPending ? new_state : prev;
+  }
+
 private:
   static size_t RegionCount;
   static size_t RegionSizeBytes;
@@ -272,6 +290,8 @@ class ShenandoahHeapRegion {
 
   bool _needs_bitmap_reset;
 
+  volatile uint _batch_evac_state;
+
 public:
   ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed);
 
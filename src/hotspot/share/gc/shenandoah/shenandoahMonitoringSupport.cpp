@@ -25,6 +25,7 @@
 #include "gc/shared/collectorCounters.hpp"
 #include "gc/shared/generationCounters.hpp"
 #include "gc/shared/hSpaceCounters.hpp"
+#include "gc/shenandoah/shenandoahCPUAllocBuffers.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionCounters.hpp"
 #include "gc/shenandoah/shenandoahMonitoringSupport.hpp"
@@ -58,7 +59,10 @@ class ShenandoahGenerationCounters : public GenerationCounters {
 ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
         _partial_counters(nullptr),
         _full_counters(nullptr),
-        _counters_update_task(this)
+        _counters_update_task(this),
+        _cpu_alloc_buffer_allocs(nullptr),
+        _cpu_alloc_buffer_refills(nullptr),
+        _cpu_alloc_buffer_retired(nullptr)
 {
   // Collection counters do not fit Shenandoah very well.
   // We record partial cycles as "young", and full cycles (including full STW GC) as "old".
@@ -72,6 +76,18 @@ ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
 
   _heap_region_counters = new ShenandoahHeapRegionCounters();
 
+  if (UsePerfData && heap->cpu_alloc_buffers() != nullptr) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    const char* ns = PerfDataManager::name_space("shenandoah", "cpuAllocBuffers");
+    _cpu_alloc_buffer_allocs = PerfDataManager::create_long_variable(SUN_GC, PerfDataManager::counter_name(ns, "allocs"),
+                                                                     PerfData::U_Events, CHECK);
+    _cpu_alloc_buffer_refills = PerfDataManager::create_long_variable(SUN_GC, PerfDataManager::counter_name(ns, "refills"),
+                                                                      PerfData::U_Events, CHECK);
+    _cpu_alloc_buffer_retired = PerfDataManager::create_long_variable(SUN_GC, PerfDataManager::counter_name(ns, "retired"),
+                                                                      PerfData::U_Bytes, CHECK);
+  }
+
   _counters_update_task.enroll();
 }
 
@@ -102,6 +118,13 @@ void ShenandoahMonitoringSupport::update_counters() {
     _space_counters->update_all(capacity, used);
     _heap_region_counters->update();
 
+    ShenandoahCPUAllocBuffers* buffers = heap->cpu_alloc_buffers();
+    if (buffers != nullptr) {
+      _cpu_alloc_buffer_allocs->set_value((jlong)buffers->allocs());
+      _cpu_alloc_buffer_refills->set_value((jlong)buffers->refills());
+      _cpu_alloc_buffer_retired->set_value((jlong)(buffers->retired_words() * HeapWordSize));
+    }
+
     MetaspaceCounters::update_performance_counters();
   }
 }
@@ -27,6 +27,7 @@
 
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/task.hpp"
 
 class HSpaceCounters;
@@ -69,6 +70,12 @@ class ShenandoahMonitoringSupport : public CHeapObj<mtGC> {
   ShenandoahHeapRegionCounters* _heap_region_counters;
   ShenandoahPeriodicCountersUpdateTask _counters_update_task;
 
+  // TLABs carved from per-CPU allocation buffers, refills of these buffers
+  // from the free set, and words filled when retiring them.
+  PerfVariable* _cpu_alloc_buffer_allocs;
+  PerfVariable* _cpu_alloc_buffer_refills;
+  PerfVariable* _cpu_alloc_buffer_retired;
+
 public:
   explicit ShenandoahMonitoringSupport(ShenandoahHeap* heap);
   CollectorCounters* stw_collection_counters();
@@ -119,6 +119,7 @@ bool ShenandoahPhaseTimings::is_worker_phase(Phase phase) {
     case conc_thread_roots:
     case conc_weak_roots_work:
     case conc_weak_refs:
+    case conc_weak_refs_old:
     case conc_strong_roots:
     case conc_coalesce_and_fill:
     case promote_in_place:
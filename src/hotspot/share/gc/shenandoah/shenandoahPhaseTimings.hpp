@@ -44,6 +44,7 @@ class outputStream;
   f(CNT_PREFIX ## CodeCacheUnload,          DESC_PREFIX "Unload Code Caches")          \
   f(CNT_PREFIX ## CLDUnlink,                DESC_PREFIX "Unlink CLDs")                 \
   f(CNT_PREFIX ## WeakRefProc,              DESC_PREFIX "Weak References")             \
+  f(CNT_PREFIX ## WeakRefProcNoQueue,       DESC_PREFIX "Weak References No Queue")    \
   f(CNT_PREFIX ## ParallelMark,             DESC_PREFIX "Parallel Mark")               \
   f(CNT_PREFIX ## ScanClusters,             DESC_PREFIX "Scan Clusters")               \
   // end
@@ -91,6 +92,8 @@ class outputStream;
   SHENANDOAH_PAR_PHASE_DO(conc_thread_roots_,       "  CTR: ", f)                      \
   f(conc_weak_refs,                                 "Concurrent Weak References")      \
   SHENANDOAH_PAR_PHASE_DO(conc_weak_refs_,          "  CWRF: ", f)                     \
+  f(conc_weak_refs_old,                             "Concurrent Weak Refs (OLD)")      \
+  SHENANDOAH_PAR_PHASE_DO(conc_weak_refs_old_,      "  CWRFO: ", f)                    \
   f(conc_weak_roots,                                "Concurrent Weak Roots")           \
   f(conc_weak_roots_work,                           "  Roots")                         \
   SHENANDOAH_PAR_PHASE_DO(conc_weak_roots_work_,    "    CWR: ", f)                    \
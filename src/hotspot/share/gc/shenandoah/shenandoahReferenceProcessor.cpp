@@ -24,7 +24,7 @@
  *
  */
 
-#include "classfile/javaClasses.hpp"
+#include "classfile/javaClasses.inline.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "gc/shenandoah/shenandoahClosures.inline.hpp"
 #include "gc/shenandoah/shenandoahGeneration.hpp"
@@ -33,6 +33,7 @@
 #include "gc/shenandoah/shenandoahThreadLocalData.hpp"
 #include "gc/shenandoah/shenandoahUtils.hpp"
 #include "logging/log.hpp"
+#include "memory/universe.hpp"
 #include "runtime/atomicAccess.hpp"
 
 static ReferenceType reference_type(oop reference) {
@@ -181,18 +182,25 @@ static void soft_reference_update_clock() {
 
 ShenandoahRefProcThreadLocal::ShenandoahRefProcThreadLocal() :
   _discovered_list(nullptr),
+  _refs_without_queue(),
   _encountered_count(),
   _discovered_count(),
-  _enqueued_count() {
+  _enqueued_count(),
+  _deferred_count(),
+  _from_old_count() {
 }
 
 void ShenandoahRefProcThreadLocal::reset() {
   _discovered_list = nullptr;
+  // Keep the storage for the next cycle
+  _refs_without_queue.clear();
   _mark_closure = nullptr;
   for (uint i = 0; i < reference_type_count; i++) {
     _encountered_count[i] = 0;
     _discovered_count[i] = 0;
     _enqueued_count[i] = 0;
+    _deferred_count[i] = 0;
+    _from_old_count[i] = 0;
   }
 }
 
@@ -231,11 +239,16 @@ ShenandoahReferenceProcessor::ShenandoahReferenceProcessor(ShenandoahGeneration*
   _iterate_discovered_list_id(0U),
   _generation(generation) {
   for (size_t i = 0; i < max_workers; i++) {
+    ::new (&_ref_proc_thread_locals[i]) ShenandoahRefProcThreadLocal();
     _ref_proc_thread_locals[i].reset();
   }
 }
 
 void ShenandoahReferenceProcessor::reset_thread_locals() {
+  if (ShenandoahRefProcArrays) {
+    initialize_null_queue_handle();
+  }
+
   uint max_workers = ShenandoahHeap::heap()->max_workers();
   for (uint i = 0; i < max_workers; i++) {
     _ref_proc_thread_locals[i].reset();
@@ -248,10 +261,13 @@ void ShenandoahReferenceProcessor::set_mark_closure(uint worker_id, ShenandoahMa
 
 void ShenandoahReferenceProcessor::set_soft_reference_policy(bool clear) {
   static LRUMaxHeapPolicy lru_max_heap_policy;
+  static LRUTargetOccupancyPolicy lru_target_occupancy_policy;
 
   if (clear) {
     log_info(gc, ref)("Clearing All SoftReferences");
     _soft_reference_policy = &_always_clear_policy;
+  } else if (SoftRefTargetOccupancy > 0) {
+    _soft_reference_policy = &lru_target_occupancy_policy;
   } else {
     _soft_reference_policy = &lru_max_heap_policy;
   }
@@ -319,6 +335,18 @@ bool ShenandoahReferenceProcessor::should_discover(oop reference, ReferenceType
   return true;
 }
 
+template <typename T>
+bool ShenandoahReferenceProcessor::is_deferred_to_young(oop reference, ReferenceType type) const {
+  if (!_generation->is_old()) {
+    return false;
+  }
+
+  T* referent_addr = (T*) java_lang_ref_Reference::referent_addr_raw(reference);
+  T heap_oop = RawAccess<>::oop_load(referent_addr);
+  oop referent = CompressedOops::decode(heap_oop);
+  return !is_inactive<T>(reference, referent, type) && ShenandoahHeap::heap()->is_in_young(referent);
+}
+
 template <typename T>
 bool ShenandoahReferenceProcessor::should_drop(oop reference, ReferenceType type) const {
   HeapWord* raw_referent = reference_referent_raw<T>(reference);
@@ -356,10 +384,21 @@ void ShenandoahReferenceProcessor::make_inactive(oop reference, ReferenceType ty
 template <typename T>
 bool ShenandoahReferenceProcessor::discover(oop reference, ReferenceType type, uint worker_id) {
   if (!should_discover<T>(reference, type)) {
+    if (is_deferred_to_young<T>(reference, type)) {
+      // Left to the next young cycle, which finds the reference through the
+      // dirty card of its referent field
+      log_trace(gc, ref)("Reference deferred to young: " PTR_FORMAT " (%s)", p2i(reference), reference_type_name(type));
+      _ref_proc_thread_locals[worker_id].inc_deferred(type);
+    }
     // Not discovered
     return false;
   }
 
+  if (_generation->is_young() && ShenandoahHeap::heap()->is_in_old(reference)) {
+    // Old reference with a young referent, found by the remembered set scan
+    _ref_proc_thread_locals[worker_id].inc_from_old(type);
+  }
+
   if (reference_discovered<T>(reference) != nullptr) {
     // Already discovered. This can happen if the reference is marked finalizable first, and then strong,
     // in which case it will be seen 2x by marking.
@@ -367,6 +406,19 @@ bool ShenandoahReferenceProcessor::discover(oop reference, ReferenceType type, u
     return true;
   }
 
+  if (ShenandoahRefProcArrays && type != REF_FINAL && !has_reference_queue(reference)) {
+    // Soft, Weak or PhantomReference without queue. It will never be enqueued, so record it
+    // for a separate pass that only clears or keeps the referent. A SoftReference has already
+    // been checked against the SoftReference policy in should_discover(). The discovered
+    // field is left alone, so a reference can be recorded twice, if marked finalizable first
+    // and then strong. Processing it twice has the same outcome.
+    ShenandoahRefProcThreadLocal& refproc_data = _ref_proc_thread_locals[worker_id];
+    refproc_data.refs_without_queue()->append(reference);
+    log_trace(gc, ref)("Discovered Reference without queue: " PTR_FORMAT " (%s)", p2i(reference), reference_type_name(type));
+    refproc_data.inc_discovered(type);
+    return true;
+  }
+
   if (type == REF_FINAL) {
     ShenandoahMarkRefsSuperClosure* cl = _ref_proc_thread_locals[worker_id].mark_closure();
     bool weak = cl->is_weak();
@@ -516,17 +568,52 @@ void ShenandoahReferenceProcessor::process_references(ShenandoahRefProcThreadLoc
   }
 }
 
-void ShenandoahReferenceProcessor::work() {
+template <typename T>
+void ShenandoahReferenceProcessor::process_references_without_queue(ShenandoahRefProcThreadLocal& refproc_data) {
+  GrowableArrayCHeap<oop, mtGC>* const refs = refproc_data.refs_without_queue();
+  for (int i = 0; i < refs->length(); i++) {
+    // The reference may have been evacuated since it was discovered
+    const oop reference = lrb(refs->at(i));
+    const ReferenceType type = reference_type(reference);
+
+    if (should_drop<T>(reference, type)) {
+      log_trace(gc, ref)("Dropped Reference without queue: " PTR_FORMAT " (%s)", p2i(reference), reference_type_name(type));
+      // Same as in drop(), the reference was not marked when discovered
+      if (ShenandoahCardBarrier) {
+        card_mark_barrier(cast_from_oop<HeapWord*>(reference), cast_to_oop(reference_referent_raw<T>(reference)));
+      }
+    } else {
+      log_trace(gc, ref)("Cleared Reference without queue: " PTR_FORMAT " (%s)", p2i(reference), reference_type_name(type));
+      reference_clear_referent(reference);
+    }
+  }
+
+  // Keep the storage for the next cycle
+  refs->clear();
+}
+
+void ShenandoahReferenceProcessor::work(ShenandoahPhaseTimings::Phase phase, uint worker_id) {
   // Process discovered references
   uint max_workers = ShenandoahHeap::heap()->max_workers();
-  uint worker_id = AtomicAccess::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
-  while (worker_id < max_workers) {
-    if (UseCompressedOops) {
-      process_references<narrowOop>(_ref_proc_thread_locals[worker_id], worker_id);
-    } else {
-      process_references<oop>(_ref_proc_thread_locals[worker_id], worker_id);
+  uint index = AtomicAccess::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
+  while (index < max_workers) {
+    {
+      ShenandoahWorkerTimingsTracker x(phase, ShenandoahPhaseTimings::WeakRefProc, worker_id, true /* cumulative */);
+      if (UseCompressedOops) {
+        process_references<narrowOop>(_ref_proc_thread_locals[index], index);
+      } else {
+        process_references<oop>(_ref_proc_thread_locals[index], index);
+      }
+    }
+    {
+      ShenandoahWorkerTimingsTracker x(phase, ShenandoahPhaseTimings::WeakRefProcNoQueue, worker_id, true /* cumulative */);
+      if (UseCompressedOops) {
+        process_references_without_queue<narrowOop>(_ref_proc_thread_locals[index]);
+      } else {
+        process_references_without_queue<oop>(_ref_proc_thread_locals[index]);
+      }
     }
-    worker_id = AtomicAccess::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
+    index = AtomicAccess::add(&_iterate_discovered_list_id, 1U, memory_order_relaxed) - 1;
   }
 }
 
@@ -547,12 +634,10 @@ class ShenandoahReferenceProcessorTask : public WorkerTask {
   virtual void work(uint worker_id) {
     if (_concurrent) {
       ShenandoahConcurrentWorkerSession worker_session(worker_id);
-      ShenandoahWorkerTimingsTracker x(_phase, ShenandoahPhaseTimings::WeakRefProc, worker_id);
-      _reference_processor->work();
+      _reference_processor->work(_phase, worker_id);
     } else {
       ShenandoahParallelWorkerSession worker_session(worker_id);
-      ShenandoahWorkerTimingsTracker x(_phase, ShenandoahPhaseTimings::WeakRefProc, worker_id);
-      _reference_processor->work();
+      _reference_processor->work(_phase, worker_id);
     }
   }
 };
@@ -634,6 +719,8 @@ void ShenandoahReferenceProcessor::clean_discovered_list(T* list) {
 void ShenandoahReferenceProcessor::abandon_partial_discovery() {
   uint max_workers = ShenandoahHeap::heap()->max_workers();
   for (uint index = 0; index < max_workers; index++) {
+    // Nothing was written to the references without queue
+    _ref_proc_thread_locals[index].refs_without_queue()->clear();
     if (UseCompressedOops) {
       clean_discovered_list<narrowOop>(_ref_proc_thread_locals[index].discovered_list_addr<narrowOop>());
     } else {
@@ -658,12 +745,16 @@ void ShenandoahReferenceProcessor::collect_statistics() {
   Counters encountered = {};
   Counters discovered = {};
   Counters enqueued = {};
+  Counters deferred = {};
+  Counters from_old = {};
   uint max_workers = ShenandoahHeap::heap()->max_workers();
   for (uint i = 0; i < max_workers; i++) {
     for (size_t type = 0; type < reference_type_count; type++) {
       encountered[type] += _ref_proc_thread_locals[i].encountered((ReferenceType)type);
       discovered[type] += _ref_proc_thread_locals[i].discovered((ReferenceType)type);
       enqueued[type] += _ref_proc_thread_locals[i].enqueued((ReferenceType)type);
+      deferred[type] += _ref_proc_thread_locals[i].deferred((ReferenceType)type);
+      from_old[type] += _ref_proc_thread_locals[i].from_old((ReferenceType)type);
     }
   }
 
@@ -678,4 +769,11 @@ void ShenandoahReferenceProcessor::collect_statistics() {
                    discovered[REF_SOFT], discovered[REF_WEAK], discovered[REF_FINAL], discovered[REF_PHANTOM]);
   log_info(gc,ref)("Enqueued    references: Soft: %zu, Weak: %zu, Final: %zu, Phantom: %zu",
                    enqueued[REF_SOFT], enqueued[REF_WEAK], enqueued[REF_FINAL], enqueued[REF_PHANTOM]);
+  if (_generation->is_old()) {
+    log_info(gc,ref)("Deferred to young references: Soft: %zu, Weak: %zu, Final: %zu, Phantom: %zu",
+                     deferred[REF_SOFT], deferred[REF_WEAK], deferred[REF_FINAL], deferred[REF_PHANTOM]);
+  } else if (_generation->is_young()) {
+    log_info(gc,ref)("Discovered from old references: Soft: %zu, Weak: %zu, Final: %zu, Phantom: %zu",
+                     from_old[REF_SOFT], from_old[REF_WEAK], from_old[REF_FINAL], from_old[REF_PHANTOM]);
+  }
 }
@@ -31,6 +31,8 @@
 #include "gc/shared/referenceProcessorStats.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "memory/allocation.hpp"
+#include "oops/oopHandle.hpp"
+#include "utilities/growableArray.hpp"
 
 class ShenandoahMarkRefsSuperClosure;
 class WorkerThreads;
@@ -73,15 +75,33 @@ typedef size_t Counters[reference_type_count];
  *
  * In order to prevent resurrection by Java threads calling Reference.get() concurrently while we are clearing
  * referents, we employ a special barrier, the native LRB, which returns nullptr when the referent is unreachable.
+ *
+ * References without queue:
+ * A Soft, Weak or PhantomReference whose queue is ReferenceQueue.NULL_QUEUE is never enqueued, so there is
+ * no need to link it into the discovered list or the pending list. Such references are instead recorded in a
+ * per-worker array when discovered, and processing them only clears or keeps the referent. Their discovered
+ * field is never written. A reference that is marked finalizable first and then strong can be recorded twice,
+ * which is harmless since processing it a second time has the same outcome.
+ *
+ * Generational mode:
+ * Each generation has its own processor, and only discovers References whose referent is in that generation.
+ * A Reference found by the old marking whose referent is young is not discovered, and the old marking does not
+ * mark the referent either. Instead its referent field is a young pointer like any other, so the card of that
+ * field is dirty and the remembered set scan of the next young cycle finds the Reference and lets the young
+ * processor discover it. The old processor counts such References as deferred, and the young processor counts
+ * the old References it discovers, so both ends of this hand-off show up in the logs.
  */
 
 class ShenandoahRefProcThreadLocal : public CHeapObj<mtGC> {
 private:
   void* _discovered_list;
+  GrowableArrayCHeap<oop, mtGC> _refs_without_queue;
   ShenandoahMarkRefsSuperClosure* _mark_closure;
   Counters _encountered_count;
   Counters _discovered_count;
   Counters _enqueued_count;
+  Counters _deferred_count;
+  Counters _from_old_count;
   NONCOPYABLE(ShenandoahRefProcThreadLocal);
 
 public:
@@ -104,6 +124,10 @@ class ShenandoahRefProcThreadLocal : public CHeapObj<mtGC> {
   template<typename T>
   void set_discovered_list_head(oop head);
 
+  GrowableArrayCHeap<oop, mtGC>* refs_without_queue() {
+    return &_refs_without_queue;
+  }
+
   size_t encountered(ReferenceType type) const {
     return _encountered_count[type];
   }
@@ -113,6 +137,12 @@ class ShenandoahRefProcThreadLocal : public CHeapObj<mtGC> {
   size_t enqueued(ReferenceType type) const {
     return _enqueued_count[type];
   }
+  size_t deferred(ReferenceType type) const {
+    return _deferred_count[type];
+  }
+  size_t from_old(ReferenceType type) const {
+    return _from_old_count[type];
+  }
 
   void inc_encountered(ReferenceType type) {
     _encountered_count[type]++;
@@ -123,9 +153,15 @@ class ShenandoahRefProcThreadLocal : public CHeapObj<mtGC> {
   void inc_enqueued(ReferenceType type) {
     _enqueued_count[type]++;
   }
+  void inc_deferred(ReferenceType type) {
+    _deferred_count[type]++;
+  }
+  void inc_from_old(ReferenceType type) {
+    _from_old_count[type]++;
+  }
 };
 
-class ShenandoahReferenceProcessor : public ReferenceDiscoverer {
+class ShenandoahReferenceProcessor final : public ReferenceDiscoverer {
 private:
   static AlwaysClearPolicy _always_clear_policy;
 
@@ -150,6 +186,8 @@ class ShenandoahReferenceProcessor : public ReferenceDiscoverer {
   template <typename T>
   bool should_discover(oop reference, ReferenceType type) const;
   template <typename T>
+  bool is_deferred_to_young(oop reference, ReferenceType type) const;
+  template <typename T>
   bool should_drop(oop reference, ReferenceType type) const;
 
   template <typename T>
@@ -165,6 +203,8 @@ class ShenandoahReferenceProcessor : public ReferenceDiscoverer {
 
   template <typename T>
   void process_references(ShenandoahRefProcThreadLocal& refproc_data, uint worker_id);
+  template <typename T>
+  void process_references_without_queue(ShenandoahRefProcThreadLocal& refproc_data);
   void enqueue_references_locked();
   void enqueue_references(bool concurrent);
 
@@ -187,7 +227,7 @@ class ShenandoahReferenceProcessor : public ReferenceDiscoverer {
 
   const ReferenceProcessorStats& reference_process_stats() { return _stats; }
 
-  void work();
+  void work(ShenandoahPhaseTimings::Phase phase, uint worker_id);
 
   void abandon_partial_discovery();
 };
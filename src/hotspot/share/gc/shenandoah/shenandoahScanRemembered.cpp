@@ -233,8 +233,34 @@ size_t ShenandoahCardCluster::get_last_start(size_t card_index) const {
   return _object_starts[card_index].offsets.last;
 }
 
+size_t ShenandoahCardCluster::prev_object_start_card(size_t card_index) const {
+  assert(card_index > 0, "No card below");
+  const size_t entries_per_word = sizeof(uintx) / sizeof(crossing_info);
+  size_t cur_index = card_index - 1;
+
+  // Step over single cards until the entry above cur_index is word aligned
+  while (cur_index > 0 && !is_aligned(&_object_starts[cur_index + 1], sizeof(uintx))) {
+    if (starts_object(cur_index)) {
+      return cur_index;
+    }
+    cur_index--;
+  }
+
+  // Skip words of entries for cards that start no object
+  while (cur_index >= entries_per_word &&
+         (*(const uintx*)&_object_starts[cur_index + 1 - entries_per_word] & StartsObjectWordMask) == 0) {
+    cur_index -= entries_per_word;
+  }
+
+  while (cur_index > 0 && !starts_object(cur_index)) {
+    cur_index--;
+  }
+  return cur_index;
+}
+
 HeapWord* ShenandoahCardCluster::first_object_start(const size_t card_index, const ShenandoahMarkingContext* const ctx,
-                                                    HeapWord* tams, HeapWord* end_range_of_interest) const {
+                                                    HeapWord* tams, HeapWord* end_range_of_interest,
+                                                    ShenandoahObjectStartCache* cache) const {
 
   HeapWord* left = _rs->addr_for_card_index(card_index);
   assert(left < end_range_of_interest, "No meaningful work to do");
@@ -314,13 +340,17 @@ HeapWord* ShenandoahCardCluster::first_object_start(const size_t card_index, con
     return left;
   }
 
-  ssize_t cur_index = (ssize_t)card_index;
-  assert(cur_index >= 0, "Overflow");
-  assert(cur_index > 0, "Should have returned above");
-  // Walk backwards over the cards...
-  while (--cur_index > 0 && !starts_object(cur_index)) {
-   // ... to the one that starts the object
+  assert(card_index > 0, "Should have returned above");
+  // Walk backwards over the cards to the one that starts the object,
+  // unless an earlier walk for a higher card already got there
+  size_t start_card;
+  if (cache == nullptr || !cache->lookup(card_index, &start_card)) {
+    start_card = prev_object_start_card(card_index);
+    if (cache != nullptr) {
+      cache->record(start_card, card_index);
+    }
   }
+  ssize_t cur_index = (ssize_t)start_card;
   // cur_index should start an object: we should not have walked
   // past the left end of the region.
   assert(cur_index >= 0 && (cur_index <= (ssize_t) card_index), "Error");
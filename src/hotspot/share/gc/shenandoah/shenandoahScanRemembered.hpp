@@ -347,6 +347,39 @@ class ShenandoahDirectCardMarkRememberedSet: public CHeapObj<mtGC> {
 // and updates the offset value for each card that the object crosses into.
 // For objects that don't straddle cards, nothing needs to be done.
 //
+// Caches the outcome of the backward crossing map walk that
+// ShenandoahCardCluster::first_object_start() does to find the object
+// spanning into a card. The dirty ranges of a cluster are processed from
+// right to left, and a large object whose head card is clean would otherwise
+// be searched for from scratch for every dirty range it spans. The cache is
+// only valid while the crossing map does not change, i.e. for the duration
+// of a single scan of a range of clusters.
+class ShenandoahObjectStartCache : public StackObj {
+private:
+  size_t _start_card;   // Card holding the start found by the last walk
+  size_t _from_card;    // Card the walk began at, no card in (_start_card, _from_card) starts an object
+  bool   _valid;
+
+public:
+  ShenandoahObjectStartCache() : _start_card(0), _from_card(0), _valid(false) {}
+
+  // Returns true, and the card the walk from card_index would stop at, if known.
+  inline bool lookup(size_t card_index, size_t* start_card) const {
+    if (_valid && _start_card < card_index && card_index <= _from_card) {
+      *start_card = _start_card;
+      return true;
+    }
+    return false;
+  }
+
+  inline void record(size_t start_card, size_t from_card) {
+    assert(start_card < from_card, "Walk goes backwards");
+    _start_card = start_card;
+    _from_card = from_card;
+    _valid = true;
+  }
+};
+
 class ShenandoahCardCluster: public CHeapObj<mtGC> {
 
 private:
@@ -371,8 +404,18 @@ class ShenandoahCardCluster: public CHeapObj<mtGC> {
   static const int MaxCardSize = NOT_LP64(512) LP64_ONLY(1024);
   STATIC_ASSERT((MaxCardSize / HeapWordSize) - 1 <= FirstStartBits);
 
+  // The ObjectStartsInCardRegion bits of all crossing_info entries held in one word, used
+  // to skip over runs of cards that start no object a word at a time.
+  STATIC_ASSERT(sizeof(crossing_info) == sizeof(uint16_t));
+  static const uintx StartsObjectWordMask =
+    ((uintx)-1 / max_jushort) * ((uintx)ObjectStartsInCardRegion << BIG_ENDIAN_ONLY(BitsPerByte) LITTLE_ENDIAN_ONLY(0));
+
   crossing_info* _object_starts;
 
+  // Returns the index of the closest card below card_index that starts an object,
+  // or 0 if there is none.
+  size_t prev_object_start_card(size_t card_index) const;
+
 public:
   // If we're setting first_start, assume the card has an object.
   inline void set_first_start(size_t card_index, uint8_t value) {
@@ -675,8 +718,13 @@ class ShenandoahCardCluster: public CHeapObj<mtGC> {
   // we expect that the marking context isn't available and the crossing maps are valid.
   // Note that crossing maps may be invalid following class unloading and before dead
   // or unloaded objects have been coalesced and filled.  Coalesce and fill updates the crossing maps.
+  //
+  // If not null, cache remembers the result of the crossing map walk for the object
+  // spanning into card_index, for use by a following call on a lower card spanned by
+  // the same object.
   HeapWord* first_object_start(size_t card_index, const ShenandoahMarkingContext* const ctx,
-                               HeapWord* tams, HeapWord* end_range_of_interest) const;
+                               HeapWord* tams, HeapWord* end_range_of_interest,
+                               ShenandoahObjectStartCache* cache = nullptr) const;
 };
 
 // ShenandoahScanRemembered is a concrete class representing the
@@ -713,7 +761,8 @@ class ShenandoahScanRemembered: public CHeapObj<mtGC> {
    "dirty_cards", "clean_cards",
    "max_dirty_run", "max_clean_run",
    "dirty_scan_objs",
-   "alternations"
+   "alternations",
+   "cards_per_ns"
   };
 
   // The statistics are collected and logged separately for
@@ -724,6 +773,12 @@ class ShenandoahScanRemembered: public CHeapObj<mtGC> {
 
   int _card_stats_log_counter[2] = {0, 0};
 
+  // Returns the index of the highest card in [start_index, cur_index] whose value
+  // is not val, or start_index - 1 if there is none. Cards are compared a word at
+  // a time where possible.
+  static inline ssize_t find_prev_card_not(const CardValue* ctbm, ssize_t start_index,
+                                           ssize_t cur_index, CardValue val);
+
 public:
   ShenandoahScanRemembered(ShenandoahDirectCardMarkRememberedSet* rs) {
     _rs = rs;
@@ -40,6 +40,31 @@
 #include "oops/objArrayOop.hpp"
 #include "oops/oop.hpp"
 
+inline ssize_t ShenandoahScanRemembered::find_prev_card_not(const CardValue* const ctbm, const ssize_t start_index,
+                                                            ssize_t cur_index, const CardValue val) {
+  const ssize_t cards_per_word = (ssize_t)sizeof(uintx);
+
+  // Step over single cards until the card above cur_index is word aligned
+  while (cur_index >= start_index && !is_aligned(&ctbm[cur_index + 1], sizeof(uintx))) {
+    if (ctbm[cur_index] != val) {
+      return cur_index;
+    }
+    cur_index--;
+  }
+
+  // Skip words of cards that all hold val
+  const uintx word_val = ((uintx)-1 / max_jubyte) * val;
+  while (cur_index - cards_per_word + 1 >= start_index &&
+         *(const uintx*)&ctbm[cur_index - cards_per_word + 1] == word_val) {
+    cur_index -= cards_per_word;
+  }
+
+  while (cur_index >= start_index && ctbm[cur_index] == val) {
+    cur_index--;
+  }
+  return cur_index;
+}
+
 // Process all objects starting within count clusters beginning with first_cluster and for which the start address is
 // less than end_of_range.  For any non-array object whose header lies on a dirty card, scan the entire object,
 // even if its end reaches beyond end_of_range. Object arrays, on the other hand, are precisely dirtied and
@@ -112,6 +137,9 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
   // scan as we move left over each contiguous range of dirty cards.
   HeapWord* upper_bound = nullptr;
 
+  // Shares the search for an object start between dirty ranges spanned by the same object.
+  ShenandoahObjectStartCache start_cache;
+
   // Starting at the right end of the address range, walk backwards accumulating
   // a maximal dirty range of cards, then process those cards.
   ssize_t cur_index = (ssize_t) end_card_index;
@@ -140,9 +168,8 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
       // ==== BEGIN DIRTY card range processing ====
 
       const size_t dirty_r = cur_index;  // record right end of dirty range (inclusive)
-      while (--cur_index >= (ssize_t)start_card_index && ctbm[cur_index] == CardTable::dirty_card_val()) {
-        // walk back over contiguous dirty cards to find left end of dirty range (inclusive)
-      }
+      // walk back over contiguous dirty cards to find left end of dirty range (inclusive)
+      cur_index = find_prev_card_not(ctbm, (ssize_t)start_card_index, cur_index - 1, CardTable::dirty_card_val());
       // [dirty_l, dirty_r] is a "maximal" closed interval range of dirty card indices:
       // it may not be maximal if we are using the write_table, because of concurrent
       // mutations dirtying the card-table. It may also not be maximal if an upper bound
@@ -178,7 +205,7 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
       // This is always the case for large object arrays, which are typically more
       // common.
       assert(ctx != nullptr || heap->old_generation()->is_parsable(), "Error");
-      HeapWord* p = _scc->first_object_start(dirty_l, ctx, tams, right);
+      HeapWord* p = _scc->first_object_start(dirty_l, ctx, tams, right, &start_cache);
       assert((p == nullptr) || (p < right), "No first object found is denoted by nullptr, p: "
              PTR_FORMAT ", right: " PTR_FORMAT ", end_addr: " PTR_FORMAT ", next card addr: " PTR_FORMAT,
              p2i(p), p2i(right), p2i(end_addr), p2i(_rs->addr_for_card_index(dirty_r + 1)));
@@ -295,12 +322,10 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
       assert(use_write_table || ctbm[cur_index] == CardTable::clean_card_val(), "Error");
 
       // walk back over contiguous clean cards
-      size_t i = 0;
-      while (--cur_index >= (ssize_t)start_card_index && ctbm[cur_index] == CardTable::clean_card_val()) {
-        NOT_PRODUCT(i++);
-      }
+      NOT_PRODUCT(const ssize_t clean_r = cur_index;)
+      cur_index = find_prev_card_not(ctbm, (ssize_t)start_card_index, cur_index - 1, CardTable::clean_card_val());
       // Record alternations, clean run length, and clean card count
-      NOT_PRODUCT(stats.record_clean_run(i);)
+      NOT_PRODUCT(stats.record_clean_run(clean_r - cur_index - 1);)
 
       // ==== END CLEAN card range processing ====
     }
@@ -370,6 +370,18 @@
           "total (young-generation) heap size.")                            \
           range(1,100)                                                      \
                                                                             \
+  product(bool, ShenandoahBatchEvacuation, false, EXPERIMENTAL,             \
+          "Let a single worker claim collection set regions with high "     \
+          "liveness and evacuate them in runs of adjacent live objects. "   \
+          "Objects of a claimed region get their forwarding pointers "      \
+          "without a CAS, other threads wait for the claiming worker. "     \
+          "Only used in non-generational modes.")                           \
+                                                                            \
+  product(uintx, ShenandoahBatchEvacLiveThreshold, 80, EXPERIMENTAL,        \
+          "Minimum live data of a collection set region, in percent of "    \
+          "region size, for it to be batch evacuated.")                     \
+          range(0,100)                                                      \
+                                                                            \
   product(double, ShenandoahEvacWaste, 1.2, EXPERIMENTAL,                   \
           "How much waste evacuations produce within the reserved space. "  \
           "Larger values make evacuations more resilient against "          \
@@ -457,6 +469,20 @@
           "humongous allocations, at the expense of higher GC copying "     \
           "costs. Currently affects stop-the-world (Full) cycle only.")     \
                                                                             \
+  product(bool, ShenandoahPerCPUAllocBuffers, false, EXPERIMENTAL,          \
+          "Carve mutator TLABs from per-CPU allocation buffers, and only "  \
+          "take the heap lock to refill these buffers.")                    \
+                                                                            \
+  product(size_t, ShenandoahPerCPUAllocBufferSize, 0, EXPERIMENTAL,         \
+          "Size in bytes of the batch of memory a per-CPU allocation "      \
+          "buffer is refilled with. 0 uses the max TLAB size.")             \
+                                                                            \
+  product(bool, ShenandoahRefProcArrays, true, DIAGNOSTIC,                  \
+          "Record discovered Soft, Weak and PhantomReferences without "     \
+          "ReferenceQueue in per-worker arrays instead of linking them "    \
+          "through the discovered field. Such references are never "        \
+          "enqueued, so processing them only clears or keeps the referent.")\
+                                                                            \
   product(bool, ShenandoahOOMDuringEvacALot, false, DIAGNOSTIC,             \
           "Testing: simulate OOM during evacuation.")                       \
                                                                             \
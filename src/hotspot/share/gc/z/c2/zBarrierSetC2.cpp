@@ -565,6 +565,22 @@ void ZBarrierSetC2::eliminate_gc_barrier_data(Node* node) const {
   }
 }
 
+bool ZBarrierSetC2::final_graph_reshaping(Compile* compile, Node* n, uint opcode, Unique_Node_List& dead_nodes) const {
+  if (opcode == Op_LoadP && ElideCompareOnlyKeepAlive) {
+    // A referent that is only compared does not need to be marked, it
+    // does not escape to the application. The load barrier still heals
+    // the field, and yields null for a referent that is being cleared.
+    MemNode* const load = n->as_Mem();
+    const uint8_t barrier_data = load->barrier_data();
+    if ((barrier_data & (ZBarrierWeak | ZBarrierPhantom)) != 0 &&
+        (barrier_data & ZBarrierNoKeepalive) == 0 &&
+        is_only_compared(load)) {
+      load->set_barrier_data(barrier_data | ZBarrierNoKeepalive);
+    }
+  }
+  return false;
+}
+
 #ifndef PRODUCT
 void ZBarrierSetC2::dump_barrier_data(const MachNode* mach, outputStream* st) const {
   if ((mach->barrier_data() & ZBarrierStrong) != 0) {
@@ -26,103 +26,172 @@
 
 #include "gc/z/zAddress.hpp"
 #include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/quickSort.hpp"
 #include <string.h>
 
+// One discovered reference. The addresses of the referent and discovered
+// fields are not stored, they are at fixed offsets from the reference.
 struct ZWeakRefData {
-  zpointer* referent_field_addr;
-  zaddress* discovered_field_addr;
+  zaddress reference_addr;
   zaddress referent_addr;
   zpointer referent_field_value;
 };
 
 // High-performance growable array specifically for storing discovered weak references.
-// Uses array-of-structs (AoS) layout for better cache locality when processing sequentially.
-// Each element is a ZWeakRefData struct containing:
-// - referent_field_addr: pointer to zpointer field (the referent field in Reference object)
-// - discovered_field_addr: pointer to zaddress field (the discovered field in Reference object)
+// Uses a structure-of-arrays (SoA) layout, with one dense array for each of:
+// - reference_addr: zaddress of the Reference object
 // - referent_addr: zaddress value of the referent object
+// - referent_field_value: zpointer value of the referent field at discovery
 //
 // Performance optimizations:
 // - Uses memcpy for bulk copying instead of element-by-element loops
 // - Does not zero newly allocated memory (caller responsible for initialization)
 // - Single clear_and_reserve operation to avoid separate clear/reserve calls
-// - Array-of-structs layout improves cache efficiency for sequential processing
+// - The three arrays share one allocation, and the referent field values are
+//   contiguous, so filters on the pointer colors can scan them sequentially
+// - Field addresses are derived from the reference, 24 instead of 32 bytes
+//   are needed per entry
+// - Backing storage is retained across GC cycles and only shrunk after it has
+//   been oversized for several consecutive cycles, so that discovery does not
+//   hit malloc in steady state. The storage is accounted as mtGC in NMT.
 class ZAddressArray : public AnyObj {
 private:
-  ZWeakRefData* _data;
-  size_t           _length;
-  size_t           _capacity;
-
-  void expand_to(size_t new_capacity) {
-    assert(new_capacity > _capacity, "expected growth but %d <= %d", new_capacity, _capacity);
-    
-    ZWeakRefData* new_data = (ZWeakRefData*)AllocateHeap(new_capacity * sizeof(ZWeakRefData), mtGC);
-    
+  static const size_t EntrySize    = sizeof(zaddress) + sizeof(zaddress) + sizeof(zpointer);
+  static const size_t MinCapacity  = 8;
+  static const size_t ShrinkFactor = 4;
+  static const size_t ShrinkDelay  = 4;
+
+  char*     _storage;
+  zaddress* _reference_addrs;
+  zaddress* _referent_addrs;
+  zpointer* _referent_field_values;
+  size_t    _length;
+  size_t    _capacity;
+  size_t    _oversized_cycles;
+
+  static size_t capacity_for(size_t length) {
+    return round_up_power_of_2(MAX2(length, MinCapacity));
+  }
+
+  // Replace the backing storage, keeping the current entries
+  void reallocate(size_t new_capacity) {
+    assert(new_capacity >= _length, "too small: %zu < %zu", new_capacity, _length);
+
+    char* const new_storage = (char*)AllocateHeap(new_capacity * EntrySize, mtGC);
+    zaddress* const new_reference_addrs = (zaddress*)new_storage;
+    zaddress* const new_referent_addrs = new_reference_addrs + new_capacity;
+    zpointer* const new_referent_field_values = (zpointer*)(new_referent_addrs + new_capacity);
+
     if (_length > 0) {
       // Use memcpy for trivially copyable types - much faster than element-by-element copy
-      memcpy(new_data, _data, _length * sizeof(ZWeakRefData));
+      memcpy(new_reference_addrs, _reference_addrs, _length * sizeof(zaddress));
+      memcpy(new_referent_addrs, _referent_addrs, _length * sizeof(zaddress));
+      memcpy(new_referent_field_values, _referent_field_values, _length * sizeof(zpointer));
     }
-    
-    if (_data != nullptr) {
-      FreeHeap(_data);
+
+    if (_storage != nullptr) {
+      FreeHeap(_storage);
     }
-    
-    _data = new_data;
+
+    _storage = new_storage;
+    _reference_addrs = new_reference_addrs;
+    _referent_addrs = new_referent_addrs;
+    _referent_field_values = new_referent_field_values;
     _capacity = new_capacity;
   }
 
   void grow(size_t min_capacity) {
-    size_t new_capacity = MAX2((size_t) 8, next_power_of_2(min_capacity - 1));
-    expand_to(new_capacity);
-  } 
+    assert(min_capacity > _capacity, "expected growth but %zu <= %zu", min_capacity, _capacity);
+    reallocate(capacity_for(min_capacity));
+  }
+
+  void set(size_t index, const ZWeakRefData& data) {
+    _reference_addrs[index] = data.reference_addr;
+    _referent_addrs[index] = data.referent_addr;
+    _referent_field_values[index] = data.referent_field_value;
+  }
 
 public:
-  ZAddressArray() : _data(nullptr), _length(0), _capacity(0) {}
+  ZAddressArray()
+    : _storage(nullptr),
+      _reference_addrs(nullptr),
+      _referent_addrs(nullptr),
+      _referent_field_values(nullptr),
+      _length(0),
+      _capacity(0),
+      _oversized_cycles(0) {}
 
   ~ZAddressArray() {
-    if (_data != nullptr) {
-      FreeHeap(_data);
-      _data = nullptr;
+    if (_storage != nullptr) {
+      FreeHeap(_storage);
+      _storage = nullptr;
     }
   }
 
   // Append a new entry
-  void append(zpointer* referent_field_addr, zaddress* discovered_field_addr, zaddress referent_addr, zpointer referent_field_value) {
+  void append(zaddress reference_addr, zaddress referent_addr, zpointer referent_field_value) {
     if (_length >= _capacity) {
       grow(_length + 1);
     }
-    _data[_length].referent_field_addr = referent_field_addr;
-    _data[_length].discovered_field_addr = discovered_field_addr;
-    _data[_length].referent_addr = referent_addr;
-    _data[_length].referent_field_value = referent_field_value;
+    _reference_addrs[_length] = reference_addr;
+    _referent_addrs[_length] = referent_addr;
+    _referent_field_values[_length] = referent_field_value;
     _length++;
   }
 
   // Get entry at index
-  const ZWeakRefData& at(size_t index) const {
-    assert(index >= 0 && index < _length, "index out of bounds: %d (length: %d)", index, _length);
-    return _data[index];
-  }
-
-  // Get referent field address at index
-  zpointer* referent_field_addr_at(size_t index) const {
-    assert(index >= 0 && index < _length, "index out of bounds: %d (length: %d)", index, _length);
-    return _data[index].referent_field_addr;
+  ZWeakRefData at(size_t index) const {
+    assert(index < _length, "index out of bounds: %zu (length: %zu)", index, _length);
+    return { _reference_addrs[index], _referent_addrs[index], _referent_field_values[index] };
   }
 
-  // Get discovered field address at index
-  zaddress* discovered_field_addr_at(size_t index) const {
-    assert(index >= 0 && index < _length, "index out of bounds: %d (length: %d)", index, _length);
-    return _data[index].discovered_field_addr;
+  // Get reference address at index
+  zaddress reference_addr_at(size_t index) const {
+    assert(index < _length, "index out of bounds: %zu (length: %zu)", index, _length);
+    return _reference_addrs[index];
   }
 
   // Get referent address at index
   zaddress referent_addr_at(size_t index) const {
-    assert(index >= 0 && index < _length, "index out of bounds: %d (length: %d)", index, _length);
-    return _data[index].referent_addr;
+    assert(index < _length, "index out of bounds: %zu (length: %zu)", index, _length);
+    return _referent_addrs[index];
+  }
+
+  // Get referent field value at index
+  zpointer referent_field_value_at(size_t index) const {
+    assert(index < _length, "index out of bounds: %zu (length: %zu)", index, _length);
+    return _referent_field_values[index];
+  }
+
+  // Dense array of all referent field values
+  const zpointer* referent_field_values() const {
+    return _referent_field_values;
+  }
+
+  // Sort the entries in [start, end) by referent address, which groups
+  // entries with referents on the same page
+  void sort_by_referent_addr(size_t start, size_t end) {
+    assert(start <= end && end <= _length, "invalid range: [%zu, %zu) (length: %zu)", start, end, _length);
+
+    ResourceMark rm;
+    const size_t length = end - start;
+    ZWeakRefData* const entries = NEW_RESOURCE_ARRAY(ZWeakRefData, length);
+
+    for (size_t i = 0; i < length; i++) {
+      entries[i] = at(start + i);
+    }
+
+    QuickSort::sort(entries, length, [](const ZWeakRefData& a, const ZWeakRefData& b) {
+      return a.referent_addr < b.referent_addr ? -1 : (a.referent_addr > b.referent_addr ? 1 : 0);
+    });
+
+    for (size_t i = 0; i < length; i++) {
+      set(start + i, entries[i]);
+    }
   }
 
   // Current length
@@ -130,18 +199,43 @@ class ZAddressArray : public AnyObj {
     return _length;
   }
 
+  bool is_empty() const {
+    return _length == 0;
+  }
+
   // Current capacity
   size_t capacity() const {
     return _capacity;
   }
 
+  // Bytes of C-heap currently held by the backing storage
+  size_t size_in_bytes() const {
+    return _capacity * EntrySize;
+  }
+
+  // Clear the array and make sure there is room for at least new_capacity
+  // entries. Existing storage is reused if it is large enough. It is only
+  // released once it has been more than ShrinkFactor times larger than
+  // needed for ShrinkDelay consecutive calls.
   void clear_and_reserve(size_t new_capacity) {
     _length = 0;
-    if (_data != nullptr) {
-      FreeHeap(_data);
+
+    const size_t needed = capacity_for(new_capacity);
+
+    if (needed > _capacity) {
+      // Too small, grow
+      _oversized_cycles = 0;
+      reallocate(needed);
+    } else if (_capacity / ShrinkFactor >= needed) {
+      // Oversized, shrink if it has been oversized for a while
+      if (++_oversized_cycles >= ShrinkDelay) {
+        _oversized_cycles = 0;
+        reallocate(needed);
+      }
+    } else {
+      // Reasonably sized, keep
+      _oversized_cycles = 0;
     }
-    _capacity = MAX2((size_t) 8, next_power_of_2(new_capacity - 1));
-    _data = (ZWeakRefData*)AllocateHeap(_capacity * sizeof(ZWeakRefData), mtGC);
   }
 
   // Clear without deallocating
@@ -45,6 +45,8 @@ class ZBitMap : public CHeapBitMap {
 
   bool par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_live);
 
+  void prefetch(idx_t bit) const;
+
   class ReverseIterator;
 };
 
@@ -27,6 +27,7 @@
 #include "gc/z/zBitMap.hpp"
 
 #include "runtime/atomicAccess.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 
@@ -91,6 +92,10 @@ inline bool ZBitMap::par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_liv
   }
 }
 
+inline void ZBitMap::prefetch(idx_t bit) const {
+  Prefetch::read(word_addr(bit), 0);
+}
+
 inline ZBitMap::ReverseIterator::ReverseIterator(BitMap* bitmap)
   : ZBitMap::ReverseIterator(bitmap, 0, bitmap->size()) {}
 
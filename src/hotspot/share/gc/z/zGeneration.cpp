@@ -502,7 +502,8 @@ ZGenerationYoung::ZGenerationYoung(ZPageTable* page_table,
     _active_type(ZYoungType::none),
     _tenuring_threshold(0),
     _remembered(page_table, old_forwarding_table, page_allocator),
-    _jfr_tracer() {
+    _jfr_tracer(),
+    _reference_processor(&_workers) {
   ZGeneration::_young = this;
 }
 
@@ -878,6 +879,9 @@ void ZGenerationYoung::mark_start() {
   // Flip remembered set bits
   _remembered.flip();
 
+  // Reset reference processing
+  _reference_processor.reset();
+
   // Update statistics
   stat_heap()->at_mark_start(_page_allocator->update_and_stats(this));
 }
@@ -902,6 +906,10 @@ bool ZGenerationYoung::mark_end() {
     return false;
   }
 
+  // Clear young references with dead referents before any mutator
+  // can load them. This must be done before leaving the mark phase.
+  _reference_processor.process_references();
+
   // Enter mark completed phase
   set_phase(Phase::MarkComplete);
 
@@ -980,7 +988,6 @@ ZGenerationTracer* ZGenerationYoung::jfr_tracer() {
 ZGenerationOld::ZGenerationOld(ZPageTable* page_table, ZPageAllocator* page_allocator)
   : ZGeneration(ZGenerationId::old, page_table, page_allocator),
     _reference_processor(&_workers),
-    _weak_roots_processor(&_workers),
     _unload(&_workers),
     _total_collections_at_start(0),
     _young_seqnum_at_reloc_start(0),
@@ -1304,11 +1311,18 @@ bool ZGenerationOld::uses_clear_all_soft_reference_policy() const {
 }
 
 class ZRendezvousGCThreads: public VM_Operation {
+ private:
+  const bool _java_threads;
+
  public:
+  ZRendezvousGCThreads(bool java_threads = false)
+    : _java_threads(java_threads) {}
+
   VMOp_Type type() const { return VMOp_ZRendezvousGCThreads; }
 
   virtual bool evaluate_at_safepoint() const {
-    // We only care about synchronizing the GC threads.
+    // We only care about synchronizing the GC threads,
+    // and the Java threads through a handshake if asked for.
     // Leave the Java threads running.
     return false;
   }
@@ -1322,7 +1336,19 @@ class ZRendezvousGCThreads: public VM_Operation {
     return true;
   }
 
+  virtual bool allow_nested_vm_operations() const {
+    // The handshake of the Java threads is a nested operation
+    return _java_threads;
+  }
+
   void doit() {
+    if (_java_threads) {
+      // Executed right here by the VM thread, instead of
+      // queueing a separate operation for it
+      ZRendezvousHandshakeClosure cl;
+      Handshake::execute(&cl);
+    }
+
     // Light weight "handshake" of the GC threads
     SuspendibleThreadSet::synchronize();
     SuspendibleThreadSet::desynchronize();
@@ -1330,11 +1356,16 @@ class ZRendezvousGCThreads: public VM_Operation {
 };
 
 void ZGenerationOld::process_non_strong_references() {
-  // Process Soft/Weak/Final/PhantomReferences
-  _reference_processor.process_references();
-
-  // Process weak roots
-  _weak_roots_processor.process_weak_roots();
+  {
+    // Process Soft/Weak/Final/PhantomReferences, and weak roots. Reference
+    // processing never marks old objects, it only resurrects young referents
+    // through the young mark, when young marking is running concurrently.
+    // Liveness of the old weak roots is read from the old mark, which is
+    // complete at this point, so the two are independent, and the workers
+    // done with references help with the weak roots.
+    ZProcessWeakRootsTask weak_roots_task;
+    _reference_processor.process_references(&weak_roots_task);
+  }
 
   ClassUnloadingContext ctx(_workers.active_workers(),
                             true /* unregister_nmethods_during_purge */,
@@ -1351,12 +1382,11 @@ void ZGenerationOld::process_non_strong_references() {
   // this point the mutator could see the unblocked state and pass
   // this invalid oop through the normal barrier path, which would
   // incorrectly try to mark the oop.
-  ZRendezvousHandshakeClosure cl;
-  Handshake::execute(&cl);
-
-  // GC threads are not part of the handshake above.
-  // Explicitly "handshake" them.
-  ZRendezvousGCThreads op;
+  //
+  // GC threads are not part of the handshake. Explicitly "handshake"
+  // them in the same VM operation, which saves a round trip to the
+  // VM thread.
+  ZRendezvousGCThreads op(true /* java_threads */);
   VMThread::execute(&op);
 
   // Unblock resurrection of weak/phantom references
@@ -36,6 +36,7 @@
 #include "gc/z/zUnload.hpp"
 #include "gc/z/zWeakRootsProcessor.hpp"
 #include "gc/z/zWorkers.hpp"
+#include "gc/z/zYoungReferenceProcessor.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
 
@@ -200,6 +201,8 @@ class ZGenerationYoung : public ZGeneration {
   ZRemembered  _remembered;
   ZYoungTracer _jfr_tracer;
 
+  ZYoungReferenceProcessor _reference_processor;
+
   void flip_mark_start();
   void flip_relocate_start();
 
@@ -231,6 +234,9 @@ class ZGenerationYoung : public ZGeneration {
 
   void collect(ZYoungType type, ConcurrentGCTimer* timer);
 
+  // Reference processing
+  ReferenceDiscoverer* reference_discoverer();
+
   // Statistics
   bool should_record_stats();
 
@@ -272,7 +278,6 @@ class ZGenerationOld : public ZGeneration {
 
 private:
   ZReferenceProcessor _reference_processor;
-  ZWeakRootsProcessor _weak_roots_processor;
   ZUnload             _unload;
   uint                _total_collections_at_start;
   uint32_t            _young_seqnum_at_reloc_start;
@@ -167,6 +167,10 @@ inline bool ZGenerationYoung::is_remembered(volatile zpointer* p) const {
   return _remembered.is_remembered(p);
 }
 
+inline ReferenceDiscoverer* ZGenerationYoung::reference_discoverer() {
+  return &_reference_processor;
+}
+
 inline ReferenceDiscoverer* ZGenerationOld::reference_discoverer() {
   return &_reference_processor;
 }
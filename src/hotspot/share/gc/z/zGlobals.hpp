@@ -78,6 +78,9 @@ const size_t      ZMarkStripesMax               = 16; // Must be a power of two
 // Mark cache size
 const size_t      ZMarkCacheSize                = 1024; // Must be a power of two
 
+// Max number of mark stack entries held back for prefetching
+const size_t      ZMarkPrefetchRingMax          = 16; // Must be a power of two
+
 // Partial array minimum size
 const size_t      ZMarkPartialArrayMinSizeShift = 12; // 4K
 const size_t      ZMarkPartialArrayMinSize      = (size_t)1 << ZMarkPartialArrayMinSizeShift;
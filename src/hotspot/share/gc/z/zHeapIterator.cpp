@@ -34,24 +34,55 @@
 #include "gc/z/zGranuleMap.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
-#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zNMethod.hpp"
+#include "memory/arena.hpp"
 #include "memory/iterator.inline.hpp"
+#include "runtime/atomicAccess.hpp"
 #include "utilities/bitMap.inline.hpp"
 
-class ZHeapIteratorBitMap : public CHeapObj<mtGC> {
+class ZHeapIteratorBitMap : public ArenaObj {
 private:
-  CHeapBitMap _bitmap;
+  ArenaBitMap _bitmap;
 
 public:
-  ZHeapIteratorBitMap(size_t size_in_bits)
-    : _bitmap(size_in_bits, mtGC) {}
+  ZHeapIteratorBitMap(Arena* arena, size_t size_in_bits)
+    : _bitmap(arena, size_in_bits) {}
 
   bool try_set_bit(size_t index) {
     return _bitmap.par_set_bit(index);
   }
 };
 
+// Per-worker allocator of bitmaps. Bitmaps are allocated from a worker
+// local arena, so installing the bitmap of a granule that has not been
+// visited before neither takes a lock nor calls malloc. A bitmap that
+// lost the race to be installed is kept and used for the next granule.
+class ZHeapIteratorBitMapAllocator {
+private:
+  Arena                _arena;
+  ZHeapIteratorBitMap* _spare;
+
+public:
+  ZHeapIteratorBitMapAllocator()
+    : _arena(mtGC),
+      _spare(nullptr) {}
+
+  ZHeapIteratorBitMap* alloc(size_t size_in_bits) {
+    ZHeapIteratorBitMap* const bitmap = _spare;
+    if (bitmap != nullptr) {
+      _spare = nullptr;
+      return bitmap;
+    }
+
+    return new (&_arena) ZHeapIteratorBitMap(&_arena, size_in_bits);
+  }
+
+  void free(ZHeapIteratorBitMap* bitmap) {
+    assert(_spare == nullptr, "Only one spare bitmap");
+    _spare = bitmap;
+  }
+};
+
 class ZHeapIteratorContext {
 private:
   ObjectClosure* const                _object_cl;
@@ -59,23 +90,30 @@ class ZHeapIteratorContext {
   const uint                          _worker_id;
   ZHeapIteratorQueue* const           _queue;
   ZHeapIteratorArrayChunkQueue* const _array_chunk_queue;
+  ZHeapIteratorBitMapAllocator* const _bitmap_allocator;
 
 public:
   ZHeapIteratorContext(ObjectClosure* object_cl,
                        OopFieldClosure* field_cl,
                        uint worker_id,
                        ZHeapIteratorQueue* queue,
-                       ZHeapIteratorArrayChunkQueue* array_chunk_queue)
+                       ZHeapIteratorArrayChunkQueue* array_chunk_queue,
+                       ZHeapIteratorBitMapAllocator* bitmap_allocator)
     : _object_cl(object_cl),
       _field_cl(field_cl),
       _worker_id(worker_id),
       _queue(queue),
-      _array_chunk_queue(array_chunk_queue) {}
+      _array_chunk_queue(array_chunk_queue),
+      _bitmap_allocator(bitmap_allocator) {}
 
   uint worker_id() const {
     return _worker_id;
   }
 
+  ZHeapIteratorBitMapAllocator* bitmap_allocator() const {
+    return _bitmap_allocator;
+  }
+
   void visit_field(oop base, oop* p) const {
     if (_field_cl != nullptr) {
       _field_cl->do_field(base, p);
@@ -257,7 +295,7 @@ ZHeapIterator::ZHeapIterator(uint nworkers,
   : _visit_weaks(visit_weaks),
     _for_verify(for_verify),
     _bitmaps(ZAddressOffsetMax),
-    _bitmaps_lock(),
+    _bitmap_allocators(NEW_C_HEAP_ARRAY(ZHeapIteratorBitMapAllocator, nworkers, mtGC)),
     _queues(nworkers),
     _array_chunk_queues(nworkers),
     _roots_colored(ZGenerationIdOptional::none),
@@ -265,6 +303,11 @@ ZHeapIterator::ZHeapIterator(uint nworkers,
     _roots_weak_colored(ZGenerationIdOptional::none),
     _terminator(nworkers, &_queues) {
 
+  // Create bitmap allocators
+  for (uint i = 0; i < nworkers; i++) {
+    ::new (_bitmap_allocators + i) ZHeapIteratorBitMapAllocator();
+  }
+
   // Create queues
   for (uint i = 0; i < _queues.size(); i++) {
     ZHeapIteratorQueue* const queue = new ZHeapIteratorQueue();
@@ -279,11 +322,11 @@ ZHeapIterator::ZHeapIterator(uint nworkers,
 }
 
 ZHeapIterator::~ZHeapIterator() {
-  // Destroy bitmaps
-  ZHeapIteratorBitMapsIterator iter(&_bitmaps);
-  for (ZHeapIteratorBitMap* bitmap; iter.next(&bitmap);) {
-    delete bitmap;
+  // Destroy bitmap allocators, which frees all bitmaps
+  for (uint i = 0; i < _queues.size(); i++) {
+    _bitmap_allocators[i].~ZHeapIteratorBitMapAllocator();
   }
+  FREE_C_HEAP_ARRAY(ZHeapIteratorBitMapAllocator, _bitmap_allocators);
 
   // Destroy array chunk queues
   for (uint i = 0; i < _array_chunk_queues.size(); i++) {
@@ -310,20 +353,24 @@ static size_t object_index(oop obj) {
   return (untype(offset) & mask) >> ZObjectAlignmentSmallShift;
 }
 
-ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(oop obj) {
+ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(const ZHeapIteratorContext& context, oop obj) {
   const zoffset offset = ZAddress::offset(to_zaddress(obj));
-  ZHeapIteratorBitMap* bitmap = _bitmaps.get_acquire(offset);
-  if (bitmap == nullptr) {
-    ZLocker<ZLock> locker(&_bitmaps_lock);
-    bitmap = _bitmaps.get(offset);
-    if (bitmap == nullptr) {
-      // Install new bitmap
-      bitmap = new ZHeapIteratorBitMap(object_index_max());
-      _bitmaps.release_put(offset, bitmap);
-    }
+  ZHeapIteratorBitMap* const bitmap = _bitmaps.get_acquire(offset);
+  if (bitmap != nullptr) {
+    return bitmap;
+  }
+
+  // Install new bitmap
+  ZHeapIteratorBitMapAllocator* const allocator = context.bitmap_allocator();
+  ZHeapIteratorBitMap* const new_bitmap = allocator->alloc(object_index_max());
+  ZHeapIteratorBitMap* const prev_bitmap = AtomicAccess::cmpxchg(_bitmaps.addr(offset), (ZHeapIteratorBitMap*)nullptr, new_bitmap, memory_order_release);
+  if (prev_bitmap != nullptr) {
+    // Another worker installed a bitmap first
+    allocator->free(new_bitmap);
+    return prev_bitmap;
   }
 
-  return bitmap;
+  return new_bitmap;
 }
 
 bool ZHeapIterator::should_visit_object_at_mark() const {
@@ -339,12 +386,12 @@ bool ZHeapIterator::should_visit_object_at_follow() const {
   return !_for_verify;
 }
 
-bool ZHeapIterator::mark_object(oop obj) {
+bool ZHeapIterator::mark_object(const ZHeapIteratorContext& context, oop obj) {
   if (obj == nullptr) {
     return false;
   }
 
-  ZHeapIteratorBitMap* const bitmap = object_bitmap(obj);
+  ZHeapIteratorBitMap* const bitmap = object_bitmap(context, obj);
   const size_t index = object_index(obj);
   return bitmap->try_set_bit(index);
 }
@@ -419,7 +466,7 @@ void ZHeapIterator::push_roots(const ZHeapIteratorContext& context) {
 }
 
 void ZHeapIterator::mark_visit_and_push(const ZHeapIteratorContext& context, oop obj) {
-  if (mark_object(obj)) {
+  if (mark_object(context, obj)) {
     if (should_visit_object_at_mark()) {
       context.visit_object(obj);
     }
@@ -537,7 +584,8 @@ void ZHeapIterator::object_and_field_iterate(ObjectClosure* object_cl, OopFieldC
                                      field_cl,
                                      worker_id,
                                      _queues.queue(worker_id),
-                                     _array_chunk_queues.queue(worker_id));
+                                     _array_chunk_queues.queue(worker_id),
+                                     _bitmap_allocators + worker_id);
 
   if (_visit_weaks) {
     object_iterate_inner<true /* VisitWeaks */>(context);
@@ -28,15 +28,14 @@
 #include "gc/shared/taskqueue.hpp"
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/z/zGranuleMap.hpp"
-#include "gc/z/zLock.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zStat.hpp"
 
 class ZHeapIteratorBitMap;
+class ZHeapIteratorBitMapAllocator;
 class ZHeapIteratorContext;
 
 using ZHeapIteratorBitMaps = ZGranuleMap<ZHeapIteratorBitMap*>;
-using ZHeapIteratorBitMapsIterator = ZGranuleMapIterator<ZHeapIteratorBitMap*, false /* Parallel */>;
 using ZHeapIteratorQueue = OverflowTaskQueue<oop, mtGC>;
 using ZHeapIteratorQueues = GenericTaskQueueSet<ZHeapIteratorQueue, mtGC>;
 using ZHeapIteratorArrayChunkQueue = OverflowTaskQueue<ObjArrayTask, mtGC>;
@@ -52,7 +51,7 @@ class ZHeapIterator : public ParallelObjectIteratorImpl {
   const bool                    _visit_weaks;
   const bool                    _for_verify;
   ZHeapIteratorBitMaps          _bitmaps;
-  ZLock                         _bitmaps_lock;
+  ZHeapIteratorBitMapAllocator* _bitmap_allocators;
   ZHeapIteratorQueues           _queues;
   ZHeapIteratorArrayChunkQueues _array_chunk_queues;
   ZRootsIteratorStrongColored   _roots_colored;
@@ -60,12 +59,12 @@ class ZHeapIterator : public ParallelObjectIteratorImpl {
   ZRootsIteratorWeakColored     _roots_weak_colored;
   TaskTerminator                _terminator;
 
-  ZHeapIteratorBitMap* object_bitmap(oop obj);
+  ZHeapIteratorBitMap* object_bitmap(const ZHeapIteratorContext& context, oop obj);
 
   bool should_visit_object_at_mark() const;
   bool should_visit_object_at_follow() const;
 
-  bool mark_object(oop obj);
+  bool mark_object(const ZHeapIteratorContext& context, oop obj);
 
   void push_strong_roots(const ZHeapIteratorContext& context);
   void push_weak_roots(const ZHeapIteratorContext& context);
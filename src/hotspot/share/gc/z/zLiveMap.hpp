@@ -93,6 +93,8 @@ class ZLiveMap {
 
   void inc_live(uint32_t objects, size_t bytes);
 
+  void prefetch(BitMap::idx_t index) const;
+
   template <typename Function>
   void iterate(ZGenerationId id, Function function);
 
@@ -119,6 +119,10 @@ inline void ZLiveMap::inc_live(uint32_t objects, size_t bytes) {
   _live_bytes.add_then_fetch(bytes);
 }
 
+inline void ZLiveMap::prefetch(BitMap::idx_t index) const {
+  _bitmap.prefetch(index);
+}
+
 inline BitMap::idx_t ZLiveMap::segment_start(BitMap::idx_t segment) const {
   return segment * _segment_size;
 }
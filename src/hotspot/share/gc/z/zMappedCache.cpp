@@ -23,9 +23,11 @@
 
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zLargePages.inline.hpp"
 #include "gc/z/zList.inline.hpp"
 #include "gc/z/zMappedCache.hpp"
 #include "gc/z/zVirtualMemory.inline.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -270,6 +272,7 @@ void ZMappedCache::cache_insert(const TreeCursor& cursor, const ZVirtualMemory&
   // Insert in tree
   TreeNode* node = entry->node_addr();
   _tree.insert(node, cursor);
+  _extent_aligned_size += extent_aligned_size(vmem);
 
   // Insert in size-class lists
   const size_t size = vmem.size();
@@ -285,6 +288,7 @@ void ZMappedCache::cache_remove(const TreeCursor& cursor, const ZVirtualMemory&
 
   // Remove from tree
   _tree.remove(node);
+  _extent_aligned_size -= extent_aligned_size(vmem);
 
   // Remove from size-class lists
   const size_t size = vmem.size();
@@ -307,6 +311,8 @@ void ZMappedCache::cache_replace(const TreeCursor& cursor, const ZVirtualMemory&
 
   // Replace in tree
   _tree.replace(old_node, new_node, cursor);
+  _extent_aligned_size -= extent_aligned_size(old_entry->vmem());
+  _extent_aligned_size += extent_aligned_size(vmem);
 
   // Replace in size-class lists
 
@@ -353,9 +359,35 @@ void ZMappedCache::cache_update(ZMappedCacheEntry* entry, const ZVirtualMemory&
   }
 
   // And update entry
+  _extent_aligned_size -= extent_aligned_size(entry->vmem());
+  _extent_aligned_size += extent_aligned_size(vmem);
   entry->update_start(vmem);
 }
 
+size_t ZMappedCache::extent_aligned_size(const ZVirtualMemory& vmem) const {
+  // The number of bytes of vmem that are covered by whole aligned extents
+  const uintptr_t start = align_up(untype(vmem.start()), _extent_size);
+  const uintptr_t end = align_down(untype(vmem.end()), _extent_size);
+
+  return start < end ? end - start : 0;
+}
+
+bool ZMappedCache::should_remove_from_back(const ZVirtualMemory& vmem, size_t to_remove) const {
+  if (_extent_size == ZGranuleSize) {
+    // All entries consist of whole extents
+    return false;
+  }
+
+  // Remove from the back, if it leaves more of the remaining
+  // vmem covered by whole aligned extents than removing from
+  // the front does
+  const size_t unused_size = vmem.size() - to_remove;
+  const ZVirtualMemory unused_when_removed_from_back = vmem.first_part(unused_size);
+  const ZVirtualMemory unused_when_removed_from_front = vmem.last_part(to_remove);
+
+  return extent_aligned_size(unused_when_removed_from_back) > extent_aligned_size(unused_when_removed_from_front);
+}
+
 template <ZMappedCache::RemovalStrategy strategy, typename SelectFunction>
 ZVirtualMemory ZMappedCache::remove_vmem(ZMappedCacheEntry* const entry, size_t min_size, SelectFunction select) {
   ZVirtualMemory vmem = entry->vmem();
@@ -377,13 +409,14 @@ ZVirtualMemory ZMappedCache::remove_vmem(ZMappedCacheEntry* const entry, size_t
 
   if (to_remove != size) {
     // Partial removal
-    if (strategy == RemovalStrategy::LowestAddress) {
+    if (strategy == RemovalStrategy::LowestAddress && !should_remove_from_back(vmem, to_remove)) {
       const size_t unused_size = size - to_remove;
       const ZVirtualMemory unused_vmem = vmem.shrink_from_back(unused_size);
       cache_update(entry, unused_vmem);
 
     } else {
-      assert(strategy == RemovalStrategy::HighestAddress, "must be LowestAddress or HighestAddress");
+      assert(strategy == RemovalStrategy::HighestAddress || strategy == RemovalStrategy::LowestAddress,
+             "must be LowestAddress or HighestAddress");
 
       const size_t unused_size = size - to_remove;
       const ZVirtualMemory unused_vmem = vmem.shrink_from_front(unused_size);
@@ -555,7 +588,11 @@ ZMappedCache::ZMappedCache()
   : _tree(),
     _size_class_lists(),
     _size(0),
-    _min_size_watermark(_size) {}
+    _min_size_watermark(_size),
+    _extent_size(ZLargePages::is_transparent() ? MAX2(os::large_page_size(), ZGranuleSize) : ZGranuleSize),
+    _extent_aligned_size(0) {
+  assert(is_aligned(_extent_size, ZGranuleSize), "Extent size must be granule aligned");
+}
 
 void ZMappedCache::insert(const ZVirtualMemory& vmem) {
   _size += vmem.size();
@@ -618,6 +655,39 @@ void ZMappedCache::insert(const ZVirtualMemory& vmem) {
   cache_insert(current_cursor, vmem);
 }
 
+ZVirtualMemory ZMappedCache::try_remove_extent_aligned(size_t size) {
+  // Scan for the lowest addressed entry that starts at an extent
+  // boundary and is large enough to satisfy the size
+  for (ZMappedCache::TreeNode* node = _tree.left_most(); node != nullptr; node = node->next()) {
+    ZMappedCacheEntry* const entry = ZMappedCacheEntry::cast_to_entry(node);
+
+    if (!is_aligned(untype(entry->start()), _extent_size) || entry->vmem().size() < size) {
+      continue;
+    }
+
+    ZVirtualMemory vmem = entry->vmem();
+    if (vmem.size() == size) {
+      // Whole removal
+      TreeCursor cursor = _tree.cursor(entry->node_addr());
+      assert(cursor.valid(), "must be");
+      cache_remove(cursor, vmem);
+    } else {
+      // Partial removal, keep the end of the entry
+      const ZVirtualMemory unused_vmem = vmem.shrink_from_back(vmem.size() - size);
+      cache_update(entry, unused_vmem);
+    }
+
+    // Update statistics
+    _size -= size;
+    _min_size_watermark = MIN2(_size, _min_size_watermark);
+
+    postcond(vmem.size() == size);
+    return vmem;
+  }
+
+  return ZVirtualMemory();
+}
+
 ZVirtualMemory ZMappedCache::remove_contiguous(size_t size) {
   precond(size > 0);
   precond(is_aligned(size, ZGranuleSize));
@@ -639,6 +709,15 @@ ZVirtualMemory ZMappedCache::remove_contiguous(size_t size) {
     return true;
   };
 
+  if (size >= _extent_size && _extent_size != ZGranuleSize) {
+    // Prefer to reuse whole huge page extents, so that the page does
+    // not have to be collapsed into huge pages again
+    result = try_remove_extent_aligned(size);
+    if (!result.is_null()) {
+      return result;
+    }
+  }
+
   if (size == ZPageSizeSmall) {
     // Small page allocations allocate at the lowest possible address
     scan_remove_vmem<RemovalStrategy::LowestAddress>(size, select_size_fn, consume_vmem_fn);
@@ -712,6 +791,18 @@ void ZMappedCache::print_on(outputStream* st) const {
   st->fill_to(17);
   st->print_cr("%zuM (%zu)", _size / M, entry_count);
 
+  if (ZLargePages::is_transparent()) {
+    // Print how much of the cache is covered by whole huge page extents
+    const size_t size = _size;
+    const size_t aligned_size = MIN2(_extent_aligned_size, size);
+
+    st->print("Cache THP ");
+    st->fill_to(17);
+    st->print_cr("%zuM (%zu%%) in " EXACTFMT " extents",
+                 aligned_size / M, size == 0 ? 100 : aligned_size * 100 / size,
+                 EXACTFMTARGS(_extent_size));
+  }
+
   if (entry_count == 0) {
     // Empty cache, skip printing size classes
     return;
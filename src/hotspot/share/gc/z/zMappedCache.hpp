@@ -94,9 +94,18 @@ class ZMappedCache {
   size_t        _size;
   size_t        _min_size_watermark;
 
+  // When transparent huge pages are used, the extent size is the size of a
+  // huge page, otherwise it is the granule size. The cache tries to keep
+  // extent aligned ranges intact, so that they stay backed by huge pages.
+  const size_t  _extent_size;
+  size_t        _extent_aligned_size;
+
   static int size_class_index(size_t size);
   static int guaranteed_size_class_index(size_t size);
 
+  size_t extent_aligned_size(const ZVirtualMemory& vmem) const;
+  bool should_remove_from_back(const ZVirtualMemory& vmem, size_t to_remove) const;
+
   void cache_insert(const TreeCursor& cursor, const ZVirtualMemory& vmem);
   void cache_remove(const TreeCursor& cursor, const ZVirtualMemory& vmem);
   void cache_replace(const TreeCursor& cursor, const ZVirtualMemory& vmem);
@@ -123,6 +132,8 @@ class ZMappedCache {
   template <RemovalStrategy strategy>
   size_t remove_discontiguous_with_strategy(size_t size, ZArray<ZVirtualMemory>* out);
 
+  ZVirtualMemory try_remove_extent_aligned(size_t size);
+
 public:
   ZMappedCache();
 
@@ -43,7 +43,8 @@
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
 #include "gc/z/zNMethod.hpp"
-#include "gc/z/zPage.hpp"
+#include "gc/z/zNUMA.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zStackWatermark.hpp"
@@ -76,6 +77,10 @@ static const ZStatSubPhase ZSubPhaseConcurrentMarkRootColoredYoung("Concurrent M
 static const ZStatSubPhase ZSubPhaseConcurrentMarkRootUncoloredOld("Concurrent Mark Root Uncolored", ZGenerationId::old);
 static const ZStatSubPhase ZSubPhaseConcurrentMarkRootColoredOld("Concurrent Mark Root Colored", ZGenerationId::old);
 
+static const ZStatCounter ZCounterMarkPrefetch("Mark", "Mark Prefetch", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkPrefetchAlreadyMarked("Mark", "Mark Prefetch Already Marked", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkCrossNodeSteal("Mark", "Mark Cross-Node Steal", ZStatUnitOpsPerSecond);
+
 ZMark::ZMark(ZGeneration* generation, ZPageTable* page_table)
   : _generation(generation),
     _page_table(page_table),
@@ -125,11 +130,14 @@ void ZMark::start() {
   LogTarget(Debug, gc, marking) log;
   if (log.is_enabled()) {
     log.print("Mark Worker/Stripe Distribution");
-    for (uint worker_id = 0; worker_id < _nworkers; worker_id++) {
-      const ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, worker_id);
-      const size_t stripe_id = _stripes.stripe_id(stripe);
-      log.print("  Worker %u(%u) -> Stripe %zu(%zu)",
-                worker_id, _nworkers, stripe_id, nstripes);
+    const uint32_t nnodes = _stripes.is_numa_partitioned() ? ZNUMA::count() : 1;
+    for (uint32_t numa_id = 0; numa_id < nnodes; numa_id++) {
+      for (uint worker_id = 0; worker_id < _nworkers; worker_id++) {
+        const ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, worker_id, numa_id);
+        const size_t stripe_id = _stripes.stripe_id(stripe);
+        log.print("  Worker %u(%u) Node %u -> Stripe %zu(%zu)",
+                  worker_id, _nworkers, numa_id, stripe_id, nstripes);
+      }
     }
   }
 }
@@ -184,7 +192,8 @@ static zpointer* decode_partial_array_offset(uintptr_t offset) {
 void ZMark::push_partial_array(zpointer* addr, size_t length, bool finalizable) {
   assert(is_aligned(addr, ZMarkPartialArrayMinSize), "Address misaligned");
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::mark_stacks(Thread::current(), _generation->id());
-  ZMarkStripe* const stripe = _stripes.stripe_for_addr((uintptr_t)addr);
+  const ZPage* const page = _page_table->get(to_zaddress((uintptr_t)addr));
+  ZMarkStripe* const stripe = _stripes.stripe_for_addr((uintptr_t)addr, numa_id(page));
   const uintptr_t offset = encode_partial_array_offset(addr);
   const ZMarkStackEntry entry(offset, length, finalizable);
 
@@ -277,7 +286,10 @@ class ZMarkBarrierFollowOopClosure : public OopIterateClosure {
   }
 
   static ReferenceDiscoverer* discoverer() {
-    if (!finalizable) {
+    if (generation == ZGenerationIdOptional::young && (ZYoungReferenceProcessing || ZReferencePromotionDelayPercent > 0)) {
+      // Young objects are only followed by the young marking
+      return ZGeneration::young()->reference_discoverer();
+    } else if (!finalizable) {
       return ZGeneration::old()->reference_discoverer();
     } else {
       return nullptr;
@@ -410,6 +422,10 @@ void ZMark::mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry) {
   // Mark
   if (mark && !page->mark_object(addr, finalizable, inc_live)) {
     // Already marked
+    if (ZMarkPrefetchDistance > 0) {
+      // The prefetch of this entry was wasted
+      context->inc_nprefetched_marked();
+    }
     return;
   }
 
@@ -452,7 +468,7 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
     }
   }
 
-  ZMarkStripe* stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id());
+  ZMarkStripe* stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id(), context->numa_id());
   if (context->stripe() != stripe) {
     // Need to switch stripe
     context->set_stripe(stripe);
@@ -467,24 +483,75 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
   return ZAbort::should_abort() || _generation->should_worker_resize();
 }
 
-bool ZMark::drain(ZMarkContext* context) {
+void ZMark::prefetch(ZMarkStackEntry entry) const {
+  if (entry.partial_array()) {
+    // Array elements are loaded in address order
+    return;
+  }
+
+  const zaddress addr = ZOffset::address(to_zoffset(entry.object_address()));
+
+  // Header, for the klass and the object size
+  Prefetch::read((void*)untype(addr), 0);
+
+  if (entry.mark()) {
+    // Mark bits
+    _page_table->get(addr)->prefetch_liveness(addr);
+  }
+}
+
+bool ZMark::pop(ZMarkContext* context, ZMarkStackEntry* entry) {
   ZMarkThreadLocalStacks* const stacks = context->stacks();
+
+  if (ZMarkPrefetchDistance == 0) {
+    // Prefetching disabled
+    return stacks->pop(&_marking_smr, &_stripes, context->stripe(), entry);
+  }
+
+  // Give the prefetches of popped entries the time it takes
+  // to follow ZMarkPrefetchDistance other entries to complete
+  while (stacks->pop(&_marking_smr, &_stripes, context->stripe(), entry)) {
+    prefetch(*entry);
+    if (context->prefetch_push(*entry, entry)) {
+      return true;
+    }
+  }
+
+  // Stacks are empty, follow the entries held back
+  return context->prefetch_pop(entry);
+}
+
+bool ZMark::drain(ZMarkContext* context) {
   ZMarkStackEntry entry;
   size_t processed = 0;
+  bool drained = true;
 
-  context->set_stripe(_stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id()));
+  context->set_stripe(_stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id(), context->numa_id()));
   context->set_nstripes(_stripes.nstripes());
 
   // Drain stripe stacks
-  while (stacks->pop(&_marking_smr, &_stripes, context->stripe(), &entry)) {
+  while (pop(context, &entry)) {
     mark_and_follow(context, entry);
 
     if ((processed++ & 31) == 0 && rebalance_work(context)) {
-      return false;
+      // Follow the entries held back for prefetching, they are
+      // not on any stack where other workers could find them
+      while (context->prefetch_pop(&entry)) {
+        mark_and_follow(context, entry);
+      }
+
+      drained = false;
+      break;
     }
   }
 
-  return true;
+  if (ZMarkPrefetchDistance > 0) {
+    ZStatInc(ZCounterMarkPrefetch, context->nprefetched());
+    ZStatInc(ZCounterMarkPrefetchAlreadyMarked, context->nprefetched_marked());
+    context->reset_prefetch_statistics();
+  }
+
+  return drained;
 }
 
 bool ZMark::try_steal_local(ZMarkContext* context) {
@@ -507,18 +574,27 @@ bool ZMark::try_steal_local(ZMarkContext* context) {
   return false;
 }
 
-bool ZMark::try_steal_global(ZMarkContext* context) {
+bool ZMark::try_steal_global(ZMarkContext* context, bool cross_node) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
+  const bool numa_partitioned = _stripes.is_numa_partitioned();
 
   // Try to steal a stack from another stripe
   for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
        victim_stripe != stripe;
        victim_stripe = _stripes.stripe_next(victim_stripe)) {
+    if (numa_partitioned && (_stripes.stripe_numa_id(victim_stripe) != context->numa_id()) != cross_node) {
+      // Not on the side of the node boundary asked for
+      continue;
+    }
+
     ZMarkStack* const stack = victim_stripe->steal_stack(&_marking_smr);
     if (stack != nullptr) {
       // Success, install the stolen stack
       stacks->install(&_stripes, stripe, stack);
+      if (numa_partitioned && cross_node) {
+        ZStatInc(ZCounterMarkCrossNodeSteal);
+      }
       return true;
     }
   }
@@ -528,7 +604,18 @@ bool ZMark::try_steal_global(ZMarkContext* context) {
 }
 
 bool ZMark::try_steal(ZMarkContext* context) {
-  return try_steal_local(context) || try_steal_global(context);
+  return try_steal_local(context) || try_steal_global(context, false /* cross_node */);
+}
+
+bool ZMark::try_steal_cross_node(ZMarkContext* context) {
+  if (!_stripes.is_numa_partitioned()) {
+    // All stripes were already tried by try_steal()
+    return false;
+  }
+
+  // Only steal the, mostly remote, work of other nodes when the
+  // own node has nothing left, not even after a proactive flush
+  return try_steal_global(context, true /* cross_node */);
 }
 
 class ZMarkFlushStacksHandshakeClosure : public HandshakeClosure {
@@ -632,9 +719,10 @@ void ZMark::leave() {
 // Returning true means marking finished successfully after marking as far as it could.
 // Returning false means that marking finished unsuccessfully due to abort or resizing.
 bool ZMark::follow_work(bool partial) {
-  ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id());
+  const uint32_t numa_id = ZNUMA::id();
+  ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id(), numa_id);
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::mark_stacks(Thread::current(), _generation->id());
-  ZMarkContext context(ZMarkStripesMax, stripe, stacks);
+  ZMarkContext context(ZMarkStripesMax, stripe, stacks, numa_id);
 
   for (;;) {
     if (!drain(&context)) {
@@ -656,6 +744,11 @@ bool ZMark::follow_work(bool partial) {
       continue;
     }
 
+    if (try_steal_cross_node(&context)) {
+      // Stole work from another node
+      continue;
+    }
+
     if (try_terminate(&context)) {
       // Terminate
       return true;
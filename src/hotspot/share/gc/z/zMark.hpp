@@ -36,6 +36,7 @@
 class Thread;
 class ZGeneration;
 class ZMarkContext;
+class ZPage;
 class ZPageTable;
 class ZWorkers;
 
@@ -70,6 +71,7 @@ class ZMark {
   uint               _nworkers;
 
   size_t calculate_nstripes(uint nworkers) const;
+  static uint32_t numa_id(const ZPage* page);
 
   bool is_array(zaddress addr) const;
   void push_partial_array(zpointer* addr, size_t length, bool finalizable);
@@ -81,11 +83,15 @@ class ZMark {
   void follow_object(oop obj, bool finalizable);
   void mark_and_follow(ZMarkContext* context, ZMarkStackEntry entry);
 
+  void prefetch(ZMarkStackEntry entry) const;
+  bool pop(ZMarkContext* context, ZMarkStackEntry* entry);
+
   bool rebalance_work(ZMarkContext* context);
   bool drain(ZMarkContext* context);
   bool try_steal_local(ZMarkContext* context);
-  bool try_steal_global(ZMarkContext* context);
+  bool try_steal_global(ZMarkContext* context, bool cross_node);
   bool try_steal(ZMarkContext* context);
+  bool try_steal_cross_node(ZMarkContext* context);
   bool flush();
   bool try_proactive_flush();
   bool try_terminate(ZMarkContext* context);
@@ -45,6 +45,11 @@
 // root processing has called ClassLoaderDataGraph::clear_claimed_marks(),
 // since it otherwise would interact badly with claiming of CLDs.
 
+inline uint32_t ZMark::numa_id(const ZPage* page) {
+  // A multi-partition page spans nodes, settle for the first
+  return page->is_multi_partition() ? 0 : page->single_partition_id();
+}
+
 template <bool resurrect, bool gc_thread, bool follow, bool finalizable>
 inline void ZMark::mark_object(zaddress addr) {
   assert_is_oop(addr);
@@ -78,7 +83,7 @@ inline void ZMark::mark_object(zaddress addr) {
 
   // Push
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::mark_stacks(Thread::current(), _generation->id());
-  ZMarkStripe* const stripe = _stripes.stripe_for_addr(untype(addr));
+  ZMarkStripe* const stripe = _stripes.stripe_for_addr(untype(addr), numa_id(page));
   ZMarkStackEntry entry(untype(ZAddress::offset(addr)), !mark_before_push, inc_live, follow, finalizable);
 
   assert(ZHeap::heap()->is_young(addr) == _generation->is_young(), "Phase/object mismatch");
@@ -24,7 +24,9 @@
 #ifndef SHARE_GC_Z_ZMARKCONTEXT_HPP
 #define SHARE_GC_Z_ZMARKCONTEXT_HPP
 
+#include "gc/z/zGlobals.hpp"
 #include "gc/z/zMarkCache.hpp"
+#include "gc/z/zMarkStackEntry.hpp"
 #include "memory/allocation.hpp"
 
 class ZMarkStripe;
@@ -36,11 +38,18 @@ class ZMarkContext : public StackObj {
   ZMarkStripe*                  _stripe;
   ZMarkThreadLocalStacks* const _stacks;
   size_t                        _nstripes;
+  const uint32_t                _numa_id;
+  ZMarkStackEntry               _prefetch_ring[ZMarkPrefetchRingMax];
+  size_t                        _prefetch_head;
+  size_t                        _prefetch_length;
+  size_t                        _nprefetched;
+  size_t                        _nprefetched_marked;
 
 public:
   ZMarkContext(size_t nstripes,
                ZMarkStripe* stripe,
-               ZMarkThreadLocalStacks* stacks);
+               ZMarkThreadLocalStacks* stacks,
+               uint32_t numa_id);
 
   ZMarkCache* cache();
   ZMarkStripe* stripe();
@@ -49,6 +58,19 @@ class ZMarkContext : public StackObj {
 
   size_t nstripes();
   void set_nstripes(size_t nstripes);
+
+  uint32_t numa_id() const;
+
+  // FIFO of popped entries that have been prefetched, but not yet
+  // followed. Pushing returns the oldest entry, once ZMarkPrefetchDistance
+  // entries are held back.
+  bool prefetch_push(ZMarkStackEntry entry, ZMarkStackEntry* oldest);
+  bool prefetch_pop(ZMarkStackEntry* entry);
+
+  void inc_nprefetched_marked();
+  size_t nprefetched();
+  size_t nprefetched_marked();
+  void reset_prefetch_statistics();
 };
 
 #endif // SHARE_GC_Z_ZMARKCONTEXT_HPP
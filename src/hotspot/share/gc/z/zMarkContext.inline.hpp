@@ -28,11 +28,18 @@
 
 inline ZMarkContext::ZMarkContext(size_t nstripes,
                                   ZMarkStripe* stripe,
-                                  ZMarkThreadLocalStacks* stacks)
+                                  ZMarkThreadLocalStacks* stacks,
+                                  uint32_t numa_id)
   : _cache(nstripes),
     _stripe(stripe),
     _stacks(stacks),
-    _nstripes(nstripes) {}
+    _nstripes(nstripes),
+    _numa_id(numa_id),
+    _prefetch_ring(),
+    _prefetch_head(0),
+    _prefetch_length(0),
+    _nprefetched(0),
+    _nprefetched_marked(0) {}
 
 inline ZMarkCache* ZMarkContext::cache() {
   return &_cache;
@@ -59,4 +66,56 @@ inline void ZMarkContext::set_nstripes(size_t nstripes) {
   _nstripes = nstripes;
 }
 
-#endif // SHARE_GC_Z_ZMARKCACHE_INLINE_HPP
+inline uint32_t ZMarkContext::numa_id() const {
+  return _numa_id;
+}
+
+inline bool ZMarkContext::prefetch_push(ZMarkStackEntry entry, ZMarkStackEntry* oldest) {
+  const size_t mask = ZMarkPrefetchRingMax - 1;
+  const size_t tail = (_prefetch_head + _prefetch_length) & mask;
+
+  _nprefetched++;
+
+  if (_prefetch_length < ZMarkPrefetchDistance) {
+    // Hold back
+    _prefetch_ring[tail] = entry;
+    _prefetch_length++;
+    return false;
+  }
+
+  // Take the oldest before its slot is reused, when the ring is full
+  *oldest = _prefetch_ring[_prefetch_head];
+  _prefetch_ring[tail] = entry;
+  _prefetch_head = (_prefetch_head + 1) & mask;
+  return true;
+}
+
+inline bool ZMarkContext::prefetch_pop(ZMarkStackEntry* entry) {
+  if (_prefetch_length == 0) {
+    return false;
+  }
+
+  *entry = _prefetch_ring[_prefetch_head];
+  _prefetch_head = (_prefetch_head + 1) & (ZMarkPrefetchRingMax - 1);
+  _prefetch_length--;
+  return true;
+}
+
+inline void ZMarkContext::inc_nprefetched_marked() {
+  _nprefetched_marked++;
+}
+
+inline size_t ZMarkContext::nprefetched() {
+  return _nprefetched;
+}
+
+inline size_t ZMarkContext::nprefetched_marked() {
+  return _nprefetched_marked;
+}
+
+inline void ZMarkContext::reset_prefetch_statistics() {
+  _nprefetched = 0;
+  _nprefetched_marked = 0;
+}
+
+#endif // SHARE_GC_Z_ZMARKCONTEXT_INLINE_HPP
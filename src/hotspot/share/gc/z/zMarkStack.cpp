@@ -24,6 +24,7 @@
 #include "gc/z/zMarkingSMR.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "logging/log.hpp"
 #include "runtime/atomicAccess.hpp"
 #include "runtime/orderAccess.hpp"
@@ -196,6 +197,7 @@ size_t ZMarkStripe::population() const {
 
 ZMarkStripeSet::ZMarkStripeSet()
   : _nstripes_mask(0),
+    _numa_count(ZNUMA::count()),
     _stripes() {}
 
 void ZMarkStripeSet::set_nstripes(size_t nstripes) {
@@ -257,10 +259,19 @@ bool ZMarkStripeSet::is_crowded() const {
   return false;
 }
 
-ZMarkStripe* ZMarkStripeSet::stripe_for_worker(uint nworkers, uint worker_id) {
+ZMarkStripe* ZMarkStripeSet::stripe_for_worker(uint nworkers, uint worker_id, uint32_t numa_id) {
   const size_t mask = AtomicAccess::load(&_nstripes_mask);
   const size_t nstripes = mask + 1;
 
+  if (nnodes(nstripes) > 1) {
+    // Distribute the workers of a node across the stripes of the node
+    assert(numa_id < _numa_count, "Invalid NUMA id");
+    const size_t index = node_stripes_start(numa_id, nstripes) +
+                         worker_id % node_stripes_size(numa_id, nstripes);
+    assert(index < nstripes, "Invalid index");
+    return &_stripes[index];
+  }
+
   const size_t spillover_limit = (nworkers / nstripes) * nstripes;
   size_t index;
 
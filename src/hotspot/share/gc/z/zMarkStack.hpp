@@ -101,10 +101,18 @@ class ZMarkStripe {
   ZMarkStack* steal_stack(ZMarkingSMR* marking_smr);
 };
 
+// With NUMA, the stripes are split into one contiguous group per node.
+// Objects are pushed to a stripe of the node their page was allocated on,
+// and workers are assigned a stripe of the node they run on.
 class ZMarkStripeSet {
 private:
-  size_t      _nstripes_mask;
-  ZMarkStripe _stripes[ZMarkStripesMax];
+  size_t         _nstripes_mask;
+  const uint32_t _numa_count;
+  ZMarkStripe    _stripes[ZMarkStripesMax];
+
+  uint32_t nnodes(size_t nstripes) const;
+  size_t node_stripes_start(uint32_t numa_id, size_t nstripes) const;
+  size_t node_stripes_size(uint32_t numa_id, size_t nstripes) const;
 
 public:
   explicit ZMarkStripeSet();
@@ -119,8 +127,11 @@ class ZMarkStripeSet {
   size_t stripe_id(const ZMarkStripe* stripe) const;
   ZMarkStripe* stripe_at(size_t index);
   ZMarkStripe* stripe_next(ZMarkStripe* stripe);
-  ZMarkStripe* stripe_for_worker(uint nworkers, uint worker_id);
-  ZMarkStripe* stripe_for_addr(uintptr_t addr);
+  ZMarkStripe* stripe_for_worker(uint nworkers, uint worker_id, uint32_t numa_id);
+  ZMarkStripe* stripe_for_addr(uintptr_t addr, uint32_t numa_id);
+
+  bool is_numa_partitioned() const;
+  uint32_t stripe_numa_id(const ZMarkStripe* stripe) const;
 };
 
 class ZMarkThreadLocalStacks {
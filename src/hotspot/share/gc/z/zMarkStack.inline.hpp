@@ -91,8 +91,45 @@ inline ZMarkStripe* ZMarkStripeSet::stripe_next(ZMarkStripe* stripe) {
   return &_stripes[index];
 }
 
-inline ZMarkStripe* ZMarkStripeSet::stripe_for_addr(uintptr_t addr) {
-  const size_t index = (addr >> ZMarkStripeShift) & AtomicAccess::load(&_nstripes_mask);
+inline uint32_t ZMarkStripeSet::nnodes(size_t nstripes) const {
+  // Partition only if every node gets at least one stripe
+  return nstripes >= _numa_count ? _numa_count : 1;
+}
+
+inline size_t ZMarkStripeSet::node_stripes_start(uint32_t numa_id, size_t nstripes) const {
+  return numa_id * nstripes / nnodes(nstripes);
+}
+
+inline size_t ZMarkStripeSet::node_stripes_size(uint32_t numa_id, size_t nstripes) const {
+  return node_stripes_start(numa_id + 1, nstripes) - node_stripes_start(numa_id, nstripes);
+}
+
+inline bool ZMarkStripeSet::is_numa_partitioned() const {
+  return nnodes(nstripes()) > 1;
+}
+
+inline uint32_t ZMarkStripeSet::stripe_numa_id(const ZMarkStripe* stripe) const {
+  const size_t mask = AtomicAccess::load(&_nstripes_mask);
+  const size_t nstripes = mask + 1;
+  const size_t index = stripe_id(stripe) & mask;
+
+  // Inverse of node_stripes_start()
+  return (uint32_t)(((index + 1) * nnodes(nstripes) - 1) / nstripes);
+}
+
+inline ZMarkStripe* ZMarkStripeSet::stripe_for_addr(uintptr_t addr, uint32_t numa_id) {
+  const size_t mask = AtomicAccess::load(&_nstripes_mask);
+  const size_t nstripes = mask + 1;
+  size_t index;
+
+  if (nnodes(nstripes) == 1) {
+    index = (addr >> ZMarkStripeShift) & mask;
+  } else {
+    assert(numa_id < _numa_count, "Invalid NUMA id");
+    index = node_stripes_start(numa_id, nstripes) +
+            (addr >> ZMarkStripeShift) % node_stripes_size(numa_id, nstripes);
+  }
+
   assert(index < ZMarkStripesMax, "Invalid index");
   return &_stripes[index];
 }
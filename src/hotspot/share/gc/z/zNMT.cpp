@@ -27,7 +27,9 @@
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/memTag.hpp"
 #include "nmt/memTracker.hpp"
+#include "nmt/vmatree.hpp"
 #include "utilities/nativeCallStack.hpp"
+#include "utilities/quickSort.hpp"
 
 MemoryFileTracker::MemoryFile* ZNMT::_device = nullptr;
 
@@ -67,6 +69,22 @@ void ZNMT::uncommit(zbacking_offset offset, size_t size) {
   MemTracker::free_memory_in(ZNMT::_device, untype(offset), size);
 }
 
+static void sort_ranges(VMATree::MappingRange* ranges, int count) {
+  QuickSort::sort(ranges, (size_t)count, [](const VMATree::MappingRange& a, const VMATree::MappingRange& b) {
+    return a.from < b.from ? -1 : (a.from > b.from ? 1 : 0);
+  });
+}
+
+void ZNMT::commit(VMATree::MappingRange* ranges, int count) {
+  sort_ranges(ranges, count);
+  MemTracker::allocate_memory_in(ZNMT::_device, ranges, count, CALLER_PC, mtJavaHeap);
+}
+
+void ZNMT::uncommit(VMATree::MappingRange* ranges, int count) {
+  sort_ranges(ranges, count);
+  MemTracker::free_memory_in(ZNMT::_device, ranges, count);
+}
+
 void ZNMT::map(zaddress_unsafe addr, size_t size, zbacking_offset offset) {
   // NMT doesn't track mappings at the moment.
 }
@@ -74,3 +92,49 @@ void ZNMT::map(zaddress_unsafe addr, size_t size, zbacking_offset offset) {
 void ZNMT::unmap(zaddress_unsafe addr, size_t size) {
   // NMT doesn't track mappings at the moment.
 }
+
+ZNMTBatch::ZNMTBatch(bool commit)
+  : _commit(commit),
+    _ranges(),
+    _count(0) {}
+
+ZNMTBatch::~ZNMTBatch() {
+  flush();
+}
+
+void ZNMTBatch::flush() {
+  if (_count == 0) {
+    return;
+  }
+
+  if (_commit) {
+    ZNMT::commit(_ranges, _count);
+  } else {
+    ZNMT::uncommit(_ranges, _count);
+  }
+
+  _count = 0;
+}
+
+void ZNMTBatch::add(zbacking_offset offset, size_t size) {
+  if (!MemTracker::enabled()) {
+    return;
+  }
+
+  const VMATree::position from = untype(offset);
+
+  // Extend the last range if the segments are contiguous in the backing file
+  if (_count > 0) {
+    VMATree::MappingRange& last = _ranges[_count - 1];
+    if (last.to == from) {
+      last.to = from + size;
+      return;
+    }
+  }
+
+  if (_count == MaxRanges) {
+    flush();
+  }
+
+  _ranges[_count++] = {from, from + size};
+}
@@ -29,6 +29,7 @@
 #include "memory/allStatic.hpp"
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/memTracker.hpp"
+#include "nmt/vmatree.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class ZNMT : public AllStatic {
@@ -43,9 +44,31 @@ class ZNMT : public AllStatic {
 
   static void commit(zbacking_offset offset, size_t size);
   static void uncommit(zbacking_offset offset, size_t size);
+  static void commit(VMATree::MappingRange* ranges, int count);
+  static void uncommit(VMATree::MappingRange* ranges, int count);
 
   static void map(zaddress_unsafe addr, size_t size, zbacking_offset offset);
   static void unmap(zaddress_unsafe addr, size_t size);
 };
 
+// Collects the backing segments committed or uncommitted by one operation,
+// to register them with NMT under a single lock and call stack, instead of
+// once per segment.
+class ZNMTBatch : public StackObj {
+private:
+  static const int MaxRanges = 64;
+
+  const bool            _commit;
+  VMATree::MappingRange _ranges[MaxRanges];
+  int                   _count;
+
+  void flush();
+
+public:
+  ZNMTBatch(bool commit);
+  ~ZNMTBatch();
+
+  void add(zbacking_offset offset, size_t size);
+};
+
 #endif // SHARE_GC_Z_ZNMT_HPP
@@ -42,7 +42,8 @@ ZPage::ZPage(ZPageType type, ZPageAge age, const ZVirtualMemory& vmem, ZMultiPar
     _livemap(object_max_count()),
     _remembered_set(),
     _multi_partition_tracker(multi_partition_tracker),
-    _relocate_promoted(false) {
+    _relocate_promoted(false),
+    _young_referents(/* set in reset */) {
   assert(!_virtual.is_null(), "Should not be null");
   assert((_type == ZPageType::small && size() == ZPageSizeSmall) ||
          (_type == ZPageType::medium && ZPageSizeMediumMin <= size() && size() <= ZPageSizeMediumMax) ||
@@ -109,6 +110,8 @@ ZPage* ZPage::reset(ZPageAge age) {
 
   reset_seqnum();
 
+  AtomicAccess::store(&_young_referents, 0u);
+
   return this;
 }
 
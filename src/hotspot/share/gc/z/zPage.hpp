@@ -53,6 +53,7 @@ class ZPage : public CHeapObj<mtGC> {
   ZRememberedSet                _remembered_set;
   ZMultiPartitionTracker* const _multi_partition_tracker;
   volatile bool                 _relocate_promoted;
+  volatile uint32_t             _young_referents;
 
   const char* type_to_string() const;
 
@@ -127,6 +128,7 @@ class ZPage : public CHeapObj<mtGC> {
 
   bool is_object_live(zaddress addr) const;
   bool is_object_strongly_live(zaddress addr) const;
+  void prefetch_liveness(zaddress addr) const;
 
   bool is_marked() const;
   bool is_object_marked_live(zaddress addr) const;
@@ -138,6 +140,9 @@ class ZPage : public CHeapObj<mtGC> {
   uint32_t live_objects() const;
   size_t live_bytes() const;
 
+  void inc_young_referents();
+  uint32_t young_referents() const;
+
   template <typename Function>
   void object_iterate(Function function);
 
@@ -259,6 +259,10 @@ inline bool ZPage::is_object_strongly_live(zaddress addr) const {
   return is_allocating() || is_strong_bit_set(addr);
 }
 
+inline void ZPage::prefetch_liveness(zaddress addr) const {
+  _livemap.prefetch(bit_index(addr));
+}
+
 inline bool ZPage::is_object_marked_live(zaddress addr) const {
   // This function is only used by the marking code and therefore has stronger
   // asserts that are not always valid to ask when checking for liveness.
@@ -310,6 +314,14 @@ inline uint32_t ZPage::live_objects() const {
   return _livemap.live_objects();
 }
 
+inline void ZPage::inc_young_referents() {
+  AtomicAccess::inc(&_young_referents, memory_order_relaxed);
+}
+
+inline uint32_t ZPage::young_referents() const {
+  return AtomicAccess::load(&_young_referents);
+}
+
 inline size_t ZPage::live_bytes() const {
   assert_zpage_mark_state();
 
@@ -231,6 +231,7 @@ size_t ZPhysicalMemoryManager::commit(const ZVirtualMemory& vmem, uint32_t numa_
       : vmem.size();
 
   size_t total_committed = 0;
+  ZNMTBatch nmt_batch(true /* commit */);
 
   // Commit segments
   for_each_segment_apply(pmem, size, [&](zbacking_offset segment_start, size_t segment_size) {
@@ -241,7 +242,7 @@ size_t ZPhysicalMemoryManager::commit(const ZVirtualMemory& vmem, uint32_t numa_
 
     // Register with NMT
     if (committed > 0) {
-      ZNMT::commit(segment_start, committed);
+      nmt_batch.add(segment_start, committed);
     }
 
     return segment_size == committed;
@@ -256,6 +257,7 @@ size_t ZPhysicalMemoryManager::uncommit(const ZVirtualMemory& vmem) {
   const size_t size = vmem.size();
 
   size_t total_uncommitted = 0;
+  ZNMTBatch nmt_batch(false /* commit */);
 
   // Uncommit segments
   for_each_segment_apply(pmem, size, [&](zbacking_offset segment_start, size_t segment_size) {
@@ -266,7 +268,7 @@ size_t ZPhysicalMemoryManager::uncommit(const ZVirtualMemory& vmem) {
 
     // Unregister with NMT
     if (uncommitted > 0) {
-      ZNMT::uncommit(segment_start, uncommitted);
+      nmt_batch.add(segment_start, uncommitted);
     }
 
     return segment_size == uncommitted;
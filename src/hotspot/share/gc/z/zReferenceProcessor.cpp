@@ -25,6 +25,7 @@
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessorStats.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zDriver.hpp"
 #include "gc/z/zHeap.inline.hpp"
@@ -41,15 +42,27 @@
 #include "runtime/atomicAccess.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/prefetch.inline.hpp"
+#include "utilities/count_trailing_zeros.hpp"
+#include "utilities/population_count.hpp"
 #include "utilities/ticks.hpp"
 
-#include "classfile/symbolTable.hpp"
-#include "classfile/systemDictionary.hpp"
-#include "oops/oopHandle.inline.hpp"
-#include "runtime/fieldDescriptor.inline.hpp"
-
 static constexpr bool UseGrowableArrayDiscoveredList = true;
 
+// Number of entries of an array of references without queue that are
+// processed as one unit of work. Splitting the arrays lets all workers
+// share the processing, no matter which worker discovered the references.
+static const size_t ZRefsWithoutQueueChunkSize = 4096;
+
+// Number of entries with a referent that is not mark good to look ahead
+// when prefetching the Reference object and the referent liveness
+// information.
+static const size_t ZRefsWithoutQueuePrefetchDistance = 8;
+
+// Number of entries filtered for mark good referents in one go, one
+// bit for each entry in a word.
+static const size_t ZRefsWithoutQueueBlockSize = BitsPerWord;
+
 static const ZStatSubPhase ZSubPhaseConcurrentReferencesProcess("Concurrent References Process", ZGenerationId::old);
 static const ZStatSubPhase ZSubPhaseConcurrentReferencesEnqueue("Concurrent References Enqueue", ZGenerationId::old);
 
@@ -89,10 +102,6 @@ static zpointer reference_referent(zaddress reference) {
   return ZBarrier::load_atomic(reference_referent_addr(reference));
 }
 
-static zaddress* reference_discovered_addr(zaddress reference) {
-  return (zaddress*)java_lang_ref_Reference::discovered_addr_raw(to_oop(reference));
-}
-
 static zaddress reference_discovered(zaddress reference) {
   return to_zaddress(java_lang_ref_Reference::discovered(to_oop(reference)));
 }
@@ -136,22 +145,25 @@ ZReferenceProcessor::ZReferenceProcessor(ZWorkers* workers)
     _discovered_count(),
     _enqueued_count(),
     _discovered_list(),
-    _pending_list(zaddress::null),
-    _pending_list_tail(zaddress::null),
+    _pending_list(),
+    _pending_list_tail(),
     _discovered_weak_refs_without_queue(),
-    _array_empty(),
-    _null_queue_handle() {
-  _array_empty.set_all(true);
-}
+    _discovered_phantom_refs_without_queue(),
+    _refs_without_queue_chunks(),
+    _worker_stats(),
+    _trace_discovery(false) {}
 
 void ZReferenceProcessor::set_soft_reference_policy(bool clear_all_soft_references) {
   static AlwaysClearPolicy always_clear_policy;
   static LRUMaxHeapPolicy lru_max_heap_policy;
+  static LRUTargetOccupancyPolicy lru_target_occupancy_policy;
 
   _uses_clear_all_soft_reference_policy = clear_all_soft_references;
 
   if (clear_all_soft_references) {
     _soft_reference_policy = &always_clear_policy;
+  } else if (SoftRefTargetOccupancy > 0) {
+    _soft_reference_policy = &lru_target_occupancy_policy;
   } else {
     _soft_reference_policy = &lru_max_heap_policy;
   }
@@ -258,7 +270,9 @@ bool ZReferenceProcessor::try_make_inactive(zaddress reference, ReferenceType ty
 }
 
 void ZReferenceProcessor::discover(zaddress reference, ReferenceType type, zaddress referent) {
-  log_trace(gc, ref)("Discovered Reference: " PTR_FORMAT " (%s)", untype(reference), reference_type_name(type));
+  if (_trace_discovery) {
+    log_trace(gc, ref)("Discovered Reference: " PTR_FORMAT " (%s)", untype(reference), reference_type_name(type));
+  }
 
   // Update statistics
   _discovered_count.get()[type]++;
@@ -266,20 +280,23 @@ void ZReferenceProcessor::discover(zaddress reference, ReferenceType type, zaddr
   assert(ZHeap::heap()->is_old(reference), "Must be old");
   assert(is_null(reference_discovered(reference)), "Already discovered");
 
-  
-  if (UseGrowableArrayDiscoveredList && type == REF_WEAK && !has_reference_queue(reference)) {
-    zpointer* const referent_addr = reference_referent_addr_non_vol(reference);
-    zaddress* const discovered_addr = reference_discovered_addr(reference);
-    const zpointer referent_value = *referent_addr;
-
-    // WeakReference with null ReferenceQueue - remember for special processing
-    ZAddressArray& weak_refs_without_queue = _discovered_weak_refs_without_queue.get();
-    weak_refs_without_queue.append(referent_addr,
-                                   discovered_addr,
-                                   referent,
-                                   referent_value);
-    _array_empty.set(false);
-    reference_set_discovered(reference, reference); // mark as discovered
+  if (UseGrowableArrayDiscoveredList && type != REF_FINAL && !has_reference_queue(to_oop(reference))) {
+    const zpointer referent_value = *reference_referent_addr_non_vol(reference);
+
+    // Soft, Weak or PhantomReference with null ReferenceQueue - remember for
+    // special processing. A SoftReference has already been checked against the
+    // SoftReference policy in should_discover(), so from here on it is treated
+    // just like a WeakReference.
+    ZAddressArray& refs_without_queue = (type == REF_PHANTOM)
+        ? _discovered_phantom_refs_without_queue.get()
+        : _discovered_weak_refs_without_queue.get();
+    //
+    // The discovered field is not used to claim the reference. The strong old
+    // marking follows each object once, so a reference can only be discovered
+    // once per cycle. Leaving the field untouched saves dirtying a word in
+    // every discovered reference, here and again when dropping it.
+    assert(ZHeap::heap()->is_object_strongly_live(reference), "Should be claimed by marking");
+    refs_without_queue.append(reference, referent, referent_value);
   } else {
     if (type == REF_FINAL) {
       // Mark referent (and its reachable subgraph) finalizable. This avoids
@@ -302,7 +319,9 @@ bool ZReferenceProcessor::discover_reference(oop reference_obj, ReferenceType ty
     return false;
   }
 
-  log_trace(gc, ref)("Encountered Reference: " PTR_FORMAT " (%s)", p2i(reference_obj), reference_type_name(type));
+  if (_trace_discovery) {
+    log_trace(gc, ref)("Encountered Reference: " PTR_FORMAT " (%s)", p2i(reference_obj), reference_type_name(type));
+  }
 
   const zaddress reference = to_zaddress(reference_obj);
 
@@ -324,9 +343,13 @@ bool ZReferenceProcessor::discover_reference(oop reference_obj, ReferenceType ty
   return true;
 }
 
-void ZReferenceProcessor::process_worker_discovered_list(zaddress discovered_list) {
+template <bool Trace>
+size_t ZReferenceProcessor::process_worker_discovered_list(zaddress discovered_list) {
+  size_t processed = 0;
   zaddress keep_head = zaddress::null;
   zaddress keep_tail = zaddress::null;
+  zaddress enqueue_head = zaddress::null;
+  zaddress enqueue_tail = zaddress::null;
 
   // Iterate over the discovered list and unlink them as we go, potentially
   // appending them to the keep list
@@ -339,95 +362,288 @@ void ZReferenceProcessor::process_worker_discovered_list(zaddress discovered_lis
 
     if (try_make_inactive(reference, type)) {
       // Keep reference
-      log_trace(gc, ref)("Enqueued Reference: " PTR_FORMAT " (%s)", untype(reference), reference_type_name(type));
+      if (Trace) {
+        log_trace(gc, ref)("Enqueued Reference: " PTR_FORMAT " (%s)", untype(reference), reference_type_name(type));
+      }
 
       // Update statistics
       _enqueued_count.get()[type]++;
 
-      list_append(keep_head, keep_tail, reference);
+      if (ZEnqueueReferencesIncrementally && type != REF_FINAL) {
+        // The referent has been cleared, so the reference can be handed
+        // to the ReferenceHandler thread before resurrection is unblocked.
+        list_append(enqueue_head, enqueue_tail, reference);
+      } else {
+        list_append(keep_head, keep_tail, reference);
+      }
     } else {
       // Drop reference
-      log_trace(gc, ref)("Dropped Reference: " PTR_FORMAT " (%s)", untype(reference), reference_type_name(type));
+      if (Trace) {
+        log_trace(gc, ref)("Dropped Reference: " PTR_FORMAT " (%s)", untype(reference), reference_type_name(type));
+      }
     }
 
     reference = next;
+    processed++;
     SuspendibleThreadSet::yield();
   }
 
-  // Prepend discovered references to internal pending list
-
   // Anything kept on the list?
   if (!is_null(keep_head)) {
-    const zaddress old_pending_list = AtomicAccess::xchg(_pending_list.addr(), keep_head);
+    // Prepend to this worker's internal pending list
+    prepend_pending_list(keep_head, keep_tail);
+  }
+
+  // Anything to enqueue right away?
+  if (!is_null(enqueue_head)) {
+    SuspendibleThreadSetLeaver sts_leaver;
+    enqueue_pending_list(enqueue_head, enqueue_tail);
+  }
+
+  return processed;
+}
+
+void ZReferenceProcessor::prepend_pending_list(zaddress head, zaddress tail) {
+  zaddress* const pending_list = _pending_list.addr();
+
+  if (is_null(*pending_list)) {
+    // First to prepend to this worker's list, record tail
+    _pending_list_tail.set(tail);
+  } else {
+    assert(ZHeap::heap()->is_old(*pending_list), "Must be old");
+  }
+
+  // Concatenate the old list
+  reference_set_discovered(tail, *pending_list);
+  *pending_list = head;
+}
+
+zaddress ZReferenceProcessor::concatenate_pending_lists(zaddress* tail) {
+  zaddress head = zaddress::null;
+  *tail = zaddress::null;
+
+  ZPerWorkerIterator<zaddress> iter_heads(&_pending_list);
+  ZPerWorkerIterator<zaddress> iter_tails(&_pending_list_tail);
 
-    // Concatenate the old list
-    reference_set_discovered(keep_tail, old_pending_list);
+  for (zaddress* worker_head, *worker_tail; iter_heads.next(&worker_head) && iter_tails.next(&worker_tail);) {
+    if (is_null(*worker_head)) {
+      continue;
+    }
 
-    if (is_null(old_pending_list)) {
-      // Old list was empty. First to prepend to list, record tail
-      _pending_list_tail = keep_tail;
+    if (is_null(head)) {
+      head = *worker_head;
     } else {
-      assert(ZHeap::heap()->is_old(old_pending_list), "Must be old");
+      reference_set_discovered(*tail, *worker_head);
     }
+
+    *tail = *worker_tail;
+
+    // Reset this worker's list
+    *worker_head = zaddress::null;
+    *worker_tail = zaddress::null;
   }
+
+  return head;
 }
 
-void ZReferenceProcessor::process_worker_discovered_weak_refs_without_queue(ZAddressArray& weak_refs_without_queue) {
-  size_t dropped = 0;
-  for (size_t i = 0; i < weak_refs_without_queue.length(); i++) {
-    const ZWeakRefData& data = weak_refs_without_queue.at(i);
-    const zaddress referent_addr = data.referent_addr;
-    const zpointer referent_ptr = data.referent_field_value;
+// Returns a bit mask where bit i is set if values[i] is not mark good,
+// i.e. if the liveness of the referent must be checked. The loop is
+// branch free so that the compiler can vectorize it.
+static uintx not_mark_good_bits(const zpointer* values, size_t length) {
+  assert(length <= ZRefsWithoutQueueBlockSize, "Invalid length %zu", length);
+
+  const uintptr_t mark_bad_mask = ZPointerMarkBadMask;
+
+  uintx bits = 0;
+  for (size_t i = 0; i < length; i++) {
+    const uintptr_t value = untype(values[i]);
+    const uintx not_good = ((value & mark_bad_mask) != 0) | (value == 0);
+    bits |= not_good << i;
+  }
+
+  return bits;
+}
+
+// Returns whichever of the cached pages contains addr, or nullptr
+static ZPage* cached_page(zaddress addr, ZPage* page, ZPage* prefetch_page) {
+  if (page != nullptr && page->is_in(addr)) {
+    return page;
+  }
+
+  if (prefetch_page != nullptr && prefetch_page->is_in(addr)) {
+    return prefetch_page;
+  }
+
+  return nullptr;
+}
+
+// Only called for entries with a referent that is not mark good, the
+// referent field is written and the referent liveness is checked.
+static void prefetch_ref_without_queue(const ZWeakRefData& data, ZPage* page, ZPage** prefetch_page) {
+  Prefetch::write(reference_referent_addr_non_vol(data.reference_addr), 0);
+
+  ZPage* referent_page = cached_page(data.referent_addr, page, *prefetch_page);
+  if (referent_page == nullptr) {
+    referent_page = ZHeap::heap()->page(data.referent_addr);
+    *prefetch_page = referent_page;
+  }
+
+  referent_page->prefetch_liveness(data.referent_addr);
+}
 
-    ZPage* const page = ZHeap::heap()->page(referent_addr);
+template <bool Trace>
+size_t ZReferenceProcessor::process_refs_without_queue(ZAddressArray& refs_without_queue, ReferenceType type, size_t start, size_t end) {
+  assert(type == REF_WEAK || type == REF_PHANTOM, "Invalid reference type %d", type);
 
-    if (ZPointer::is_mark_good(referent_ptr)) {
-      log_trace(gc, ref)("Dropped Weak Reference without Queue");
-      dropped++;
-      *data.discovered_field_addr = zaddress::null; // Mark as dropped
+  // A PhantomReference keeps its referent if it is finalizable reachable,
+  // while Soft and WeakReferences only keep strongly reachable referents.
+  const bool is_phantom = type == REF_PHANTOM;
+
+  if (ZSortReferencesWithoutQueue) {
+    // Process entries with referents on the same page together
+    refs_without_queue.sort_by_referent_addr(start, end);
+  }
+
+  // Page of the previous referent, consecutive referents are
+  // often on the same page, in particular when sorted. The page of
+  // the previous look-ahead referent is kept as well, so that the
+  // page of each referent is normally only looked up once.
+  ZPage* page = nullptr;
+  ZPage* prefetch_page = nullptr;
+
+  const zpointer* const referent_field_values = refs_without_queue.referent_field_values();
+
+  size_t dropped = 0;
+  for (size_t block_start = start; block_start < end; block_start += ZRefsWithoutQueueBlockSize) {
+    const size_t block_end = MIN2(block_start + ZRefsWithoutQueueBlockSize, end);
+    const size_t block_length = block_end - block_start;
+    const uintx slow_bits = not_mark_good_bits(referent_field_values + block_start, block_length);
+    const uintx good_bits = ~slow_bits & right_n_bits(block_length);
+
+    // Referents that were already mark good are live, drop the references.
+    // Nothing needs to be written to them.
+    dropped += population_count(good_bits);
+
+    // Prefetch the first entries whose referent liveness is checked
+    uintx prefetch_bits = slow_bits;
+    for (size_t n = 0; n < ZRefsWithoutQueuePrefetchDistance && prefetch_bits != 0; n++) {
+      prefetch_ref_without_queue(refs_without_queue.at(block_start + count_trailing_zeros(prefetch_bits)), page, &prefetch_page);
+      prefetch_bits &= prefetch_bits - 1;
     }
-    else if (!page->is_object_strongly_live(referent_addr) && page->is_old()) {
-      log_trace(gc, ref)("\"Enqueued\" Weak Reference without Queue");
-      *data.referent_field_addr = color_null();
-    } else {
-      log_trace(gc, ref)("Dropped Weak Reference without Queue");
-      dropped++;
-      *data.discovered_field_addr = zaddress::null; // Mark as dropped
-      *data.referent_field_addr = ZAddress::color(referent_addr, ZPointerLoadGoodMask | ZPointerMarkedYoung | ZPointerMarkedOld | ZPointerRememberedMask);
-      if (page->is_young() && ZGeneration::young()->is_phase_mark()) {
-        ZBarrier::mark_young<ZMark::Resurrect, ZMark::AnyThread, ZMark::Follow>(referent_addr);
+
+    // Check liveness of the remaining referents
+    for (uintx bits = slow_bits; bits != 0; bits &= bits - 1) {
+      const size_t i = block_start + count_trailing_zeros(bits);
+
+      if (prefetch_bits != 0) {
+        prefetch_ref_without_queue(refs_without_queue.at(block_start + count_trailing_zeros(prefetch_bits)), page, &prefetch_page);
+        prefetch_bits &= prefetch_bits - 1;
+      }
+
+      const ZWeakRefData data = refs_without_queue.at(i);
+      const zaddress referent_addr = data.referent_addr;
+      zpointer* const referent_field_addr = reference_referent_addr_non_vol(data.reference_addr);
+
+      ZPage* const referent_page = cached_page(referent_addr, page, prefetch_page);
+      page = referent_page != nullptr ? referent_page : ZHeap::heap()->page(referent_addr);
+
+      if (page->is_old() && !(is_phantom ? page->is_object_live(referent_addr)
+                                         : page->is_object_strongly_live(referent_addr))) {
+        if (Trace) {
+          log_trace(gc, ref)("\"Enqueued\" %s Reference without Queue", reference_type_name(type));
+        }
+        *referent_field_addr = color_null();
+      } else {
+        if (Trace) {
+          log_trace(gc, ref)("Dropped %s Reference without Queue", reference_type_name(type));
+        }
+        dropped++;
+        *referent_field_addr = ZAddress::color(referent_addr, ZPointerLoadGoodMask | ZPointerMarkedYoung | ZPointerMarkedOld | ZPointerRememberedMask);
+        if (page->is_young() && ZGeneration::young()->is_phase_mark()) {
+          ZBarrier::mark_young<ZMark::Resurrect, ZMark::AnyThread, ZMark::Follow>(referent_addr);
+        }
       }
     }
 
-    SuspendibleThreadSet::yield();
+    if (SuspendibleThreadSet::should_yield()) {
+      SuspendibleThreadSet::yield();
+
+      // Pages might have changed while yielding
+      page = nullptr;
+      prefetch_page = nullptr;
+    }
+  }
+
+  return dropped;
+}
+
+void ZReferenceProcessor::split_refs_without_queue(ZAddressArray* refs_without_queue, ReferenceType type) {
+  const size_t length = refs_without_queue->length();
+
+  for (size_t start = 0; start < length; start += ZRefsWithoutQueueChunkSize) {
+    const size_t end = MIN2(start + ZRefsWithoutQueueChunkSize, length);
+    _refs_without_queue_chunks.append({refs_without_queue, type, start, end, 0 /* dropped */});
   }
-  weak_refs_without_queue.clear_and_reserve(dropped);
 }
 
-void ZReferenceProcessor::work() {
-  SuspendibleThreadSetJoiner sts_joiner;
+void ZReferenceProcessor::split_refs_without_queue() {
+  assert(_refs_without_queue_chunks.is_empty(), "Chunks not released");
 
-  ZPerWorkerIterator<zaddress> iter(&_discovered_list);
   ZPerWorkerIterator<ZAddressArray> iter_weak_refs(&_discovered_weak_refs_without_queue);
-  ZPerWorkerIterator<bool> iter_array_empty(&_array_empty);
+  for (ZAddressArray* array; iter_weak_refs.next(&array);) {
+    split_refs_without_queue(array, REF_WEAK);
+  }
 
-  zaddress* list_addr = nullptr;
-  ZAddressArray* array_addr = nullptr;
-  bool* array_empty = nullptr;
+  ZPerWorkerIterator<ZAddressArray> iter_phantom_refs(&_discovered_phantom_refs_without_queue);
+  for (ZAddressArray* array; iter_phantom_refs.next(&array);) {
+    split_refs_without_queue(array, REF_PHANTOM);
+  }
+}
 
-  for (; iter.next(&list_addr) && iter_weak_refs.next(&array_addr) && iter_array_empty.next(&array_empty);) {
+void ZReferenceProcessor::release_refs_without_queue() {
+  // Size the arrays for the next cycle by the number of discovered
+  // references. Arrays are only shrunk after being oversized for a
+  // number of cycles, which keeps them at the recent high-water mark.
+  ZPerWorkerIterator<ZAddressArray> iter_weak_refs(&_discovered_weak_refs_without_queue);
+  for (ZAddressArray* array; iter_weak_refs.next(&array);) {
+    array->clear_and_reserve(array->length());
+  }
 
-    const zaddress discovered_list = AtomicAccess::xchg(list_addr, zaddress::null);
-    const bool has_array = !AtomicAccess::xchg(array_empty, true);
-    const bool has_discovered = discovered_list != zaddress::null;
+  ZPerWorkerIterator<ZAddressArray> iter_phantom_refs(&_discovered_phantom_refs_without_queue);
+  for (ZAddressArray* array; iter_phantom_refs.next(&array);) {
+    array->clear_and_reserve(array->length());
+  }
 
-    if (has_discovered) {
-      process_worker_discovered_list(discovered_list);
-    }
-    if (has_array) {
-      process_worker_discovered_weak_refs_without_queue(*array_addr);
+  _refs_without_queue_chunks.clear();
+}
+
+void ZReferenceProcessor::work(ZArrayParallelIterator<ZRefsWithoutQueueChunk>* chunks_iter) {
+  SuspendibleThreadSetJoiner sts_joiner;
+
+  const Ticks start = Ticks::now();
+  const bool trace = log_is_enabled(Trace, gc, ref);
+  size_t processed = 0;
+
+  ZPerWorkerIterator<zaddress> iter(&_discovered_list);
+  for (zaddress* list_addr; iter.next(&list_addr);) {
+    const zaddress discovered_list = AtomicAccess::xchg(list_addr, zaddress::null);
+    if (!is_null(discovered_list)) {
+      processed += trace ? process_worker_discovered_list<true>(discovered_list)
+                         : process_worker_discovered_list<false>(discovered_list);
     }
   }
+
+  for (size_t index; chunks_iter->next_index(&index);) {
+    ZRefsWithoutQueueChunk* const chunk = _refs_without_queue_chunks.adr_at((int)index);
+    chunk->_dropped = trace ? process_refs_without_queue<true>(*chunk->_array, chunk->_type, chunk->_start, chunk->_end)
+                            : process_refs_without_queue<false>(*chunk->_array, chunk->_type, chunk->_start, chunk->_end);
+    processed += chunk->_end - chunk->_start;
+  }
+
+  // Update statistics
+  ZReferenceWorkerStats& stats = _worker_stats.get();
+  stats._processed += processed;
+  stats._time += Ticks::now() - start;
 }
 
 void ZReferenceProcessor::verify_empty() const {
@@ -437,18 +653,28 @@ void ZReferenceProcessor::verify_empty() const {
     assert(is_null(*head), "Discovered list not empty");
   }
 
+  ZPerWorkerConstIterator<zaddress> iter_pending(&_pending_list);
+  for (const zaddress* head; iter_pending.next(&head);) {
+    assert(is_null(*head), "Pending list not empty");
+  }
+
   ZPerWorkerConstIterator<ZAddressArray> iter_weak_refs(&_discovered_weak_refs_without_queue);
   for (const ZAddressArray* array; iter_weak_refs.next(&array);) {
     assert(array->is_empty(), "Discovered weak refs without queue not empty");
   }
 
-  assert(is_null(_pending_list.get()), "Pending list not empty");
+  ZPerWorkerConstIterator<ZAddressArray> iter_phantom_refs(&_discovered_phantom_refs_without_queue);
+  for (const ZAddressArray* array; iter_phantom_refs.next(&array);) {
+    assert(array->is_empty(), "Discovered phantom refs without queue not empty");
+  }
 #endif
 }
 
 void ZReferenceProcessor::reset_statistics() {
   verify_empty();
 
+  _trace_discovery = log_is_enabled(Trace, gc, ref);
+
   // Reset encountered
   ZPerWorkerIterator<Counters> iter_encountered(&_encountered_count);
   for (Counters* counters; iter_encountered.next(&counters);) {
@@ -472,6 +698,9 @@ void ZReferenceProcessor::reset_statistics() {
       (*counters)[i] = 0;
     }
   }
+
+  // Reset worker statistics
+  _worker_stats.set_all({0 /* processed */, Tickspan()});
 }
 
 void ZReferenceProcessor::collect_statistics() {
@@ -517,30 +746,104 @@ void ZReferenceProcessor::collect_statistics() {
   ZDriver::major()->jfr_tracer()->report_gc_reference_stats(stats);
 }
 
+void ZReferenceProcessor::trace_statistics() const {
+  // Split of the references without queue
+  size_t without_queue = 0;
+  size_t dropped = 0;
+  for (int i = 0; i < _refs_without_queue_chunks.length(); i++) {
+    const ZRefsWithoutQueueChunk& chunk = _refs_without_queue_chunks.at(i);
+    without_queue += chunk._end - chunk._start;
+    dropped += chunk._dropped;
+  }
+
+  size_t discovered = 0;
+  for (uint32_t worker_id = 0; worker_id < _discovered_count.count(); worker_id++) {
+    const Counters& counters = _discovered_count.get(worker_id);
+    size_t worker_discovered = 0;
+    for (int i = REF_SOFT; i <= REF_PHANTOM; i++) {
+      worker_discovered += counters[i];
+    }
+
+    const size_t worker_without_queue = _discovered_weak_refs_without_queue.get(worker_id).length() +
+                                        _discovered_phantom_refs_without_queue.get(worker_id).length();
+    const ZReferenceWorkerStats& stats = _worker_stats.get(worker_id);
+
+    log_trace(gc, ref)("Worker %u References: %zu discovered (%zu without queue), %zu processed, %.3fms",
+                       worker_id, worker_discovered, worker_without_queue, stats._processed, stats._time.seconds() * MILLIUNITS);
+    ZTracer::report_reference_processing_worker(worker_id, worker_discovered, worker_without_queue, stats._processed, stats._time);
+
+    discovered += worker_discovered;
+  }
+
+  const size_t with_queue = discovered - without_queue;
+  const size_t cleared = without_queue - dropped;
+  const size_t storage = refs_without_queue_size_in_bytes();
+
+  log_debug(gc, ref)("References: %zu with queue, %zu without queue (%zu dropped, %zu cleared), %zuK storage",
+                     with_queue, without_queue, dropped, cleared, storage / K);
+  ZTracer::report_reference_processing(with_queue, without_queue, dropped, cleared, storage);
+}
+
+size_t ZReferenceProcessor::refs_without_queue_size_in_bytes() const {
+  size_t size = 0;
+
+  ZPerWorkerConstIterator<ZAddressArray> iter_weak_refs(&_discovered_weak_refs_without_queue);
+  for (const ZAddressArray* array; iter_weak_refs.next(&array);) {
+    size += array->size_in_bytes();
+  }
+
+  ZPerWorkerConstIterator<ZAddressArray> iter_phantom_refs(&_discovered_phantom_refs_without_queue);
+  for (const ZAddressArray* array; iter_phantom_refs.next(&array);) {
+    size += array->size_in_bytes();
+  }
+
+  return size;
+}
+
 class ZReferenceProcessorTask : public ZTask {
 private:
-  ZReferenceProcessor* const _reference_processor;
+  ZReferenceProcessor* const                      _reference_processor;
+  ZArrayParallelIterator<ZRefsWithoutQueueChunk> _chunks_iter;
+  ZTask* const                                    _overlapped_task;
 
 public:
-  ZReferenceProcessorTask(ZReferenceProcessor* reference_processor)
+  ZReferenceProcessorTask(ZReferenceProcessor* reference_processor, ZTask* overlapped_task)
     : ZTask("ZReferenceProcessorTask"),
-      _reference_processor(reference_processor) {}
+      _reference_processor(reference_processor),
+      _chunks_iter(&reference_processor->_refs_without_queue_chunks),
+      _overlapped_task(overlapped_task) {}
 
   virtual void work() {
-    _reference_processor->work();
+    _reference_processor->work(&_chunks_iter);
+
+    if (_overlapped_task != nullptr) {
+      _overlapped_task->work();
+    }
   }
 };
 
-void ZReferenceProcessor::process_references() {
+void ZReferenceProcessor::process_references(ZTask* overlapped_task) {
   ZStatTimerOld timer(ZSubPhaseConcurrentReferencesProcess);
 
   if (_uses_clear_all_soft_reference_policy) {
     log_info(gc, ref)("Clearing All SoftReferences");
   }
   
-  // Process discovered lists
-  ZReferenceProcessorTask task(this);
-  _workers->run(&task);
+  // Split references without queue into chunks of work
+  split_refs_without_queue();
+
+  // Process discovered lists and references without queue
+  {
+    ZReferenceProcessorTask task(this, overlapped_task);
+    _workers->run(&task);
+  }
+
+  // Log and trace the fast path and per-worker statistics,
+  // while the references without queue are still around
+  trace_statistics();
+
+  // Reset references without queue for the next cycle
+  release_refs_without_queue();
 
   // Update SoftReference clock
   soft_reference_update_clock();
@@ -549,13 +852,13 @@ void ZReferenceProcessor::process_references() {
   collect_statistics();
 }
 
-void ZReferenceProcessor::verify_pending_references() {
+void ZReferenceProcessor::verify_pending_references(zaddress pending_list) {
 #ifdef ASSERT
   SuspendibleThreadSetJoiner sts_joiner;
 
-  assert(!is_null(_pending_list.get()), "Should not contain colored null");
+  assert(!is_null(pending_list), "Should not contain colored null");
 
-  for (zaddress current = _pending_list.get();
+  for (zaddress current = pending_list;
        !is_null(current);
        current = reference_discovered(current))
   {
@@ -578,54 +881,40 @@ zaddress ZReferenceProcessor::swap_pending_list(zaddress pending_list) {
   return to_zaddress(prev);
 }
 
-void ZReferenceProcessor::enqueue_references() {
-  ZStatTimerOld timer(ZSubPhaseConcurrentReferencesEnqueue);
-
-  if (is_null(_pending_list.get())) {
-    // Nothing to enqueue
-    return;
-  }
+void ZReferenceProcessor::enqueue_pending_list(zaddress head, zaddress tail) {
+  // Heap_lock protects external pending list
+  MonitorLocker ml(Heap_lock);
+  SuspendibleThreadSetJoiner sts_joiner;
 
-  // Verify references on internal pending list
-  verify_pending_references();
+  const zaddress prev_list = swap_pending_list(head);
 
-  {
-    // Heap_lock protects external pending list
-    MonitorLocker ml(Heap_lock);
-    SuspendibleThreadSetJoiner sts_joiner;
+  // Link together new and old list
+  reference_set_discovered(tail, prev_list);
 
-    const zaddress prev_list = swap_pending_list(_pending_list.get());
+  // Notify ReferenceHandler thread
+  ml.notify_all();
+}
 
-    // Link together new and old list
-    reference_set_discovered(_pending_list_tail, prev_list);
+void ZReferenceProcessor::enqueue_references() {
+  ZStatTimerOld timer(ZSubPhaseConcurrentReferencesEnqueue);
 
-    // Notify ReferenceHandler thread
-    ml.notify_all();
+  // Concatenate the per-worker internal pending lists
+  zaddress pending_list;
+  zaddress pending_list_tail;
+  {
+    SuspendibleThreadSetJoiner sts_joiner;
+    pending_list = concatenate_pending_lists(&pending_list_tail);
   }
 
-  // Reset internal pending list
-  _pending_list.set(zaddress::null);
-  _pending_list_tail = zaddress::null;
-}
+  if (is_null(pending_list)) {
+    // Nothing to enqueue
+    return;
+  }
 
-inline bool ZReferenceProcessor::has_reference_queue(zaddress reference) {
-  oop ref_queue = to_oop(reference)->obj_field_access<AS_NO_KEEPALIVE>(java_lang_ref_Reference::queue_offset());
-  bool result = ref_queue != _null_queue_handle.resolve();
-  return result;
-}
+  // Verify references on internal pending list
+  verify_pending_references(pending_list);
 
-void ZReferenceProcessor::initialize_null_queue_handle() {
-  EXCEPTION_MARK;
-  TempNewSymbol class_name = SymbolTable::new_symbol("java/lang/ref/ReferenceQueue");
-  Klass* k = SystemDictionary::resolve_or_fail(class_name, true, CHECK);
-  InstanceKlass* ik = InstanceKlass::cast(k);
-  ik->initialize(CHECK);
-  fieldDescriptor fd;
-  bool found = ik->find_local_field(SymbolTable::new_symbol("NULL_QUEUE"),
-                                    vmSymbols::referencequeue_signature(), &fd);
-  assert(found && fd.is_static(), "ReferenceQueue.NULL_QUEUE missing");
-  oop null_q = ik->java_mirror()->obj_field(fd.offset());
-  _null_queue_handle = OopHandle(Universe::vm_global(), null_q);
+  enqueue_pending_list(pending_list, pending_list_tail);
 }
 
 void ZReferenceProcessor::prepare() {
@@ -27,13 +27,31 @@
 #include "gc/shared/referenceDiscoverer.hpp"
 #include "gc/z/zAddress.hpp"
 #include "gc/z/zAddressArray.hpp"
+#include "gc/z/zArray.hpp"
 #include "gc/z/zValue.hpp"
+#include "oops/oopHandle.hpp"
+#include "utilities/ticks.hpp"
 
 class ConcurrentGCTimer;
 class ReferencePolicy;
+class ZTask;
 class ZWorkers;
 
+// A range of entries in one of the per-worker arrays of references without
+// queue, processed as one unit of work by any of the GC workers.
+struct ZRefsWithoutQueueChunk {
+  ZAddressArray* _array;
+  ReferenceType  _type;
+  size_t         _start;
+  size_t         _end;
+  size_t         _dropped;
+};
 
+// Per-worker reference processing statistics
+struct ZReferenceWorkerStats {
+  size_t   _processed;
+  Tickspan _time;
+};
 
 class ZReferenceProcessor : public ReferenceDiscoverer {
   friend class ZReferenceProcessorTask;
@@ -49,11 +67,15 @@ class ZReferenceProcessor : public ReferenceDiscoverer {
   ZPerWorker<Counters> _discovered_count;
   ZPerWorker<Counters> _enqueued_count;
   ZPerWorker<zaddress> _discovered_list;
-  ZContended<zaddress> _pending_list;
-  zaddress             _pending_list_tail;
+  ZPerWorker<zaddress> _pending_list;
+  ZPerWorker<zaddress> _pending_list_tail;
   ZPerWorker<ZAddressArray> _discovered_weak_refs_without_queue;
-  ZPerWorker<bool>     _array_empty;
-  OopHandle            _null_queue_handle;
+  ZPerWorker<ZAddressArray> _discovered_phantom_refs_without_queue;
+  ZArray<ZRefsWithoutQueueChunk> _refs_without_queue_chunks;
+  ZPerWorker<ZReferenceWorkerStats> _worker_stats;
+  // Whether gc+ref=trace was enabled when the cycle started, checked
+  // instead of the log level for every encountered reference
+  bool                 _trace_discovery;
 
   bool is_inactive(zaddress reference, oop referent, ReferenceType type) const;
   bool is_strongly_live(oop referent) const;
@@ -66,16 +88,24 @@ class ZReferenceProcessor : public ReferenceDiscoverer {
   
   void verify_empty() const;
 
-  void process_worker_discovered_list(zaddress discovered_list);
-  void process_worker_discovered_weak_refs_without_queue(ZAddressArray& weak_refs_without_queue);
-  void work();
+  // The per-reference gc+ref=trace logging is only compiled into the
+  // instantiations with Trace set, selected once per unit of work
+  template <bool Trace>
+  size_t process_worker_discovered_list(zaddress discovered_list);
+  template <bool Trace>
+  size_t process_refs_without_queue(ZAddressArray& refs_without_queue, ReferenceType type, size_t start, size_t end);
+  void split_refs_without_queue(ZAddressArray* refs_without_queue, ReferenceType type);
+  void split_refs_without_queue();
+  void release_refs_without_queue();
+  void work(ZArrayParallelIterator<ZRefsWithoutQueueChunk>* chunks_iter);
   void collect_statistics();
+  void trace_statistics() const;
+  size_t refs_without_queue_size_in_bytes() const;
 
+  void prepend_pending_list(zaddress head, zaddress tail);
+  zaddress concatenate_pending_lists(zaddress* tail);
   zaddress swap_pending_list(zaddress pending_list);
-
-  inline bool has_reference_queue(zaddress reference);
-
-  void initialize_null_queue_handle();
+  void enqueue_pending_list(zaddress head, zaddress tail);
 
 public:
   ZReferenceProcessor(ZWorkers* workers);
@@ -86,10 +116,12 @@ class ZReferenceProcessor : public ReferenceDiscoverer {
   void reset_statistics();
   
   virtual bool discover_reference(oop reference, ReferenceType type);
-  void process_references();
+  // The workers run out of reference processing work continue
+  // with overlapped_task, if given, instead of idling.
+  void process_references(ZTask* overlapped_task = nullptr);
   void enqueue_references();
   
-  void verify_pending_references();
+  void verify_pending_references(zaddress pending_list);
   
   void prepare();
 };
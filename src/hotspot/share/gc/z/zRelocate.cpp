@@ -586,6 +586,9 @@ class ZRelocateMediumAllocator {
 template <typename Allocator>
 class ZRelocateWork : public StackObj {
 private:
+  // Max number of objects copied as one block
+  static const size_t RunMaxLength = 64;
+
   Allocator* const    _allocator;
   ZForwarding*        _forwarding;
   ZRelocationTargets* _targets;
@@ -593,6 +596,9 @@ class ZRelocateWork : public StackObj {
   size_t              _other_promoted;
   size_t              _other_compacted;
   ZStringDedupContext _string_dedup_context;
+  zaddress            _run[RunMaxLength];
+  size_t              _run_length;
+  zaddress            _run_end;
 
   size_t object_alignment() const {
     return (size_t)1 << _forwarding->object_alignment_shift();
@@ -899,6 +905,85 @@ class ZRelocateWork : public StackObj {
     return to_page;
   }
 
+  bool try_relocate_run() {
+    ZForwardingCursor cursors[RunMaxLength];
+
+    // Leave objects already relocated by other threads to the
+    // object-by-object path, which also accounts for them
+    for (size_t i = 0; i < _run_length; i++) {
+      if (!is_null(_forwarding->find(_run[i], &cursors[i]))) {
+        return false;
+      }
+    }
+
+    const zaddress run_start = _run[0];
+    const size_t size = untype(_run_end) - untype(run_start);
+    ZPage* const to_page = _targets->get(_forwarding->partition_id(), _forwarding->to_age());
+
+    const zaddress allocated_addr = _allocator->alloc_object(to_page, size);
+    if (is_null(allocated_addr)) {
+      // The object-by-object path fills up the current target page
+      // and deals with getting a new one
+      return false;
+    }
+
+    // Copy the objects, their relative positions are kept
+    ZUtils::object_copy_disjoint(run_start, allocated_addr, size);
+
+    // Insert forwardings
+    for (size_t i = 0; i < _run_length; i++) {
+      const zaddress from_addr = _run[i];
+      const zaddress allocated_obj = to_zaddress(untype(allocated_addr) + (untype(from_addr) - untype(run_start)));
+      const zaddress to_addr = _forwarding->insert(from_addr, allocated_obj, &cursors[i]);
+      if (to_addr != allocated_obj) {
+        // Relocated by another thread since the lookup. The copy in the
+        // block can't be undone and is left as garbage in the target page.
+        increase_other_forwarded(ZUtils::object_size(from_addr));
+        continue;
+      }
+
+      update_remset_for_fields(from_addr, to_addr);
+
+      maybe_string_dedup(to_addr);
+    }
+
+    return true;
+  }
+
+  void relocate_run() {
+    // In-place relocation may have started since the run was collected
+    if (_run_length == 1 || _forwarding->in_place_relocation() || !try_relocate_run()) {
+      for (size_t i = 0; i < _run_length; i++) {
+        relocate_object(to_oop(_run[i]));
+      }
+    }
+
+    _run_length = 0;
+  }
+
+  void relocate_object_in_run(oop obj) {
+    const zaddress addr = to_zaddress(obj);
+    assert(ZHeap::heap()->is_object_live(addr), "Should be live");
+
+    if (_run_length > 0 && (addr != _run_end || _run_length == RunMaxLength)) {
+      // Not adjacent to the run, or the run is full
+      relocate_run();
+    }
+
+    _run[_run_length++] = addr;
+    _run_end = to_zaddress(untype(addr) + align_up(ZUtils::object_size(addr), object_alignment()));
+  }
+
+  bool should_use_runs() const {
+    if (ZRelocateLiveRunsLimit == 0 || _forwarding->in_place_relocation()) {
+      return false;
+    }
+
+    // Dense pages have long runs of adjacent live objects
+    const ZPage* const page = _forwarding->page();
+    return page->live_bytes() * 100 >= page->size() * ZRelocateLiveRunsLimit;
+  }
+
   void relocate_object(oop obj) {
     const zaddress addr = to_zaddress(obj);
     assert(ZHeap::heap()->is_object_live(addr), "Should be live");
@@ -934,7 +1019,10 @@ class ZRelocateWork : public StackObj {
       _targets(targets),
       _generation(generation),
       _other_promoted(0),
-      _other_compacted(0) {}
+      _other_compacted(0),
+      _run(),
+      _run_length(0),
+      _run_end(zaddress::null) {}
 
   ~ZRelocateWork() {
     _targets->apply_and_clear_targets([&](ZPage* page) {
@@ -998,7 +1086,14 @@ class ZRelocateWork : public StackObj {
     ZVerify::before_relocation(_forwarding);
 
     // Relocate objects
-    _forwarding->object_iterate([&](oop obj) { relocate_object(obj); });
+    if (should_use_runs()) {
+      _forwarding->object_iterate([&](oop obj) { relocate_object_in_run(obj); });
+      if (_run_length > 0) {
+        relocate_run();
+      }
+    } else {
+      _forwarding->object_iterate([&](oop obj) { relocate_object(obj); });
+    }
 
     ZVerify::after_relocation(_forwarding);
 
@@ -1319,6 +1414,41 @@ ZPageAge ZRelocate::compute_to_age(ZPageAge from_age) {
   return to_zpageage(age + 1);
 }
 
+static bool should_delay_promotion(const ZPage* page) {
+  if (ZReferencePromotionDelayPercent == 0) {
+    // Disabled
+    return false;
+  }
+
+  if (ZGeneration::young()->type() == ZYoungType::major_full_preclean) {
+    // Everything must be promoted
+    return false;
+  }
+
+  if (page->age() == ZPageAge::survivor14) {
+    // Max age reached
+    return false;
+  }
+
+  // References are only processed by old collections, so the referents of
+  // promoted References get promoted along with them. If a large part of
+  // the live objects are References with young referents, keep the page
+  // young, so that the referents get a chance to die in young collections.
+  return size_t(page->young_referents()) * 100 >= size_t(page->live_objects()) * ZReferencePromotionDelayPercent;
+}
+
+ZPageAge ZRelocate::compute_to_age(const ZPage* page) {
+  const ZPageAge from_age = page->age();
+  const ZPageAge to_age = compute_to_age(from_age);
+
+  if (to_age == ZPageAge::old && from_age != ZPageAge::old && should_delay_promotion(page)) {
+    page->log_msg(" (promotion delayed)");
+    return to_zpageage(untype(from_age) + 1);
+  }
+
+  return to_age;
+}
+
 class ZFlipAgePagesTask : public ZTask {
 private:
   ZArrayParallelIterator<ZPage*> _iter;
@@ -1334,7 +1464,7 @@ class ZFlipAgePagesTask : public ZTask {
 
     for (ZPage* prev_page; _iter.next(&prev_page);) {
       const ZPageAge from_age = prev_page->age();
-      const ZPageAge to_age = ZRelocate::compute_to_age(from_age);
+      const ZPageAge to_age = ZRelocate::compute_to_age(prev_page);
       assert(from_age != ZPageAge::old, "invalid age for a young collection");
 
       // Figure out if this is proper promotion
@@ -113,6 +113,7 @@ class ZRelocate {
   static void add_remset(volatile zpointer* p);
 
   static ZPageAge compute_to_age(ZPageAge from_age);
+  static ZPageAge compute_to_age(const ZPage* page);
 
   zaddress relocate_object(ZForwarding* forwarding, zaddress_unsafe from_addr);
   zaddress forward_object(ZForwarding* forwarding, zaddress_unsafe from_addr);
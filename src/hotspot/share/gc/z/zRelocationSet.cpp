@@ -66,7 +66,7 @@ class ZRelocationSetInstallTask : public ZTask {
   }
 
   ZPageAge to_age(ZPage* page) {
-    return ZRelocate::compute_to_age(page->age());
+    return ZRelocate::compute_to_age(page);
   }
 
   void track_if_promoted(ZPage* page, ZForwarding* forwarding, ZArray<ZPage*>& relocate_promoted) {
@@ -58,10 +58,12 @@ class ZRootStatTimer {
 private:
   const ZStatPhase*  _phase;
   const Ticks        _start;
+  const jlong        _start_cpu_time;
 
   ZRootStatTimer(const ZStatPhase* phase)
     : _phase(phase),
-      _start(Ticks::now()) {
+      _start(Ticks::now()),
+      _start_cpu_time(phase != nullptr ? phase->cpu_time() : 0) {
     if (phase != nullptr) {
       _phase->register_start(nullptr /* timer */, _start);
     }
@@ -71,7 +73,8 @@ class ZRootStatTimer {
   ~ZRootStatTimer() {
     if (_phase != nullptr) {
       const Ticks end = Ticks::now();
-      _phase->register_end(nullptr /* timer */, _start, end);
+      const jlong cpu_time = _phase->cpu_time() - _start_cpu_time;
+      _phase->register_end(nullptr /* timer */, _start, end, cpu_time);
     }
   }
 
@@ -610,16 +610,29 @@ void ZStatPhase::log_start(LogTargetHandle log, bool thread) const {
   }
 }
 
-void ZStatPhase::log_end(LogTargetHandle log, const Tickspan& duration, bool thread) const {
+void ZStatPhase::log_end(LogTargetHandle log, const Tickspan& duration, bool thread, jlong cpu_time) const {
   if (!log.is_enabled()) {
     return;
   }
 
-  if (thread) {
+  const double duration_ms = TimeHelper::counter_to_millis(duration.value());
+
+  if (cpu_time >= 0) {
+    // With the parallelism, the CPU time per wall time
+    const double cpu_time_ms = double(cpu_time) / NANOSECS_PER_MILLISEC;
+    const double parallelism = duration_ms > 0.0 ? cpu_time_ms / duration_ms : 0.0;
+
+    if (thread) {
+      ResourceMark rm;
+      log.print("%s (%s) %.3fms (CPU %.3fms, %.2fx)", name(), Thread::current()->name(), duration_ms, cpu_time_ms, parallelism);
+    } else {
+      log.print("%s %.3fms (CPU %.3fms, %.2fx)", name(), duration_ms, cpu_time_ms, parallelism);
+    }
+  } else if (thread) {
     ResourceMark rm;
-    log.print("%s (%s) %.3fms", name(), Thread::current()->name(), TimeHelper::counter_to_millis(duration.value()));
+    log.print("%s (%s) %.3fms", name(), Thread::current()->name(), duration_ms);
   } else {
-    log.print("%s %.3fms", name(), TimeHelper::counter_to_millis(duration.value()));
+    log.print("%s %.3fms", name(), duration_ms);
   }
 }
 
@@ -627,6 +640,11 @@ const char* ZStatPhase::name() const {
   return _sampler.name();
 }
 
+jlong ZStatPhase::cpu_time() const {
+  // Not tracked
+  return 0;
+}
+
 ZStatPhaseCollection::ZStatPhaseCollection(const char* name, bool minor)
   : ZStatPhase(minor ? "Minor Collection" : "Major Collection", name),
     _minor(minor) {}
@@ -664,7 +682,7 @@ void ZStatPhaseCollection::register_start(ConcurrentGCTimer* timer, const Ticks&
   log_info(gc)("%s (%s)", name(), GCCause::to_string(cause));
 }
 
-void ZStatPhaseCollection::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const {
+void ZStatPhaseCollection::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const {
   const GCCause::Cause cause = _minor ? ZDriver::minor()->gc_cause() : ZDriver::major()->gc_cause();
 
   if (ZAbort::should_abort()) {
@@ -708,7 +726,7 @@ void ZStatPhaseGeneration::register_start(ConcurrentGCTimer* timer, const Ticks&
   log_info(gc, phases)("%s", name());
 }
 
-void ZStatPhaseGeneration::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const {
+void ZStatPhaseGeneration::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const {
   if (ZAbort::should_abort()) {
     log_info(gc, phases)("%s Aborted", name());
     return;
@@ -763,7 +781,7 @@ void ZStatPhasePause::register_start(ConcurrentGCTimer* timer, const Ticks& star
   log_start(log);
 }
 
-void ZStatPhasePause::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const {
+void ZStatPhasePause::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const {
   timer->register_gc_pause_end(end);
 
   const Tickspan duration = end - start;
@@ -791,7 +809,7 @@ void ZStatPhaseConcurrent::register_start(ConcurrentGCTimer* timer, const Ticks&
   log_start(log);
 }
 
-void ZStatPhaseConcurrent::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const {
+void ZStatPhaseConcurrent::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const {
   if (ZAbort::should_abort()) {
     return;
   }
@@ -806,7 +824,45 @@ void ZStatPhaseConcurrent::register_end(ConcurrentGCTimer* timer, const Ticks& s
 }
 
 ZStatSubPhase::ZStatSubPhase(const char* name, ZGenerationId id)
-  : ZStatPhase(id == ZGenerationId::young ? "Young Subphase" : "Old Subphase", name) {}
+  : ZStatPhase(id == ZGenerationId::young ? "Young Subphase" : "Old Subphase", name),
+    _id(id),
+    _cpu_sampler(id == ZGenerationId::young ? "Young Subphase CPU" : "Old Subphase CPU", name, ZStatUnitTime) {}
+
+class ZStatWorkersCPUTimeClosure : public ThreadClosure {
+private:
+  jlong _cpu_time;
+
+public:
+  ZStatWorkersCPUTimeClosure()
+    : _cpu_time(0) {}
+
+  virtual void do_thread(Thread* thread) {
+    _cpu_time += MAX2(os::thread_cpu_time(thread), (jlong)0);
+  }
+
+  jlong cpu_time() const {
+    return _cpu_time;
+  }
+};
+
+jlong ZStatSubPhase::cpu_time() const {
+  if (!os::is_thread_cpu_time_supported()) {
+    return 0;
+  }
+
+  const jlong current_cpu_time = MAX2(os::current_thread_cpu_time(), (jlong)0);
+
+  if (Thread::current()->is_Worker_thread()) {
+    // Timed by the worker itself
+    return current_cpu_time;
+  }
+
+  // Timed by the thread driving the workers, which do the actual work
+  ZStatWorkersCPUTimeClosure cl;
+  ZGeneration::generation(_id)->workers()->threads_do(&cl);
+
+  return current_cpu_time + cl.cpu_time();
+}
 
 void ZStatSubPhase::register_start(ConcurrentGCTimer* timer, const Ticks& start) const {
   if (timer != nullptr && !ZAbort::should_abort()) {
@@ -823,7 +879,7 @@ void ZStatSubPhase::register_start(ConcurrentGCTimer* timer, const Ticks& start)
   }
 }
 
-void ZStatSubPhase::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const {
+void ZStatSubPhase::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const {
   if (ZAbort::should_abort()) {
     return;
   }
@@ -833,17 +889,18 @@ void ZStatSubPhase::register_end(ConcurrentGCTimer* timer, const Ticks& start, c
     timer->register_gc_phase_end(end);
   }
 
-  ZTracer::report_thread_phase(name(), start, end);
+  ZTracer::report_thread_phase(name(), start, end, cpu_time);
 
   const Tickspan duration = end - start;
   ZStatDurationSample(_sampler, duration);
+  ZStatSample(_cpu_sampler, (uint64_t)TimeHelper::micros_to_counter(cpu_time / (NANOUNITS / MICROUNITS)));
 
   if (Thread::current()->is_Worker_thread()) {
     LogTarget(Trace, gc, phases) log;
-    log_end(log, duration, true /* thread */);
+    log_end(log, duration, true /* thread */, cpu_time);
   } else {
     LogTarget(Debug, gc, phases) log;
-    log_end(log, duration, false /* thread */);
+    log_end(log, duration, false /* thread */, cpu_time);
   }
 }
 
@@ -859,8 +916,8 @@ void ZStatCriticalPhase::register_start(ConcurrentGCTimer* timer, const Ticks& s
   // really log anything useful here.
 }
 
-void ZStatCriticalPhase::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const {
-  ZTracer::report_thread_phase(name(), start, end);
+void ZStatCriticalPhase::register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const {
+  ZTracer::report_thread_phase(name(), start, end, 0 /* cpu_time */);
 
   const Tickspan duration = end - start;
   ZStatDurationSample(_sampler, duration);
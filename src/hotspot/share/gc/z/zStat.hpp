@@ -216,13 +216,16 @@ class ZStatPhase {
   ZStatPhase(const char* group, const char* name);
 
   void log_start(LogTargetHandle log, bool thread = false) const;
-  void log_end(LogTargetHandle log, const Tickspan& duration, bool thread = false) const;
+  void log_end(LogTargetHandle log, const Tickspan& duration, bool thread = false, jlong cpu_time = -1) const;
 
 public:
   const char* name() const;
 
+  // CPU time in nanoseconds attributed to the phase, 0 if not tracked
+  virtual jlong cpu_time() const;
+
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const = 0;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const = 0;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const = 0;
 };
 
 class ZStatPhaseCollection : public ZStatPhase {
@@ -238,7 +241,7 @@ class ZStatPhaseCollection : public ZStatPhase {
   ZStatPhaseCollection(const char* name, bool minor);
 
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const;
 };
 
 class ZStatPhaseGeneration : public ZStatPhase {
@@ -251,7 +254,7 @@ class ZStatPhaseGeneration : public ZStatPhase {
   ZStatPhaseGeneration(const char* name, ZGenerationId id);
 
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const;
 };
 
 class ZStatPhasePause : public ZStatPhase {
@@ -264,7 +267,7 @@ class ZStatPhasePause : public ZStatPhase {
   static const Tickspan& max();
 
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const;
 };
 
 class ZStatPhaseConcurrent : public ZStatPhase {
@@ -272,15 +275,21 @@ class ZStatPhaseConcurrent : public ZStatPhase {
   ZStatPhaseConcurrent(const char* name, ZGenerationId id);
 
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const;
 };
 
 class ZStatSubPhase : public ZStatPhase {
+private:
+  const ZGenerationId _id;
+  const ZStatSampler  _cpu_sampler;
+
 public:
   ZStatSubPhase(const char* name, ZGenerationId id);
 
+  virtual jlong cpu_time() const;
+
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const;
 };
 
 class ZStatCriticalPhase : public ZStatPhase {
@@ -292,7 +301,7 @@ class ZStatCriticalPhase : public ZStatPhase {
   ZStatCriticalPhase(const char* name, bool verbose = true);
 
   virtual void register_start(ConcurrentGCTimer* timer, const Ticks& start) const;
-  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end) const;
+  virtual void register_end(ConcurrentGCTimer* timer, const Ticks& start, const Ticks& end, jlong cpu_time) const;
 };
 
 //
@@ -303,12 +312,14 @@ class ZStatTimer : public StackObj {
   ConcurrentGCTimer* const _gc_timer;
   const ZStatPhase&        _phase;
   const Ticks              _start;
+  const jlong              _start_cpu_time;
 
 public:
   ZStatTimer(const ZStatPhase& phase, ConcurrentGCTimer* gc_timer)
     : _gc_timer(gc_timer),
       _phase(phase),
-      _start(Ticks::now()) {
+      _start(Ticks::now()),
+      _start_cpu_time(phase.cpu_time()) {
     _phase.register_start(_gc_timer, _start);
   }
 
@@ -322,7 +333,8 @@ class ZStatTimer : public StackObj {
 
   ~ZStatTimer() {
     const Ticks end = Ticks::now();
-    _phase.register_end(_gc_timer, _start, end);
+    const jlong cpu_time = _phase.cpu_time() - _start_cpu_time;
+    _phase.register_end(_gc_timer, _start, end, cpu_time);
   }
 };
 
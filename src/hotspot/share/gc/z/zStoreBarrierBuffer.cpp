@@ -30,6 +30,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/vmError.hpp"
 
 ByteSize ZStoreBarrierEntry::p_offset() {
@@ -275,13 +276,63 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
+  flush_mark();
+  flush_remember();
+
+  clear();
+}
+
+void ZStoreBarrierBuffer::flush_mark() const {
+  // Mark the previous values. Repeated stores to the same field, or of
+  // the same value, often leave the same previous value in consecutive
+  // entries, which only needs to be marked once.
+  zaddress last_marked = zaddress::null;
+
   for (size_t i = current(); i < BufferLength; ++i) {
-    const ZStoreBarrierEntry& entry = _buffer[i];
-    const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    const zaddress addr = ZBarrier::make_load_good(_buffer[i]._prev);
+    if (!is_null(addr) && addr != last_marked) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+      last_marked = addr;
+    }
   }
+}
 
-  clear();
+static int compare_field_addrs(uintptr_t a, uintptr_t b) {
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+void ZStoreBarrierBuffer::flush_remember() const {
+  // Sort the field addresses, so that duplicates are adjacent and fields
+  // on the same page are remembered with a single page table lookup
+  uintptr_t fields[BufferLength];
+  const size_t first = current();
+  const size_t length = BufferLength - first;
+
+  for (size_t i = 0; i < length; ++i) {
+    fields[i] = (uintptr_t)_buffer[first + i]._p;
+  }
+
+  QuickSort::sort(fields, length, compare_field_addrs);
+
+  ZPage* page = nullptr;
+
+  for (size_t i = 0; i < length; ++i) {
+    if (i > 0 && fields[i] == fields[i - 1]) {
+      // Already remembered
+      continue;
+    }
+
+    volatile zpointer* const p = (volatile zpointer*)fields[i];
+
+    if (page == nullptr || !page->is_in(to_zaddress(fields[i]))) {
+      page = ZHeap::heap()->page(p);
+    }
+
+    if (page->is_old()) {
+      // Only need remset entries for old objects
+      page->remember(p);
+    }
+  }
 }
 
 bool ZStoreBarrierBuffer::is_in(volatile zpointer* p) {
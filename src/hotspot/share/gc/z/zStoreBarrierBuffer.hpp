@@ -72,6 +72,9 @@ class ZStoreBarrierBuffer : public CHeapObj<mtGC> {
 
   void install_base_pointers_inner();
 
+  void flush_mark() const;
+  void flush_remember() const;
+
   void on_error(outputStream* st);
   class OnError;
 
@@ -144,13 +144,14 @@ void ZTracer::send_stat_sampler(const ZStatSampler& sampler, uint64_t value) {
   }
 }
 
-void ZTracer::send_thread_phase(const char* name, const Ticks& start, const Ticks& end) {
+void ZTracer::send_thread_phase(const char* name, const Ticks& start, const Ticks& end, jlong cpu_time) {
   NoSafepointVerifier nsv;
 
   EventZThreadPhase e(UNTIMED);
   if (e.should_commit()) {
     e.set_gcId(GCId::current_or_undefined());
     e.set_name(name);
+    e.set_cpuTime((u8)cpu_time);
     e.set_starttime(start);
     e.set_endtime(end);
     e.commit();
@@ -169,3 +170,33 @@ void ZTracer::send_thread_debug(const char* name, const Ticks& start, const Tick
     e.commit();
   }
 }
+
+void ZTracer::send_reference_processing(size_t with_queue, size_t without_queue, size_t dropped, size_t cleared, size_t storage) {
+  NoSafepointVerifier nsv;
+
+  EventZReferenceProcessing e;
+  if (e.should_commit()) {
+    e.set_gcId(GCId::current());
+    e.set_withQueue(with_queue);
+    e.set_withoutQueue(without_queue);
+    e.set_dropped(dropped);
+    e.set_cleared(cleared);
+    e.set_storage(storage);
+    e.commit();
+  }
+}
+
+void ZTracer::send_reference_processing_worker(uint worker_id, size_t discovered, size_t without_queue, size_t processed, const Tickspan& time) {
+  NoSafepointVerifier nsv;
+
+  EventZReferenceProcessingWorker e;
+  if (e.should_commit()) {
+    e.set_gcId(GCId::current());
+    e.set_workerId(worker_id);
+    e.set_discovered(discovered);
+    e.set_withoutQueue(without_queue);
+    e.set_processed(processed);
+    e.set_processingTime(time);
+    e.commit();
+  }
+}
@@ -35,16 +35,20 @@ class ZTracer : AllStatic {
 private:
   static void send_stat_counter(const ZStatCounter& counter, uint64_t increment, uint64_t value);
   static void send_stat_sampler(const ZStatSampler& sampler, uint64_t value);
-  static void send_thread_phase(const char* name, const Ticks& start, const Ticks& end);
+  static void send_thread_phase(const char* name, const Ticks& start, const Ticks& end, jlong cpu_time);
   static void send_thread_debug(const char* name, const Ticks& start, const Ticks& end);
+  static void send_reference_processing(size_t with_queue, size_t without_queue, size_t dropped, size_t cleared, size_t storage);
+  static void send_reference_processing_worker(uint worker_id, size_t discovered, size_t without_queue, size_t processed, const Tickspan& time);
 
 public:
   static void initialize();
 
   static void report_stat_counter(const ZStatCounter& counter, uint64_t increment, uint64_t value);
   static void report_stat_sampler(const ZStatSampler& sampler, uint64_t value);
-  static void report_thread_phase(const char* name, const Ticks& start, const Ticks& end);
+  static void report_thread_phase(const char* name, const Ticks& start, const Ticks& end, jlong cpu_time);
   static void report_thread_debug(const char* name, const Ticks& start, const Ticks& end);
+  static void report_reference_processing(size_t with_queue, size_t without_queue, size_t dropped, size_t cleared, size_t storage);
+  static void report_reference_processing_worker(uint worker_id, size_t discovered, size_t without_queue, size_t processed, const Tickspan& time);
 };
 
 class ZMinorTracer : public GCTracer {
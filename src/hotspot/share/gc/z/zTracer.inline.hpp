@@ -40,9 +40,9 @@ inline void ZTracer::report_stat_sampler(const ZStatSampler& sampler, uint64_t v
   }
 }
 
-inline void ZTracer::report_thread_phase(const char* name, const Ticks& start, const Ticks& end) {
+inline void ZTracer::report_thread_phase(const char* name, const Ticks& start, const Ticks& end, jlong cpu_time) {
   if (EventZThreadPhase::is_enabled()) {
-    send_thread_phase(name, start, end);
+    send_thread_phase(name, start, end, cpu_time);
   }
 }
 
@@ -52,6 +52,18 @@ inline void ZTracer::report_thread_debug(const char* name, const Ticks& start, c
   }
 }
 
+inline void ZTracer::report_reference_processing(size_t with_queue, size_t without_queue, size_t dropped, size_t cleared, size_t storage) {
+  if (EventZReferenceProcessing::is_enabled()) {
+    send_reference_processing(with_queue, without_queue, dropped, cleared, storage);
+  }
+}
+
+inline void ZTracer::report_reference_processing_worker(uint worker_id, size_t discovered, size_t without_queue, size_t processed, const Tickspan& time) {
+  if (EventZReferenceProcessingWorker::is_enabled()) {
+    send_reference_processing_worker(worker_id, discovered, without_queue, processed, time);
+  }
+}
+
 inline ZTraceThreadDebug::ZTraceThreadDebug(const char* name)
   : _start(Ticks::now()),
     _name(name) {}
@@ -22,6 +22,7 @@
  */
 
 #include "gc/shared/gc_globals.hpp"
+#include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zLock.inline.hpp"
@@ -135,12 +136,15 @@ void ZUncommitter::run_thread() {
         break;
       }
 
-      if (_next_uncommit_timeout != 0) {
+      // Never uncommit faster than the max uncommit rate
+      const uint64_t timeout = MAX2(_next_uncommit_timeout, paced_uncommit_timeout(uncommitted));
+
+      if (timeout != 0) {
         // Update statistics
         update_statistics(uncommitted_since_last_timeout, start, &accumulated_time);
 
         // Wait until next uncommit
-        wait(_next_uncommit_timeout);
+        wait(timeout);
 
         // Reset event and statistics counters
         start = Ticks::now();
@@ -202,7 +206,36 @@ void ZUncommitter::deactivate_uncommit_cycle() {
   reset_uncommit_cycle();
 }
 
+size_t ZUncommitter::predicted_headroom() const {
+  if (!ZUncommitPredictHeadroom) {
+    return 0;
+  }
+
+  // Predict how much the mutators will allocate until the next young
+  // collection has freed up memory. Before the young collection has
+  // warmed up, the interval is not known and the whole uncommit delay
+  // is used instead.
+  const ZStatCycleStats cycle_stats = ZGeneration::young()->stat_cycle()->stats();
+  const double interval = cycle_stats._is_warm
+      ? MIN2(cycle_stats._avg_cycle_interval, double(ZUncommitDelay))
+      : double(ZUncommitDelay);
+
+  const ZStatMutatorAllocRateStats alloc_rate_stats = ZStatMutatorAllocRate::stats();
+  const double alloc_rate = MAX2(alloc_rate_stats._avg, alloc_rate_stats._predict) + alloc_rate_stats._sd;
+
+  // The allocation rate is for the whole heap, each partition keeps its share
+  const double headroom = alloc_rate * interval / ZNUMA::count();
+
+  log_debug(gc, heap)("Uncommitter (%u) Predicted Headroom: %zuM (Allocation Rate: %.1fMB/s, Interval: %.3fs)",
+                      _id, size_t(headroom) / M, alloc_rate / M, interval);
+
+  return align_up(size_t(MIN2(headroom, double(_partition->_current_max_capacity))), ZGranuleSize);
+}
+
 bool ZUncommitter::activate_uncommit_cycle() {
+  // The statistics are read before taking the page allocator lock
+  const size_t headroom = predicted_headroom();
+
   ZLocker<ZLock> locker(&_partition->_page_allocator->_lock);
 
   precond(uncommit_cycle_is_finished());
@@ -226,8 +259,9 @@ bool ZUncommitter::activate_uncommit_cycle() {
   // Read watermark from cache
   const size_t uncommit_watermark = cache->min_size_watermark();
 
-  // Keep 10% as a headroom
-  const size_t to_uncommit = align_up(size_t(double(uncommit_watermark) * 0.9), ZGranuleSize);
+  // Keep 10% as a headroom, or more if predicted to be allocated soon
+  const size_t min_headroom = uncommit_watermark - align_up(size_t(double(uncommit_watermark) * 0.9), ZGranuleSize);
+  const size_t to_uncommit = uncommit_watermark - MIN2(MAX2(min_headroom, headroom), uncommit_watermark);
 
   // Never uncommit below min capacity
   const size_t uncommit_limit = _partition->_capacity - _partition->_min_capacity;
@@ -289,6 +323,16 @@ void ZUncommitter::cancel_uncommit_cycle() {
   _cancel_time = os::elapsedTime();
 }
 
+uint64_t ZUncommitter::paced_uncommit_timeout(size_t size) const {
+  if (ZUncommitMaxRate == 0) {
+    // No pacing
+    return 0;
+  }
+
+  // Time needed for size to be uncommitted at the max rate
+  return to_millis(double(size) / (double(ZUncommitMaxRate) * M));
+}
+
 void ZUncommitter::register_uncommit(size_t size) {
   precond(uncommit_cycle_is_active());
   precond(size > 0);
@@ -48,6 +48,9 @@ class ZUncommitter : public ZThread {
 
   uint64_t to_millis(double seconds) const;
 
+  size_t predicted_headroom() const;
+  uint64_t paced_uncommit_timeout(size_t size) const;
+
   void update_next_cycle_timeout(double from_time);
   void update_next_cycle_timeout_on_cancel();
   void update_next_cycle_timeout_on_finish();
@@ -28,7 +28,6 @@
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zTask.hpp"
 #include "gc/z/zWeakRootsProcessor.hpp"
-#include "gc/z/zWorkers.hpp"
 #include "memory/iterator.hpp"
 #include "runtime/atomicAccess.hpp"
 #include "utilities/debug.hpp"
@@ -45,30 +44,16 @@ class ZPhantomCleanOopClosure : public OopClosure {
   }
 };
 
-ZWeakRootsProcessor::ZWeakRootsProcessor(ZWorkers* workers)
-  : _workers(workers) {}
+ZProcessWeakRootsTask::ZProcessWeakRootsTask()
+  : ZTask("ZProcessWeakRootsTask"),
+    _roots_weak_colored(ZGenerationIdOptional::old) {}
 
-class ZProcessWeakRootsTask : public ZTask {
-private:
-  ZRootsIteratorWeakColored _roots_weak_colored;
-
-public:
-  ZProcessWeakRootsTask()
-    : ZTask("ZProcessWeakRootsTask"),
-      _roots_weak_colored(ZGenerationIdOptional::old) {}
-
-  ~ZProcessWeakRootsTask() {
-    _roots_weak_colored.report_num_dead();
-  }
-
-  virtual void work() {
-    SuspendibleThreadSetJoiner sts_joiner;
-    ZPhantomCleanOopClosure cl;
-    _roots_weak_colored.apply(&cl);
-  }
-};
+ZProcessWeakRootsTask::~ZProcessWeakRootsTask() {
+  _roots_weak_colored.report_num_dead();
+}
 
-void ZWeakRootsProcessor::process_weak_roots() {
-  ZProcessWeakRootsTask task;
-  _workers->run(&task);
+void ZProcessWeakRootsTask::work() {
+  SuspendibleThreadSetJoiner sts_joiner;
+  ZPhantomCleanOopClosure cl;
+  _roots_weak_colored.apply(&cl);
 }
@@ -24,16 +24,20 @@
 #ifndef SHARE_GC_Z_ZWEAKROOTSPROCESSOR_HPP
 #define SHARE_GC_Z_ZWEAKROOTSPROCESSOR_HPP
 
-class ZWorkers;
+#include "gc/z/zRootsIterator.hpp"
+#include "gc/z/zTask.hpp"
 
-class ZWeakRootsProcessor {
+// Cleans the dead old generation weak roots. Run overlapped with
+// reference processing, see ZGenerationOld::process_non_strong_references().
+class ZProcessWeakRootsTask : public ZTask {
 private:
-  ZWorkers* const _workers;
+  ZRootsIteratorWeakColored _roots_weak_colored;
 
 public:
-  ZWeakRootsProcessor(ZWorkers* workers);
+  ZProcessWeakRootsTask();
+  ~ZProcessWeakRootsTask();
 
-  void process_weak_roots();
+  virtual void work();
 };
 
 #endif // SHARE_GC_Z_ZWEAKROOTSPROCESSOR_HPP
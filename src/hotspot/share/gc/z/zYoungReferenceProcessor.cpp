@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "classfile/javaClasses.inline.hpp"
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
+#include "gc/z/zBarrier.inline.hpp"
+#include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
+#include "gc/z/zTask.hpp"
+#include "gc/z/zValue.inline.hpp"
+#include "gc/z/zWorkers.hpp"
+#include "gc/z/zYoungReferenceProcessor.hpp"
+#include "gc/z/z_globals.hpp"
+#include "logging/log.hpp"
+#include "runtime/safepoint.hpp"
+
+// Number of references processed as one unit of work
+static const size_t ZYoungRefsChunkSize = 4096;
+
+static volatile zpointer* reference_referent_addr(zaddress reference) {
+  return (volatile zpointer*)java_lang_ref_Reference::referent_addr_raw(to_oop(reference));
+}
+
+static zpointer* reference_referent_addr_non_vol(zaddress reference) {
+  return (zpointer*)java_lang_ref_Reference::referent_addr_raw(to_oop(reference));
+}
+
+static zpointer reference_discovered(zaddress reference) {
+  return *(zpointer*)java_lang_ref_Reference::discovered_addr_raw(to_oop(reference));
+}
+
+ZYoungReferenceProcessor::ZYoungReferenceProcessor(ZWorkers* workers)
+  : _workers(workers),
+    _encountered_count(),
+    _discovered_refs(),
+    _chunks() {}
+
+void ZYoungReferenceProcessor::reset() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  // Forget references discovered by an aborted young marking
+  ZPerWorkerIterator<size_t> iter_count(&_encountered_count);
+  for (size_t* count; iter_count.next(&count);) {
+    *count = 0;
+  }
+
+  ZPerWorkerIterator<ZAddressArray> iter_refs(&_discovered_refs);
+  for (ZAddressArray* refs; iter_refs.next(&refs);) {
+    refs->clear();
+  }
+}
+
+bool ZYoungReferenceProcessor::should_discover(zaddress reference, ReferenceType type, zaddress referent) const {
+  if (type != REF_WEAK) {
+    // Only WeakReferences can be cleared without knowing
+    // the SoftReference policy or the finalizable liveness
+    return false;
+  }
+
+  if (!is_null_any(reference_discovered(reference))) {
+    // Already on the pending list, or on its way there
+    return false;
+  }
+
+  if (is_null(referent)) {
+    // Inactive, cleared by the application
+    return false;
+  }
+
+  if (!ZHeap::heap()->is_young(referent)) {
+    // Liveness of old referents is not known by the young marking
+    return false;
+  }
+
+  if (ZHeap::heap()->is_object_strongly_live(referent)) {
+    // Already marked, nothing to clear
+    return false;
+  }
+
+  // Check the queue last, it requires an extra load
+  return !has_reference_queue(to_oop(reference));
+}
+
+void ZYoungReferenceProcessor::count_young_referent(zaddress reference) const {
+  const zaddress referent = ZBarrier::load_barrier_on_oop_field(reference_referent_addr(reference));
+
+  if (!is_null(referent) && ZHeap::heap()->is_young(referent)) {
+    // Feeds the promotion decision for the page of the reference
+    ZHeap::heap()->page(reference)->inc_young_referents();
+  }
+}
+
+bool ZYoungReferenceProcessor::discover_reference(oop reference_obj, ReferenceType type) {
+  if (!RegisterReferences) {
+    // Reference processing disabled
+    return false;
+  }
+
+  const zaddress reference = to_zaddress(reference_obj);
+
+  if (ZReferencePromotionDelayPercent > 0) {
+    count_young_referent(reference);
+  }
+
+  if (!ZYoungReferenceProcessing) {
+    // Young reference processing disabled
+    return false;
+  }
+
+  assert(ZGeneration::young()->is_phase_mark(), "Must be marking");
+  assert(ZHeap::heap()->is_young(reference), "Must be young");
+
+  if (!is_null_queue_handle_initialized()) {
+    // No old generation collection has prepared reference processing yet
+    return false;
+  }
+
+  // Update statistics
+  _encountered_count.get()++;
+
+  volatile zpointer* const referent_addr = reference_referent_addr(reference);
+  const zaddress referent = ZBarrier::load_barrier_on_oop_field(referent_addr);
+
+  if (!should_discover(reference, type, referent)) {
+    // Not discovered
+    return false;
+  }
+
+  log_trace(gc, ref)("Discovered Young Reference: " PTR_FORMAT, untype(reference));
+
+  // The load barrier above healed the referent field. An object is only
+  // followed once per marking, so no claiming of the reference is needed.
+  _discovered_refs.get().append(reference, referent, *reference_referent_addr_non_vol(reference));
+
+  // Discovered
+  return true;
+}
+
+template <bool Trace>
+size_t ZYoungReferenceProcessor::process_refs(ZAddressArray& refs, size_t start, size_t end) {
+  // Page of the previous referent, consecutive referents
+  // are often on the same page
+  ZPage* page = nullptr;
+
+  size_t dropped = 0;
+  for (size_t i = start; i < end; i++) {
+    const zaddress referent_addr = refs.referent_addr_at(i);
+    zpointer* const referent_field_addr = reference_referent_addr_non_vol(refs.reference_addr_at(i));
+
+    if (is_null_any(*referent_field_addr)) {
+      // Cleared by the application during marking
+      dropped++;
+      continue;
+    }
+
+    if (page == nullptr || !page->is_in(referent_addr)) {
+      page = ZHeap::heap()->page(referent_addr);
+    }
+
+    if (!page->is_object_strongly_live(referent_addr)) {
+      if (Trace) {
+        log_trace(gc, ref)("Cleared Young Reference: " PTR_FORMAT, untype(refs.reference_addr_at(i)));
+      }
+      *referent_field_addr = color_null();
+    } else {
+      // Keep the referent, and make sure the field is not left
+      // with a color that the upcoming relocation can't remap
+      dropped++;
+      *referent_field_addr = ZAddress::color(referent_addr, ZPointerLoadGoodMask | ZPointerMarkedYoung | ZPointerMarkedOld | ZPointerRememberedMask);
+    }
+  }
+
+  return dropped;
+}
+
+size_t ZYoungReferenceProcessor::process_refs(ZRefsWithoutQueueChunk* chunk, bool trace) {
+  return trace ? process_refs<true>(*chunk->_array, chunk->_start, chunk->_end)
+               : process_refs<false>(*chunk->_array, chunk->_start, chunk->_end);
+}
+
+void ZYoungReferenceProcessor::split_refs() {
+  assert(_chunks.is_empty(), "Chunks not released");
+
+  ZPerWorkerIterator<ZAddressArray> iter(&_discovered_refs);
+  for (ZAddressArray* refs; iter.next(&refs);) {
+    const size_t length = refs->length();
+
+    for (size_t start = 0; start < length; start += ZYoungRefsChunkSize) {
+      const size_t end = MIN2(start + ZYoungRefsChunkSize, length);
+      _chunks.append({refs, REF_WEAK, start, end, 0 /* dropped */});
+    }
+  }
+}
+
+void ZYoungReferenceProcessor::release_refs() {
+  if (!ZYoungReferenceProcessing) {
+    // Young reference processing disabled, nothing was discovered
+    assert(_chunks.is_empty(), "Nothing should have been discovered");
+    return;
+  }
+
+  size_t encountered = 0;
+  ZPerWorkerConstIterator<size_t> iter_count(&_encountered_count);
+  for (const size_t* count; iter_count.next(&count);) {
+    encountered += *count;
+  }
+
+  size_t dropped = 0;
+  for (int i = 0; i < _chunks.length(); i++) {
+    dropped += _chunks.at(i)._dropped;
+  }
+
+  size_t discovered = 0;
+  ZPerWorkerIterator<ZAddressArray> iter_refs(&_discovered_refs);
+  for (ZAddressArray* refs; iter_refs.next(&refs);) {
+    discovered += refs->length();
+
+    // Size the array for the next cycle
+    refs->clear_and_reserve(refs->length());
+  }
+
+  _chunks.clear();
+
+  log_debug(gc, ref)("Young References: %zu encountered, %zu discovered, %zu cleared",
+                     encountered, discovered, discovered - dropped);
+}
+
+void ZYoungReferenceProcessor::work(ZArrayParallelIterator<ZRefsWithoutQueueChunk>* chunks_iter) {
+  const bool trace = log_is_enabled(Trace, gc, ref);
+  for (size_t index; chunks_iter->next_index(&index);) {
+    ZRefsWithoutQueueChunk* const chunk = _chunks.adr_at((int)index);
+    chunk->_dropped = process_refs(chunk, trace);
+  }
+}
+
+class ZYoungReferenceProcessorTask : public ZTask {
+private:
+  ZYoungReferenceProcessor* const                _reference_processor;
+  ZArrayParallelIterator<ZRefsWithoutQueueChunk> _chunks_iter;
+
+public:
+  ZYoungReferenceProcessorTask(ZYoungReferenceProcessor* reference_processor)
+    : ZTask("ZYoungReferenceProcessorTask"),
+      _reference_processor(reference_processor),
+      _chunks_iter(&reference_processor->_chunks) {}
+
+  virtual void work() {
+    _reference_processor->work(&_chunks_iter);
+  }
+};
+
+void ZYoungReferenceProcessor::process_references() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  // Split discovered references into chunks of work
+  split_refs();
+
+  if (_chunks.length() == 1) {
+    // Not worth waking up the workers
+    ZRefsWithoutQueueChunk* const chunk = _chunks.adr_at(0);
+    chunk->_dropped = process_refs(chunk, log_is_enabled(Trace, gc, ref));
+  } else if (!_chunks.is_empty()) {
+    ZYoungReferenceProcessorTask task(this);
+    _workers->run(&task);
+  }
+
+  release_refs();
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_GC_Z_ZYOUNGREFERENCEPROCESSOR_HPP
+#define SHARE_GC_Z_ZYOUNGREFERENCEPROCESSOR_HPP
+
+#include "gc/shared/referenceDiscoverer.hpp"
+#include "gc/z/zAddress.hpp"
+#include "gc/z/zAddressArray.hpp"
+#include "gc/z/zArray.hpp"
+#include "gc/z/zReferenceProcessor.hpp"
+#include "gc/z/zValue.hpp"
+
+class ZWorkers;
+
+// Reference discovery and processing for the young generation.
+//
+// Only young WeakReferences with a null ReferenceQueue and a young referent
+// are discovered. Such references never need to be enqueued, so processing
+// them boils down to clearing the referent if it was not marked by the young
+// marking. Processing is done in the mark end pause, where the young marking
+// is complete and no mutator can observe, and thereby resurrect, a referent
+// that is about to be cleared.
+//
+// All other references encountered by the young marking are not discovered,
+// and their referents are treated as strongly reachable.
+class ZYoungReferenceProcessor : public ReferenceDiscoverer {
+  friend class ZYoungReferenceProcessorTask;
+
+private:
+  ZWorkers* const                _workers;
+  ZPerWorker<size_t>             _encountered_count;
+  ZPerWorker<ZAddressArray>      _discovered_refs;
+  ZArray<ZRefsWithoutQueueChunk> _chunks;
+
+  bool should_discover(zaddress reference, ReferenceType type, zaddress referent) const;
+  void count_young_referent(zaddress reference) const;
+
+  // The per-reference gc+ref=trace logging is only compiled into
+  // the instantiation with Trace set
+  template <bool Trace>
+  size_t process_refs(ZAddressArray& refs, size_t start, size_t end);
+  size_t process_refs(ZRefsWithoutQueueChunk* chunk, bool trace);
+  void split_refs();
+  void release_refs();
+  void work(ZArrayParallelIterator<ZRefsWithoutQueueChunk>* chunks_iter);
+
+public:
+  ZYoungReferenceProcessor(ZWorkers* workers);
+
+  void reset();
+
+  virtual bool discover_reference(oop reference, ReferenceType type);
+  void process_references();
+};
+
+#endif // SHARE_GC_Z_ZYOUNGREFERENCEPROCESSOR_HPP
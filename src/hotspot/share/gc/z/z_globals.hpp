@@ -55,6 +55,14 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(bool, ZUncommitPredictHeadroom, false, EXPERIMENTAL,              \
+          "Never uncommit memory needed to satisfy the predicted "          \
+          "allocations until the next young collection")                    \
+                                                                            \
+  product(uint, ZUncommitMaxRate, 0, EXPERIMENTAL,                          \
+          "Maximum rate at which memory is uncommitted (in MB/s). "         \
+          "0 means no limit")                                               \
+                                                                            \
   product(double, ZYoungCompactionLimit, 25.0,                              \
           "Maximum allowed garbage in young pages")                         \
           range(0, 100)                                                     \
@@ -101,6 +109,30 @@
           "0: Claim tree "                                                  \
           "1: Simple Striped ")                                             \
                                                                             \
+  product(bool, ZSortReferencesWithoutQueue, false, DIAGNOSTIC,             \
+          "Sort discovered references without queue by referent address "   \
+          "before processing them")                                         \
+                                                                            \
+  product(bool, ZEnqueueReferencesIncrementally, false, DIAGNOSTIC,         \
+          "Hand cleared Soft/Weak/PhantomReferences to the Reference "      \
+          "Handler thread while reference processing is still running")     \
+                                                                            \
+  product(bool, ZYoungReferenceProcessing, false, DIAGNOSTIC,               \
+          "Clear young WeakReferences without queue with dead young "       \
+          "referents during young collections")                             \
+                                                                            \
+  product(uint, ZMarkPrefetchDistance, 8, DIAGNOSTIC,                       \
+          "Number of popped mark stack entries whose object header and "    \
+          "mark bits are prefetched before the entries are followed, "      \
+          "0 disables prefetching")                                         \
+          range(0, ZMarkPrefetchRingMax)                                    \
+                                                                            \
+  product(uint, ZRelocateLiveRunsLimit, 0, DIAGNOSTIC,                      \
+          "Copy runs of adjacent live objects as one block when relocating "\
+          "pages that are at least this percent live, 0 disables block "    \
+          "copying")                                                        \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, ZVerifyRemembered, trueInDebug, DIAGNOSTIC,                 \
           "Verify remembered sets")                                         \
                                                                             \
@@ -115,6 +147,12 @@
           "Young generation tenuring threshold, -1 for dynamic computation")\
           range(-1, static_cast<int>(ZPageAgeCount) - 1)                    \
                                                                             \
+  product(uint, ZReferencePromotionDelayPercent, 0, EXPERIMENTAL,           \
+          "Keep young pages where at least this percentage of the live "    \
+          "objects are References with young referents in the young "       \
+          "generation until they reach the max age, 0 to disable")          \
+          range(0, 100)                                                     \
+                                                                            \
   develop(bool, ZVerifyOops, false,                                         \
           "Verify accessed oops")                                           \
                                                                             \
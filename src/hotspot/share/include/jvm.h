@@ -753,6 +753,9 @@ JVM_ReportFinalizationComplete(JNIEnv *env, jobject finalizee);
 JNIEXPORT jboolean JNICALL
 JVM_IsFinalizationEnabled(JNIEnv *env);
 
+JNIEXPORT void JNICALL
+JVM_RunFinalization(JNIEnv *env);
+
 /*************************************************************************
  PART 2: Support for the Verifier and Class File Format Checker
  ************************************************************************/
@@ -426,7 +426,7 @@ void InterpreterOopMap::copy_from(const OopMapCacheEntry* src) {
   }
 }
 
-inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
+inline unsigned int OopMapCache::hash_value_for(const Method* method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
   return   ((unsigned int) bci)
@@ -436,30 +436,83 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
+OopMapCacheTable* volatile OopMapCache::_old_tables = nullptr;
+
+// Marks a slot of a table that has been replaced by a larger one. Such a
+// slot can no longer be filled, so that no entry gets lost in the old table.
+static OopMapCacheEntry* const moved_entry = reinterpret_cast<OopMapCacheEntry*>(-1);
+
+// The hashtable of an OopMapCache. Lookups only read it, inside a
+// GlobalCounter critical section, and new entries are installed with a CAS.
+// When all slots for a lookup are taken the table is replaced by one twice
+// the size, up to max_size. The old table is reclaimed out of band like
+// evicted entries are.
+class OopMapCacheTable : public CHeapObj<mtClass> {
+  friend class OopMapCache;
+
+  const int _size;
+  OopMapCacheEntry* volatile* const _entries;
+  OopMapCacheTable* _next;  // link for the cleanup list
+
+  OopMapCacheTable(int size) :
+    _size(size),
+    _entries(NEW_C_HEAP_ARRAY(OopMapCacheEntry* volatile, size, mtClass)),
+    _next(nullptr) {
+    for (int i = 0; i < _size; i++) {
+      _entries[i] = nullptr;
+    }
+  }
+
+  ~OopMapCacheTable() {
+    FREE_C_HEAP_ARRAY(OopMapCacheEntry* volatile, _entries);
+  }
+
+  int size() const { return _size; }
+
+  // Returns nullptr for empty and moved slots
+  OopMapCacheEntry* entry_at(int i) const {
+    OopMapCacheEntry* entry = AtomicAccess::load_acquire(&_entries[i % _size]);
+    return (entry == moved_entry) ? nullptr : entry;
+  }
+
+  bool is_free(int i) const {
+    return AtomicAccess::load(&_entries[i % _size]) == nullptr;
+  }
 
-OopMapCache::OopMapCache() {
-  for(int i = 0; i < size; i++) _array[i] = nullptr;
+  // Fails if the slot does not hold old, in particular if it was moved
+  bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
+    assert(old != moved_entry, "cannot replace a moved slot");
+    return AtomicAccess::cmpxchg(&_entries[i % _size], old, entry) == old;
+  }
+
+  // Takes the entry out of a slot and marks the slot as moved
+  OopMapCacheEntry* move_at(int i) {
+    return AtomicAccess::xchg(&_entries[i], moved_entry);
+  }
+};
+
+OopMapCache::OopMapCache() :
+  _table(new OopMapCacheTable(initial_size)),
+  _resizing(false) {
 }
 
 
 OopMapCache::~OopMapCache() {
   // Deallocate oop maps that are allocated out-of-line
   flush();
+  delete _table;
 }
 
-OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return AtomicAccess::load_acquire(&(_array[i % size]));
-}
-
-bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
-  return AtomicAccess::cmpxchg(&_array[i % size], old, entry) == old;
+OopMapCacheTable* OopMapCache::table() const {
+  return AtomicAccess::load_acquire(&_table);
 }
 
 void OopMapCache::flush() {
-  for (int i = 0; i < size; i++) {
-    OopMapCacheEntry* entry = _array[i];
+  OopMapCacheTable* t = _table;
+  for (int i = 0; i < t->size(); i++) {
+    OopMapCacheEntry* entry = t->entry_at(i);
     if (entry != nullptr) {
-      _array[i] = nullptr;  // no barrier, only called in OopMapCache destructor
+      t->_entries[i] = nullptr;  // no barrier, only called in OopMapCache destructor
       OopMapCacheEntry::deallocate(entry);
     }
   }
@@ -467,8 +520,9 @@ void OopMapCache::flush() {
 
 void OopMapCache::flush_obsolete_entries() {
   assert(SafepointSynchronize::is_at_safepoint(), "called by RedefineClasses in a safepoint");
-  for (int i = 0; i < size; i++) {
-    OopMapCacheEntry* entry = _array[i];
+  OopMapCacheTable* t = _table;
+  for (int i = 0; i < t->size(); i++) {
+    OopMapCacheEntry* entry = t->entry_at(i);
     if (entry != nullptr && !entry->is_empty() && entry->method()->is_old()) {
       // Cache entry is occupied by an old redefined method and we don't want
       // to pin it down so flush the entry.
@@ -478,17 +532,58 @@ void OopMapCache::flush_obsolete_entries() {
           ("flush: %s(%s): cached entry @%d",
            entry->method()->name()->as_C_string(), entry->method()->signature()->as_C_string(), i);
       }
-      _array[i] = nullptr;
+      t->_entries[i] = nullptr;
       OopMapCacheEntry::deallocate(entry);
     }
   }
 }
 
+// Replace the table with one twice the size. Returns false if another
+// thread is already doing so, or the table cannot grow any further.
+bool OopMapCache::grow(OopMapCacheTable* old_table) {
+  if (old_table->size() >= max_size || AtomicAccess::cmpxchg(&_resizing, false, true)) {
+    return false;
+  }
+  if (table() != old_table) {
+    // Someone else has grown the table since we looked at it
+    AtomicAccess::release_store(&_resizing, false);
+    return true;
+  }
+
+  OopMapCacheTable* new_table = new OopMapCacheTable(old_table->size() * 2);
+  for (int i = 0; i < old_table->size(); i++) {
+    OopMapCacheEntry* entry = old_table->move_at(i);
+    if (entry == nullptr) {
+      continue;
+    }
+    assert(!entry->is_empty(), "only filled entries are cached");
+    int probe = hash_value_for(entry->method(), entry->bci());
+    bool placed = false;
+    for (int j = 0; j < probe_depth && !placed; j++) {
+      if (new_table->is_free(probe + j)) {
+        new_table->put_at(probe + j, entry, nullptr);
+        placed = true;
+      }
+    }
+    if (!placed) {
+      // Readers of the old table may still be using it
+      enqueue_for_cleanup(entry);
+    }
+  }
+
+  AtomicAccess::release_store(&_table, new_table);
+  AtomicAccess::release_store(&_resizing, false);
+  // Cannot free the old table on the spot either, for the same reason
+  enqueue_for_cleanup(old_table);
+  log_debug(interpreter, oopmap)("grew oopmap cache to %d entries", new_table->size());
+  return true;
+}
+
 // Lookup or compute/cache the entry.
 void OopMapCache::lookup(const methodHandle& method,
                          int bci,
                          InterpreterOopMap* entry_for) {
-  int probe = hash_value_for(method, bci);
+  int probe = hash_value_for(method(), bci);
 
   if (log_is_enabled(Debug, interpreter, oopmap)) {
     static int count = 0;
@@ -502,8 +597,9 @@ void OopMapCache::lookup(const methodHandle& method,
   // Need a critical section to avoid race against concurrent reclamation.
   {
     GlobalCounter::CriticalSection cs(Thread::current());
+    OopMapCacheTable* t = table();
     for (int i = 0; i < probe_depth; i++) {
-      OopMapCacheEntry *entry = entry_at(probe + i);
+      OopMapCacheEntry *entry = t->entry_at(probe + i);
       if (entry != nullptr && !entry->is_empty() && entry->match(method, bci)) {
         entry_for->copy_from(entry);
         assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
@@ -530,23 +626,31 @@ void OopMapCache::lookup(const methodHandle& method,
     return;
   }
 
-  // First search for an empty slot
-  for (int i = 0; i < probe_depth; i++) {
-    OopMapCacheEntry* entry = entry_at(probe + i);
-    if (entry == nullptr) {
-      if (put_at(probe + i, tmp, nullptr)) {
-        assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
-        return;
+  // First search for an empty slot, growing the table if there is none.
+  // A put into a table that is being replaced fails, so retry with the
+  // new one.
+  OopMapCacheTable* t = table();
+  while (true) {
+    for (int i = 0; i < probe_depth; i++) {
+      if (t->is_free(probe + i)) {
+        if (t->put_at(probe + i, tmp, nullptr)) {
+          assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
+          return;
+        }
       }
     }
+    if (!grow(t)) {
+      break;
+    }
+    t = table();
   }
 
   log_debug(interpreter, oopmap)("*** collision in oopmap cache - flushing item ***");
 
   // No empty slot (uncommon case). Use (some approximation of a) LRU algorithm
   // where the first entry in the collision array is replaced with the new one.
-  OopMapCacheEntry* old = entry_at(probe + 0);
-  if (put_at(probe + 0, tmp, old)) {
+  OopMapCacheEntry* old = t->entry_at(probe + 0);
+  if (old != nullptr && t->put_at(probe + 0, tmp, old)) {
     // Cannot deallocate old entry on the spot: it can still be used by readers
     // that got a reference to it before we were able to replace it in the map.
     // Instead of synchronizing on GlobalCounter here and incurring heavy thread
@@ -577,8 +681,19 @@ void OopMapCache::enqueue_for_cleanup(OopMapCacheEntry* entry) {
   }
 }
 
+void OopMapCache::enqueue_for_cleanup(OopMapCacheTable* table) {
+  while (true) {
+    OopMapCacheTable* head = AtomicAccess::load(&_old_tables);
+    table->_next = head;
+    if (AtomicAccess::cmpxchg(&_old_tables, head, table) == head) {
+      break;
+    }
+  }
+}
+
 bool OopMapCache::has_cleanup_work() {
-  return AtomicAccess::load(&_old_entries) != nullptr;
+  return AtomicAccess::load(&_old_entries) != nullptr ||
+         AtomicAccess::load(&_old_tables) != nullptr;
 }
 
 void OopMapCache::try_trigger_cleanup() {
@@ -593,7 +708,8 @@ void OopMapCache::try_trigger_cleanup() {
 
 void OopMapCache::cleanup() {
   OopMapCacheEntry* entry = AtomicAccess::xchg(&_old_entries, (OopMapCacheEntry*)nullptr);
-  if (entry == nullptr) {
+  OopMapCacheTable* table = AtomicAccess::xchg(&_old_tables, (OopMapCacheTable*)nullptr);
+  if (entry == nullptr && table == nullptr) {
     // No work.
     return;
   }
@@ -612,6 +728,12 @@ void OopMapCache::cleanup() {
     OopMapCacheEntry::deallocate(entry);
     entry = next;
   }
+
+  while (table != nullptr) {
+    OopMapCacheTable* next = table->_next;
+    delete table;
+    table = next;
+  }
 }
 
 void OopMapCache::compute_one_oop_map(const methodHandle& method, int bci, InterpreterOopMap* entry) {
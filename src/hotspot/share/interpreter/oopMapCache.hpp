@@ -148,19 +148,25 @@ class InterpreterOopMap: ResourceObj {
   bool has_valid_mask() const { return _mask_size != USHRT_MAX; }
 };
 
+class OopMapCacheTable;
+
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
+ static OopMapCacheTable* volatile _old_tables;
  private:
-  static constexpr int size = 32;        // Use fixed size for now
+  static constexpr int initial_size = 32;
+  static constexpr int max_size = 512;   // grow up to this size on collisions
   static constexpr int probe_depth = 3;  // probe depth in case of collisions
 
-  OopMapCacheEntry* volatile _array[size];
+  OopMapCacheTable* volatile _table;
+  volatile bool _resizing;
 
-  unsigned int hash_value_for(const methodHandle& method, int bci) const;
-  OopMapCacheEntry* entry_at(int i) const;
-  bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
+  unsigned int hash_value_for(const Method* method, int bci) const;
+  OopMapCacheTable* table() const;
+  bool grow(OopMapCacheTable* table);
 
   static void enqueue_for_cleanup(OopMapCacheEntry* entry);
+  static void enqueue_for_cleanup(OopMapCacheTable* table);
 
   void flush();
 
@@ -117,7 +117,7 @@ void BFSClosure::closure_impl(UnifiedOopRef reference, const oop pointee) {
   assert(!reference.is_null(), "invariant");
   assert(reference.dereference() == pointee, "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || !_edge_store->has_pending_candidates()) {
      return;
   }
 
@@ -171,7 +171,7 @@ void BFSClosure::process_queue() {
   assert(_prev_frontier_idx == 0, "invariant");
 
   _next_frontier_idx = _edge_queue->top();
-  while (!is_complete()) {
+  while (_edge_store->has_pending_candidates() && !is_complete()) {
     iterate(_edge_queue->remove()); // edge_queue.remove() increments bottom
   }
 }
@@ -76,7 +76,7 @@ void DFSClosure::closure_impl(UnifiedOopRef reference, const oop pointee) {
   assert(pointee != nullptr, "invariant");
   assert(!reference.is_null(), "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || !_edge_store->has_pending_candidates()) {
     return;
   }
 
@@ -218,7 +218,7 @@ bool EdgeStore::put_edges(StoredEdge** previous, const Edge** current, size_t li
 
 static GrowableArray<const StoredEdge*>* _leak_context_edges = nullptr;
 
-EdgeStore::EdgeStore() : _edges(new EdgeHashTable(this)) {}
+EdgeStore::EdgeStore() : _edges(new EdgeHashTable(this)), _pending_candidates(SIZE_MAX) {}
 
 EdgeStore::~EdgeStore() {
   assert(_edges != nullptr, "invariant");
@@ -320,6 +320,10 @@ void EdgeStore::put_chain(const Edge* chain, size_t length) {
   assert(leak_context_edge != nullptr, "invariant");
   assert(leak_context_edge->parent() == nullptr, "invariant");
 
+  if (_pending_candidates > 0) {
+    --_pending_candidates;
+  }
+
   if (1 == length) {
     store_gc_root_id_in_leak_context_edge(leak_context_edge, leak_context_edge);
     return;
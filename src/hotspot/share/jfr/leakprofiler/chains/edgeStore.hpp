@@ -73,6 +73,7 @@ class EdgeStore : public CHeapObj<mtTracing> {
  private:
   static traceid _edge_id_counter;
   EdgeHashTable* _edges;
+  size_t _pending_candidates;
 
   // Hash table callbacks
   void on_link(EdgeEntry* entry);
@@ -106,6 +107,11 @@ class EdgeStore : public CHeapObj<mtTracing> {
   bool is_empty() const;
   traceid get_id(const Edge* edge) const;
   void put_chain(const Edge* chain, size_t length);
+
+  // The number of leak candidates the search has yet to find a chain for.
+  // Once all are found, the rest of the heap need not be traversed.
+  void set_pending_candidates(size_t count) { _pending_candidates = count; }
+  bool has_pending_candidates() const { return _pending_candidates > 0; }
 };
 
 #endif // SHARE_JFR_LEAKPROFILER_CHAINS_EDGESTORE_HPP
@@ -98,11 +98,15 @@ void PathToGcRootsOperation::doit() {
   // Save the original markWord for the potential leak objects,
   // to be restored on function exit
   ObjectSampleMarker marker;
-  if (ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all) == 0) {
+  const int candidates = ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all);
+  if (candidates == 0) {
     // no valid samples to process
     return;
   }
 
+  // The search is complete once chains are found for all candidates
+  _edge_store->set_pending_candidates((size_t)candidates);
+
   // Necessary condition for attempting a root set iteration
   Universe::heap()->ensure_parsability(false);
 
@@ -23,6 +23,8 @@
  *
  */
 
+#include "classfile/javaClasses.inline.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/leakprofiler/chains/edgeStore.hpp"
 #include "jfr/leakprofiler/chains/pathToGcRootsOperation.hpp"
@@ -33,6 +35,7 @@
 #include "jfr/leakprofiler/utilities/unifiedOopRef.inline.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/markWord.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/javaThread.hpp"
@@ -155,6 +158,23 @@ void EventEmitter::write_event(const ObjectSample* sample, EdgeStore* edge_store
   e.set_object(object_id);
   e.set_arrayElements(array_size(edge->pointee()));
   e.set_root(gc_root_id);
+  e.set_survivedCollections(Universe::heap()->total_collections() - sample->collections_at_allocation());
+  e.set_referenceType(sample->reference_type());
+
+  // Report what has become of a sampled Reference so far, to find the code
+  // creating References whose referents are cleared, or keep surviving collections.
+  bool reference_queue = false;
+  bool referent_cleared = false;
+  u4 referent_survivals = 0;
+  if (sample->is_reference()) {
+    const oop reference = edge->pointee();
+    reference_queue = java_lang_ref_Reference::queue_state(reference) == java_lang_ref_Reference::queue_present;
+    referent_cleared = java_lang_ref_Reference::unknown_referent_no_keepalive(reference) == nullptr;
+    referent_survivals = (u4)java_lang_ref_Reference::referent_survivals(reference);
+  }
+  e.set_referenceQueue(reference_queue);
+  e.set_referentCleared(referent_cleared);
+  e.set_referentSurvivals(referent_survivals);
 
   // Temporarily assigning both the stack trace id and thread id
   // onto the thread local data structure of the emitter thread (for the duration
@@ -32,6 +32,7 @@ void ObjectSample::reset() {
   set_stack_trace_id(0);
   set_stack_trace_hash(0);
   release_references();
+  _reference_type = REF_NONE;
   _virtual_thread = false;
 }
 
@@ -30,6 +30,7 @@
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
 #include "memory/allocation.hpp"
+#include "memory/referenceType.hpp"
 #include "oops/oop.hpp"
 #include "oops/weakHandle.hpp"
 #include "utilities/ticks.hpp"
@@ -57,6 +58,8 @@ class ObjectSample : public JfrCHeapObj {
   size_t _span;
   size_t _allocated;
   size_t _heap_used_at_last_gc;
+  uint _collections_at_allocation;
+  ReferenceType _reference_type;
   int _index;
   bool _virtual_thread;
   mutable bool _thread_exited;
@@ -82,6 +85,8 @@ class ObjectSample : public JfrCHeapObj {
                    _span(0),
                    _allocated(0),
                    _heap_used_at_last_gc(0),
+                   _collections_at_allocation(0),
+                   _reference_type(REF_NONE),
                    _index(0),
                    _virtual_thread(false),
                    _thread_exited(false) {}
@@ -160,6 +165,27 @@ class ObjectSample : public JfrCHeapObj {
     return _heap_used_at_last_gc;
   }
 
+  void set_collections_at_allocation(uint collections) {
+    _collections_at_allocation = collections;
+  }
+
+  uint collections_at_allocation() const {
+    return _collections_at_allocation;
+  }
+
+  // The type of a sampled java.lang.ref.Reference, REF_NONE for other objects.
+  ReferenceType reference_type() const {
+    return _reference_type;
+  }
+
+  void set_reference_type(ReferenceType type) {
+    _reference_type = type;
+  }
+
+  bool is_reference() const {
+    return _reference_type != REF_NONE;
+  }
+
   bool has_stack_trace_id() const {
     return stack_trace_id() != 0;
   }
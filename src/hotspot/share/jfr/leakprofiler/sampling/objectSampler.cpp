@@ -40,6 +40,7 @@
 #include "jfr/utilities/jfrTryLock.hpp"
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomicAccess.hpp"
 #include "runtime/javaThread.hpp"
@@ -294,6 +295,9 @@ void ObjectSampler::add(HeapWord* obj, size_t allocated, traceid thread_id, bool
   sample->set_allocated(allocated);
   sample->set_allocation_time(JfrTicks::now());
   sample->set_heap_used_at_last_gc(Universe::heap()->used_at_last_gc());
+  sample->set_collections_at_allocation(Universe::heap()->total_collections());
+  const Klass* const k = cast_to_oop(obj)->klass();
+  sample->set_reference_type(k->is_instance_klass() ? InstanceKlass::cast(k)->reference_type() : REF_NONE);
   _priority_queue->push(sample);
 }
 
@@ -25,6 +25,7 @@
 #include "compiler/compileBroker.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/periodic/jfrCompilerQueueUtilization.hpp"
+#include "runtime/timer.hpp"
 
 enum {
     c1_compiler_queue_id = 1,
@@ -40,6 +41,8 @@ struct CompilerQueueEntry {
   GET_COMPILER_THREAD_COUNT get_compiler_thread_count;
   uint64_t added;
   uint64_t removed;
+  uint64_t selected;
+  jlong queue_time;
 };
 
 // If current counters are less than previous, we assume the interface has been reset
@@ -54,8 +57,8 @@ static uint64_t rate_per_second(uint64_t current, uint64_t old, const JfrTickspa
 
 void JfrCompilerQueueUtilization::send_events() {
   static CompilerQueueEntry compilerQueueEntries[num_compiler_queues] = {
-    {CompileBroker::c1_compile_queue(), c1_compiler_queue_id, &CompileBroker::get_c1_thread_count, 0, 0},
-    {CompileBroker::c2_compile_queue(), c2_compiler_queue_id, &CompileBroker::get_c2_thread_count, 0, 0}};
+    {CompileBroker::c1_compile_queue(), c1_compiler_queue_id, &CompileBroker::get_c1_thread_count, 0, 0, 0, 0},
+    {CompileBroker::c2_compile_queue(), c2_compiler_queue_id, &CompileBroker::get_c2_thread_count, 0, 0, 0, 0}};
 
   const JfrTicks cur_time = JfrTicks::now();
   static JfrTicks last_sample_instant;
@@ -67,6 +70,10 @@ void JfrCompilerQueueUtilization::send_events() {
       const uint64_t current_removed = entry->compilerQueue->get_total_removed();
       const uint64_t addedRate = rate_per_second(current_added, entry->added, interval);
       const uint64_t removedRate = rate_per_second(current_removed, entry->removed, interval);
+      const uint64_t current_selected = entry->compilerQueue->get_total_selected();
+      const jlong current_queue_time = entry->compilerQueue->get_total_queue_time();
+      const jlong average_queue_time = current_selected > entry->selected ?
+        (current_queue_time - entry->queue_time) / (jlong)(current_selected - entry->selected) : 0;
 
       EventCompilerQueueUtilization event;
       event.set_compiler(entry->compiler_queue_id);
@@ -79,10 +86,13 @@ void JfrCompilerQueueUtilization::send_events() {
       event.set_totalAddedCount(current_added);
       event.set_totalRemovedCount(current_removed);
       event.set_compilerThreadCount(entry->get_compiler_thread_count());
+      event.set_averageQueueTime((u8)TimeHelper::counter_to_millis(average_queue_time));
       event.commit();
 
       entry->added = current_added;
       entry->removed = current_removed;
+      entry->selected = current_selected;
+      entry->queue_time = current_queue_time;
     }
 
     last_sample_instant = cur_time;
@@ -54,6 +54,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiAgentList.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/continuation.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -560,6 +561,20 @@ TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(ContinuationStatistics) {
+  Continuations::PathCounts counts;
+  Continuations::path_counts(&counts);
+  EventContinuationStatistics event;
+  event.set_fastFreezes(counts.fast_freezes);
+  event.set_slowFreezes(counts.slow_freezes);
+  event.set_fastThaws(counts.fast_thaws);
+  event.set_barrierFastThaws(counts.barrier_fast_thaws);
+  event.set_slowThaws(counts.slow_thaws);
+  event.set_chunkPoolHits(counts.chunk_pool_hits);
+  event.set_chunkPoolMisses(counts.chunk_pool_misses);
+  event.commit();
+}
+
 TRACE_REQUEST_FUNC(GCHeapMemoryUsage) {
   MemoryUsage usage = Universe::heap()->memory_usage();
   EventGCHeapMemoryUsage event(UNTIMED);
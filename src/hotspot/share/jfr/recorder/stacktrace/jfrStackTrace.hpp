@@ -38,6 +38,7 @@ struct JfrSampleRequest;
 
 class JfrStackTrace : public JfrCHeapObj {
   friend class JfrNativeSamplerCallback;
+  friend class JfrStackTraceCache;
   friend class JfrStackTraceRepository;
   friend class LeakProfilerStackTraceWriter;
   friend class JfrThreadSampling;
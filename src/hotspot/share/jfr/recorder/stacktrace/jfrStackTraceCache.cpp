@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "jfr/recorder/stacktrace/jfrStackTrace.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceCache.hpp"
+
+JfrStackTraceCache::JfrStackTraceCache() {
+  for (size_t i = 0; i < SIZE; ++i) {
+    _entries[i]._trace = nullptr;
+    _entries[i]._generation = 0;
+  }
+}
+
+JfrStackTraceCache::~JfrStackTraceCache() {
+  for (size_t i = 0; i < SIZE; ++i) {
+    delete _entries[i]._trace;
+  }
+}
+
+traceid JfrStackTraceCache::lookup(const JfrStackTrace& stacktrace, u8 generation) const {
+  const Entry& entry = _entries[index(stacktrace.hash())];
+  if (entry._trace != nullptr && entry._generation == generation && entry._trace->equals(stacktrace)) {
+    return entry._trace->id();
+  }
+  return 0;
+}
+
+void JfrStackTraceCache::insert(const JfrStackTrace& stacktrace, traceid id, u8 generation) {
+  assert(id != 0, "invariant");
+  Entry& entry = _entries[index(stacktrace.hash())];
+  delete entry._trace;
+  entry._trace = new JfrStackTrace(id, stacktrace, nullptr);
+  entry._generation = generation;
+}
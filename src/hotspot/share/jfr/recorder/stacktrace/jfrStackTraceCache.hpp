@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKTRACECACHE_HPP
+#define SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKTRACECACHE_HPP
+
+#include "jfr/utilities/jfrAllocation.hpp"
+#include "jfr/utilities/jfrTypes.hpp"
+
+class JfrStackTrace;
+
+/*
+ * A small, direct mapped, cache of the stack traces a thread most recently added
+ * to the JfrStackTraceRepository. A thread recording the same stack trace over and
+ * over, as is common in loops, finds its id here without taking the JfrStacktrace_lock.
+ *
+ * The cache is only accessed by its owning thread. Entries hold their own copy
+ * of the stack trace, to be compared in full, and are tagged with the generation
+ * of the repository, which changes whenever the repository is cleared, at chunk
+ * rotation. An entry of an earlier generation is a miss, for its id is no longer
+ * in the repository.
+ */
+class JfrStackTraceCache : public JfrCHeapObj {
+ private:
+  static const size_t SIZE = 8;
+
+  struct Entry {
+    const JfrStackTrace* _trace;
+    u8 _generation;
+  };
+
+  Entry _entries[SIZE];
+
+  static size_t index(traceid hash) { return hash & (SIZE - 1); }
+
+ public:
+  JfrStackTraceCache();
+  ~JfrStackTraceCache();
+
+  // Returns the id of the stacktrace, or 0 if not cached for this generation.
+  traceid lookup(const JfrStackTrace& stacktrace, u8 generation) const;
+  void insert(const JfrStackTrace& stacktrace, traceid id, u8 generation);
+};
+
+#endif // SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKTRACECACHE_HPP
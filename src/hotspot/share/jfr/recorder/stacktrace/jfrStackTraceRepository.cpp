@@ -26,8 +26,10 @@
 #include "jfr/recorder/checkpoint/jfrCheckpointWriter.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceCache.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomicAccess.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 
@@ -41,6 +43,8 @@
 static JfrStackTraceRepository* _instance = nullptr;
 static JfrStackTraceRepository* _leak_profiler_instance = nullptr;
 static traceid _next_id = 0;
+// Incremented whenever the traces of the instance are deleted, see JfrStackTraceCache.
+static volatile u8 _generation = 1;
 
 JfrStackTraceRepository& JfrStackTraceRepository::instance() {
   assert(_instance != nullptr, "invariant");
@@ -117,6 +121,7 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (clear) {
     memset(_table, 0, sizeof(_table));
     _entries = 0;
+    next_generation(*this);
   }
   _last_entries = _entries;
   return count;
@@ -136,6 +141,7 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
     }
   }
   memset(repo._table, 0, sizeof(repo._table));
+  next_generation(repo);
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -154,7 +160,30 @@ traceid JfrStackTraceRepository::record(Thread* current_thread, int skip /* 0 */
   }
   ResourceMark rm(current_thread);
   JfrStackTrace stacktrace;
-  return stacktrace.record(JavaThread::cast(current_thread), skip, stack_filter_id) ? add(instance(), stacktrace) : 0;
+  return stacktrace.record(JavaThread::cast(current_thread), skip, stack_filter_id) ? add(tl, stacktrace) : 0;
+}
+
+void JfrStackTraceRepository::next_generation(const JfrStackTraceRepository& repo) {
+  assert_lock_strong(JfrStacktrace_lock);
+  if (&repo == _instance) {
+    AtomicAccess::release_store(&_generation, _generation + 1);
+  }
+}
+
+// Adds a trace of the current thread to the instance, first looking it up in
+// the thread's cache of its recent traces.
+traceid JfrStackTraceRepository::add(JfrThreadLocal* tl, const JfrStackTrace& stacktrace) {
+  assert(tl != nullptr, "invariant");
+  // Load the generation before adding, so that a concurrent clear invalidates the new entry
+  const u8 generation = AtomicAccess::load_acquire(&_generation);
+  JfrStackTraceCache* const cache = tl->stack_trace_cache();
+  const traceid cached_id = cache->lookup(stacktrace, generation);
+  if (cached_id != 0) {
+    return cached_id;
+  }
+  const traceid id = add(instance(), stacktrace);
+  cache->insert(stacktrace, id, generation);
+  return id;
 }
 
 traceid JfrStackTraceRepository::add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace) {
@@ -32,6 +32,7 @@
 class JavaThread;
 class JfrChunkWriter;
 class JfrStackTrace;
+class JfrThreadLocal;
 
 class JfrStackTraceRepository : public JfrCHeapObj {
   friend class JfrDeprecatedEdge;
@@ -70,7 +71,9 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   static void iterate_leakprofiler(Callback& cb);
 
   static traceid next_id();
+  static void next_generation(const JfrStackTraceRepository& repo);
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
+  static traceid add(JfrThreadLocal* tl, const JfrStackTrace& stacktrace);
   traceid add_trace(const JfrStackTrace& stacktrace);
 
  public:
@@ -32,6 +32,7 @@
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdEpoch.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceCache.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/support/jfrThreadId.inline.hpp"
@@ -61,6 +62,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _checkpoint_buffer_epoch_1(nullptr),
   _sample_state(0),
   _dcmd_arena(nullptr),
+  _stack_trace_cache(nullptr),
   _thread(),
   _vthread_id(0),
   _jvm_thread_id(0),
@@ -217,6 +219,10 @@ void JfrThreadLocal::release(Thread* t) {
     delete _dcmd_arena;
     _dcmd_arena = nullptr;
   }
+  if (_stack_trace_cache != nullptr) {
+    delete _stack_trace_cache;
+    _stack_trace_cache = nullptr;
+  }
 }
 
 void JfrThreadLocal::release(JfrThreadLocal* tl, Thread* t) {
@@ -582,6 +588,13 @@ Arena* JfrThreadLocal::dcmd_arena(JavaThread* jt) {
   return arena;
 }
 
+JfrStackTraceCache* JfrThreadLocal::stack_trace_cache() {
+  if (_stack_trace_cache == nullptr) {
+    _stack_trace_cache = new JfrStackTraceCache();
+  }
+  return _stack_trace_cache;
+}
+
 
 #ifdef LINUX
 
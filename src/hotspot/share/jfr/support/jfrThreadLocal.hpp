@@ -40,6 +40,7 @@
 class Arena;
 class JavaThread;
 class JfrBuffer;
+class JfrStackTraceCache;
 class Thread;
 
 class JfrThreadLocal {
@@ -61,6 +62,7 @@ class JfrThreadLocal {
   JfrBuffer* _checkpoint_buffer_epoch_1;
   volatile int _sample_state;
   Arena* _dcmd_arena;
+  JfrStackTraceCache* _stack_trace_cache;
   JfrBlobHandle _thread;
   mutable traceid _vthread_id;
   mutable traceid _jvm_thread_id;
@@ -362,6 +364,9 @@ class JfrThreadLocal {
 
   static Arena* dcmd_arena(JavaThread* jt);
 
+  // Only to be used by the owning thread
+  JfrStackTraceCache* stack_trace_cache();
+
   bool has_thread_blob() const;
   void set_thread_blob(const JfrBlobHandle& handle);
   const JfrBlobHandle& thread_blob() const;
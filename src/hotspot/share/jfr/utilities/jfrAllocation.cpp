@@ -95,7 +95,7 @@ void* JfrCHeapObj::operator new(size_t size) throw() {
 }
 
 void* JfrCHeapObj::operator new (size_t size, const std::nothrow_t&  nothrow_constant) throw() {
-  void* const memory = CHeapObj<mtTracing>::operator new(size, nothrow_constant, CALLER_PC);
+  void* const memory = CHeapObj<mtTracing>::operator new(size, nothrow_constant, MALLOC_CALLER_PC(size));
   hook_memory_allocation((const char*)memory, size);
   return memory;
 }
@@ -105,7 +105,7 @@ void* JfrCHeapObj::operator new [](size_t size) throw() {
 }
 
 void* JfrCHeapObj::operator new [](size_t size, const std::nothrow_t&  nothrow_constant) throw() {
-  void* const memory = CHeapObj<mtTracing>::operator new[](size, nothrow_constant, CALLER_PC);
+  void* const memory = CHeapObj<mtTracing>::operator new[](size, nothrow_constant, MALLOC_CALLER_PC(size));
   hook_memory_allocation((const char*)memory, size);
   return memory;
 }
@@ -132,5 +132,5 @@ void JfrCHeapObj::free(void* p, size_t size) {
 }
 
 char* JfrCHeapObj::allocate_array_noinline(size_t elements, size_t element_size) {
-  return AllocateHeap(elements * element_size, mtTracing, CALLER_PC, AllocFailStrategy::RETURN_NULL);
+  return AllocateHeap(elements * element_size, mtTracing, MALLOC_CALLER_PC(elements * element_size), AllocFailStrategy::RETURN_NULL);
 }
@@ -38,6 +38,7 @@ class StreamWriterHost : public MemoryWriterHost<Adapter, AP> {
   int64_t current_stream_position() const;
 
   void write_bytes(const u1* buf, intptr_t len);
+  bool should_coalesce(intptr_t len) const;
 
  protected:
   StreamWriterHost(StorageType* storage, Thread* thread);
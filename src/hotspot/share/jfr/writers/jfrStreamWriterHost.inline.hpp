@@ -129,8 +129,25 @@ void StreamWriterHost<Adapter, AP>::write_buffered(const void* buf, intptr_t len
   this->write_bytes(this->current_pos(), (const u1*)buf, len);
 }
 
+// Small writes, typically the contents of thread local buffers, are coalesced
+// in the buffer into fewer and larger writes to the stream. A copy is cheaper
+// than a system call, but not for writes large enough to fill the buffer.
+template <typename Adapter, typename AP>
+inline bool StreamWriterHost<Adapter, AP>::should_coalesce(intptr_t len) const {
+  const size_t capacity = pointer_delta(this->end_pos(), this->start_pos(), sizeof(u1));
+  return (size_t)len <= capacity / 8;
+}
+
 template <typename Adapter, typename AP>
 void StreamWriterHost<Adapter, AP>::write_unbuffered(const void* buf, intptr_t len) {
+  assert(len >= 0, "invariant");
+  if (this->is_valid() && should_coalesce(len)) {
+    if ((size_t)len > this->available_size()) {
+      this->flush();
+    }
+    MemoryWriterHost<Adapter, AP>::write_bytes(this->current_pos(), buf, len);
+    return;
+  }
   this->flush();
   assert(0 == this->used_offset(), "can only seek from beginning");
   this->write_bytes((const u1*)buf, len);
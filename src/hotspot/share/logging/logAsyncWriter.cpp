@@ -29,6 +29,7 @@
 #include "memory/allocation.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomicAccess.hpp"
+#include "runtime/orderAccess.hpp"
 
 class AsyncLogWriter::Locker : public StackObj {
   Thread*& _holder;
@@ -77,6 +78,88 @@ class AsyncLogWriter::ConsumerLocker : public Locker {
 Thread* AsyncLogWriter::ProducerLocker::_holder = nullptr;
 Thread* AsyncLogWriter::ConsumerLocker::_holder = nullptr;
 
+// Each entry in a ThreadBuffer is a header holding the size of the entry, followed by the Message.
+// A zero header tells the consumer that the rest of the ring is unused and the next entry is at the
+// start. _head and _tail are monotonically increasing byte counts, only the AsyncLog Thread advances
+// _head and only the owning thread advances _tail. Appended entries become visible to the consumer
+// when they are published, so the lines of a LogMessageBuffer are written out together.
+class AsyncLogWriter::ThreadBuffer : public CHeapObj<mtLogging> {
+  static constexpr size_t HeaderSize = align_up(sizeof(size_t), alignof(Message));
+
+  char* const _buf;
+  const size_t _capacity;
+  volatile size_t _head;
+  volatile size_t _tail;
+  // Owner only, end of the entries appended but not yet published
+  size_t _pending_tail;
+  ThreadBuffer* _next;
+
+  size_t* header_at(size_t pos) const {
+    return reinterpret_cast<size_t*>(_buf + pos % _capacity);
+  }
+
+public:
+  ThreadBuffer(size_t capacity) :
+    _buf(NEW_C_HEAP_ARRAY(char, capacity, mtLogging)),
+    _capacity(capacity),
+    _head(0),
+    _tail(0),
+    _pending_tail(0),
+    _next(nullptr) {
+    assert(is_aligned(_buf, alignof(Message)), "must be");
+    assert(is_aligned(capacity, alignof(Message)), "must be");
+  }
+
+  ThreadBuffer* next() const { return _next; }
+  void set_next(ThreadBuffer* next) { _next = next; }
+
+  // Owner only
+  bool append(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg, size_t msg_len) {
+    const size_t entry_size = HeaderSize + Message::calc_size(msg_len);
+    size_t tail = _pending_tail;
+    const size_t contiguous = _capacity - tail % _capacity;
+    const size_t pad = (contiguous < entry_size) ? contiguous : 0;
+    if (tail + pad + entry_size - AtomicAccess::load_acquire(&_head) > _capacity) {
+      return false;
+    }
+    if (pad > 0) {
+      *header_at(tail) = 0;
+      tail += pad;
+    }
+    *header_at(tail) = entry_size;
+    new (_buf + tail % _capacity + HeaderSize) Message(output, decorations, msg, msg_len);
+    _pending_tail = tail + entry_size;
+    return true;
+  }
+
+  void publish() { AtomicAccess::release_store(&_tail, _pending_tail); }
+  void discard() { _pending_tail = _tail; }
+
+  // Consumer only
+  bool is_empty() const {
+    return _head == AtomicAccess::load_acquire(&_tail);
+  }
+
+  void write_all() {
+    size_t head = _head;
+    const size_t tail = AtomicAccess::load_acquire(&_tail);
+    while (head != tail) {
+      const size_t entry_size = *header_at(head);
+      if (entry_size == 0) {
+        head += _capacity - head % _capacity;
+      } else {
+        const Message* m = reinterpret_cast<const Message*>(_buf + head % _capacity + HeaderSize);
+        m->output()->write_blocking(m->decorations(), m->message());
+        head += entry_size;
+      }
+      // Give the space back as soon as possible
+      AtomicAccess::release_store(&_head, head);
+    }
+  }
+};
+
+THREAD_LOCAL AsyncLogWriter::ThreadBuffer* AsyncLogWriter::_current_thread_buffer = nullptr;
+
 // LogDecorator::None applies to 'constant initialization' because of its constexpr constructor.
 const LogDecorations& AsyncLogWriter::None = LogDecorations(LogLevel::Warning, LogTagSetMapping<LogTag::__NO_TAG>::tagset(),
                                       LogDecorators::None);
@@ -178,11 +261,97 @@ bool AsyncLogWriter::is_enqueue_allowed() {
   return true;
 }
 
+AsyncLogWriter::ThreadBuffer* AsyncLogWriter::thread_buffer(Thread* thread) {
+  ThreadBuffer* buffer = _current_thread_buffer;
+  if (buffer != nullptr || AsyncLogThreadBufferSize < Message::calc_size(0) ||
+      LogConfiguration::async_mode() != LogConfiguration::AsyncMode::Drop ||
+      !(thread->is_Worker_thread() || thread->is_ConcurrentGC_thread())) {
+    return buffer;
+  }
+
+  buffer = new ThreadBuffer(align_down(AsyncLogThreadBufferSize, alignof(Message)));
+  ThreadBuffer* head;
+  do {
+    head = AtomicAccess::load_acquire(&_thread_buffers);
+    buffer->set_next(head);
+  } while (AtomicAccess::cmpxchg(&_thread_buffers, head, buffer) != head);
+  _current_thread_buffer = buffer;
+  return buffer;
+}
+
+void AsyncLogWriter::count_dropped(LogFileStreamOutput* output, uint32_t count) {
+  ConsumerLocker clocker;
+  bool p_created;
+  uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
+  *counter = *counter + count;
+}
+
+void AsyncLogWriter::notify_writer() {
+  // Pairs with the fence after setting _writer_waiting in run(). Either the writer sees the
+  // published entries before it waits, or we see it waiting and wake it up.
+  OrderAccess::fence();
+  if (AtomicAccess::load(&_writer_waiting)) {
+    ConsumerLocker clocker;
+    clocker.notify();
+  }
+}
+
+void AsyncLogWriter::enqueue_thread_buffer(ThreadBuffer* buffer, LogFileStreamOutput* output,
+                                           const LogDecorations& decorations, const char* msg) {
+  assert(msg != nullptr, "enqueuing a null message!");
+  if (buffer->append(output, decorations, msg, strlen(msg))) {
+    buffer->publish();
+    notify_writer();
+  } else {
+    count_dropped(output, 1);
+  }
+}
+
+void AsyncLogWriter::enqueue_thread_buffer(ThreadBuffer* buffer, LogFileStreamOutput* output,
+                                           LogMessageBuffer::Iterator msg_iterator) {
+  uint32_t lines = 0;
+  bool fits = true;
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    lines++;
+    fits = fits && buffer->append(output, msg_iterator.decorations(), msg_iterator.message(),
+                                  strlen(msg_iterator.message()));
+  }
+  if (fits) {
+    buffer->publish();
+    notify_writer();
+  } else {
+    // Drop the whole message rather than a part of it
+    buffer->discard();
+    count_dropped(output, lines);
+  }
+}
+
+bool AsyncLogWriter::thread_buffers_have_data() const {
+  for (ThreadBuffer* buffer = AtomicAccess::load_acquire(&_thread_buffers); buffer != nullptr; buffer = buffer->next()) {
+    if (!buffer->is_empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void AsyncLogWriter::write_thread_buffers() {
+  for (ThreadBuffer* buffer = AtomicAccess::load_acquire(&_thread_buffers); buffer != nullptr; buffer = buffer->next()) {
+    buffer->write_all();
+  }
+}
+
 bool AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
   if (!is_enqueue_allowed()) {
     return false;
   }
 
+  ThreadBuffer* buffer = _instance->thread_buffer(Thread::current());
+  if (buffer != nullptr) {
+    _instance->enqueue_thread_buffer(buffer, &output, decorations, msg);
+    return true;
+  }
+
   ProducerLocker plocker;
 
 #ifdef ASSERT
@@ -203,6 +372,12 @@ bool AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iter
   }
 
   // If we get here we know the AsyncLogWriter is initialized.
+  ThreadBuffer* buffer = _instance->thread_buffer(Thread::current());
+  if (buffer != nullptr) {
+    _instance->enqueue_thread_buffer(buffer, &output, msg_iterator);
+    return true;
+  }
+
   ProducerLocker plocker;
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
     AsyncLogWriter::instance()->enqueue_locked(&output, msg_iterator.decorations(), msg_iterator.message());
@@ -217,12 +392,17 @@ AsyncLogWriter::AsyncLogWriter()
   _data_available(false),
   _initialized(false),
   _stats(),
-  _stalled_message(nullptr) {
+  _stalled_message(nullptr),
+  _thread_buffers(nullptr),
+  _writer_waiting(false) {
 
   size_t size = AsyncLogBufferSize / 2;
   _buffer = new Buffer(size);
   _buffer_staging = new Buffer(size);
   log_info(logging)("AsyncLogBuffer estimates memory use: %zu bytes", size * 2);
+  if (LogConfiguration::async_mode() == LogConfiguration::AsyncMode::Drop && AsyncLogThreadBufferSize > 0) {
+    log_info(logging)("AsyncLogThreadBufferSize adds %zu bytes per GC thread that logs", AsyncLogThreadBufferSize);
+  }
   if (os::create_thread(this, os::asynclog_thread)) {
     _initialized = true;
   } else {
@@ -270,8 +450,14 @@ void AsyncLogWriter::run() {
     {
       ConsumerLocker clocker;
       while (!_data_available) {
+        // Thread buffer producers do not take the lock unless we are waiting, see notify_writer().
+        AtomicAccess::release_store_fence(&_writer_waiting, true);
+        if (thread_buffers_have_data()) {
+          break;
+        }
         clocker.wait();
       }
+      AtomicAccess::store(&_writer_waiting, false);
 
       // Only doing a swap and statistics under the lock to
       // guarantee that I/O jobs don't block logsites.
@@ -291,6 +477,8 @@ void AsyncLogWriter::run() {
     }
 
     bool saw_flush_token = write(snapshot);
+    // Drained after the shared buffer, so a flush also covers everything enqueued to thread buffers before it.
+    write_thread_buffers();
 
     // Any stalled message must be written *after* the buffer has been written.
     // This is because we try hard to output messages in program-order.
@@ -57,12 +57,20 @@ class LogFileStreamOutput;
 // flush() ensures that all pending messages have been written out before it returns. It is not MT-safe in itself. When users
 // change the logging configuration via jcmd, LogConfiguration::configure_output() calls flush() under the protection of the
 // ConfigurationLock. In addition flush() is called during JVM termination, via LogConfiguration::finalize.
+//
+// Thread buffers:
+// In drop mode, GC worker and concurrent GC threads enqueue to a ThreadBuffer of their own instead of the shared buffer.
+// That is a single-producer single-consumer ring of AsyncLogThreadBufferSize bytes, drained by the AsyncLog Thread after
+// the shared buffer, so log sites in parallel GC phases do not serialize on the producer and consumer locks. A message
+// that does not fit is dropped and counted in _stats like any other dropped message. Messages of one thread keep their
+// order, messages of different threads are only ordered by their decorations.
 class AsyncLogWriter : public NonJavaThread {
   friend class AsyncLogTest;
   friend class AsyncLogTest_logBuffer_vm_Test;
   class Locker;
   class ProducerLocker;
   class ConsumerLocker;
+  class ThreadBuffer;
 
   // account for dropped messages
   template <AnyObj::allocation_type ALLOC_TYPE>
@@ -182,11 +190,28 @@ class AsyncLogWriter : public NonJavaThread {
   // owning producer thread of the stalled message. This thread will finally release both locks in order, allowing for other producers to continue.
   volatile Message* _stalled_message;
 
+  // All thread buffers ever created. GC worker and concurrent GC threads are never terminated,
+  // so thread buffers are never unlinked or freed.
+  ThreadBuffer* volatile _thread_buffers;
+  // Set while the AsyncLog Thread is about to wait, thread buffer producers only notify then.
+  volatile bool _writer_waiting;
+  static THREAD_LOCAL ThreadBuffer* _current_thread_buffer;
+
   static const LogDecorations& None;
 
   AsyncLogWriter();
   void enqueue_locked(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
   bool write(AsyncLogMap<AnyObj::RESOURCE_AREA>& snapshot);
+
+  ThreadBuffer* thread_buffer(Thread* thread);
+  void enqueue_thread_buffer(ThreadBuffer* buffer, LogFileStreamOutput* output,
+                             const LogDecorations& decorations, const char* msg);
+  void enqueue_thread_buffer(ThreadBuffer* buffer, LogFileStreamOutput* output,
+                             LogMessageBuffer::Iterator msg_iterator);
+  void count_dropped(LogFileStreamOutput* output, uint32_t count);
+  void notify_writer();
+  bool thread_buffers_have_data() const;
+  void write_thread_buffers();
   void run() override;
   void pre_run() override {
     NonJavaThread::pre_run();
@@ -31,6 +31,7 @@
 #include "nmt/memTracker.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
@@ -84,8 +85,10 @@ const char* Arena::tag_desc[] = {
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
 class ChunkPool {
+  friend class ChunkThreadCache;
+
   // Our four static pools
-  static constexpr int _num_pools = 4;
+  static constexpr int _num_pools = ChunkThreadCache::_num_sizes;
   static ChunkPool _pools[_num_pools];
 
   Chunk*       _first;
@@ -147,6 +150,34 @@ class ChunkPool {
   static void deallocate_chunk(Chunk* p);
 };
 
+// Returns the chunk cache of the current thread, or null if the current
+// thread does not cache chunks.
+static ChunkThreadCache* current_chunk_thread_cache() {
+  if (!UseChunkThreadCache) {
+    return nullptr;
+  }
+  Thread* thread = Thread::current_or_null();
+  if (thread == nullptr || !(thread->is_Compiler_thread() || thread->is_Worker_thread())) {
+    return nullptr;
+  }
+  return thread->chunk_thread_cache();
+}
+
+ChunkThreadCache::ChunkThreadCache() {
+  for (int i = 0; i < _num_sizes; i++) {
+    _chunks[i] = nullptr;
+  }
+}
+
+ChunkThreadCache::~ChunkThreadCache() {
+  for (int i = 0; i < _num_sizes; i++) {
+    if (_chunks[i] != nullptr) {
+      ChunkPool::_pools[i].return_to_pool(_chunks[i]);
+      _chunks[i] = nullptr;
+    }
+  }
+}
+
 static bool on_compiler_thread() {
 #if defined(COMPILER1) || defined(COMPILER2)
   return Thread::current_or_null() != nullptr &&
@@ -179,7 +210,15 @@ Chunk* ChunkPool::allocate_chunk(Arena* arena, size_t length, AllocFailType allo
   ChunkPool* pool = ChunkPool::get_pool_for_size(length);
   Chunk* chunk = nullptr;
   if (pool != nullptr) {
-    Chunk* c = pool->take_from_pool();
+    ChunkThreadCache* cache = current_chunk_thread_cache();
+    Chunk* c = nullptr;
+    if (cache != nullptr) {
+      c = cache->_chunks[pool - _pools];
+      cache->_chunks[pool - _pools] = nullptr;
+    }
+    if (c == nullptr) {
+      c = pool->take_from_pool();
+    }
     if (c != nullptr) {
       assert(c->length() == length, "wrong length?");
       chunk = c;
@@ -188,7 +227,7 @@ Chunk* ChunkPool::allocate_chunk(Arena* arena, size_t length, AllocFailType allo
   if (chunk == nullptr) {
     // Either the pool was empty, or this is a non-standard length. Allocate a new Chunk from C-heap.
     size_t bytes = ARENA_ALIGN(sizeof(Chunk)) + length;
-    void* p = os::malloc(bytes, mtChunk, CALLER_PC);
+    void* p = os::malloc(bytes, mtChunk, MALLOC_CALLER_PC(bytes));
     if (p == nullptr && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
       vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
     }
@@ -221,7 +260,13 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
   // If this is a standard-sized chunk, return it to its pool; otherwise free it.
   ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
   if (pool != nullptr) {
-    pool->return_to_pool(c);
+    ChunkThreadCache* cache = current_chunk_thread_cache();
+    if (cache != nullptr && cache->_chunks[pool - _pools] == nullptr) {
+      c->set_next(nullptr);
+      cache->_chunks[pool - _pools] = c;
+    } else {
+      pool->return_to_pool(c);
+    }
   } else {
     // Free chunks under a lock so that NMT adjustment is stable.
     ChunkPoolLocker lock;
@@ -241,6 +286,10 @@ class ChunkPoolCleaner : public PeriodicTask {
    }
 };
 
+void Arena::clean_chunk_pools() {
+  ChunkPool::clean();
+}
+
 void Arena::start_chunk_pool_cleaner_task() {
 #ifdef ASSERT
   static bool task_created = false;
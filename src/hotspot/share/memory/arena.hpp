@@ -44,6 +44,25 @@ class ChunkPoolLocker : public StackObj {
   ~ChunkPoolLocker();
 };
 
+class Chunk;
+
+// A per-thread cache holding at most one free chunk of each of the standard
+// chunk sizes. Compiler threads and GC workers create and destroy arenas at
+// a high rate; serving them from their own cache spares them the lock of the
+// global chunk pools. When the thread dies, the cache is drained into the
+// global chunk pools.
+class ChunkThreadCache {
+  friend class ChunkPool;
+
+  static constexpr int _num_sizes = 4;
+  Chunk* _chunks[_num_sizes];
+
+public:
+  ChunkThreadCache();
+  ~ChunkThreadCache();
+  NONCOPYABLE(ChunkThreadCache);
+};
+
 // Linked list of raw memory chunks
 class Chunk {
 
@@ -162,6 +181,11 @@ class Arena : public CHeapObjBase {
 
   // Start the chunk_pool cleaner task
   static void start_chunk_pool_cleaner_task();
+
+  // Free all chunks in the global chunk pools. The native heap trimmer
+  // does this right before trimming, so that the freed chunks can be
+  // returned to the OS.
+  static void clean_chunk_pools();
   Arena(MemTag mem_tag, Tag tag = Tag::tag_other, size_t init_size = Chunk::init_size);
   ~Arena();
   void  destruct_contents();
@@ -39,6 +39,8 @@
 #include "memory/metaspaceTracer.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "oops/klass.hpp"
+#include "runtime/atomicAccess.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/debug.hpp"
 
@@ -53,6 +55,31 @@ using metaspace::InternalStats;
 #define LOGFMT         "CLMS @" PTR_FORMAT " "
 #define LOGFMT_ARGS    p2i(this)
 
+THREAD_LOCAL MetaspaceAllocationBuffer* MetaspaceAllocationBuffer::_current = nullptr;
+
+// Like MutexLocker, but notes in *is_contended if the lock was held by another thread.
+class ContentionNotingLocker : public StackObj {
+  Mutex* const _lock;
+public:
+  ContentionNotingLocker(Mutex* lock, volatile bool* is_contended) : _lock(lock) {
+    if (!_lock->try_lock()) {
+      InternalStats::inc_num_arena_lock_contended();
+      if (!AtomicAccess::load(is_contended)) {
+        AtomicAccess::store(is_contended, true);
+      }
+      _lock->lock_without_safepoint_check();
+    }
+  }
+  ~ContentionNotingLocker() {
+    _lock->unlock();
+  }
+};
+
+// Size of a thread-local allocation buffer, in words; 0 if buffers are disabled.
+static size_t allocation_buffer_words() {
+  return align_down(MetaspaceAllocationBufferSize / BytesPerWord, Metaspace::min_allocation_word_size);
+}
+
 ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type) :
     ClassLoaderMetaspace(lock, space_type,
                          MetaspaceContext::context_nonclass(),
@@ -65,6 +92,7 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
                                            MetaspaceContext* class_context,
                                            size_t klass_alignment_words) :
   _lock(lock),
+  _is_contended(false),
   _space_type(space_type),
   _non_class_space_arena(nullptr),
   _class_space_arena(nullptr)
@@ -100,9 +128,18 @@ ClassLoaderMetaspace::~ClassLoaderMetaspace() {
 // Allocate word_size words from Metaspace.
 MetaWord* ClassLoaderMetaspace::allocate(size_t word_size, Metaspace::MetadataType mdType) {
   word_size = align_up(word_size, Metaspace::min_allocation_word_size);
-  MutexLocker fcl(lock(), Mutex::_no_safepoint_check_flag);
-  MetaBlock result, wastage;
   const bool is_class = have_class_space_arena() && mdType == Metaspace::ClassType;
+  if (!is_class) {
+    MetaspaceAllocationBuffer* const buffer = MetaspaceAllocationBuffer::current();
+    if (buffer != nullptr && buffer->metaspace() == this) {
+      MetaWord* const p = allocate_from_buffer(buffer, word_size);
+      if (p != nullptr) {
+        return p;
+      }
+    }
+  }
+  ContentionNotingLocker fcl(lock(), &_is_contended);
+  MetaBlock result, wastage;
   if (is_class) {
     assert(word_size >= (sizeof(Klass)/BytesPerWord), "weird size for klass: %zu", word_size);
     result = class_space_arena()->allocate(word_size, wastage);
@@ -123,6 +160,57 @@ MetaWord* ClassLoaderMetaspace::allocate(size_t word_size, Metaspace::MetadataTy
   return result.base();
 }
 
+MetaWord* ClassLoaderMetaspace::allocate_from_buffer(MetaspaceAllocationBuffer* buffer, size_t word_size) {
+  MetaWord* p = buffer->allocate(word_size);
+  if (p != nullptr) {
+    return p;
+  }
+  // Only carve a new buffer if the lock is worth avoiding, and only for
+  // allocations small enough not to waste most of it.
+  const size_t buffer_words = allocation_buffer_words();
+  if (!AtomicAccess::load(&_is_contended) || word_size > buffer_words / 4) {
+    return nullptr;
+  }
+  ContentionNotingLocker fcl(lock(), &_is_contended);
+  retire_buffer_locked(buffer);
+  MetaBlock wastage;
+  MetaBlock bl = non_class_space_arena()->allocate(buffer_words, wastage);
+  if (wastage.is_nonempty()) {
+    non_class_space_arena()->deallocate(wastage);
+  }
+  if (bl.is_empty()) {
+    // Leave it to the regular path, which knows how to deal with hitting a limit.
+    return nullptr;
+  }
+  InternalStats::inc_num_alloc_buffer_refills();
+  UL2(trace, "new allocation buffer " METABLOCKFORMAT ".", METABLOCKFORMATARGS(bl));
+  buffer->_top = bl.base();
+  buffer->_end = bl.base() + bl.word_size();
+  return buffer->allocate(word_size);
+}
+
+void ClassLoaderMetaspace::retire_buffer_locked(MetaspaceAllocationBuffer* buffer) {
+  assert_lock_strong(lock());
+  if (buffer->free_words() > 0) {
+    non_class_space_arena()->deallocate(MetaBlock(buffer->_top, buffer->free_words()));
+  }
+  buffer->_top = buffer->_end = nullptr;
+}
+
+MetaspaceAllocationBuffer::MetaspaceAllocationBuffer(ClassLoaderMetaspace* metaspace) :
+  _metaspace(metaspace), _prev(_current), _top(nullptr), _end(nullptr) {
+  _current = this;
+}
+
+MetaspaceAllocationBuffer::~MetaspaceAllocationBuffer() {
+  assert(_current == this, "buffers must nest");
+  _current = _prev;
+  if (free_words() > 0) {
+    MutexLocker fcl(_metaspace->lock(), Mutex::_no_safepoint_check_flag);
+    _metaspace->retire_buffer_locked(this);
+  }
+}
+
 // Attempt to expand the GC threshold to be good for at least another word_size words
 // and allocate. Returns null if failure. Used during Metaspace GC.
 MetaWord* ClassLoaderMetaspace::expand_and_allocate(size_t word_size, Metaspace::MetadataType mdType) {
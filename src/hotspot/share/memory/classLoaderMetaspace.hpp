@@ -29,6 +29,7 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+class MetaspaceAllocationBuffer;
 class outputStream;
 
 namespace metaspace {
@@ -60,10 +61,16 @@ namespace metaspace {
 //
 class ClassLoaderMetaspace : public CHeapObj<mtClass> {
   friend class metaspace::ClmsTester; // for gtests
+  friend class MetaspaceAllocationBuffer;
 
   // A reference to an outside lock, held by the CLD.
   Mutex* const _lock;
 
+  // Set once a thread found _lock held by another thread. From then on, threads
+  // defining classes in this metaspace carve their non-class allocations from
+  // thread-local buffers (see MetaspaceAllocationBuffer).
+  volatile bool _is_contended;
+
   const Metaspace::MetaspaceType _space_type;
 
   // Arena for allocations from non-class  metaspace
@@ -80,6 +87,13 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
 
   bool have_class_space_arena() const { return _class_space_arena != nullptr; }
 
+  // Allocate from the thread-local buffer, refilling it from the non-class arena
+  // if needed. Returns null if the allocation should take the regular path.
+  MetaWord* allocate_from_buffer(MetaspaceAllocationBuffer* buffer, size_t word_size);
+
+  // Returns the unused tail of the buffer to the non-class arena. Expects _lock to be held.
+  void retire_buffer_locked(MetaspaceAllocationBuffer* buffer);
+
   ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type,
                        metaspace::MetaspaceContext* non_class_context,
                        metaspace::MetaspaceContext* class_context,
@@ -120,5 +134,47 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
 
 }; // end: ClassLoaderMetaspace
 
+// While a MetaspaceAllocationBuffer is live, the current thread takes its
+// non-class allocations from the given ClassLoaderMetaspace out of a
+// thread-local buffer, without taking the metaspace lock. This is meant for
+// class definition: parallel-capable loaders may define many classes at once,
+// and would otherwise serialize on the lock for every Method, ConstMethod,
+// ConstantPool etc.
+//
+// The buffer is only carved from the non-class arena once the metaspace lock
+// has been found contended, so that loaders defining their classes from a
+// single thread pay no footprint. Whatever is left of the buffer is handed
+// back to the arena's free blocks when the MetaspaceAllocationBuffer dies.
+//
+// MetaspaceAllocationBuffers nest; only the innermost one is used.
+class MetaspaceAllocationBuffer : public StackObj {
+  friend class ClassLoaderMetaspace;
+
+  static THREAD_LOCAL MetaspaceAllocationBuffer* _current;
+
+  ClassLoaderMetaspace* const _metaspace;
+  MetaspaceAllocationBuffer* const _prev;
+  MetaWord* _top;
+  MetaWord* _end;
+
+  MetaWord* allocate(size_t word_size) {
+    if (pointer_delta(_end, _top, sizeof(MetaWord)) < word_size) {
+      return nullptr;
+    }
+    MetaWord* const p = _top;
+    _top += word_size;
+    return p;
+  }
+
+public:
+  MetaspaceAllocationBuffer(ClassLoaderMetaspace* metaspace);
+  ~MetaspaceAllocationBuffer();
+
+  static MetaspaceAllocationBuffer* current() { return _current; }
+
+  ClassLoaderMetaspace* metaspace() const     { return _metaspace; }
+  size_t free_words() const                   { return pointer_delta(_end, _top, sizeof(MetaWord)); }
+};
+
 
 #endif // SHARE_MEMORY_CLASSLOADERMETASPACE_HPP
@@ -24,6 +24,7 @@
 
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/javaClasses.inline.hpp"
 #include "classfile/moduleEntry.hpp"
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/collectedHeap.hpp"
@@ -167,9 +168,18 @@ class KlassInfoTable::AllClassesFinder : public LockedClassesDo {
 };
 
 
-KlassInfoTable::KlassInfoTable(bool add_all_classes) {
+KlassInfoTable::KlassInfoTable(bool add_all_classes, bool record_references) {
   _size_of_instances_in_words = 0;
   _ref = (uintptr_t) Universe::boolArrayKlass();
+  for (int index = 0; index < _cache_size; index++) {
+    _cache[index] = nullptr;
+  }
+  _record_references = record_references;
+  for (int type = 0; type <= REF_PHANTOM; type++) {
+    for (int state = 0; state < num_queue_states; state++) {
+      _reference_counts[type][state] = 0;
+    }
+  }
   _buckets =
     (KlassInfoBucket*)  AllocateHeap(sizeof(KlassInfoBucket) * _num_buckets,
        mtInternal, CURRENT_PC, AllocFailStrategy::RETURN_NULL);
@@ -209,17 +219,45 @@ KlassInfoEntry* KlassInfoTable::lookup(Klass* k) {
   return e;
 }
 
+// Consecutive objects are often of a few classes only, so keep the
+// entries found last, indexed by a multiplicative hash of the Klass*
+// as klasses may be aligned to more than a word.
+KlassInfoEntry* KlassInfoTable::cached_lookup(Klass* k) {
+  STATIC_ASSERT(_cache_size == 256);
+  const uint idx = (hash(k) * 0x9E3779B9u) >> 24;
+  KlassInfoEntry* e = _cache[idx];
+  if (e != nullptr && e->is_equal(k)) {
+    return e;
+  }
+  e = lookup(k);
+  if (e != nullptr) {
+    _cache[idx] = e;
+  }
+  return e;
+}
+
+void KlassInfoTable::record_reference(KlassInfoEntry* elt, const oop obj, ReferenceType type) {
+  const int state = java_lang_ref_Reference::queue_state(obj);
+  assert(state < num_queue_states, "invalid queue state %d", state);
+  _reference_counts[type][state]++;
+  elt->add_queue_state_count(state, 1);
+}
+
 // Return false if the entry could not be recorded on account
 // of running out of space required to create a new entry.
 bool KlassInfoTable::record_instance(const oop obj) {
   Klass*        k = obj->klass();
-  KlassInfoEntry* elt = lookup(k);
+  KlassInfoEntry* elt = cached_lookup(k);
   // elt may be null if it's a new klass for which we
   // could not allocate space for a new entry in the hashtable.
   if (elt != nullptr) {
+    const size_t size = obj->size();
     elt->set_count(elt->count() + 1);
-    elt->set_words(elt->words() + obj->size());
-    _size_of_instances_in_words += obj->size();
+    elt->set_words(elt->words() + size);
+    _size_of_instances_in_words += size;
+    if (_record_references && k->is_reference_instance_klass()) {
+      record_reference(elt, obj, InstanceKlass::cast(k)->reference_type());
+    }
     return true;
   } else {
     return false;
@@ -247,6 +285,9 @@ bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
   if (elt != nullptr) {
     elt->set_count(elt->count() + cie->count());
     elt->set_words(elt->words() + cie->words());
+    for (int state = 0; state < num_queue_states; state++) {
+      elt->add_queue_state_count(state, cie->queue_state_count(state));
+    }
     _size_of_instances_in_words += cie->words();
     return true;
   }
@@ -269,9 +310,83 @@ class KlassInfoTableMergeClosure : public KlassInfoClosure {
 bool KlassInfoTable::merge(KlassInfoTable* table) {
   KlassInfoTableMergeClosure closure(this);
   table->iterate(&closure);
+  for (int type = 0; type <= REF_PHANTOM; type++) {
+    for (int state = 0; state < num_queue_states; state++) {
+      _reference_counts[type][state] += table->_reference_counts[type][state];
+    }
+  }
   return closure.success();
 }
 
+void KlassInfoTable::print_reference_histo_on(outputStream* st) const {
+  static const char* const type_names[] = { nullptr, "Soft", "Weak", "Final", "Phantom" };
+  STATIC_ASSERT(ARRAY_SIZE(type_names) == REF_PHANTOM + 1);
+
+  // The queue state is the one last recorded by a collector, so references
+  // that were never discovered are listed as unknown.
+  st->cr();
+  st->print_cr("References by type and ReferenceQueue state (as last seen by GC):");
+  st->print_cr(" type          #no queue       #queue     #unknown");
+  st->print_cr("----------------------------------------------------");
+  for (int type = REF_SOFT; type <= REF_PHANTOM; type++) {
+    st->print_cr(" %-8s" UINT64_FORMAT_W(13) UINT64_FORMAT_W(13) UINT64_FORMAT_W(13),
+                 type_names[type],
+                 (uint64_t)_reference_counts[type][java_lang_ref_Reference::queue_none],
+                 (uint64_t)_reference_counts[type][java_lang_ref_Reference::queue_present],
+                 (uint64_t)_reference_counts[type][java_lang_ref_Reference::queue_unknown]);
+  }
+}
+
+class ReferenceKlassClosure : public KlassInfoClosure {
+ private:
+  GrowableArray<KlassInfoEntry*>* _entries;
+ public:
+  ReferenceKlassClosure(GrowableArray<KlassInfoEntry*>* entries) : _entries(entries) {}
+  void do_cinfo(KlassInfoEntry* cie) {
+    if (cie->count() > 0 && cie->klass()->is_reference_instance_klass()) {
+      _entries->append(cie);
+    }
+  }
+};
+
+static int compare_reference_entries(KlassInfoEntry** e1, KlassInfoEntry** e2) {
+  if ((*e1)->count() != (*e2)->count()) {
+    return (*e1)->count() > (*e2)->count() ? -1 : 1;
+  }
+  return (*e1)->compare(*e1, *e2);
+}
+
+// Lists the Reference subclasses by number of instances, to find the
+// libraries creating most references, and whether these get a queue.
+void KlassInfoTable::print_reference_stats_on(outputStream* st) {
+  static const char* const type_names[] = { "Other", "Soft", "Weak", "Final", "Phantom" };
+  STATIC_ASSERT(ARRAY_SIZE(type_names) == REF_PHANTOM + 1);
+
+  GrowableArray<KlassInfoEntry*> entries(64);
+  ReferenceKlassClosure closure(&entries);
+  iterate(&closure);
+  entries.sort(compare_reference_entries);
+
+  print_reference_histo_on(st);
+  st->cr();
+  st->print_cr("References by class and ReferenceQueue state (as last seen by GC):");
+  st->print_cr(" num   #instances    #no queue       #queue     #unknown  type     class name");
+  st->print_cr("-------------------------------------------------------------------------------");
+  uint64_t total = 0;
+  for (int i = 0; i < entries.length(); i++) {
+    KlassInfoEntry* const e = entries.at(i);
+    const ReferenceType type = InstanceKlass::cast(e->klass())->reference_type();
+    st->print_cr("%4d:" UINT64_FORMAT_W(13) UINT64_FORMAT_W(13) UINT64_FORMAT_W(13) UINT64_FORMAT_W(13) "  %-8s %s",
+                 i + 1, e->count(),
+                 e->queue_state_count(java_lang_ref_Reference::queue_none),
+                 e->queue_state_count(java_lang_ref_Reference::queue_present),
+                 e->queue_state_count(java_lang_ref_Reference::queue_unknown),
+                 type_names[type], e->name());
+    total += e->count();
+  }
+  st->print_cr("Total" UINT64_FORMAT_W(13), total);
+}
+
 int KlassInfoHisto::sort_helper(KlassInfoEntry** e1, KlassInfoEntry** e2) {
   return (*e1)->compare(*e1,*e2);
 }
@@ -534,33 +649,59 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
+ParHeapInspectTask::~ParHeapInspectTask() {
+  delete _pending;
+}
+
 // Heap inspection for every worker.
 // When native OOM happens for KlassInfoTable, set _success to false.
 void ParHeapInspectTask::work(uint worker_id) {
-  uintx missed_count = 0;
-  bool merge_success = true;
   if (!AtomicAccess::load(&_success)) {
     // other worker has failed on parallel iteration.
     return;
   }
 
-  KlassInfoTable cit(false);
-  if (cit.allocation_failed()) {
+  KlassInfoTable* cit = new (std::nothrow) KlassInfoTable(false, _shared_cit->record_references());
+  if (cit == nullptr || cit->allocation_failed()) {
     // fail to allocate memory, stop parallel mode
+    delete cit;
     AtomicAccess::store(&_success, false);
     return;
   }
-  RecordInstanceClosure ric(&cit, _filter);
+  RecordInstanceClosure ric(cit, _filter);
   _poi->object_iterate(&ric, worker_id);
-  missed_count = ric.missed_count();
-  {
-    MutexLocker x(&_mutex, Mutex::_no_safepoint_check_flag);
-    merge_success = _shared_cit->merge(&cit);
+  AtomicAccess::add(&_missed_count, ric.missed_count());
+  reduce(cit);
+}
+
+void ParHeapInspectTask::reduce(KlassInfoTable* cit) {
+  while (true) {
+    KlassInfoTable* other = AtomicAccess::xchg(&_pending, (KlassInfoTable*)nullptr);
+    if (other == nullptr) {
+      if (AtomicAccess::cmpxchg(&_pending, (KlassInfoTable*)nullptr, cit) == nullptr) {
+        return;
+      }
+      // Another worker parked its table in the meantime, take that one.
+      continue;
+    }
+    const bool merge_success = cit->merge(other);
+    delete other;
+    if (!merge_success) {
+      delete cit;
+      AtomicAccess::store(&_success, false);
+      return;
+    }
   }
-  if (merge_success) {
-    AtomicAccess::add(&_missed_count, missed_count);
-  } else {
-    AtomicAccess::store(&_success, false);
+}
+
+void ParHeapInspectTask::merge_pending() {
+  KlassInfoTable* cit = _pending;
+  _pending = nullptr;
+  if (cit != nullptr) {
+    if (!_shared_cit->merge(cit)) {
+      _success = false;
+    }
+    delete cit;
   }
 }
 
@@ -572,6 +713,9 @@ uintx HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *fil
     ParHeapInspectTask task(&poi, cit, filter);
     // Run task with the active workers.
     workers->run_task(&task);
+    if (task.success()) {
+      task.merge_pending();
+    }
     if (task.success()) {
       return task.missed_count();
     }
@@ -584,10 +728,10 @@ uintx HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *fil
   return ric.missed_count();
 }
 
-void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers) {
+void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers, bool print_references) {
   ResourceMark rm;
 
-  KlassInfoTable cit(false);
+  KlassInfoTable cit(false, print_references);
   if (!cit.allocation_failed()) {
     // populate table with object allocation info
     uintx missed_count = populate_table(&cit, nullptr, workers);
@@ -605,12 +749,34 @@ void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers) {
 
     histo.sort();
     histo.print_histo_on(st);
+
+    if (print_references) {
+      cit.print_reference_histo_on(st);
+    }
   } else {
     st->print_cr("ERROR: Ran out of C-heap; histogram not generated");
   }
   st->flush();
 }
 
+void HeapInspection::reference_stats(outputStream* st, WorkerThreads* workers) {
+  ResourceMark rm;
+
+  KlassInfoTable cit(false, true /* record_references */);
+  if (!cit.allocation_failed()) {
+    uintx missed_count = populate_table(&cit, nullptr, workers);
+    if (missed_count != 0) {
+      log_info(gc, classhisto)("WARNING: Ran out of C-heap; undercounted %zu"
+                               " total instances in data below",
+                               missed_count);
+    }
+    cit.print_reference_stats_on(st);
+  } else {
+    st->print_cr("ERROR: Ran out of C-heap; reference statistics not generated");
+  }
+  st->flush();
+}
+
 class FindInstanceClosure : public ObjectClosure {
  private:
   Klass* _klass;
@@ -27,6 +27,7 @@
 
 #include "gc/shared/workerThread.hpp"
 #include "memory/allocation.hpp"
+#include "memory/referenceType.hpp"
 #include "oops/annotations.hpp"
 #include "oops/objArrayOop.hpp"
 #include "oops/oop.hpp"
@@ -42,6 +43,10 @@ class ParallelObjectIterator;
 // KlassInfoTable is a bucket hash table that
 // maps Klass*s to extra information:
 //    instance count and instance word size.
+// Recording instances goes through a small direct-mapped
+// cache of recently used entries in front of the buckets.
+// Optionally, the table also counts java.lang.ref.Reference
+// instances by reference type and ReferenceQueue state.
 //
 // A KlassInfoBucket is the head of a link list
 // of KlassInfoEntry's
@@ -51,6 +56,10 @@ class ParallelObjectIterator;
 // the entries.
 
 class KlassInfoEntry: public CHeapObj<mtInternal> {
+ public:
+  // Indexed by java_lang_ref_Reference::QueueState.
+  static const int num_queue_states = 3;
+
  private:
   KlassInfoEntry* _next;
   Klass*          _klass;
@@ -59,11 +68,13 @@ class KlassInfoEntry: public CHeapObj<mtInternal> {
   int64_t         _index;
   bool            _do_print; // True if we should print this class when printing the class hierarchy.
   GrowableArray<KlassInfoEntry*>* _subclasses;
+  // Instances by ReferenceQueue state, for Reference subclasses
+  uint64_t        _queue_state_counts[num_queue_states];
 
  public:
   KlassInfoEntry(Klass* k, KlassInfoEntry* next) :
     _next(next), _klass(k), _instance_count(0), _instance_words(0), _index(-1),
-    _do_print(false), _subclasses(nullptr)
+    _do_print(false), _subclasses(nullptr), _queue_state_counts()
   {}
   ~KlassInfoEntry();
   KlassInfoEntry* next() const   { return _next; }
@@ -73,6 +84,8 @@ class KlassInfoEntry: public CHeapObj<mtInternal> {
   void set_count(uint64_t ct)    { _instance_count = ct; }
   size_t words()  const          { return _instance_words; }
   void set_words(size_t wds)     { _instance_words = wds; }
+  uint64_t queue_state_count(int state) const { return _queue_state_counts[state]; }
+  void add_queue_state_count(int state, uint64_t ct) { _queue_state_counts[state] += ct; }
   void set_index(int64_t index)  { _index = index; }
   int64_t index()    const       { return _index; }
   GrowableArray<KlassInfoEntry*>* subclasses() const { return _subclasses; }
@@ -102,9 +115,13 @@ class KlassInfoBucket: public CHeapObj<mtInternal> {
   void iterate(KlassInfoClosure* cic);
 };
 
-class KlassInfoTable: public StackObj {
+class KlassInfoTable: public CHeapObj<mtInternal> {
+ public:
+  static const int num_queue_states = KlassInfoEntry::num_queue_states;
+
  private:
   static const int _num_buckets = 20011;
+  static const int _cache_size = 256;
   size_t _size_of_instances_in_words;
 
   // An aligned reference address (typically the least
@@ -112,13 +129,20 @@ class KlassInfoTable: public StackObj {
   uintptr_t _ref;
 
   KlassInfoBucket* _buckets;
+  KlassInfoEntry*  _cache[_cache_size];
+
+  bool   _record_references;
+  size_t _reference_counts[REF_PHANTOM + 1][num_queue_states];
+
   uint hash(const Klass* p);
   KlassInfoEntry* lookup(Klass* k); // allocates if not found!
+  KlassInfoEntry* cached_lookup(Klass* k);
+  void record_reference(KlassInfoEntry* elt, const oop obj, ReferenceType type);
 
   class AllClassesFinder;
 
  public:
-  KlassInfoTable(bool add_all_classes);
+  KlassInfoTable(bool add_all_classes, bool record_references = false);
   ~KlassInfoTable();
   bool record_instance(const oop obj);
   void iterate(KlassInfoClosure* cic);
@@ -127,6 +151,13 @@ class KlassInfoTable: public StackObj {
   bool merge(KlassInfoTable* table);
   bool merge_entry(const KlassInfoEntry* cie);
 
+  bool record_references() const { return _record_references; }
+  size_t reference_count(ReferenceType type, int queue_state) const {
+    return _reference_counts[type][queue_state];
+  }
+  void print_reference_histo_on(outputStream* st) const;
+  void print_reference_stats_on(outputStream* st);
+
   friend class KlassInfoHisto;
   friend class KlassHierarchy;
 };
@@ -199,7 +230,9 @@ class KlassInfoClosure;
 
 class HeapInspection : public StackObj {
  public:
-  void heap_inspection(outputStream* st, WorkerThreads* workers) NOT_SERVICES_RETURN;
+  void heap_inspection(outputStream* st, WorkerThreads* workers, bool print_references = false) NOT_SERVICES_RETURN;
+  // Prints the java.lang.ref.Reference instances by class and ReferenceQueue state
+  void reference_stats(outputStream* st, WorkerThreads* workers) NOT_SERVICES_RETURN;
   uintx populate_table(KlassInfoTable* cit, BoolObjectClosure* filter, WorkerThreads* workers) NOT_SERVICES_RETURN_(0);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
 };
@@ -207,6 +240,12 @@ class HeapInspection : public StackObj {
 // Parallel heap inspection task. Parallel inspection can fail due to
 // a native OOM when allocating memory for TL-KlassInfoTable.
 // _success will be set false on an OOM, and serial inspection tried.
+//
+// The worker tables are reduced without locking: a worker that finishes
+// either parks its table in _pending, or takes the table parked there,
+// merges it into its own and tries again. Merges of different tables thus
+// proceed in parallel, and at the end a single table is left in _pending
+// to be merged into the shared table.
 class ParHeapInspectTask : public WorkerTask {
  private:
   ParallelObjectIterator* _poi;
@@ -214,7 +253,9 @@ class ParHeapInspectTask : public WorkerTask {
   BoolObjectClosure* _filter;
   uintx _missed_count;
   bool _success;
-  Mutex _mutex;
+  KlassInfoTable* volatile _pending;
+
+  void reduce(KlassInfoTable* cit);
 
  public:
   ParHeapInspectTask(ParallelObjectIterator* poi,
@@ -226,7 +267,9 @@ class ParHeapInspectTask : public WorkerTask {
       _filter(filter),
       _missed_count(0),
       _success(true),
-      _mutex(Mutex::nosafepoint, "ParHeapInspectTask_lock") {}
+      _pending(nullptr) {}
+
+  ~ParHeapInspectTask();
 
   uintx missed_count() const {
     return _missed_count;
@@ -237,6 +280,9 @@ class ParHeapInspectTask : public WorkerTask {
   }
 
   virtual void work(uint worker_id);
+
+  // Merge the reduced worker tables into the shared table.
+  void merge_pending();
 };
 
 #endif // SHARE_MEMORY_HEAPINSPECTION_HPP
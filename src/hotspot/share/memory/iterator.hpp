@@ -80,6 +80,11 @@ class OopIterateClosure : public OopClosure {
  public:
   ReferenceDiscoverer* ref_discoverer() const { return _ref_discoverer; }
 
+  // The type of the ReferenceDiscoverer installed in the closure. Closures that
+  // are only ever given discoverers of one final type may redeclare this, which
+  // lets Devirtualizer::discover_reference take a non-virtual call.
+  typedef ReferenceDiscoverer ReferenceDiscovererType;
+
   // Iteration of InstanceRefKlasses differ depending on the closure,
   // the below enum describes the different alternatives.
   enum ReferenceIterationMode {
@@ -67,6 +67,13 @@ class InternalStats : public AllStatic {
   /* ... and died. */                               \
   x_atomic(num_arena_deaths)                        \
                                                     \
+  /* Number of times the lock of a */               \
+  /*  ClassLoaderMetaspace was found contended. */  \
+  x_atomic(num_arena_lock_contended)                \
+  /* Number of thread-local allocation buffers */   \
+  /*  carved from non-class arenas. */              \
+  x_atomic(num_alloc_buffer_refills)                \
+                                                    \
   /* Number of times VirtualSpaceNode were */       \
   /*  born...  */                                   \
   x(num_vsnodes_births)                             \
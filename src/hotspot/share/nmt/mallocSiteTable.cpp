@@ -181,8 +181,12 @@ MallocSite* MallocSiteTable::malloc_site(uint32_t marker) {
 // (pre-installed allocation site) has to be used to avoid infinite
 // recursion.
 MallocSiteHashtableEntry* MallocSiteTable::new_entry(const NativeCallStack& key, MemTag mem_tag) {
+  // When sampling, the entry is not recorded by any site rather than by its
+  // pre-installed site with a weight it was not sampled with.
+  const NativeCallStack& stack = MallocSampler::is_enabled() ? NativeCallStack::empty_stack()
+                                                             : *hash_entry_allocation_stack();
   void* p = AllocateHeap(sizeof(MallocSiteHashtableEntry), mtNMT,
-    *hash_entry_allocation_stack(), AllocFailStrategy::RETURN_NULL);
+    stack, AllocFailStrategy::RETURN_NULL);
   if (p == nullptr) {
     return nullptr;
   } else {
@@ -126,6 +126,9 @@ class MallocSiteTable : AllStatic {
 
   static bool initialize();
 
+  // Marker of a malloc that was not sampled, which has no malloc site
+  static uint32_t unsampled_marker() { return build_marker(MAX_MALLOCSITE_TABLE_SIZE, 0); }
+
   // Number of hash buckets
   static inline int hash_buckets()      { return (int)table_size; }
 
@@ -140,7 +143,8 @@ class MallocSiteTable : AllStatic {
     return false;
   }
 
-  // Record a new allocation from specified call path.
+  // Record a new allocation from specified call path, weighted if it was
+  // sampled, see MallocSampler.
   // Return true if the allocation is recorded successfully and updates marker
   // to indicate the entry where the allocation information was recorded.
   // Return false only occurs under rare scenarios:
@@ -149,7 +153,7 @@ class MallocSiteTable : AllStatic {
   static inline bool allocation_at(const NativeCallStack& stack, size_t size,
       uint32_t* marker, MemTag mem_tag) {
     MallocSite* site = lookup_or_add(stack, marker, mem_tag);
-    if (site != nullptr) site->allocate(size);
+    if (site != nullptr) site->allocate(MallocSampler::weight(size));
     return site != nullptr;
   }
 
@@ -158,7 +162,7 @@ class MallocSiteTable : AllStatic {
   static inline bool deallocation_at(size_t size, uint32_t marker) {
     MallocSite* site = malloc_site(marker);
     if (site != nullptr) {
-      site->deallocate(size);
+      site->deallocate(MallocSampler::weight(size));
       return true;
     }
     return false;
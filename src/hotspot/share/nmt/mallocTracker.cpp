@@ -159,12 +159,55 @@ bool MallocMemorySummary::category_limit_reached(MemTag mem_tag, size_t s, size_
   return true;
 }
 
+size_t MallocSampler::_interval = 0;
+THREAD_LOCAL size_t MallocSampler::_bytes_until_sample = 0;
+THREAD_LOCAL uint64_t MallocSampler::_rnd = 0;
+
+// Draws the distance to the next sample from an exponential distribution,
+// with the lrand64 generator also used by ThreadHeapSampler.
+void MallocSampler::pick_next_sample() {
+  const uint64_t PrngMult = 0x5DEECE66DLL;
+  const uint64_t PrngAdd = 0xB;
+  const uint64_t PrngModPower = 48;
+  const uint64_t PrngModMask = ((uint64_t)1 << PrngModPower) - 1;
+  _rnd = (PrngMult * _rnd + PrngAdd) & PrngModMask;
+  // Top 26 bits as a uniform value in (0, 1]
+  const double u = (static_cast<double>(_rnd >> (PrngModPower - 26)) + 1.0) / static_cast<double>(1 << 26);
+  _bytes_until_sample = static_cast<size_t>(-log(u) * static_cast<double>(_interval)) + 1;
+}
+
+bool MallocSampler::should_sample_slow(size_t size) {
+  if (_rnd == 0) {
+    // First malloc of this thread, pick its first sample point
+    _rnd = (static_cast<uint64_t>(p2i(&_bytes_until_sample)) >> 4) | 1;
+    pick_next_sample();
+    if (_bytes_until_sample > size) {
+      _bytes_until_sample -= size;
+      return false;
+    }
+  }
+  // The sample point falls into this malloc. Since the distribution is
+  // memoryless, the distance to the next one can be counted from its end.
+  pick_next_sample();
+  return true;
+}
+
+size_t MallocSampler::weight(size_t size) {
+  if (!is_enabled()) {
+    return size;
+  }
+  // A malloc of size bytes is sampled with probability 1 - exp(-size / interval)
+  const double p = -expm1(-static_cast<double>(size) / static_cast<double>(_interval));
+  return static_cast<size_t>(static_cast<double>(size) / p);
+}
+
 bool MallocTracker::initialize(NMT_TrackingLevel level) {
   if (level >= NMT_summary) {
     MallocMemorySummary::initialize();
   }
 
   if (level == NMT_detail) {
+    MallocSampler::initialize(NativeMemoryTrackingSampleInterval);
     return MallocSiteTable::initialize();
   }
   return true;
@@ -180,7 +223,12 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MemTag mem_ta
   MallocMemorySummary::record_malloc(size, mem_tag);
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::allocation_at(stack, size, &mst_marker, mem_tag);
+    if (MallocSampler::is_enabled() && stack.is_empty()) {
+      // Not sampled, see MALLOC_CALLER_PC
+      mst_marker = MallocSiteTable::unsampled_marker();
+    } else {
+      MallocSiteTable::allocation_at(stack, size, &mst_marker, mem_tag);
+    }
   }
 
   // Uses placement global new operator to initialize malloc header
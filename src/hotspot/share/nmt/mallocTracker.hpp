@@ -261,6 +261,41 @@ class MallocMemorySummary : AllStatic {
 
 };
 
+// Samples the malloced bytes for NativeMemoryTracking=detail when
+// NativeMemoryTrackingSampleInterval is set, the way ThreadHeapSampler samples
+// Java heap allocations: the number of bytes between two samples taken by a
+// thread is exponentially distributed, with the interval as mean. Only sampled
+// mallocs walk their stack and are recorded in the MallocSiteTable, weighted by
+// the inverse of their probability of being sampled, so that the sizes of the
+// malloc sites are unbiased estimates.
+class MallocSampler : AllStatic {
+  static size_t _interval;
+  static THREAD_LOCAL size_t _bytes_until_sample;
+  static THREAD_LOCAL uint64_t _rnd;
+
+  static void pick_next_sample();
+  static bool should_sample_slow(size_t size);
+
+ public:
+  static void initialize(size_t interval) { _interval = interval; }
+  static bool is_enabled() { return _interval > 0; }
+
+  // Decides, before the stack is walked, whether a malloc of size bytes is sampled
+  static inline bool should_sample(size_t size) {
+    if (!is_enabled()) {
+      return true;
+    }
+    if (_bytes_until_sample > size) {
+      _bytes_until_sample -= size;
+      return false;
+    }
+    return should_sample_slow(size);
+  }
+
+  // The estimated number of bytes a sampled malloc of size bytes stands for
+  static size_t weight(size_t size);
+};
+
 // Main class called from MemTracker to track malloc activities
 class MallocTracker : AllStatic {
  public:
@@ -313,6 +313,12 @@ void MemDetailReporter::report_detail() {
   outputStream* out = output();
   out->print_cr("Details:\n");
 
+  if (MallocSampler::is_enabled()) {
+    out->print_cr("(Malloc sites are sampled once every %zu bytes on average: their sizes are "
+                  "estimates and their counts are the number of sampled mallocs.)\n",
+                  NativeMemoryTrackingSampleInterval);
+  }
+
   int num_omitted =
       report_malloc_sites() +
       report_virtual_memory_allocation_sites();
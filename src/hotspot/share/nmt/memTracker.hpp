@@ -42,6 +42,15 @@
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
 
+// Variants for a malloc of size bytes, which only walk the stack if the
+// malloc is sampled, see MallocSampler. Other mallocs get an empty stack.
+#define MALLOC_CURRENT_PC(size) ((MemTracker::tracking_level() == NMT_detail) ?        \
+                                 (MallocSampler::should_sample(size) ?                 \
+                                  NativeCallStack(0) : NativeCallStack()) : FAKE_CALLSTACK)
+#define MALLOC_CALLER_PC(size)  ((MemTracker::tracking_level() == NMT_detail) ?        \
+                                 (MallocSampler::should_sample(size) ?                 \
+                                  NativeCallStack(1) : NativeCallStack()) : FAKE_CALLSTACK)
+
 class MemTracker : AllStatic {
   friend class VirtualMemoryTrackerTest;
 
@@ -213,6 +222,27 @@ class MemTracker : AllStatic {
     MemoryFileTracker::Instance::free_memory(file, offset, size);
   }
 
+  // Batched variants of the above, registering count ranges sorted by offset
+  // under a single lock and call stack
+  static inline void allocate_memory_in(MemoryFileTracker::MemoryFile* file,
+                                        const VMATree::MappingRange* ranges, int count,
+                                        const NativeCallStack& stack, MemTag mem_tag) {
+    assert_post_init();
+    if (!enabled()) return;
+    assert(file != nullptr, "must be");
+    NmtVirtualMemoryLocker nvml;
+    MemoryFileTracker::Instance::allocate_memory(file, ranges, count, stack, mem_tag);
+  }
+
+  static inline void free_memory_in(MemoryFileTracker::MemoryFile* file,
+                                    const VMATree::MappingRange* ranges, int count) {
+    assert_post_init();
+    if (!enabled()) return;
+    assert(file != nullptr, "must be");
+    NmtVirtualMemoryLocker nvml;
+    MemoryFileTracker::Instance::free_memory(file, ranges, count);
+  }
+
   // Given an existing memory mapping registered with NMT and a splitting
   //  address, split the mapping in two. The memory region is supposed to
   //  be fully uncommitted.
@@ -37,6 +37,14 @@ DeferredStatic<MemoryFileTracker> MemoryFileTracker::Instance::_tracker;
 MemoryFileTracker::MemoryFileTracker(bool is_detailed_mode)
   : _stack_storage(is_detailed_mode), _files() {}
 
+void MemoryFileTracker::apply_summary_diff(MemoryFile* file, const VMATree::SummaryDiff& diff) {
+  for (int i = 0; i < mt_number_of_tags; i++) {
+    VirtualMemory* summary = file->_summary.by_tag(NMTUtil::index_to_tag(i));
+    summary->reserve_memory(diff.tag[i].commit);
+    summary->commit_memory(diff.tag[i].commit);
+  }
+}
+
 void MemoryFileTracker::allocate_memory(MemoryFile* file, size_t offset,
                                         size_t size, const NativeCallStack& stack,
                                         MemTag mem_tag) {
@@ -44,21 +52,28 @@ void MemoryFileTracker::allocate_memory(MemoryFile* file, size_t offset,
   VMATree::RegionData regiondata(sidx, mem_tag);
   VMATree::SummaryDiff diff;
   file->_tree.commit_mapping(offset, size, regiondata, diff);
-  for (int i = 0; i < mt_number_of_tags; i++) {
-    VirtualMemory* summary = file->_summary.by_tag(NMTUtil::index_to_tag(i));
-    summary->reserve_memory(diff.tag[i].commit);
-    summary->commit_memory(diff.tag[i].commit);
-  }
+  apply_summary_diff(file, diff);
 }
 
 void MemoryFileTracker::free_memory(MemoryFile* file, size_t offset, size_t size) {
   VMATree::SummaryDiff diff;
   file->_tree.release_mapping(offset, size, diff);
-  for (int i = 0; i < mt_number_of_tags; i++) {
-    VirtualMemory* summary = file->_summary.by_tag(NMTUtil::index_to_tag(i));
-    summary->reserve_memory(diff.tag[i].commit);
-    summary->commit_memory(diff.tag[i].commit);
-  }
+  apply_summary_diff(file, diff);
+}
+
+void MemoryFileTracker::allocate_memory(MemoryFile* file, const VMATree::MappingRange* ranges, int count,
+                                        const NativeCallStack& stack, MemTag mem_tag) {
+  NativeCallStackStorage::StackIndex sidx = _stack_storage.push(stack);
+  VMATree::RegionData regiondata(sidx, mem_tag);
+  VMATree::SummaryDiff diff;
+  file->_tree.commit_mappings(ranges, count, regiondata, diff);
+  apply_summary_diff(file, diff);
+}
+
+void MemoryFileTracker::free_memory(MemoryFile* file, const VMATree::MappingRange* ranges, int count) {
+  VMATree::SummaryDiff diff;
+  file->_tree.release_mappings(ranges, count, diff);
+  apply_summary_diff(file, diff);
 }
 
 void MemoryFileTracker::print_report_on(const MemoryFile* file, outputStream* stream, size_t scale) {
@@ -144,6 +159,16 @@ void MemoryFileTracker::Instance::free_memory(MemoryFile* file, size_t offset, s
   _tracker->free_memory(file, offset, size);
 }
 
+void MemoryFileTracker::Instance::allocate_memory(MemoryFile* file, const VMATree::MappingRange* ranges,
+                                                  int count, const NativeCallStack& stack,
+                                                  MemTag mem_tag) {
+  _tracker->allocate_memory(file, ranges, count, stack, mem_tag);
+}
+
+void MemoryFileTracker::Instance::free_memory(MemoryFile* file, const VMATree::MappingRange* ranges, int count) {
+  _tracker->free_memory(file, ranges, count);
+}
+
 MemoryFileTracker::MemoryFile*
 MemoryFileTracker::Instance::make_file(const char* descriptive_name) {
   return _tracker->make_file(descriptive_name);
@@ -67,9 +67,18 @@ class MemoryFileTracker {
 public:
   MemoryFileTracker(bool is_detailed_mode);
 
+private:
+  static void apply_summary_diff(MemoryFile* file, const VMATree::SummaryDiff& diff);
+
+public:
+
   void allocate_memory(MemoryFile* file, size_t offset, size_t size, const NativeCallStack& stack,
                        MemTag mem_tag);
   void free_memory(MemoryFile* file, size_t offset, size_t size);
+  // Batched variants, see VMATree::commit_mappings
+  void allocate_memory(MemoryFile* file, const VMATree::MappingRange* ranges, int count,
+                       const NativeCallStack& stack, MemTag mem_tag);
+  void free_memory(MemoryFile* file, const VMATree::MappingRange* ranges, int count);
 
   MemoryFile* make_file(const char* descriptive_name);
   void free_file(MemoryFile* file);
@@ -104,6 +113,9 @@ class MemoryFileTracker {
     static void allocate_memory(MemoryFile* device, size_t offset, size_t size,
                                 const NativeCallStack& stack, MemTag mem_tag);
     static void free_memory(MemoryFile* device, size_t offset, size_t size);
+    static void allocate_memory(MemoryFile* device, const VMATree::MappingRange* ranges, int count,
+                                const NativeCallStack& stack, MemTag mem_tag);
+    static void free_memory(MemoryFile* device, const VMATree::MappingRange* ranges, int count);
 
     template<typename F>
     static void iterate_summary(F f) {
@@ -242,6 +242,24 @@ void VMATree::update_region(TNode* n1, TNode* n2, const RequestInfo& req, Summar
 }
 
 
+void VMATree::register_mappings(const MappingRange* ranges, int count, StateType state,
+                                const RegionData& metadata, VMATree::SummaryDiff& diff, bool use_tag_inplace) {
+  diff.clear();
+  SummaryDiff range_diff;
+  int i = 0;
+  while (i < count) {
+    const position from = ranges[i].from;
+    position to = ranges[i].to;
+    // Merge the abutting ranges which follow
+    for (i++; i < count && ranges[i].from == to; i++) {
+      to = ranges[i].to;
+    }
+    assert(i == count || ranges[i].from > to, "ranges must be sorted and must not overlap");
+    register_mapping(from, to, state, metadata, range_diff, use_tag_inplace);
+    diff.add(range_diff);
+  }
+}
+
 void VMATree::register_mapping(position _A, position _B, StateType state,
                                                const RegionData& metadata, VMATree::SummaryDiff& diff, bool use_tag_inplace) {
 
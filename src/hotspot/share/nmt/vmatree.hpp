@@ -285,8 +285,15 @@ class VMATree : public CHeapObjBase {
     }
   };
 
+ // A range [from, to) of a batch of mappings, see register_mappings
+  struct MappingRange {
+    position from;
+    position to;
+  };
+
  private:
   void register_mapping(position A, position B, StateType state, const RegionData& metadata, SummaryDiff& diff, bool use_tag_inplace = false);
+  void register_mappings(const MappingRange* ranges, int count, StateType state, const RegionData& metadata, SummaryDiff& diff, bool use_tag_inplace = false);
   StateType get_new_state(const StateType existinting_state, const RequestInfo& req) const;
   MemTag get_new_tag(const MemTag existinting_tag, const RequestInfo& req) const;
   SIndex get_new_reserve_callstack(const SIndex existinting_stack, const StateType ex, const RequestInfo& req) const;
@@ -323,6 +330,22 @@ class VMATree : public CHeapObjBase {
     register_mapping(from, from + sz, StateType::Released, VMATree::empty_regiondata, diff);
   }
 
+  // Batched variants, applying the same mapping to count ranges sorted by
+  // address and not overlapping, such as the segments committed by a GC in one
+  // go. Abutting ranges are merged into a single update of the tree, and diff
+  // is the sum of the diffs of all the ranges.
+  void commit_mappings(const MappingRange* ranges, int count, const RegionData& metadata, SummaryDiff& diff) {
+    register_mappings(ranges, count, StateType::Committed, metadata, diff, false);
+  }
+
+  void uncommit_mappings(const MappingRange* ranges, int count, const RegionData& metadata, SummaryDiff& diff) {
+    register_mappings(ranges, count, StateType::Reserved, metadata, diff, true);
+  }
+
+  void release_mappings(const MappingRange* ranges, int count, SummaryDiff& diff) {
+    register_mappings(ranges, count, StateType::Released, VMATree::empty_regiondata, diff);
+  }
+
 public:
   template<typename F>
   void visit_in_order(F f) const {
@@ -71,7 +71,7 @@ bool InstanceRefKlass::try_discover(oop obj, ReferenceType type, OopClosureType*
     if (referent != nullptr) {
       if (!referent->is_gc_marked()) {
         // Only try to discover if not yet marked.
-        return rd->discover_reference(obj, type);
+        return Devirtualizer::discover_reference(closure, obj, type);
       }
     }
   }
@@ -105,7 +105,7 @@ void InstanceRefKlass::oop_oop_iterate_fields_except_referent(oop obj, OopClosur
 
 template <typename T, class OopClosureType, class Contains>
 void InstanceRefKlass::oop_oop_iterate_ref_processing(oop obj, OopClosureType* closure, Contains& contains) {
-  switch (closure->reference_iteration_mode()) {
+  switch (Devirtualizer::reference_iteration_mode(closure)) {
     case OopIterateClosure::DO_DISCOVERY:
       trace_reference_gc<T>("do_discovery", obj);
       oop_oop_iterate_discovery<T>(obj, reference_type(), closure, contains);
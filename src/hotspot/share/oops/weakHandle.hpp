@@ -40,6 +40,7 @@ class OopStorage;
 // depending on the type.
 
 class WeakHandle {
+  friend class JvmtiTagMapTable;
  public:
  private:
   oop* _obj;
@@ -41,6 +41,8 @@ inline oop WeakHandle::peek() const {
 
 inline void WeakHandle::replace(oop with_obj) {
   assert(!is_empty(), "Must not use replace on empty handle");
+  // Weak processing skips entries it has cleared, see OopStorage::ParState
+  assert(with_obj == nullptr || peek() != nullptr, "Must not revive a cleared handle");
   NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(_obj, with_obj);
 }
 
@@ -560,6 +560,12 @@
   develop(bool, PrintEscapeAnalysis, false,                                 \
           "Print the results of escape analysis")                           \
                                                                             \
+  product(uintx, C2PhaseTimesLogThreshold, 1000, DIAGNOSTIC,                \
+          "Write the time spent in each phase of C2 compilations taking "   \
+          "at least this many milliseconds to the compilation log. "        \
+          "0 disables")                                                     \
+          range(0, max_uintx)                                               \
+                                                                            \
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
@@ -778,6 +784,10 @@
   product(bool, OptimizeExpensiveOps, true, DIAGNOSTIC,                     \
           "Find best control for expensive operations")                     \
                                                                             \
+  product(bool, ElideCompareOnlyKeepAlive, false, DIAGNOSTIC,               \
+          "Load the referent without keeping it alive when the result of "  \
+          "Reference.get() is only compared, like Reference.refersTo()")    \
+                                                                            \
   product(bool, UseMathExactIntrinsics, true, DIAGNOSTIC,                   \
           "Enables intrinsification of various java.lang.Math functions")   \
                                                                             \
@@ -632,6 +632,8 @@ Compile::Compile(ciEnv* ci_env, ciMethod* target, int osr_bci,
                  Options options, DirectiveSet* directive)
     : Phase(Compiler),
       _compile_id(ci_env->compile_id()),
+      _start_ticks(os::elapsed_counter()),
+      _phase_ticks(),
       _options(options),
       _method(target),
       _entry_bci(osr_bci),
@@ -893,6 +895,29 @@ Compile::Compile(ciEnv* ci_env, ciMethod* target, int osr_bci,
 
   // Now generate code
   Code_Gen();
+
+  log_phase_times();
+}
+
+// Write the time spent in each phase of an unusually long compilation to the
+// compilation log. Nested phases are included in the time of their parents.
+void Compile::log_phase_times() {
+  if (log() == nullptr || C2PhaseTimesLogThreshold == 0) {
+    return;
+  }
+  const double total_ms = TimeHelper::counter_to_millis(os::elapsed_counter() - _start_ticks);
+  if (total_ms < (double)C2PhaseTimesLogThreshold) {
+    return;
+  }
+  log()->begin_head("phase_times total='%.3f'", total_ms);
+  log()->end_head();
+  for (int id = 0; id < max_phase_timers; id++) {
+    const char* name = Phase::get_phase_trace_id_text((PhaseTraceId)id);
+    if (_phase_ticks[id] > 0 && name[0] != '\0') {
+      log()->elem("phase_time name='%s' time='%.3f'", name, TimeHelper::counter_to_millis(_phase_ticks[id]));
+    }
+  }
+  log()->tail("phase_times");
 }
 
 //------------------------------Compile----------------------------------------
@@ -908,6 +933,8 @@ Compile::Compile(ciEnv* ci_env,
                  DirectiveSet* directive)
     : Phase(Compiler),
       _compile_id(0),
+      _start_ticks(os::elapsed_counter()),
+      _phase_ticks(),
       _options(Options::for_runtime_stub()),
       _method(nullptr),
       _entry_bci(InvocationEntryBci),
@@ -4457,7 +4484,9 @@ Compile::TracePhase::TracePhase(const char* name, PhaseTraceId id)
   : TraceTime(name, &Phase::timers[id], CITime, CITimeVerbose),
     _compile(Compile::current()),
     _log(nullptr),
-    _dolog(CITimeVerbose)
+    _dolog(CITimeVerbose),
+    _id(id),
+    _start_ticks(os::elapsed_counter())
 {
   assert(_compile != nullptr, "sanity check");
   assert(id != PhaseTraceId::_t_none, "Don't use none");
@@ -4480,6 +4509,7 @@ Compile::TracePhase::TracePhase(PhaseTraceId id)
   : TracePhase(Phase::get_phase_trace_id_text(id), id) {}
 
 Compile::TracePhase::~TracePhase() {
+  _compile->_phase_ticks[_id] += os::elapsed_counter() - _start_ticks;
 
   // Inform memory statistic, if enabled
   if (CompilationMemoryStatistic::enabled()) {
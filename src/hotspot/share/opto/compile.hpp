@@ -239,6 +239,8 @@ class Compile : public Phase {
     Compile* const _compile;
     CompileLog* _log;
     const bool _dolog;
+    const PhaseTraceId _id;
+    const jlong _start_ticks;
    public:
     TracePhase(PhaseTraceId phaseTraceId);
     TracePhase(const char* name, PhaseTraceId phaseTraceId);
@@ -301,6 +303,8 @@ class Compile : public Phase {
  private:
   // Fixed parameters to this compilation.
   const int             _compile_id;
+  const jlong           _start_ticks;           // os::elapsed_counter() at start of compilation
+  jlong                 _phase_ticks[max_phase_timers]; // Time spent in each TracePhase
   const Options         _options;               // Compilation options
   ciMethod*             _method;                // The method being compiled.
   int                   _entry_bci;             // entry bci for osr methods.
@@ -681,6 +685,8 @@ class Compile : public Phase {
   void begin_method();
   void end_method();
 
+  void log_phase_times();
+
   void print_method(CompilerPhaseType compile_phase, int level, Node* n = nullptr);
 
 #ifndef PRODUCT
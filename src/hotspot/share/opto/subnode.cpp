@@ -1118,6 +1118,14 @@ Node *CmpPNode::Ideal( PhaseGVN *phase, bool can_reshape ) {
     }
   }
 
+  // A null check is the only use of a decoded narrow oop, as when counting
+  // the non-null elements of an object array. Compare the narrow oop itself
+  // so that the DecodeN goes away and SuperWord can vectorize the LoadN.
+  if (can_reshape && in(1)->is_DecodeN() && in(1)->outcnt() == 1 &&
+      phase->type(in(2)) == TypePtr::NULL_PTR) {
+    return new CmpNNode(in(1)->in(1), phase->makecon(TypeNarrowOop::NULL_PTR));
+  }
+
   // Constant pointer on right?
   const TypeKlassPtr* t2 = phase->type(in(2))->isa_klassptr();
   if (t2 == nullptr || !t2->klass_is_exact())
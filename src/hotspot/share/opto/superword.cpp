@@ -155,7 +155,7 @@ void SuperWord::unrolling_analysis(const VLoop &vloop, int &local_loop_unroll_fa
     // Ignore nodes with non-primitive type.
     BasicType bt;
     if (n->is_Mem()) {
-      bt = n->as_Mem()->value_basic_type();
+      bt = SuperWord::mem_value_basic_type(n->as_Mem());
     } else {
       bt = n->bottom_type()->basic_type();
     }
@@ -188,7 +188,7 @@ void SuperWord::unrolling_analysis(const VLoop &vloop, int &local_loop_unroll_fa
       BasicType bt;
       Node* n = lpt->_body.at(i);
       if (n->is_Mem()) {
-        bt = n->as_Mem()->value_basic_type();
+        bt = SuperWord::mem_value_basic_type(n->as_Mem());
       } else {
         bt = n->bottom_type()->basic_type();
       }
@@ -562,6 +562,15 @@ void SuperWord::create_adjacent_memop_pairs() {
 #endif
 }
 
+// Basic type of the values loaded or stored by 'mem', as far as vectorization
+// is concerned. Narrow oops which are only null checked are treated as ints.
+BasicType SuperWord::mem_value_basic_type(MemNode* mem) {
+  if (VectorNode::is_null_checked_narrow_oop_load(mem)) {
+    return T_INT;
+  }
+  return mem->value_basic_type();
+}
+
 // Collect all memops that could potentially be vectorized.
 void SuperWord::collect_valid_memops(GrowableArray<MemOp>& memops) const {
   int original_index = 0;
@@ -569,7 +578,7 @@ void SuperWord::collect_valid_memops(GrowableArray<MemOp>& memops) const {
     const VPointer& p = vpointer(mem);
     if (p.is_valid() &&
         !mem->is_LoadStore() &&
-        is_java_primitive(mem->value_basic_type())) {
+        is_java_primitive(mem_value_basic_type(mem))) {
       memops.append(MemOp(mem, &p, original_index++));
     }
   });
@@ -739,8 +748,8 @@ bool SuperWord::are_adjacent_refs(Node* s1, Node* s2) const {
   if (!in_bb(s1)    || !in_bb(s2))    return false;
 
   // Do not use superword for non-primitives
-  if (!is_java_primitive(s1->as_Mem()->value_basic_type()) ||
-      !is_java_primitive(s2->as_Mem()->value_basic_type())) {
+  if (!is_java_primitive(mem_value_basic_type(s1->as_Mem())) ||
+      !is_java_primitive(mem_value_basic_type(s2->as_Mem()))) {
     return false;
   }
 
@@ -2636,7 +2645,7 @@ void VLoopTypes::compute_vector_element_type() {
 const Type* VLoopTypes::container_type(Node* n) const {
   int opc = n->Opcode();
   if (n->is_Mem()) {
-    BasicType bt = n->as_Mem()->value_basic_type();
+    BasicType bt = SuperWord::mem_value_basic_type(n->as_Mem());
     if (n->is_Store() && (bt == T_CHAR)) {
       // Use T_SHORT type instead of T_CHAR for stored values because any
       // preceding arithmetic operation extends values to signed Int.
@@ -261,6 +261,7 @@ int VectorNode::opcode(int sopc, BasicType bt) {
   case Op_LoadL:
   case Op_LoadF:
   case Op_LoadD:
+  case Op_LoadN: // Only null checked, see is_null_checked_narrow_oop_load
     return Op_LoadVector;
 
   case Op_StoreB:
@@ -335,6 +336,23 @@ bool VectorNode::is_muladds2i(const Node* n) {
   return n->Opcode() == Op_MulAddS2I;
 }
 
+// A narrow oop load that needs no GC barrier and is only compared against
+// null can be vectorized as a load of ints: the compressed null is zero
+// whatever the encoding.
+bool VectorNode::is_null_checked_narrow_oop_load(Node* n) {
+  if (n->Opcode() != Op_LoadN || n->as_Load()->barrier_data() != 0 || n->outcnt() == 0) {
+    return false;
+  }
+  for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+    Node* use = n->fast_out(i);
+    if (use->Opcode() != Op_CmpN || use->in(1) != n ||
+        use->in(2)->bottom_type() != TypeNarrowOop::NULL_PTR) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool VectorNode::is_roundopD(Node* n) {
   return n->Opcode() == Op_RoundDoubleMode;
 }
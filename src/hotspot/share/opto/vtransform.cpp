@@ -1044,6 +1044,11 @@ float VTransformReplicateNode::cost(const VLoopAnalyzer& vloop_analyzer) const {
 
 VTransformApplyResult VTransformReplicateNode::apply(VTransformApplyState& apply_state) const {
   Node* val = apply_state.transformed_node(in_req(1));
+  if (val->bottom_type() == TypeNarrowOop::NULL_PTR) {
+    // Null check of narrow oops loaded as ints, see VectorNode::is_null_checked_narrow_oop_load.
+    assert(_element_type == T_INT, "narrow oops are vectorized as ints");
+    val = apply_state.phase()->intcon(0);
+  }
   VectorNode* vn = VectorNode::scalar2vector(val, _vlen, _element_type);
   register_new_node_from_vectorization(apply_state, vn);
   return VTransformApplyResult::make_vector(vn);
@@ -74,6 +74,7 @@
 #include "runtime/atomicAccess.hpp"
 #include "runtime/continuation.hpp"
 #include "runtime/deoptimization.hpp"
+#include "runtime/finalizerThread.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/handshake.hpp"
@@ -714,6 +715,12 @@ JVM_LEAF(jboolean, JVM_IsFinalizationEnabled(JNIEnv * env))
   return InstanceKlass::is_finalization_enabled();
 JVM_END
 
+JVM_ENTRY(void, JVM_RunFinalization(JNIEnv * env))
+  if (FinalizerThread::is_active()) {
+    FinalizerThread::run_finalization(THREAD);
+  }
+JVM_END
+
 // jdk.internal.vm.Continuation /////////////////////////////////////////////////////
 
 JVM_ENTRY(void, JVM_RegisterContinuationMethods(JNIEnv *env, jclass cls))
@@ -2974,10 +2981,17 @@ JVM_END
 
 
 JVM_ENTRY(jobject, JVM_GetAndClearReferencePendingList(JNIEnv* env))
-  MonitorLocker ml(Heap_lock);
-  oop ref = Universe::reference_pending_list();
-  if (ref != nullptr) {
-    Universe::clear_reference_pending_list();
+  oop ref;
+  {
+    MonitorLocker ml(Heap_lock);
+    ref = Universe::reference_pending_list();
+    if (ref != nullptr) {
+      Universe::clear_reference_pending_list();
+    }
+  }
+  if (ref != nullptr && FinalizerThread::is_active()) {
+    // Hand the Finalizers directly to the VM finalizer threads
+    ref = FinalizerThread::take_finalizers(ref, thread);
   }
   return JNIHandles::make_local(THREAD, ref);
 JVM_END
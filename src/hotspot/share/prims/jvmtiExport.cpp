@@ -742,6 +742,7 @@ void JvmtiExport::initialize_oop_storage() {
   _jvmti_oop_storage = OopStorageSet::create_strong("JVMTI OopStorage", mtServiceability);
   _weak_tag_storage  = OopStorageSet::create_weak("JVMTI Tag Weak OopStorage", mtServiceability);
   _weak_tag_storage->register_num_dead_callback(&JvmtiTagMap::gc_notification);
+  _weak_tag_storage->register_dead_entries_callback(&JvmtiTagMap::record_dead_handles);
 }
 
 // Lookup an agent from an JvmtiEnv. Return agent only if it is not yet initialized.
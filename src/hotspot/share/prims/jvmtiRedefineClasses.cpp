@@ -25,7 +25,7 @@
 #include "cds/aotMetaspace.hpp"
 #include "cds/cdsConfig.hpp"
 #include "classfile/classFileStream.hpp"
-#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/classLoadInfo.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/klassFactory.hpp"
@@ -37,6 +37,8 @@
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -281,8 +283,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  adjust_and_clean_metadata(current);
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -3777,6 +3778,62 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
   }
 }
 
+// The classes are handed out to the workers in chunks of an array
+// collected up front, rather than per CLD, since most of the classes
+// usually belong to a handful of class loaders.
+class VM_RedefineClasses::AdjustAndCleanMetadataTask : public WorkerTask {
+  static const int ChunkSize = 64;
+
+  const GrowableArray<Klass*>* _klasses;
+  volatile int _claimed;
+
+public:
+  AdjustAndCleanMetadataTask(const GrowableArray<Klass*>* klasses) :
+    WorkerTask("Adjust and Clean Metadata"),
+    _klasses(klasses),
+    _claimed(0) {}
+
+  void work(uint worker_id) {
+    AdjustAndCleanMetadata adjust_and_clean(Thread::current());
+    for (;;) {
+      int start = AtomicAccess::fetch_then_add(&_claimed, ChunkSize);
+      if (start >= _klasses->length()) {
+        return;
+      }
+      int end = MIN2(start + ChunkSize, _klasses->length());
+      for (int i = start; i < end; i++) {
+        adjust_and_clean.do_klass(_klasses->at(i));
+      }
+    }
+  }
+};
+
+void VM_RedefineClasses::adjust_and_clean_metadata(Thread* current) {
+  const int parallel_threshold = 4096;
+
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr && workers->active_workers() > 1 &&
+      ClassLoaderDataGraph::num_instance_classes() >= (size_t)parallel_threshold) {
+    class CollectKlasses : public KlassClosure {
+      GrowableArray<Klass*>* _klasses;
+     public:
+      CollectKlasses(GrowableArray<Klass*>* klasses) : _klasses(klasses) {}
+      void do_klass(Klass* k) { _klasses->append(k); }
+    };
+
+    ResourceMark rm(current);
+    GrowableArray<Klass*> klasses(parallel_threshold);
+    CollectKlasses collect(&klasses);
+    ClassLoaderDataGraph::classes_do(&collect);
+
+    AdjustAndCleanMetadataTask task(&klasses);
+    workers->run_task(&task);
+  } else {
+    AdjustAndCleanMetadata adjust_and_clean(current);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean);
+  }
+}
+
 void VM_RedefineClasses::update_jmethod_ids() {
   for (int j = 0; j < _matching_methods_length; ++j) {
     Method* old_method = _matching_old_methods[j];
@@ -499,6 +499,10 @@ class VM_RedefineClasses: public VM_Operation {
 
   void flush_dependent_code();
 
+  // Run AdjustAndCleanMetadata over all classes, using the safepoint
+  // workers when there are enough classes to make it worthwhile.
+  void adjust_and_clean_metadata(Thread* current);
+
   // lock classes to redefine since constant pool merging isn't thread safe.
   void lock_classes();
   void unlock_classes();
@@ -526,6 +530,8 @@ class VM_RedefineClasses: public VM_Operation {
     void do_klass(Klass* k);
   };
 
+  class AdjustAndCleanMetadataTask;
+
  public:
   VM_RedefineClasses(jint class_count,
                      const jvmtiClassDefinition *class_defs,
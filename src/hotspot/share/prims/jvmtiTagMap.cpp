@@ -72,13 +72,17 @@
 typedef ObjectBitSet<mtServiceability> JVMTIBitSet;
 
 bool JvmtiTagMap::_has_object_free_events = false;
+JvmtiDeadHandles* JvmtiTagMap::_gc_dead_handles = nullptr;
+bool JvmtiTagMap::_gc_dead_handles_complete = true;
 
 // create a JvmtiTagMap
 JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
   _env(env),
   _lock(Mutex::nosafepoint, "JvmtiTagMap_lock"),
   _needs_cleaning(false),
-  _posting_events(false) {
+  _posting_events(false),
+  _dead_handles(),
+  _dead_handles_complete(true) {
 
   assert(JvmtiThreadState_lock->is_locked(), "sanity check");
   assert(((JvmtiEnvBase *)env)->tag_map() == nullptr, "tag map already exists for environment");
@@ -107,6 +111,8 @@ JvmtiTagMap::~JvmtiTagMap() {
 void JvmtiTagMap::clear() {
   MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
   _hashmap->clear();
+  _dead_handles.clear_and_deallocate();
+  _dead_handles_complete = true;
 }
 
 // returns the tag map for the given environments. If the tag map
@@ -1173,9 +1179,17 @@ void JvmtiTagMap::remove_dead_entries_locked(GrowableArray<jlong>* objects) {
     if (!env()->is_enabled(JVMTI_EVENT_OBJECT_FREE)) {
       objects = nullptr;
     }
-    log_info(jvmti, table)("TagMap table needs cleaning%s",
-                           ((objects != nullptr) ? " and posting" : ""));
-    hashmap()->remove_dead_entries(objects);
+    log_info(jvmti, table)("TagMap table needs cleaning%s, %s",
+                           ((objects != nullptr) ? " and posting" : ""),
+                           (_dead_handles_complete ? "by cleared handles" : "by table scan"));
+    if (_dead_handles_complete) {
+      // Only look at the entries of the handles the GCs cleared
+      hashmap()->remove_dead_entries(&_dead_handles, objects);
+    } else {
+      hashmap()->remove_dead_entries(objects);
+    }
+    _dead_handles.clear_and_deallocate();
+    _dead_handles_complete = true;
     _needs_cleaning = false;
   }
 }
@@ -3106,13 +3120,19 @@ void JvmtiTagMap::follow_references(jint heap_filter,
 // Verify gc_notification follows set_needs_cleaning.
 DEBUG_ONLY(static bool notified_needs_cleaning = false;)
 
-void JvmtiTagMap::set_needs_cleaning() {
+void JvmtiTagMap::set_needs_cleaning(bool reports_dead_handles) {
   assert(SafepointSynchronize::is_at_safepoint(), "called in gc pause");
   assert(Thread::current()->is_VM_thread(), "should be the VM thread");
   // Can't assert !notified_needs_cleaning; a partial GC might be upgraded
   // to a full GC and do this twice without intervening gc_notification.
   DEBUG_ONLY(notified_needs_cleaning = true;)
 
+  if (!reports_dead_handles) {
+    // The tag maps must be scanned to find the cleared entries
+    MutexLocker ml(JvmtiTagMapDead_lock, Mutex::_no_safepoint_check_flag);
+    _gc_dead_handles_complete = false;
+  }
+
   JvmtiEnvIterator it;
   for (JvmtiEnv* env = it.first(); env != nullptr; env = it.next(env)) {
     JvmtiTagMap* tag_map = env->tag_map_acquire();
@@ -3122,28 +3142,71 @@ void JvmtiTagMap::set_needs_cleaning() {
   }
 }
 
+// Called by the GC worker threads, possibly in parallel.
+void JvmtiTagMap::record_dead_handles(oop* const* handles, size_t count) {
+  MutexLocker ml(JvmtiTagMapDead_lock, Mutex::_no_safepoint_check_flag);
+  if (_gc_dead_handles == nullptr) {
+    _gc_dead_handles = new JvmtiDeadHandles();
+  }
+  for (size_t i = 0; i < count; i++) {
+    _gc_dead_handles->append(handles[i]);
+  }
+}
+
+void JvmtiTagMap::add_dead_handles(const JvmtiDeadHandles* handles, bool complete) {
+  assert(is_locked(), "precondition");
+  if (!_needs_cleaning) {
+    // Nothing of this tag map was cleared
+    return;
+  }
+  if (!complete) {
+    _dead_handles.clear_and_deallocate();
+    _dead_handles_complete = false;
+  } else if (_dead_handles_complete && handles != nullptr) {
+    _dead_handles.appendAll(handles);
+  }
+}
+
 void JvmtiTagMap::gc_notification(size_t num_dead_entries) {
   assert(notified_needs_cleaning, "missing GC notification");
   DEBUG_ONLY(notified_needs_cleaning = false;)
 
-  // Notify ServiceThread if there's work to do.
+  // Take the handles cleared by this GC.
+  JvmtiDeadHandles* dead_handles;
+  bool dead_handles_complete;
   {
-    MonitorLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
-    _has_object_free_events = (num_dead_entries != 0);
-    if (_has_object_free_events) ml.notify_all();
+    MutexLocker ml(JvmtiTagMapDead_lock, Mutex::_no_safepoint_check_flag);
+    dead_handles = _gc_dead_handles;
+    dead_handles_complete = _gc_dead_handles_complete;
+    _gc_dead_handles = nullptr;
+    _gc_dead_handles_complete = true;
   }
 
-  // If no dead entries then cancel cleaning requests.
-  if (num_dead_entries == 0) {
-    JvmtiEnvIterator it;
-    for (JvmtiEnv* env = it.first(); env != nullptr; env = it.next(env)) {
-      JvmtiTagMap* tag_map = env->tag_map_acquire();
-      if (tag_map != nullptr) {
-        MutexLocker ml (tag_map->lock(), Mutex::_no_safepoint_check_flag);
+  // If no dead entries then cancel cleaning requests, otherwise hand
+  // the cleared handles to the tag maps.
+  JvmtiEnvIterator it;
+  for (JvmtiEnv* env = it.first(); env != nullptr; env = it.next(env)) {
+    JvmtiTagMap* tag_map = env->tag_map_acquire();
+    if (tag_map != nullptr) {
+      MutexLocker ml (tag_map->lock(), Mutex::_no_safepoint_check_flag);
+      if (num_dead_entries == 0) {
         tag_map->_needs_cleaning = false;
+        tag_map->_dead_handles.clear();
+        tag_map->_dead_handles_complete = true;
+      } else {
+        tag_map->add_dead_handles(dead_handles, dead_handles_complete);
       }
     }
   }
+
+  delete dead_handles;
+
+  // Notify ServiceThread if there's work to do.
+  {
+    MonitorLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    _has_object_free_events = (num_dead_entries != 0);
+    if (_has_object_free_events) ml.notify_all();
+  }
 }
 
 // Used by ServiceThread to discover there is work to do.
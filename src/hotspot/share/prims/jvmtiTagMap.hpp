@@ -29,11 +29,15 @@
 
 #include "jvmtifiles/jvmti.h"
 #include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/growableArray.hpp"
 
 class JvmtiEnv;
 class JvmtiTagMapTable;
 class JvmtiTagMapKeyClosure;
 
+typedef GrowableArrayCHeap<oop*, mtServiceability> JvmtiDeadHandles;
+
 class JvmtiTagMap :  public CHeapObj<mtServiceability> {
  private:
 
@@ -43,8 +47,19 @@ class JvmtiTagMap :  public CHeapObj<mtServiceability> {
   bool                  _needs_cleaning;
   bool                  _posting_events;
 
+  // Handles cleared by the GCs since the last cleaning.  If some GC did
+  // not report its cleared handles, the whole table is scanned instead.
+  JvmtiDeadHandles      _dead_handles;
+  bool                  _dead_handles_complete;
+
   static bool           _has_object_free_events;
 
+  // Handles cleared by the ongoing GC, until handed to the tag maps
+  static JvmtiDeadHandles* _gc_dead_handles;
+  static bool              _gc_dead_handles_complete;
+
+  void add_dead_handles(const JvmtiDeadHandles* handles, bool complete);
+
   // create a tag map
   JvmtiTagMap(JvmtiEnv* env);
 
@@ -114,7 +129,10 @@ class JvmtiTagMap :  public CHeapObj<mtServiceability> {
   void post_dead_objects(GrowableArray<jlong>* const objects);
 
   static void check_hashmaps_for_heapwalk(GrowableArray<jlong>* objects);
-  static void set_needs_cleaning() NOT_JVMTI_RETURN;
+  // A GC that reports the handles it clears through record_dead_handles()
+  // lets the tag maps remove their dead entries without scanning the tables.
+  static void set_needs_cleaning(bool reports_dead_handles = false) NOT_JVMTI_RETURN;
+  static void record_dead_handles(oop* const* handles, size_t count) NOT_JVMTI_RETURN;
   static void gc_notification(size_t num_dead_entries) NOT_JVMTI_RETURN;
 
   void flush_object_free_events();
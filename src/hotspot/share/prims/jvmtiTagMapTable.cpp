@@ -30,23 +30,13 @@
 #include "prims/jvmtiTagMapTable.hpp"
 
 
-JvmtiTagMapKey::JvmtiTagMapKey(oop obj) : _obj(obj) {}
+JvmtiTagMapKey::JvmtiTagMapKey(oop obj) : _obj(obj), _hash((unsigned)obj->identity_hash()) {}
 
-JvmtiTagMapKey::JvmtiTagMapKey(const JvmtiTagMapKey& src) {
-  // move object into WeakHandle when copying into the table
-  if (src._obj != nullptr) {
+JvmtiTagMapKey::JvmtiTagMapKey(WeakHandle wh, unsigned hash) : _wh(wh), _obj(nullptr), _hash(hash) {}
 
-    // obj was read with AS_NO_KEEPALIVE, or equivalent, like during
-    // a heap walk.  The object needs to be kept alive when it is published.
-    Universe::heap()->keep_alive(src._obj);
-
-    _wh = WeakHandle(JvmtiExport::weak_tag_storage(), src._obj);
-  } else {
-    // resizing needs to create a copy.
-    _wh = src._wh;
-  }
-  // obj is always null after a copy.
-  _obj = nullptr;
+JvmtiTagMapKey::JvmtiTagMapKey(const JvmtiTagMapKey& src) : _wh(src._wh), _obj(nullptr), _hash(src._hash) {
+  // Only keys with a handle are copied into the table.
+  assert(src._obj == nullptr, "must have a handle");
 }
 
 void JvmtiTagMapKey::release_weak_handle() {
@@ -66,15 +56,25 @@ oop JvmtiTagMapKey::object_no_keepalive() const {
 static const int INITIAL_TABLE_SIZE = 1007;
 static const int MAX_TABLE_SIZE     = 0x3fffffff;
 
-JvmtiTagMapTable::JvmtiTagMapTable() : _table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE) {}
+JvmtiTagMapTable::JvmtiTagMapTable() :
+  _table(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE),
+  _handles(INITIAL_TABLE_SIZE, MAX_TABLE_SIZE) {}
+
+void JvmtiTagMapTable::release_entry(JvmtiTagMapKey& entry) {
+  bool removed = _handles.remove(entry.handle_raw());
+  assert(removed, "handle of entry must be indexed");
+  entry.release_weak_handle();
+}
 
 void JvmtiTagMapTable::clear() {
   struct RemoveAll {
+    JvmtiTagMapTable* _table;
+    RemoveAll(JvmtiTagMapTable* table) : _table(table) {}
     bool do_entry(JvmtiTagMapKey& entry, const jlong& tag) {
-      entry.release_weak_handle();
+      _table->release_entry(entry);
       return true;
     }
-  } remove_all;
+  } remove_all(this);
   // The unlink method of ResourceHashTable gets a pointer to a type whose 'do_entry(K,V)' method is callled
   // while iterating over all the elements of the table. If the do_entry() method returns true the element
   // will be removed.
@@ -82,6 +82,7 @@ void JvmtiTagMapTable::clear() {
   _table.unlink(&remove_all);
 
   assert(_table.number_of_entries() == 0, "should have removed all entries");
+  assert(_handles.number_of_entries() == 0, "should have removed all handles");
 }
 
 JvmtiTagMapTable::~JvmtiTagMapTable() {
@@ -104,28 +105,38 @@ jlong JvmtiTagMapTable::find(oop obj) {
 }
 
 void JvmtiTagMapTable::add(oop obj, jlong tag) {
-  JvmtiTagMapKey new_entry(obj);
-  bool is_added;
-  if (obj->fast_no_hash_check()) {
-    // Can't be in the table so add it fast.
-    is_added = _table.put_when_absent(new_entry, tag);
-  } else {
-    jlong* value = _table.put_if_absent(new_entry, tag, &is_added);
-    *value = tag; // assign the new tag
-  }
-  if (is_added) {
-    if (_table.maybe_grow(5, true /* use_large_table_sizes */)) {
-      int max_bucket_size = DEBUG_ONLY(_table.verify()) NOT_DEBUG(0);
-      log_info(jvmti, table) ("JvmtiTagMap table resized to %d for %d entries max bucket %d",
-                              _table.table_size(), _table.number_of_entries(), max_bucket_size);
+  if (!obj->fast_no_hash_check()) {
+    // Objects without a hashcode can't be in the table.
+    JvmtiTagMapKey jtme(obj);
+    jlong* value = _table.get(jtme);
+    if (value != nullptr) {
+      *value = tag; // assign the new tag
+      return;
     }
   }
+
+  // obj was read with AS_NO_KEEPALIVE, or equivalent, like during
+  // a heap walk.  The object needs to be kept alive when it is published.
+  Universe::heap()->keep_alive(obj);
+
+  const unsigned hash = (unsigned)obj->identity_hash();
+  WeakHandle wh(JvmtiExport::weak_tag_storage(), obj);
+  JvmtiTagMapKey new_entry(wh, hash);
+  _table.put_when_absent(new_entry, tag);
+  _handles.put_when_absent(wh.ptr_raw(), hash);
+
+  if (_table.maybe_grow(5, true /* use_large_table_sizes */)) {
+    int max_bucket_size = DEBUG_ONLY(_table.verify()) NOT_DEBUG(0);
+    log_info(jvmti, table) ("JvmtiTagMap table resized to %d for %d entries max bucket %d",
+                            _table.table_size(), _table.number_of_entries(), max_bucket_size);
+  }
+  _handles.maybe_grow(5, true /* use_large_table_sizes */);
 }
 
 void JvmtiTagMapTable::remove(oop obj) {
   JvmtiTagMapKey jtme(obj);
-  auto clean = [] (JvmtiTagMapKey& entry, jlong tag) {
-    entry.release_weak_handle();
+  auto clean = [&] (JvmtiTagMapKey& entry, jlong tag) {
+    release_entry(entry);
   };
   _table.remove(jtme, clean);
 }
@@ -136,18 +147,44 @@ void JvmtiTagMapTable::entry_iterate(JvmtiTagMapKeyClosure* closure) {
 
 void JvmtiTagMapTable::remove_dead_entries(GrowableArray<jlong>* objects) {
   struct IsDead {
+    JvmtiTagMapTable* _table;
     GrowableArray<jlong>* _objects;
-    IsDead(GrowableArray<jlong>* objects) : _objects(objects) {}
+    IsDead(JvmtiTagMapTable* table, GrowableArray<jlong>* objects) : _table(table), _objects(objects) {}
     bool do_entry(JvmtiTagMapKey& entry, jlong tag) {
       if (entry.object_no_keepalive() == nullptr) {
         if (_objects != nullptr) {
           _objects->append(tag);
         }
-        entry.release_weak_handle();
+        _table->release_entry(entry);
         return true;
       }
       return false;;
     }
-  } is_dead(objects);
+  } is_dead(this, objects);
   _table.unlink(&is_dead);
 }
+
+void JvmtiTagMapTable::remove_dead_entries(const GrowableArrayCHeap<oop*, mtServiceability>* handles,
+                                           GrowableArray<jlong>* objects) {
+  auto clean = [&] (JvmtiTagMapKey& entry, jlong tag) {
+    if (objects != nullptr) {
+      objects->append(tag);
+    }
+    release_entry(entry);
+  };
+  for (int i = 0; i < handles->length(); i++) {
+    oop* const handle = handles->at(i);
+    const unsigned* const hash = _handles.get(handle);
+    if (hash == nullptr) {
+      // Belongs to another table, or already removed
+      continue;
+    }
+    JvmtiTagMapKey jtme(WeakHandle(handle), *hash);
+    if (jtme.object_no_keepalive() != nullptr) {
+      // The handle has been released and reused for a live object
+      continue;
+    }
+    bool removed = _table.remove(jtme, clean);
+    assert(removed, "indexed handle must have an entry");
+  }
+}
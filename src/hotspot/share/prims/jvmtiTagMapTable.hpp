@@ -28,6 +28,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "memory/allocation.hpp"
 #include "oops/weakHandle.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/resizableHashTable.hpp"
 
 class JvmtiEnv;
@@ -40,24 +41,33 @@ class JvmtiTagMapKeyClosure;
 // This class is the Key type for inserting in ResizeableResourceHashTable
 // Its get_hash() and equals() methods are also used for getting the hash
 // value of a Key and comparing two Keys, respectively.
+//
+// The key keeps the identity hash of the object, so that the entry of a
+// dead object can still be found by its handle.
 class JvmtiTagMapKey : public CHeapObj<mtServiceability> {
   WeakHandle _wh;
   oop _obj; // temporarily hold obj while searching
+  unsigned _hash;
  public:
   JvmtiTagMapKey(oop obj);
+  JvmtiTagMapKey(WeakHandle wh, unsigned hash);
   JvmtiTagMapKey(const JvmtiTagMapKey& src);
   JvmtiTagMapKey& operator=(const JvmtiTagMapKey&) = delete;
 
   oop object() const;
   oop object_no_keepalive() const;
   void release_weak_handle();
+  oop* handle_raw() const { return _wh.ptr_raw(); }
 
   static unsigned get_hash(const JvmtiTagMapKey& entry) {
-    assert(entry._obj != nullptr, "must lookup obj to hash");
-    return (unsigned)entry._obj->identity_hash();
+    return entry._hash;
   }
 
   static bool equals(const JvmtiTagMapKey& lhs, const JvmtiTagMapKey& rhs) {
+    if (lhs._obj == nullptr && rhs._obj == nullptr) {
+      // Lookup by handle, the object may be dead
+      return lhs.handle_raw() == rhs.handle_raw();
+    }
     oop lhs_obj = lhs._obj != nullptr ? lhs._obj : lhs.object_no_keepalive();
     oop rhs_obj = rhs._obj != nullptr ? rhs._obj : rhs.object_no_keepalive();
     return lhs_obj == rhs_obj;
@@ -70,9 +80,17 @@ ResizeableHashTable <JvmtiTagMapKey, jlong,
                               JvmtiTagMapKey::get_hash,
                               JvmtiTagMapKey::equals> ResizableHT;
 
+// Maps the handle of each entry to the identity hash of its object.
+typedef
+ResizeableHashTable <oop*, unsigned,
+                              AnyObj::C_HEAP, mtServiceability> HandleHT;
+
 class JvmtiTagMapTable : public CHeapObj<mtServiceability> {
  private:
   ResizableHT _table;
+  HandleHT _handles;
+
+  void release_entry(JvmtiTagMapKey& entry);
 
  public:
   JvmtiTagMapTable();
@@ -90,6 +108,11 @@ class JvmtiTagMapTable : public CHeapObj<mtServiceability> {
 
   // Cleanup cleared entries and store dead object tags in objects array
   void remove_dead_entries(GrowableArray<jlong>* objects);
+
+  // Cleanup the entries of the given cleared handles and store dead object
+  // tags in objects array.  Handles not in this table are ignored.
+  void remove_dead_entries(const GrowableArrayCHeap<oop*, mtServiceability>* handles,
+                           GrowableArray<jlong>* objects);
   void clear();
 };
 
@@ -47,6 +47,7 @@
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcConfig.hpp"
 #include "gc/shared/genArguments.hpp"
+#include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "jfr/periodic/sampling/jfrCPUTimeThreadSampler.hpp"
 #include "jvm.h"
 #include "jvmtifiles/jvmtiEnv.hpp"
@@ -1528,6 +1529,26 @@ WB_ENTRY(void, WB_YoungGC(JNIEnv* env, jobject o))
   Universe::heap()->collect(GCCause::_wb_young_gc);
 WB_END
 
+// Returns the statistics of the last completed reference processing of the
+// collectors using ReferenceProcessor (Serial, Parallel and G1). Element 0 is
+// the number of reference processings completed so far, the remaining ones
+// are laid out as described by ReferenceProcessorPhaseTimes::LastStat.
+WB_ENTRY(jlongArray, WB_GetLastReferenceProcessingStats(JNIEnv* env, jobject o))
+  if (!UseSerialGC && !UseParallelGC && !UseG1GC) {
+    THROW_MSG_NULL(vmSymbols::java_lang_UnsupportedOperationException(),
+                   "WB_GetLastReferenceProcessingStats: not supported by the selected GC");
+  }
+  jlong stats[ReferenceProcessorPhaseTimes::NumLastStats];
+  const size_t num_completed = ReferenceProcessorPhaseTimes::last_stats(stats);
+
+  typeArrayOop result = oopFactory::new_longArray(1 + ReferenceProcessorPhaseTimes::NumLastStats, CHECK_NULL);
+  result->long_at_put(0, (jlong)num_completed);
+  for (int i = 0; i < ReferenceProcessorPhaseTimes::NumLastStats; i++) {
+    result->long_at_put(1 + i, stats[i]);
+  }
+  return (jlongArray) JNIHandles::make_local(THREAD, result);
+WB_END
+
 WB_ENTRY(void, WB_ReadReservedMemory(JNIEnv* env, jobject o))
   // static+volatile in order to force the read to happen
   // (not be eliminated by the compiler)
@@ -2987,6 +3008,7 @@ static JNINativeMethod methods[] = {
   {CC"isInStringTable",    CC"(Ljava/lang/String;)Z", (void*)&WB_IsInStringTable  },
   {CC"fullGC",   CC"()V",                             (void*)&WB_FullGC },
   {CC"youngGC",  CC"()V",                             (void*)&WB_YoungGC },
+  {CC"getLastReferenceProcessingStats", CC"()[J",    (void*)&WB_GetLastReferenceProcessingStats },
   {CC"readReservedMemory", CC"()V",                   (void*)&WB_ReadReservedMemory },
   {CC"allocateMetaspace",
      CC"(Ljava/lang/ClassLoader;J)J",                 (void*)&WB_AllocateMetaspace },
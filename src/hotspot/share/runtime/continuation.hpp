@@ -40,6 +40,20 @@ class Continuations : public AllStatic {
 public:
   static void init();
   static bool enabled();
+
+  // Number of freezes and thaws that took each path, and of new chunks
+  // taken from and not found in the carrier's StackChunkPool, counted while
+  // the ContinuationStatistics event is enabled.
+  struct PathCounts {
+    size_t fast_freezes;
+    size_t slow_freezes;
+    size_t fast_thaws;
+    size_t barrier_fast_thaws;
+    size_t slow_thaws;
+    size_t chunk_pool_hits;
+    size_t chunk_pool_misses;
+  };
+  static void path_counts(PathCounts* counts);
 };
 
 void continuations_init();
@@ -175,6 +175,38 @@ static const bool TEST_THAW_ONE_CHUNK_FRAME = false; // force thawing frames one
   #define CONT_JFR_ONLY(code)
 #endif
 
+// Counts of the freeze and thaw paths taken, reported by the periodic
+// ContinuationStatistics event. To keep freeze and thaw cheap they are
+// only maintained while that event is enabled.
+enum ContinuationPath {
+  fast_freeze_path,
+  slow_freeze_path,
+  fast_thaw_path,
+  barrier_fast_thaw_path,
+  slow_thaw_path,
+  chunk_pool_hit_path,
+  chunk_pool_miss_path,
+  number_of_continuation_paths
+};
+
+static volatile size_t _continuation_path_counts[number_of_continuation_paths];
+
+static inline void count_continuation_path(ContinuationPath path) {
+  if (EventContinuationStatistics::is_enabled()) {
+    AtomicAccess::inc(&_continuation_path_counts[path], memory_order_relaxed);
+  }
+}
+
+void Continuations::path_counts(PathCounts* counts) {
+  counts->fast_freezes       = AtomicAccess::load(&_continuation_path_counts[fast_freeze_path]);
+  counts->slow_freezes       = AtomicAccess::load(&_continuation_path_counts[slow_freeze_path]);
+  counts->fast_thaws         = AtomicAccess::load(&_continuation_path_counts[fast_thaw_path]);
+  counts->barrier_fast_thaws = AtomicAccess::load(&_continuation_path_counts[barrier_fast_thaw_path]);
+  counts->slow_thaws         = AtomicAccess::load(&_continuation_path_counts[slow_thaw_path]);
+  counts->chunk_pool_hits    = AtomicAccess::load(&_continuation_path_counts[chunk_pool_hit_path]);
+  counts->chunk_pool_misses  = AtomicAccess::load(&_continuation_path_counts[chunk_pool_miss_path]);
+}
+
 // TODO: See AbstractAssembler::generate_stack_overflow_check,
 // Compile::bang_size_in_bytes(), m->as_SafePoint()->jvms()->interpreter_frame_size()
 // when we stack-bang, we need to update a thread field with the lowest (farthest) bang point.
@@ -486,6 +518,7 @@ template <typename ConfigT>
 class Freeze : public FreezeBase {
 private:
   stackChunkOop allocate_chunk(size_t stack_size, int argsize_md);
+  stackChunkOop recycle_chunk(stackChunkOop chunk, int argsize_md);
 
 public:
   inline Freeze(JavaThread* thread, ContinuationWrapper& cont, intptr_t* frame_sp, bool preempt)
@@ -740,6 +773,7 @@ bool FreezeBase::freeze_fast_new_chunk(stackChunkOop chunk) {
 
 void FreezeBase::freeze_fast_copy(stackChunkOop chunk, int chunk_start_sp CONT_JFR_ONLY(COMMA bool chunk_is_allocated)) {
   assert(chunk != nullptr, "");
+  count_continuation_path(fast_freeze_path);
   assert(!chunk->has_mixed_frames(), "");
   assert(!chunk->is_gc_mode(), "");
   assert(!chunk->has_bitmap(), "");
@@ -863,6 +897,7 @@ NOINLINE freeze_result FreezeBase::freeze_slow() {
 #endif
 
   log_develop_trace(continuations)("freeze_slow  #" INTPTR_FORMAT, _cont.hash());
+  count_continuation_path(slow_freeze_path);
   assert(_thread->thread_state() == _thread_in_vm || _thread->thread_state() == _thread_blocked, "");
 
 #if CONT_JFR
@@ -1567,6 +1602,15 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size, int argsize_md)
   JavaThread* current = _preempt ? JavaThread::current() : _thread;
   assert(current == JavaThread::current(), "should be current");
 
+  if (StackChunkPoolSize > 0) {
+    stackChunkOop chunk = current->stack_chunk_pool()->remove(stack_size);
+    if (chunk != nullptr) {
+      count_continuation_path(chunk_pool_hit_path);
+      return recycle_chunk(chunk, argsize_md);
+    }
+    count_continuation_path(chunk_pool_miss_path);
+  }
+
   // Allocate the chunk.
   //
   // This might safepoint while allocating, but all safepointing due to
@@ -1629,6 +1673,29 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size, int argsize_md)
   return chunk;
 }
 
+// Reinitializes an empty chunk taken from the carrier's StackChunkPool the way
+// StackChunkAllocator and allocate_chunk initialize a new one. The chunk may
+// be larger than requested; freezing only relies on its sp and bottom.
+template <typename ConfigT>
+stackChunkOop Freeze<ConfigT>::recycle_chunk(stackChunkOop chunk, int argsize_md) {
+  log_develop_trace(continuations)("allocate_chunk reusing pooled chunk " INTPTR_FORMAT, p2i((oopDesc*)chunk));
+  assert(ContinuationGCSupport::can_recycle_stack_chunk(chunk), "");
+
+  int bottom = chunk->stack_size() - argsize_md;
+  chunk->set_bottom(bottom);
+  chunk->set_sp(bottom);
+  chunk->set_max_thawing_size(0);
+  chunk->set_pc(nullptr);
+  chunk->clear_flags();
+  chunk->set_lockstack_size(0);
+  chunk->set_parent(_cont.last_nonempty_chunk());
+  chunk->set_cont(_cont.continuation());
+
+  assert(chunk->is_empty(), "");
+  _barriers = false;
+  return chunk;
+}
+
 void FreezeBase::throw_stack_overflow_on_humongous_chunk() {
   ContinuationWrapper::SafepointOp so(_thread, _cont); // could also call _cont.done() instead
   Exceptions::_throw_msg(_thread, __FILE__, __LINE__, vmSymbols::java_lang_StackOverflowError(), "Humongous stack chunk");
@@ -2131,6 +2198,9 @@ class Thaw : public ThawBase {
 public:
   Thaw(JavaThread* thread, ContinuationWrapper& cont) : ThawBase(thread, cont) {}
 
+  // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
+  static const int full_chunk_thaw_threshold = 500; // words
+
   inline bool can_thaw_fast(stackChunkOop chunk) {
     return    !_barriers
            &&  _thread->cont_fastpath_thread_state()
@@ -2138,9 +2208,25 @@ class Thaw : public ThawBase {
            && !PreserveFramePointer;
   }
 
+  // A small chunk of compiled frames that only takes the slow path because
+  // it has been seen by the GC can still be thawed in one copy: the barriers
+  // are applied to the whole chunk up front and the copied oops are fixed
+  // in bulk afterwards, instead of thawing frame by frame.
+  inline bool can_thaw_fast_with_barriers(stackChunkOop chunk) {
+    return     UseContinuationBarrierFastThaw
+           &&  (_barriers || chunk->is_gc_mode())
+           &&  _thread->cont_fastpath_thread_state()
+           && !chunk->has_mixed_frames()
+           && !chunk->has_lockstack()
+           && !chunk->preempted()
+           && !PreserveFramePointer
+           &&  chunk->stack_size() - chunk->sp() < full_chunk_thaw_threshold;
+  }
+
   inline intptr_t* thaw(Continuation::thaw_kind kind);
   template<bool check_stub = false>
   NOINLINE intptr_t* thaw_fast(stackChunkOop chunk);
+  NOINLINE intptr_t* thaw_fast_with_barriers(stackChunkOop chunk);
   NOINLINE intptr_t* thaw_slow(stackChunkOop chunk, Continuation::thaw_kind kind);
   inline void patch_caller_links(intptr_t* sp, intptr_t* bottom);
 };
@@ -2156,8 +2242,16 @@ inline intptr_t* Thaw<ConfigT>::thaw(Continuation::thaw_kind kind) {
   assert(!chunk->is_empty(), "guaranteed by prepare_thaw");
 
   _barriers = chunk->requires_barriers();
-  return (LIKELY(can_thaw_fast(chunk))) ? thaw_fast(chunk)
-                                        : thaw_slow(chunk, kind);
+  if (LIKELY(can_thaw_fast(chunk))) {
+    return thaw_fast(chunk);
+  }
+  if (can_thaw_fast_with_barriers(chunk)) {
+    intptr_t* sp = thaw_fast_with_barriers(chunk);
+    if (sp != nullptr) {
+      return sp;
+    }
+  }
+  return thaw_slow(chunk, kind);
 }
 
 class ReconstructedStack : public StackObj {
@@ -2294,16 +2388,13 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
     chunk->print_on(true, &ls);
   }
 
-  // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
-  static const int threshold = 500; // words
-
   const int full_chunk_size = chunk->stack_size() - chunk->sp(); // this initial size could be reduced if it's a partial thaw
   int argsize, thaw_size;
 
   intptr_t* const chunk_sp = chunk->start_address() + chunk->sp();
 
   bool partial, empty;
-  if (LIKELY(!TEST_THAW_ONE_CHUNK_FRAME && (full_chunk_size < threshold))) {
+  if (LIKELY(!TEST_THAW_ONE_CHUNK_FRAME && (full_chunk_size < full_chunk_thaw_threshold))) {
     prefetch_chunk_pd(chunk->start_address(), full_chunk_size); // prefetch anticipating memcpy starting at highest address
 
     partial = false;
@@ -2321,6 +2412,8 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   const bool is_last = empty && chunk->parent() == nullptr;
   assert(!is_last || argsize == 0, "");
 
+  count_continuation_path(fast_thaw_path);
+
   log_develop_trace(continuations)("thaw_fast partial: %d is_last: %d empty: %d size: %d argsize: %d entrySP: " PTR_FORMAT,
                               partial, is_last, empty, thaw_size, argsize, p2i(_cont.entrySP()));
 
@@ -2340,6 +2433,14 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   // insert the back links from callee to caller frames
   patch_caller_links(rs.top(), rs.top() + rs.total_size());
 
+  // The continuation no longer needs its only chunk, and may well be done.
+  // Hand the chunk to the carrier so that the next freeze on this thread,
+  // of this or any other continuation, need not allocate one.
+  if (is_last && StackChunkPoolSize > 0 && _thread->stack_chunk_pool()->add(chunk)) {
+    _cont.set_tail(nullptr);
+    _cont.write();
+  }
+
   assert(is_last == _cont.is_empty(), "");
   assert(_cont.chunk_invariant(), "");
 
@@ -2377,6 +2478,121 @@ static inline void relativize_chunk_concurrently(stackChunkOop chunk) {
 #endif
 }
 
+// Records the full-width oop slots of the frames in a stack chunk, as word
+// offsets from 'base', so they can be fixed after being copied to the stack.
+// Narrow oop slots are left as they are by BarrierSetStackChunk::decode_gc_mode()
+// and need not be recorded.
+class ThawOopSlotsClosure : public OopClosure {
+  intptr_t* const _base;
+  int* const      _offsets;
+  const int       _max;
+  int             _count;
+
+public:
+  ThawOopSlotsClosure(intptr_t* base, int* offsets, int max)
+    : _base(base), _offsets(offsets), _max(max), _count(0) {}
+
+  virtual void do_oop(oop* p) override {
+    assert(_count < _max, "more oops than words in the chunk");
+    _offsets[_count++] = checked_cast<int>((intptr_t*)p - _base);
+  }
+  virtual void do_oop(narrowOop* p) override {}
+
+  int count() const { return _count; }
+};
+
+// Iterates over the oop slots recorded by ThawOopSlotsClosure at their
+// location in the thawed frames.
+class ThawedOopSlotsIterator : public OopIterator {
+  intptr_t* const  _base;
+  const int* const _offsets;
+  const int        _count;
+
+public:
+  ThawedOopSlotsIterator(intptr_t* base, const int* offsets, int count)
+    : _base(base), _offsets(offsets), _count(count) {}
+
+  virtual void oops_do(OopClosure* cl) override {
+    for (int i = 0; i < _count; i++) {
+      cl->do_oop((oop*)(_base + _offsets[i]));
+    }
+  }
+};
+
+template <typename ConfigT>
+NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast_with_barriers(stackChunkOop chunk) {
+  assert(chunk == _cont.tail(), "");
+  assert(_barriers || chunk->is_gc_mode(), "");
+  assert(!_thread->is_interp_only_mode(), "");
+
+  // Call this first to avoid racing with GC threads when modifying the chunk.
+  relativize_chunk_concurrently(chunk);
+
+  const int full_chunk_size = chunk->stack_size() - chunk->sp();
+  intptr_t* const chunk_sp = chunk->start_address() + chunk->sp();
+  intptr_t* const copy_start = chunk_sp - frame::metadata_words_at_bottom;
+
+  // Apply the store barriers if the chunk requires them, and collect the
+  // oops to fix after the copy. Frames with derived pointers or that are
+  // deoptimized need per-frame fixing after the copy, so leave them to the
+  // slow path. The barriers applied so far are harmless if we bail out.
+  int oop_slots[full_chunk_thaw_threshold];
+  ThawOopSlotsClosure slots_cl(copy_start, oop_slots, full_chunk_thaw_threshold);
+  for (StackChunkFrameStream<ChunkFrames::CompiledOnly> f(chunk); !f.is_done(); f.next(SmallRegisterMap::instance_no_args())) {
+    if (f.is_stub() || f.oopmap()->has_derived_oops() || f.cb()->as_nmethod()->is_deopt_pc(f.pc())) {
+      log_develop_trace(continuations)("thaw_fast_with_barriers: falling back to thaw_slow");
+      return nullptr;
+    }
+    if (_barriers) {
+      chunk->do_barriers<stackChunkOopDesc::BarrierType::Store>(f, SmallRegisterMap::instance_no_args());
+    }
+    f.iterate_oops(&slots_cl, SmallRegisterMap::instance_no_args());
+  }
+
+  count_continuation_path(barrier_fast_thaw_path);
+
+  prefetch_chunk_pd(chunk->start_address(), full_chunk_size);
+
+  const int argsize = chunk->argsize(); // must be called *before* clearing the chunk
+  clear_chunk(chunk);
+
+  // The chunk cannot be reused for another freeze since the GC has seen it
+  stackChunkOop parent = chunk->parent();
+  const bool is_last = parent == nullptr;
+  assert(!is_last || argsize == 0, "");
+
+  log_develop_trace(continuations)("thaw_fast_with_barriers is_last: %d size: %d argsize: %d oops: %d entrySP: " PTR_FORMAT,
+                                   is_last, full_chunk_size, argsize, slots_cl.count(), p2i(_cont.entrySP()));
+
+  ReconstructedStack rs(_cont.entrySP(), full_chunk_size, argsize);
+
+  // also copy metadata words at frame bottom
+  copy_from_chunk(copy_start, rs.top(), rs.total_size());
+
+  // Fix the copied oops in bulk, as fix_thawed_frame does for each frame
+  BarrierSetStackChunk* bs_chunk = BarrierSet::barrier_set()->barrier_set_stack_chunk();
+  ThawedOopSlotsIterator thawed_oops(rs.top(), oop_slots, slots_cl.count());
+  bs_chunk->decode_gc_mode(chunk, &thawed_oops);
+
+  _cont.set_tail(parent);
+  _cont.write();
+
+  // update the ContinuationEntry
+  _cont.set_argsize(argsize);
+  assert(rs.bottom_sp() == _cont.entry()->bottom_sender_sp(), "");
+
+  // install the return barrier if not last frame, or the entry's pc if last
+  patch_return(rs.bottom_sp(), is_last);
+
+  // insert the back links from callee to caller frames
+  patch_caller_links(rs.top(), rs.top() + rs.total_size());
+
+  assert(is_last == _cont.is_empty(), "");
+  assert(_cont.chunk_invariant(), "");
+
+  return rs.sp();
+}
+
 template <typename ConfigT>
 NOINLINE intptr_t* Thaw<ConfigT>::thaw_slow(stackChunkOop chunk, Continuation::thaw_kind kind) {
   Continuation::preempt_kind preempt_kind;
@@ -2455,6 +2671,8 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_slow(stackChunkOop chunk, Continuation::t
     chunk->print_on(true, &ls);
   }
 
+  count_continuation_path(slow_thaw_path);
+
 #if CONT_JFR
   EventContinuationThawSlow e;
   if (e.should_commit()) {
@@ -35,6 +35,7 @@
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/memAllocator.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/bytecode.inline.hpp"
 #include "interpreter/bytecodeStream.hpp"
 #include "interpreter/interpreter.hpp"
@@ -85,6 +86,7 @@
 #include "runtime/stackWatermarkSet.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.hpp"
+#include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/vframe.hpp"
@@ -1055,6 +1057,34 @@ class DeoptimizeMarkedHandshakeClosure : public HandshakeClosure {
   }
 };
 
+// Walks the stacks of the Java threads claimed by each worker and deoptimizes
+// the frames of marked nmethods. Used at safepoints with many threads, where
+// the stack walks would otherwise all be done by the VM thread.
+class ParallelDeoptimizeMarkedTask : public WorkerTask {
+  class DeoptimizeMarkedClosure : public ThreadClosure {
+   public:
+    void do_thread(Thread* thread) {
+      if (thread->is_Java_thread()) {
+        JavaThread::cast(thread)->deoptimize_marked_methods();
+      }
+    }
+  };
+
+  ThreadsClaimTokenScope _claim_token_scope;
+
+ public:
+  ParallelDeoptimizeMarkedTask() : WorkerTask("Parallel Deoptimize Marked") {}
+
+  void work(uint worker_id) {
+    ResourceMark rm;
+    DeoptimizeMarkedClosure cl;
+    Threads::possibly_parallel_threads_do(true /* is_par */, &cl);
+  }
+};
+
+// Below this many threads a serial walk is cheaper than waking the workers.
+static const int parallel_deoptimize_min_threads = 64;
+
 void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
 
@@ -1063,7 +1093,14 @@ void Deoptimization::deoptimize_all_marked() {
 
   DeoptimizeMarkedHandshakeClosure deopt;
   if (SafepointSynchronize::is_at_safepoint()) {
-    Threads::java_threads_do(&deopt);
+    WorkerThreads* workers = Universe::heap()->safepoint_workers();
+    if (workers != nullptr && workers->active_workers() > 1 &&
+        Threads::number_of_threads() >= parallel_deoptimize_min_threads) {
+      ParallelDeoptimizeMarkedTask task;
+      workers->run_task(&task);
+    } else {
+      Threads::java_threads_do(&deopt);
+    }
   } else {
     Handshake::execute(&deopt);
   }
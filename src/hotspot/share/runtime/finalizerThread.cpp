@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "classfile/javaClasses.inline.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/vmClasses.hpp"
+#include "classfile/vmSymbols.hpp"
+#include "logging/log.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/oopHandle.inline.hpp"
+#include "runtime/finalizerThread.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/perfData.hpp"
+#include "utilities/formatBuffer.hpp"
+
+OopHandle     FinalizerThread::_queue_head;
+OopHandle     FinalizerThread::_queue_tail;
+size_t        FinalizerThread::_queue_length = 0;
+OopHandle     FinalizerThread::_java_lang_access;
+volatile bool FinalizerThread::_is_active = false;
+
+PerfVariable* FinalizerThread::_perf_queue_length = nullptr;
+PerfCounter*  FinalizerThread::_perf_finalizers_queued = nullptr;
+PerfCounter*  FinalizerThread::_perf_finalizers_run = nullptr;
+
+void FinalizerThread::initialize(TRAPS) {
+  if (FinalizerThreads == 0 || !InstanceKlass::is_finalization_enabled()) {
+    return;
+  }
+
+  // Look up the JavaLangAccess passed to Finalizer.runFinalizer
+  Klass* const k = SystemDictionary::resolve_or_fail(vmSymbols::jdk_internal_access_SharedSecrets(), true, CHECK);
+  JavaValue result(T_OBJECT);
+  JavaCalls::call_static(&result,
+                         k,
+                         vmSymbols::getJavaLangAccess_name(),
+                         vmSymbols::void_JavaLangAccess_signature(),
+                         CHECK);
+  _java_lang_access = OopHandle(Universe::vm_global(), result.get_oop());
+  _queue_head = OopHandle(Universe::vm_global(), nullptr);
+  _queue_tail = OopHandle(Universe::vm_global(), nullptr);
+
+  if (UsePerfData) {
+    _perf_queue_length =
+      PerfDataManager::create_variable(SUN_RT, "finalizerQueueLength", PerfData::U_Events, CHECK);
+    _perf_finalizers_queued =
+      PerfDataManager::create_counter(SUN_RT, "finalizersQueued", PerfData::U_Events, CHECK);
+    _perf_finalizers_run =
+      PerfDataManager::create_counter(SUN_RT, "finalizersRun", PerfData::U_Events, CHECK);
+  }
+
+  for (uint i = 0; i < FinalizerThreads; i++) {
+    FormatBuffer<> name("VM Finalizer#%u", i);
+    Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+
+    FinalizerThread* thread = new FinalizerThread(&finalizer_thread_entry);
+    JavaThread::vm_exit_on_osthread_failure(thread);
+
+    // Same priority as the java.lang.ref.Finalizer thread
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NearMaxPriority);
+  }
+
+  log_info(gc, ref)("Started %u VM finalizer threads", FinalizerThreads);
+  _is_active = true;
+}
+
+oop FinalizerThread::take_finalizers(oop list, JavaThread* current) {
+  assert(is_active(), "precondition");
+
+  // Split the list, nothing here may safepoint
+  oop others_head = nullptr;
+  oop others_tail = nullptr;
+  oop final_head = nullptr;
+  oop final_tail = nullptr;
+  size_t count = 0;
+
+  for (oop ref = list; ref != nullptr;) {
+    const oop next = java_lang_ref_Reference::discovered(ref);
+    if (java_lang_ref_Reference::is_final(ref)) {
+      if (final_tail == nullptr) {
+        final_head = ref;
+      } else {
+        java_lang_ref_Reference::set_discovered(final_tail, ref);
+      }
+      final_tail = ref;
+      count++;
+    } else {
+      if (others_tail == nullptr) {
+        others_head = ref;
+      } else {
+        java_lang_ref_Reference::set_discovered(others_tail, ref);
+      }
+      others_tail = ref;
+    }
+    ref = next;
+  }
+
+  if (final_tail == nullptr) {
+    // No Finalizers
+    return list;
+  }
+
+  java_lang_ref_Reference::set_discovered(final_tail, nullptr);
+  if (others_tail != nullptr) {
+    java_lang_ref_Reference::set_discovered(others_tail, nullptr);
+  }
+
+  Handle others(current, others_head);
+  enqueue(Handle(current, final_head), Handle(current, final_tail), count, current);
+  return others();
+}
+
+void FinalizerThread::enqueue(Handle head, Handle tail, size_t count, JavaThread* current) {
+  MonitorLocker ml(current, FinalizerQueue_lock);
+
+  const oop queue_tail = _queue_tail.resolve();
+  if (queue_tail == nullptr) {
+    _queue_head.replace(head());
+  } else {
+    java_lang_ref_Reference::set_discovered(queue_tail, head());
+  }
+  _queue_tail.replace(tail());
+  _queue_length += count;
+
+  if (UsePerfData) {
+    _perf_queue_length->set_value((jlong)_queue_length);
+    _perf_finalizers_queued->inc((jlong)count);
+  }
+
+  log_debug(gc, ref)("Queued %zu finalizers, %zu in queue", count, _queue_length);
+  ml.notify_all();
+}
+
+oop FinalizerThread::dequeue(JavaThread* current, bool wait) {
+  MonitorLocker ml(current, FinalizerQueue_lock);
+  while (_queue_head.peek() == nullptr) {
+    if (!wait) {
+      return nullptr;
+    }
+    ml.wait();
+  }
+
+  const oop ref = _queue_head.resolve();
+  const oop next = java_lang_ref_Reference::discovered(ref);
+  java_lang_ref_Reference::set_discovered(ref, nullptr);
+  _queue_head.replace(next);
+  if (next == nullptr) {
+    _queue_tail.replace(nullptr);
+  }
+  _queue_length--;
+
+  if (UsePerfData) {
+    _perf_queue_length->set_value((jlong)_queue_length);
+  }
+
+  return ref;
+}
+
+void FinalizerThread::run_finalizer(Handle finalizer, TRAPS) {
+  // Finalizer.runFinalizer() unlinks the Finalizer from the unfinalized
+  // list, invokes finalize() and reports the completion.
+  JavaValue result(T_VOID);
+  Handle java_lang_access(THREAD, _java_lang_access.resolve());
+  JavaCalls::call_special(&result,
+                          finalizer,
+                          vmClasses::Finalizer_klass(),
+                          vmSymbols::run_finalizer_name(),
+                          vmSymbols::JavaLangAccess_void_signature(),
+                          java_lang_access,
+                          THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    // runFinalizer() ignores exceptions thrown by finalize(),
+    // anything else is as unexpected as on the Finalizer thread
+    log_info(gc, ref)("Exception while running finalizer: %s",
+                      PENDING_EXCEPTION->klass()->external_name());
+    CLEAR_PENDING_EXCEPTION;
+  }
+
+  if (UsePerfData) {
+    _perf_finalizers_run->inc();
+  }
+}
+
+void FinalizerThread::run_finalization(JavaThread* current) {
+  assert(is_active(), "precondition");
+
+  // Like the secondary finalizer of Finalizer.runFinalization(), help
+  // the finalizer threads instead of waiting for them.
+  while (true) {
+    HandleMark hm(current);
+    const oop ref = dequeue(current, false /* wait */);
+    if (ref == nullptr) {
+      return;
+    }
+    Handle finalizer(current, ref);
+    run_finalizer(finalizer, current);
+  }
+}
+
+void FinalizerThread::finalizer_thread_entry(JavaThread* jt, TRAPS) {
+  while (true) {
+    HandleMark hm(jt);
+    Handle finalizer(jt, dequeue(jt, true /* wait */));
+    run_finalizer(finalizer, jt);
+  }
+}
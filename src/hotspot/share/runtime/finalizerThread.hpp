@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_FINALIZERTHREAD_HPP
+#define SHARE_RUNTIME_FINALIZERTHREAD_HPP
+
+#include "oops/oopHandle.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/perfDataTypes.hpp"
+
+// JavaThreads that run finalizers, enabled with FinalizerThreads.
+//
+// The Finalizers (FinalReferences) on the reference pending list are taken
+// out of the list by the VM when the ReferenceHandler thread picks up the
+// list, and are appended to a queue served by FinalizerThreads threads.
+// This skips the handoff through the Finalizer's ReferenceQueue to the
+// single java.lang.ref.Finalizer thread. The queue is linked through the
+// discovered field of the Finalizers, like the pending list.
+class FinalizerThread : public JavaThread {
+ private:
+  static OopHandle     _queue_head;
+  static OopHandle     _queue_tail;
+  static size_t        _queue_length;
+  static OopHandle     _java_lang_access;
+  static volatile bool _is_active;
+
+  static PerfVariable* _perf_queue_length;
+  static PerfCounter*  _perf_finalizers_queued;
+  static PerfCounter*  _perf_finalizers_run;
+
+  static void finalizer_thread_entry(JavaThread* thread, TRAPS);
+  FinalizerThread(ThreadFunction entry_point) : JavaThread(entry_point) {};
+
+  static void enqueue(Handle head, Handle tail, size_t count, JavaThread* current);
+  // Returns nullptr if the queue is empty and wait is false
+  static oop dequeue(JavaThread* current, bool wait);
+  static void run_finalizer(Handle finalizer, TRAPS);
+
+ public:
+  // Starts the threads, called once java.lang.System is initialized.
+  static void initialize(TRAPS);
+
+  static bool is_active() { return _is_active; }
+
+  // Moves the Finalizers of the given pending list to the queue, and
+  // returns the remaining list.
+  static oop take_finalizers(oop list, JavaThread* current);
+
+  // Runs the queued finalizers on the current thread until the queue is
+  // empty, for Runtime.runFinalization().
+  static void run_finalization(JavaThread* current);
+};
+
+#endif // SHARE_RUNTIME_FINALIZERTHREAD_HPP
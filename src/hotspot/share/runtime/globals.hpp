@@ -587,6 +587,12 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(size_t, NativeMemoryTrackingSampleInterval, 0, DIAGNOSTIC,        \
+          "With NativeMemoryTracking=detail, only record the call stack "   \
+          "of about one in this many malloced bytes, and scale the sizes "  \
+          "of the malloc sites accordingly. 0 records every malloc "        \
+          "call stack")                                                     \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -748,6 +754,11 @@ const int ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                                 \
           range(1024, max_jint)                                             \
                                                                             \
+  product(uint, MonitorDeflationWorkers, 0, EXPERIMENTAL,                   \
+          "Number of worker threads that deflate idle monitors in "         \
+          "parallel for the MonitorDeflationThread (0 deflates serially).") \
+          range(0, 256)                                                     \
+                                                                            \
   product(intx, MonitorUnlinkBatch, 500, DIAGNOSTIC,                        \
           "The maximum number of monitors to unlink in one batch. ")        \
           range(1, max_jint)                                                \
@@ -790,6 +801,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, RestoreMXCSROnJNICalls, false,                              \
           "Restore MXCSR when returning from JNI calls")                    \
                                                                             \
+  product(bool, UseJNIGlobalHandleCache, false, EXPERIMENTAL,               \
+          "Allocate and release JNI global and weak global handles "        \
+          "through small per-thread caches of storage entries, to avoid "   \
+          "contention on the storage lock")                                 \
+                                                                            \
   product(bool, CheckJNICalls, false,                                       \
           "Verify all arguments to JNI calls")                              \
                                                                             \
@@ -902,6 +918,12 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, TraceFinalizerRegistration, false,                          \
           "Trace registration of final references")                         \
                                                                             \
+  product(uint, FinalizerThreads, 0, EXPERIMENTAL,                          \
+          "Number of VM threads that run the finalizers taken directly "    \
+          "from the reference pending list. Zero leaves finalization to "   \
+          "the java.lang.ref.Finalizer thread")                             \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, IgnoreEmptyClassPaths, false,                               \
           "Ignore empty path elements in -classpath")                       \
                                                                             \
@@ -1414,6 +1436,13 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintMetaspaceStatisticsAtExit, false, DIAGNOSTIC,          \
           "Print metaspace statistics upon VM exit.")                       \
                                                                             \
+  product(size_t, MetaspaceAllocationBufferSize, 16*K, DIAGNOSTIC,          \
+          "Size in bytes of the thread-local buffers from which threads "   \
+          "defining classes allocate non-class metadata once the "          \
+          "metaspace lock of the class loader has been found contended. "   \
+          "0 disables the buffers.")                                        \
+          range(0, 1*M)                                                     \
+                                                                            \
   product(bool, PrintCompilerMemoryStatisticsAtExit, false, DIAGNOSTIC,     \
           "Print compiler memory statistics upon VM exit.")                 \
                                                                             \
@@ -1436,6 +1465,13 @@ const int ObjectAlignmentInBytes = 8;
           range(0, max_intx)                                                \
           constraint(SoftRefLRUPolicyMSPerMBConstraintFunc,AfterMemoryInit) \
                                                                             \
+  product(uintx, SoftRefTargetOccupancy, 0,                                 \
+          "Target heap occupancy after a major collection, as a percent "   \
+          "of the maximum heap size. SoftReferences are cleared, least "    \
+          "recently used first, to keep the live size at this target. "     \
+          "Zero uses the SoftRefLRUPolicyMSPerMB policies")                 \
+          range(0, 100)                                                     \
+                                                                            \
   product(size_t, MinHeapDeltaBytes, ScaleForWordSize(128*K),               \
           "The minimum change in heap space due to GC (in bytes)")          \
           range(0, max_uintx / 2 + 1)                                       \
@@ -1570,6 +1606,28 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, NMethodRelocation, false, EXPERIMENTAL,                     \
           "Enables use of experimental function nmethod::relocate()")       \
                                                                             \
+  product(size_t, HotCodeHeapSize, 0, EXPERIMENTAL,                         \
+          "Size of the code heap, carved from the non-profiled one, that "  \
+          "frequently executed nmethods are relocated to (in bytes). "      \
+          "0 disables it. Requires SegmentedCodeCache and "                 \
+          "NMethodRelocation")                                              \
+          range(0, SIZE_MAX)                                                \
+                                                                            \
+  product(uint, HotCodeSampleInterval, 100, EXPERIMENTAL,                   \
+          "Milliseconds between two samples of the compiled frames on "     \
+          "the thread stacks used to find hot nmethods")                    \
+          range(PeriodicTask::min_interval, PeriodicTask::max_interval)     \
+                                                                            \
+  product(uint, HotCodeGroupingSamples, 10, EXPERIMENTAL,                   \
+          "Number of samples taken between two rounds of relocating "       \
+          "nmethods into and out of the hot code heap")                     \
+          range(1, max_juint)                                               \
+                                                                            \
+  product(uint, HotCodeMinSamples, 4, EXPERIMENTAL,                         \
+          "Minimum decayed sample count of an nmethod for it to be "        \
+          "relocated into the hot code heap")                               \
+          range(1, max_juint)                                               \
+                                                                            \
   /* interpreter debugging */                                               \
   develop(intx, BinarySwitchThreshold, 5,                                   \
           "Minimal number of lookupswitch entries for rewriting to binary " \
@@ -1884,6 +1942,12 @@ const int ObjectAlignmentInBytes = 8;
           "Logging (-Xlog:async).")                                         \
           range(DEBUG_ONLY(192) NOT_DEBUG(100*K), 50*M)                     \
                                                                             \
+  product(size_t, AsyncLogThreadBufferSize, 64*K, DIAGNOSTIC,               \
+          "Size (in bytes) of the buffer each GC worker and concurrent "    \
+          "GC thread enqueues messages of Asynchronous Logging to "         \
+          "without taking a lock, in drop mode. 0 disables them.")          \
+          range(0, 50*M)                                                    \
+                                                                            \
   product(bool, CheckIntrinsics, true, DIAGNOSTIC,                          \
              "When a class C is loaded, check that "                        \
              "(1) all intrinsics defined by the VM for class C are present "\
@@ -1923,6 +1987,15 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(bool, UseContinuationBarrierFastThaw, false, DIAGNOSTIC,          \
+          "Thaw small compiled-only stack chunks seen by the GC in one "    \
+          "copy, fixing their oops in bulk")                                \
+                                                                            \
+  product(int, StackChunkPoolSize, 0, DIAGNOSTIC,                           \
+          "Maximum number of empty stack chunks each carrier thread "       \
+          "keeps for reuse by later freezes; 0 disables the pool")          \
+          range(0, 16)                                                      \
+                                                                            \
   develop(int, VerifyMetaspaceInterval, DEBUG_ONLY(500) NOT_DEBUG(0),       \
                "Run periodic metaspace verifications (0 - none, "           \
                "1 - always, >1 every nth interval)")                        \
@@ -1948,6 +2021,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
+  product(bool, UseFastElapsedCounter, false, EXPERIMENTAL,                 \
+          "Use the invariant time stamp counter, calibrated against the "   \
+          "OS clock, as the elapsed counter behind GC phase timing and "    \
+          "other Ticks based time stamps, where supported")                 \
+                                                                            \
   product(bool, DeoptimizeNMethodBarriersALot, false, DIAGNOSTIC,           \
                 "Make nmethod barriers deoptimise a lot.")                  \
                                                                             \
@@ -1974,6 +2052,11 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(bool, UseChunkThreadCache, true, DIAGNOSTIC,                      \
+          "Let compiler threads and GC workers keep a free arena chunk of " \
+          "each standard size for reuse, bypassing the global chunk "       \
+          "pools")                                                          \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
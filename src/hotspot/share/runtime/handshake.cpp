@@ -228,6 +228,62 @@ static void check_handshake_timeout(jlong start_time, HandshakeOperation* op, Ja
   }
 }
 
+// Statistics over the batches of handshake operations processed under a
+// single claim of a HandshakeState, reported by Handshake::statistics_exit_log().
+static volatile uint64_t _handshake_batches = 0;
+static volatile uint64_t _handshake_batched_ops = 0;
+static volatile uint _handshake_max_batch_size = 0;
+static volatile jlong _handshake_max_batch_time_ns = 0;
+
+// Timing the batches and updating the shared counters is only done when the
+// result is logged, to keep the handshake paths free of it by default.
+static bool should_record_handshake_batch() {
+  return log_is_enabled(Info, handshake, stats) || log_is_enabled(Debug, handshake);
+}
+
+static void record_handshake_batch(jlong start_time_ns, uint batch_size, const char* by) {
+  if (batch_size == 0) {
+    return;
+  }
+  jlong batch_time = os::javaTimeNanos() - start_time_ns;
+  AtomicAccess::inc(&_handshake_batches);
+  AtomicAccess::add(&_handshake_batched_ops, (uint64_t)batch_size);
+  uint max_size = AtomicAccess::load(&_handshake_max_batch_size);
+  while (batch_size > max_size) {
+    uint prev = AtomicAccess::cmpxchg(&_handshake_max_batch_size, max_size, batch_size);
+    if (prev == max_size) {
+      break;
+    }
+    max_size = prev;
+  }
+  jlong max_time = AtomicAccess::load(&_handshake_max_batch_time_ns);
+  while (batch_time > max_time) {
+    jlong prev = AtomicAccess::cmpxchg(&_handshake_max_batch_time_ns, max_time, batch_time);
+    if (prev == max_time) {
+      break;
+    }
+    max_time = prev;
+  }
+  log_debug(handshake)("Handshake batch of %u operation(s) processed by %s, Total completion time: "
+                       JLONG_FORMAT " ns", batch_size, by, batch_time);
+}
+
+void Handshake::statistics_exit_log() {
+  if (!log_is_enabled(Info, handshake, stats)) {
+    return;
+  }
+  uint64_t batches = AtomicAccess::load(&_handshake_batches);
+  uint64_t ops = AtomicAccess::load(&_handshake_batched_ops);
+  log_info(handshake, stats)("Handshake batches  " UINT64_FORMAT ", operations " UINT64_FORMAT,
+                             batches, ops);
+  if (batches != 0) {
+    log_info(handshake, stats)("Average batch size  %.2f", (double)ops / (double)batches);
+  }
+  log_info(handshake, stats)("Maximum batch size  %u", AtomicAccess::load(&_handshake_max_batch_size));
+  log_info(handshake, stats)("Maximum batch time  " INT64_FORMAT " ns",
+                             (int64_t)AtomicAccess::load(&_handshake_max_batch_time_ns));
+}
+
 static void log_handshake_info(jlong start_time_ns, const char* name, int targets, int emitted_handshakes_executed, const char* extra = nullptr) {
   if (log_is_enabled(Info, handshake)) {
     jlong completion_time = os::javaTimeNanos() - start_time_ns;
@@ -596,13 +652,18 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
   // set by this thread in case the operation is ThreadSuspendHandshake.
   OrderAccess::fence();
 
+  // All pending synchronous operations are processed while holding the
+  // lock, so they are coalesced into one trip through the poll.
+  const bool record_batch = should_record_handshake_batch();
+  const jlong start_time_ns = record_batch ? os::javaTimeNanos() : 0;
+  uint batch_size = 0;
   while (has_operation()) {
     // Handshakes cannot safely safepoint. The exceptions to this rule are
     // the asynchronous suspension and unsafe access error handshakes.
     MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
 
-    HandshakeOperation* op = get_op_for_self(allow_suspend, check_async_exception);
-    if (op != nullptr) {
+    HandshakeOperation* op;
+    while ((op = get_op_for_self(allow_suspend, check_async_exception)) != nullptr) {
       assert(op->_target == nullptr || op->_target == Thread::current(), "Wrong thread");
       bool async = op->is_async();
       log_trace(handshake)("Proc handshake %s " INTPTR_FORMAT " on " INTPTR_FORMAT " by self",
@@ -613,6 +674,7 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
         PreserveExceptionMark pem(_handshakee);
         op->do_handshake(_handshakee); // acquire, op removed after
         remove_op(op);
+        batch_size++;
       } else {
         // An asynchronous handshake may put the JavaThread in blocked state (safepoint safe).
         // The destructor ~PreserveExceptionMark touches the exception oop so it must not be executed,
@@ -621,11 +683,16 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
         op->do_handshake(_handshakee);
         log_handshake_info(((AsyncHandshakeOperation*)op)->start_time(), op->name(), 1, 0, "asynchronous");
         delete op;
+        if (record_batch) {
+          record_handshake_batch(start_time_ns, batch_size + 1, "self");
+        }
         return true; // Must check for safepoints
       }
-    } else {
-      return false;
     }
+    break;
+  }
+  if (record_batch) {
+    record_handshake_batch(start_time_ns, batch_size, "self");
   }
   return false;
 }
@@ -697,32 +764,51 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
   }
 
   Thread* current_thread = Thread::current();
+  const bool record_batch = should_record_handshake_batch();
+  const jlong start_time_ns = record_batch ? os::javaTimeNanos() : 0;
 
   HandshakeOperation* op = get_op();
 
   assert(op != nullptr, "Must have an op");
   assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
-  assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
 
-  log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
-                       op == match_op ? "handshaker" : "cooperative",
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+  // While we hold the lock and the handshakee is observed safe it cannot
+  // proceed, so all pending operations that may be executed by another
+  // thread are coalesced and processed under this single claim.
+  bool processed_match_op = false;
+  uint batch_size = 0;
+  do {
+    assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
+
+    log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
+                         op == match_op ? "handshaker" : "cooperative",
+                         current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+
+    op->prepare(_handshakee, current_thread);
 
-  op->prepare(_handshakee, current_thread);
+    set_active_handshaker(current_thread);
+    op->do_handshake(_handshakee); // acquire, op removed after
+    set_active_handshaker(nullptr);
+    remove_op(op);
 
-  set_active_handshaker(current_thread);
-  op->do_handshake(_handshakee); // acquire, op removed after
-  set_active_handshaker(nullptr);
-  remove_op(op);
+    processed_match_op |= (op == match_op);
+    batch_size++;
+    op = get_op();
+  } while (op != nullptr);
 
   _lock.unlock();
 
-  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed an op for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
+  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed %u op(s) for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
                        current_thread->is_VM_thread() ? "VM Thread" : "JavaThread",
-                       p2i(current_thread), p2i(_handshakee),
-                       op == match_op ? "including" : "excluding", p2i(match_op));
+                       p2i(current_thread), batch_size, p2i(_handshakee),
+                       processed_match_op ? "including" : "excluding", p2i(match_op));
+
+  if (record_batch) {
+    record_handshake_batch(start_time_ns, batch_size,
+                           current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+  }
 
-  return op == match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
+  return processed_match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
 }
 
 void HandshakeState::handle_unsafe_access_error() {
@@ -78,6 +78,9 @@ class Handshake : public AllStatic {
   // This version of execute() relies on a ThreadListHandle somewhere in
   // the caller's context to protect target (and we sanity check for that).
   static void execute(AsyncHandshakeClosure*  hs_cl, JavaThread* target);
+
+  // Log statistics about coalesced handshake operations at VM exit.
+  static void statistics_exit_log();
 };
 
 class JvmtiRawMonitor;
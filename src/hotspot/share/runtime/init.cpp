@@ -41,6 +41,7 @@
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/icache.hpp"
 #include "runtime/init.hpp"
 #include "runtime/safepoint.hpp"
@@ -220,6 +221,7 @@ void exit_globals() {
     destructorsCalled = true;
     perfMemory_exit();
     SafepointTracing::statistics_exit_log();
+    Handshake::statistics_exit_log();
     if (PrintStringTableStatistics) {
       SymbolTable::dump(tty);
       StringTable::dump(tty);
@@ -430,6 +430,7 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_global_handle_caches(nullptr),
   _monitor_owner_id(0),
 
   _suspend_flags(0),
@@ -675,6 +676,9 @@ JavaThread::~JavaThread() {
   // Enqueue OopHandles for release by the service thread.
   add_oop_handles_for_release();
 
+  // Return cached JNI global handle entries to their storage.
+  JNIHandles::release_thread_caches(this);
+
   // Return the sleep event to the free list
   ParkEvent::Release(_SleepEvent);
   _SleepEvent = nullptr;
@@ -38,6 +38,7 @@
 #include "runtime/lockStack.hpp"
 #include "runtime/park.hpp"
 #include "runtime/safepointMechanism.hpp"
+#include "runtime/stackChunkPool.hpp"
 #include "runtime/stackOverflow.hpp"
 #include "runtime/stackWatermarkSet.hpp"
 #include "runtime/suspendResumeManager.hpp"
@@ -56,6 +57,7 @@
 class AsyncExceptionHandshakeClosure;
 class DeoptResourceMark;
 class InternalOOMEMark;
+class JNIGlobalHandleCaches;
 class JNIHandleBlock;
 class JVMCIRuntime;
 
@@ -159,6 +161,9 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Cached global and weak global handle entries, see UseJNIGlobalHandleCache
+  JNIGlobalHandleCaches* _jni_global_handle_caches;
+
   // ID used as owner for inflated monitors. Same as the j.l.Thread.tid of the
   // current _vthread object, except during creation of the primordial and JNI
   // attached thread cases where this field can have a temporary value.
@@ -205,6 +210,9 @@ class JavaThread: public Thread {
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
+  JNIGlobalHandleCaches* jni_global_handle_caches() const { return _jni_global_handle_caches; }
+  void set_jni_global_handle_caches(JNIGlobalHandleCaches* caches) { _jni_global_handle_caches = caches; }
+
   void push_jni_handle_block();
   void pop_jni_handle_block();
 
@@ -470,6 +478,8 @@ class JavaThread: public Thread {
 
   ObjectMonitor* _unlocked_inflated_monitor;
 
+  StackChunkPool _stack_chunk_pool; // empty stack chunks kept for reuse by freeze
+
   // This is the field we poke in the interpreter and native
   // wrapper (Object.wait) to check for preemption.
   address _preempt_alternate_return;
@@ -691,6 +701,7 @@ class JavaThread: public Thread {
   intptr_t* raw_cont_fastpath() const          { return _cont_fastpath; }
   bool cont_fastpath() const                   { return _cont_fastpath == nullptr && _cont_fastpath_thread_state != 0; }
   bool cont_fastpath_thread_state() const      { return _cont_fastpath_thread_state != 0; }
+  StackChunkPool* stack_chunk_pool()           { return &_stack_chunk_pool; }
 
   // Support for SharedRuntime::monitor_exit_helper()
   ObjectMonitor* unlocked_inflated_monitor() const { return _unlocked_inflated_monitor; }
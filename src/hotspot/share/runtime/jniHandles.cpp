@@ -49,6 +49,68 @@ OopStorage* JNIHandles::weak_global_handles() {
 OopStorage* JNIHandles::_global_handles = nullptr;
 OopStorage* JNIHandles::_weak_global_handles = nullptr;
 
+// Caches of global and weak global entries of a JavaThread, allocated when
+// the thread first creates or destroys such a handle.
+class JNIGlobalHandleCaches : public CHeapObj<mtInternal> {
+public:
+  OopStorageAllocationCache _global;
+  OopStorageAllocationCache _weak;
+
+  JNIGlobalHandleCaches(OopStorage* global, OopStorage* weak) :
+    _global(global), _weak(weak) {}
+
+  OopStorageAllocationCache* cache(bool weak) {
+    return weak ? &_weak : &_global;
+  }
+};
+
+OopStorageAllocationCache* JNIHandles::current_thread_cache(bool weak) {
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return nullptr;
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  JNIGlobalHandleCaches* caches = jt->jni_global_handle_caches();
+  if (caches == nullptr) {
+    caches = new JNIGlobalHandleCaches(global_handles(), weak_global_handles());
+    jt->set_jni_global_handle_caches(caches);
+  }
+  return caches->cache(weak);
+}
+
+oop* JNIHandles::allocate_entry(bool weak) {
+  if (UseJNIGlobalHandleCache) {
+    OopStorageAllocationCache* cache = current_thread_cache(weak);
+    if (cache != nullptr) {
+      return cache->allocate();
+    }
+  }
+  return weak ? weak_global_handles()->allocate() : global_handles()->allocate();
+}
+
+void JNIHandles::release_entry(bool weak, oop* ptr) {
+  if (UseJNIGlobalHandleCache) {
+    OopStorageAllocationCache* cache = current_thread_cache(weak);
+    if (cache != nullptr) {
+      cache->release(ptr);
+      return;
+    }
+  }
+  if (weak) {
+    weak_global_handles()->release(ptr);
+  } else {
+    global_handles()->release(ptr);
+  }
+}
+
+void JNIHandles::release_thread_caches(JavaThread* thread) {
+  JNIGlobalHandleCaches* caches = thread->jni_global_handle_caches();
+  if (caches != nullptr) {
+    thread->set_jni_global_handle_caches(nullptr);
+    delete caches;              // Flushes the caches.
+  }
+}
+
 void jni_handles_init() {
   JNIHandles::_global_handles = OopStorageSet::create_strong("JNI Global", mtInternal);
   JNIHandles::_weak_global_handles = OopStorageSet::create_weak("JNI Weak", mtInternal);
@@ -88,7 +150,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_entry(false /* weak */);
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -110,7 +172,7 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_entry(true /* weak */);
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -147,7 +209,7 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    release_entry(false /* weak */, oop_ptr);
   }
 }
 
@@ -156,7 +218,7 @@ void JNIHandles::destroy_weak_global(jweak handle) {
   if (handle != nullptr) {
     oop* oop_ptr = weak_global_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)nullptr);
-    weak_global_handles()->release(oop_ptr);
+    release_entry(true /* weak */, oop_ptr);
   }
 }
 
@@ -30,6 +30,7 @@
 
 class JavaThread;
 class OopStorage;
+class OopStorageAllocationCache;
 class Thread;
 
 // Interface for creating and resolving local/global JNI handles
@@ -45,6 +46,12 @@ class JNIHandles : AllStatic {
   static OopStorage* global_handles();
   static OopStorage* weak_global_handles();
 
+  // Allocation and release of global and weak global entries, through the
+  // caches of the current thread with UseJNIGlobalHandleCache.
+  static OopStorageAllocationCache* current_thread_cache(bool weak);
+  static oop* allocate_entry(bool weak);
+  static void release_entry(bool weak, oop* ptr);
+
   inline static bool is_local_tagged(jobject handle);
   inline static bool is_weak_global_tagged(jobject handle);
   inline static bool is_global_tagged(jobject handle);
@@ -128,6 +135,9 @@ class JNIHandles : AllStatic {
   static void weak_oops_do(OopClosure* f);
 
   static bool is_global_storage(const OopStorage* storage);
+
+  // Releases the global and weak global entries cached by thread.
+  static void release_thread_caches(JavaThread* thread);
 };
 
 
@@ -51,6 +51,7 @@ Mutex*   JvmtiThreadState_lock        = nullptr;
 Monitor* EscapeBarrier_lock           = nullptr;
 Monitor* VThreadTransition_lock       = nullptr;
 Mutex*   JvmtiVThreadSuspend_lock     = nullptr;
+Mutex*   JvmtiTagMapDead_lock         = nullptr;
 Monitor* Heap_lock                    = nullptr;
 #if INCLUDE_PARALLELGC
 Mutex*   PSOldGenExpand_lock      = nullptr;
@@ -112,6 +113,7 @@ Mutex*   G1Uncommit_lock              = nullptr;
 
 Mutex*   Management_lock              = nullptr;
 Monitor* MonitorDeflation_lock        = nullptr;
+Monitor* FinalizerQueue_lock          = nullptr;
 Monitor* Service_lock                 = nullptr;
 Monitor* Notification_lock            = nullptr;
 Monitor* PeriodicTask_lock            = nullptr;
@@ -231,6 +233,7 @@ void mutex_init() {
   MUTEX_DEFN(MetaspaceCritical_lock          , PaddedMonitor, nosafepoint-1);
 
   MUTEX_DEFN(MonitorDeflation_lock           , PaddedMonitor, nosafepoint);      // used for monitor deflation thread operations
+  MUTEX_DEFN(FinalizerQueue_lock             , PaddedMonitor, safepoint);        // used for the VM finalizer threads queue
   MUTEX_DEFN(Service_lock                    , PaddedMonitor, service);          // used for service thread operations
   MUTEX_DEFN(Notification_lock               , PaddedMonitor, service);          // used for notification thread operations
 
@@ -267,6 +270,7 @@ void mutex_init() {
 
   MUTEX_DEFN(VThreadTransition_lock          , PaddedMonitor, safepoint);
   MUTEX_DEFN(JvmtiVThreadSuspend_lock        , PaddedMutex,   nosafepoint-1);
+  MUTEX_DEFN(JvmtiTagMapDead_lock            , PaddedMutex  , nosafepoint); // Used by GC workers to record cleared JVMTI tag handles
   MUTEX_DEFN(EscapeBarrier_lock              , PaddedMonitor, nosafepoint); // Used to synchronize object reallocation/relocking triggered by JVMTI
   MUTEX_DEFN(Management_lock                 , PaddedMutex  , safepoint);   // used for JVM management
 
@@ -49,6 +49,7 @@ extern Mutex*   JvmtiThreadState_lock;           // a lock on modification of JV
 extern Monitor* EscapeBarrier_lock;              // a lock to sync reallocating and relocking objects because of JVMTI access
 extern Monitor* VThreadTransition_lock;          // a lock used when disabling virtual thread transitions
 extern Mutex*   JvmtiVThreadSuspend_lock;        // a lock for virtual threads suspension
+extern Mutex*   JvmtiTagMapDead_lock;            // a lock on the JVMTI tag handles cleared by the GC
 extern Monitor* Heap_lock;                       // a lock on the heap
 #if INCLUDE_PARALLELGC
 extern Mutex*   PSOldGenExpand_lock;         // a lock on expanding the heap
@@ -111,6 +112,7 @@ extern Mutex*   PerfDataManager_lock;            // a long on access to PerfData
 
 extern Mutex*   Management_lock;                 // a lock used to serialize JVM management
 extern Monitor* MonitorDeflation_lock;           // a lock used for monitor deflation thread operation
+extern Monitor* FinalizerQueue_lock;             // a lock on the queue of the VM finalizer threads
 extern Monitor* Service_lock;                    // a lock used for service thread operation
 extern Monitor* Notification_lock;               // a lock used for notification thread operation
 extern Monitor* PeriodicTask_lock;               // protects the periodic task structure
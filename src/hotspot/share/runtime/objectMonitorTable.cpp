@@ -182,13 +182,23 @@ ObjectMonitor* ObjectMonitorTable::monitor_get(Thread* current, oop obj) {
   return result;
 }
 
+void ObjectMonitorTable::notify_resize() {
+  AtomicAccess::store(&_resize, true);
+  if (Service_lock->try_lock()) {
+    Service_lock->notify();
+    Service_lock->unlock();
+  }
+}
+
 void ObjectMonitorTable::try_notify_grow() {
   if (!_table->is_max_size_reached() && !AtomicAccess::load(&_resize)) {
-    AtomicAccess::store(&_resize, true);
-    if (Service_lock->try_lock()) {
-      Service_lock->notify();
-      Service_lock->unlock();
-    }
+    notify_resize();
+  }
+}
+
+void ObjectMonitorTable::try_notify_shrink() {
+  if (should_shrink() && !AtomicAccess::load(&_resize)) {
+    notify_resize();
   }
 }
 
@@ -196,6 +206,11 @@ bool ObjectMonitorTable::should_grow() {
   return get_load_factor() > GROW_LOAD_FACTOR && !_table->is_max_size_reached();
 }
 
+// The table is never shrunk below its initial size.
+bool ObjectMonitorTable::should_shrink() {
+  return get_load_factor() < SHRINK_LOAD_FACTOR && _table_size > (((size_t)1) << initial_log_size());
+}
+
 bool ObjectMonitorTable::should_resize() {
   return should_grow() || should_shrink() || AtomicAccess::load(&_resize);
 }
@@ -228,6 +243,31 @@ bool ObjectMonitorTable::grow(JavaThread* current) {
   return false;
 }
 
+// Each step halves the table, the concurrent readers and writers are delayed
+// for the duration of a step. Safepoints are let through in between.
+bool ObjectMonitorTable::shrink(JavaThread* current) {
+  bool shrunk = false;
+  while (should_shrink()) {
+    bool success;
+    {
+      TraceTime timer("Shrink", TRACETIME_LOG(Debug, monitortable, perf));
+      success = _table->shrink(current);
+    }
+    if (!success) {
+      break;
+    }
+    _table_size = table_size(current);
+    shrunk = true;
+    {
+      ThreadBlockInVM tbivm(current);
+    }
+  }
+  if (shrunk) {
+    log_info(monitortable)("Shrunk to size: %zu", _table_size);
+  }
+  return shrunk;
+}
+
 bool ObjectMonitorTable::clean(JavaThread* current) {
   ConcurrentTable::BulkDeleteTask clean_task(_table);
   auto is_dead = [&](ObjectMonitor** monitor) {
@@ -245,6 +285,9 @@ bool ObjectMonitorTable::resize(JavaThread* current) {
   if (should_grow()) {
     lt.print("Start growing with load factor %f", get_load_factor());
     success = grow(current);
+  } else if (should_shrink()) {
+    lt.print("Start shrinking with load factor %f", get_load_factor());
+    success = shrink(current);
   } else {
     if (!_table->is_max_size_reached() && AtomicAccess::load(&_resize)) {
       lt.print("WARNING: Getting resize hints with load factor %f", get_load_factor());
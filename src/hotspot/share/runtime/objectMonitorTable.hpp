@@ -50,22 +50,27 @@ class ObjectMonitorTable : AllStatic {
   static size_t clamp_log_size(V log_size);
   static size_t initial_log_size();
   static size_t grow_hint();
+  static void notify_resize();
 
  public:
   static void create();
   static void verify_monitor_get_result(oop obj, ObjectMonitor* monitor);
   static ObjectMonitor* monitor_get(Thread* current, oop obj);
   static void try_notify_grow();
-  static bool should_shrink() { return false; } // Not implemented
+  // Called after monitor deflation removed entries from the table.
+  static void try_notify_shrink();
 
   static constexpr double GROW_LOAD_FACTOR = 0.75;
+  static constexpr double SHRINK_LOAD_FACTOR = 0.25;
 
   static bool should_grow();
+  static bool should_shrink();
   static bool should_resize();
 
   template <typename Task, typename... Args>
   static bool run_task(JavaThread* current, Task& task, const char* task_name, Args&... args);
   static bool grow(JavaThread* current);
+  static bool shrink(JavaThread* current);
   static bool clean(JavaThread* current);
   static bool resize(JavaThread* current);
   static ObjectMonitor* monitor_put_get(Thread* current, ObjectMonitor* monitor, oop obj);
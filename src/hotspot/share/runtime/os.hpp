@@ -392,6 +392,12 @@ class os: AllStatic {
   // The returned value is guaranteed to be between 0 and (os::processor_count() - 1).
   static uint processor_id();
 
+  // Binds the calling thread to one of the processors this process is allowed
+  // to run on. Consecutive processor indexes visit all physical cores before
+  // a second hardware thread of any core, and wrap around. Returns false if
+  // binding is not supported or failed.
+  static bool bind_to_processor(uint processor_index);
+
   // number of CPUs
   static int processor_count() {
     return _processor_count;
@@ -26,6 +26,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/padded.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/handles.inline.hpp"
@@ -35,9 +36,11 @@
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "runtime/task.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalCounter.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 PerfDataList*   PerfDataManager::_all = nullptr;
 PerfDataList*   PerfDataManager::_constants = nullptr;
@@ -117,6 +120,49 @@ PerfData::PerfData(CounterNS ns, const char* name, Units u, Variability v)
   }
 }
 
+PerfStripedCounter* volatile PerfStripedCounter::_all_striped = nullptr;
+
+PerfStripedCounter::PerfStripedCounter(CounterNS ns, const char* namep, Units u,
+                                       jlong initial_value)
+                   : PerfLongCounter(ns, namep, u, initial_value),
+                     _next(nullptr), _stripes_base(nullptr), _stripes(nullptr) {
+  uint stripes = MIN2(round_up_power_of_2((uint)os::processor_count()), max_stripes);
+  _stripe_mask = stripes - 1;
+  jlong* s = PaddedPrimitiveArray<jlong, mtInternal>::create(stripes * stripe_words, &_stripes_base);
+  s[0] = initial_value;
+  _stripes = s;
+}
+
+PerfStripedCounter::~PerfStripedCounter() {
+  FreeHeap(_stripes_base);
+}
+
+jlong PerfStripedCounter::get_value() {
+  jlong sum = 0;
+  for (uint i = 0; i <= _stripe_mask; i++) {
+    sum += AtomicAccess::load(_stripes + i * stripe_words);
+  }
+  return sum;
+}
+
+void PerfStripedCounter::publish() {
+  if (is_valid()) {
+    AtomicAccess::store((jlong*)_valuep, get_value());
+  }
+}
+
+void PerfStripedCounter::publish_all() {
+  for (PerfStripedCounter* p = AtomicAccess::load_acquire(&_all_striped); p != nullptr; p = p->_next) {
+    p->publish();
+  }
+}
+
+class PerfStripedCounterPublishTask : public PeriodicTask {
+ public:
+  PerfStripedCounterPublishTask() : PeriodicTask(PerfStripedCounter::publish_interval_ms) {}
+  void task() { PerfStripedCounter::publish_all(); }
+};
+
 PerfData::~PerfData() {
   FREE_C_HEAP_ARRAY(char, _name);
   if (is_on_c_heap()) {
@@ -253,6 +299,9 @@ void PerfDataManager::destroy() {
   AtomicAccess::store(&_has_PerfData, false);
   GlobalCounter::write_synchronize();
 
+  // The publish task has been stopped with the WatcherThread.
+  AtomicAccess::store(&PerfStripedCounter::_all_striped, (PerfStripedCounter*)nullptr);
+
   log_debug(perf, datacreation)("Total = %d, Constants = %d",
                                 _all->length(),
                                 _constants == nullptr ? 0 : _constants->length());
@@ -411,6 +460,34 @@ PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
   return p;
 }
 
+PerfStripedCounter* PerfDataManager::create_striped_counter(CounterNS ns,
+                                                            const char* name,
+                                                            PerfData::Units u,
+                                                            TRAPS) {
+
+  PerfStripedCounter* p = new PerfStripedCounter(ns, name, u);
+
+  if (!p->is_valid()) {
+    // allocation of native resources failed.
+    delete p;
+    THROW_NULL(vmSymbols::java_lang_OutOfMemoryError());
+  }
+
+  add_item(p);
+
+  // Link into the list of striped counters, and start publishing their
+  // values with the first one.
+  PerfStripedCounter* head = AtomicAccess::load(&PerfStripedCounter::_all_striped);
+  do {
+    p->_next = head;
+  } while ((head = AtomicAccess::cmpxchg(&PerfStripedCounter::_all_striped, p->_next, p)) != p->_next);
+  if (p->_next == nullptr && UsePerfData) {
+    (new PerfStripedCounterPublishTask())->enroll();
+  }
+
+  return p;
+}
+
 /*
  * Call into java.lang.System.getProperty to check that the value of the
  * specified property matches
@@ -393,6 +393,58 @@ class PerfLongCounter : public PerfLongVariant {
                                      initial_value) { }
 };
 
+/*
+ * The PerfStripedCounter class implements a PerfLongCounter for counters
+ * that are incremented by many threads at a high rate. Increments are
+ * atomic and go to one of several cache line sized stripes, chosen by the
+ * incrementing thread, so that threads on different CPUs do not contend
+ * for the same cache line. get_value() sums the stripes. The sum is also
+ * published to the PerfData memory region every
+ * PerfStripedCounter::publish_interval_ms, so external readers such as
+ * jstat see a single jlong with the usual layout, lagging by at most that
+ * interval.
+ *
+ * Increments must go through a PerfStripedCounter, not a PerfCounter,
+ * pointer: inc() is not virtual.
+ */
+class PerfStripedCounter : public PerfLongCounter {
+
+  friend class PerfDataManager; // for access to protected constructor
+
+  private:
+    static const size_t stripe_words = DEFAULT_PADDING_SIZE / sizeof(jlong);
+    static const uint max_stripes = 64;
+
+    // All striped counters, for publication. Never shrinks until
+    // PerfDataManager::destroy().
+    static PerfStripedCounter* volatile _all_striped;
+
+    PerfStripedCounter* _next;
+    void* _stripes_base;
+    volatile jlong* _stripes;
+    uint _stripe_mask;
+
+    inline volatile jlong* stripe();
+
+  protected:
+    PerfStripedCounter(CounterNS ns, const char* namep, Units u,
+                       jlong initial_value=0);
+    ~PerfStripedCounter();
+
+  public:
+    static const int publish_interval_ms = 50;
+
+    inline void inc();
+    inline void inc(jlong val);
+
+    // Sum of the stripes, which is more recent than the published value.
+    jlong get_value();
+
+    // Writes the sum of the stripes to the PerfData memory region.
+    void publish();
+    static void publish_all();
+};
+
 /*
  * The PerfLongVariable class, and its alias PerfVariable, implement
  * a PerfData subtype that holds a jlong data value that can
@@ -672,6 +724,9 @@ class PerfDataManager : AllStatic {
                                                 PerfData::Units u,
                                                 jlong ival, TRAPS);
 
+    static PerfStripedCounter* create_striped_counter(CounterNS ns, const char* name,
+                                                      PerfData::Units u, TRAPS);
+
 
     // these creation methods are provided for ease of use. These allow
     // Long performance data types to be created with a shorthand syntax.
@@ -27,6 +27,7 @@
 
 #include "runtime/perfData.hpp"
 
+#include "runtime/thread.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/growableArray.hpp"
 
@@ -50,4 +51,19 @@ inline bool PerfDataManager::exists(const char* name) {
   }
 }
 
+// Threads are spread over the stripes by hashing their address, so a thread
+// keeps using the same stripe.
+inline volatile jlong* PerfStripedCounter::stripe() {
+  uint64_t h = (uint64_t)p2i(Thread::current_or_null()) * UCONST64(0x9E3779B97F4A7C15);
+  return _stripes + ((uint)(h >> 32) & _stripe_mask) * stripe_words;
+}
+
+inline void PerfStripedCounter::inc() {
+  inc(1);
+}
+
+inline void PerfStripedCounter::inc(jlong val) {
+  AtomicAccess::add(stripe(), val, memory_order_relaxed);
+}
+
 #endif // SHARE_RUNTIME_PERFDATA_INLINE_HPP
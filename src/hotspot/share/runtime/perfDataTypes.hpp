@@ -33,6 +33,7 @@
 
 class PerfLongConstant;
 class PerfLongCounter;
+class PerfStripedCounter;
 class PerfLongVariable;
 class PerfStringVariable;
 
@@ -34,6 +34,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -65,6 +66,7 @@
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
+#include "utilities/ticks.hpp"
 #include "utilities/vmError.hpp"
 
 static void post_safepoint_begin_event(EventSafepointBegin& event,
@@ -101,6 +103,92 @@ static void post_safepoint_end_event(EventSafepointEnd& event, uint64_t safepoin
   }
 }
 
+// Keeps track of the last threads to reach a safepoint while synchronizing.
+// These are the threads that delay the time to safepoint. They are reported
+// with the code they stopped in, which is where the offending poll is, once
+// all threads are stopped and their stacks can be inspected.
+class SafepointStragglers : AllStatic {
+  static const uint MaxStragglers = 4;
+
+  struct Straggler {
+    JavaThread*     _thread;
+    JavaThreadState _state;
+    Ticks           _reached;
+  };
+
+  static Straggler _stragglers[MaxStragglers];
+  static uint      _count;
+  static bool      _enabled;
+  static Ticks     _start;
+
+ public:
+  static void begin() {
+    _count = 0;
+    _enabled = EventSafepointStraggler::is_enabled();
+    if (_enabled) {
+      _start = Ticks::now();
+    }
+  }
+
+  static void reached(ThreadSafepointState* tss) {
+    if (_enabled) {
+      Straggler& s = _stragglers[_count++ % MaxStragglers];
+      s._thread = tss->thread();
+      s._state = tss->last_running_state();
+      s._reached = Ticks::now();
+    }
+  }
+
+  static void post(uint64_t safepoint_id);
+};
+
+SafepointStragglers::Straggler SafepointStragglers::_stragglers[SafepointStragglers::MaxStragglers];
+uint SafepointStragglers::_count = 0;
+bool SafepointStragglers::_enabled = false;
+Ticks SafepointStragglers::_start;
+
+void SafepointStragglers::post(uint64_t safepoint_id) {
+  assert(SafepointSynchronize::is_at_safepoint(), "stacks must be stable");
+  if (!_enabled) {
+    return;
+  }
+  uint recorded = MIN2(_count, MaxStragglers);
+  for (uint rank = 1; rank <= recorded; rank++) {
+    const Straggler& s = _stragglers[(_count - rank) % MaxStragglers];
+    EventSafepointStraggler event(UNTIMED);
+    event.set_starttime(_start);
+    event.set_endtime(s._reached);
+    if (!event.should_commit()) {
+      // Stragglers are ordered, so earlier ones are below the threshold too.
+      break;
+    }
+    JavaThread* thread = s._thread;
+    const Method* method = nullptr;
+    bool compiled = false;
+    int pc_offset = -1;
+    if (thread->has_last_Java_frame()) {
+      frame fr = thread->last_frame();
+      if (fr.is_compiled_frame()) {
+        nmethod* nm = fr.cb()->as_nmethod();
+        method = nm->method();
+        compiled = true;
+        pc_offset = checked_cast<int>(fr.pc() - nm->code_begin());
+      } else if (fr.is_interpreted_frame()) {
+        method = fr.interpreter_frame_method();
+      }
+    }
+    event.set_safepointId(safepoint_id);
+    event.set_straggler(JFR_JVM_THREAD_ID(thread));
+    event.set_rank(rank);
+    event.set_threadState(s._state);
+    event.set_method(method);
+    event.set_compiled(compiled);
+    event.set_pcOffset(pc_offset);
+    event.set_jniCritical(thread->in_critical());
+    event.commit();
+  }
+}
+
 // SafepointCheck
 SafepointStateTracker::SafepointStateTracker(uint64_t safepoint_id, bool at_safepoint)
   : _safepoint_id(safepoint_id), _at_safepoint(at_safepoint) {}
@@ -228,6 +316,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
+  SafepointStragglers::begin();
 
   do {
     log_trace(safepoint)("Checking thread status");
@@ -245,6 +334,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
         log_trace(safepoint)("Thread " INTPTR_FORMAT " [%d] is now blocked",
                              p2i(cur_tss->thread()), cur_tss->thread()->osthread()->thread_id());
         --still_running;
+        SafepointStragglers::reached(cur_tss);
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -418,6 +508,8 @@ void SafepointSynchronize::begin() {
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
+  SafepointStragglers::post(_safepoint_id);
+
   post_safepoint_begin_event(begin_event, _safepoint_id, nof_threads, _current_jni_active_count);
 }
 
@@ -681,7 +773,8 @@ void SafepointSynchronize::print_safepoint_timeout() {
 
 ThreadSafepointState::ThreadSafepointState(JavaThread *thread)
   : _at_poll_safepoint(false), _thread(thread), _safepoint_safe(false),
-    _safepoint_id(SafepointSynchronize::InactiveSafepointCounter), _next(nullptr) {
+    _safepoint_id(SafepointSynchronize::InactiveSafepointCounter),
+    _last_running_state(_thread_uninitialized), _next(nullptr) {
 }
 
 void ThreadSafepointState::create(JavaThread *thread) {
@@ -723,6 +816,8 @@ void ThreadSafepointState::examine_state_of_thread(uint64_t safepoint_count) {
     return;
   }
 
+  _last_running_state = stable_state;
+
   // All other thread states will continue to run until they
   // transition and self-block in state _blocked
   // Safepoint polling in compiled code causes the Java threads to do the same.
@@ -26,6 +26,7 @@
 #include "classfile/javaClasses.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
+#include "code/hotCodeGrouper.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "interpreter/oopMapCache.hpp"
@@ -86,6 +87,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool jvmti_tagmap_work = false;
     bool oopmap_cache_work = false;
     bool object_monitor_table_work = false;
+    bool hot_code_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
       // will be handled by safepoint correctly when this thread is
@@ -113,7 +115,8 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
               (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset()) |
               (oopmap_cache_work = OopMapCache::has_cleanup_work()) |
-              (object_monitor_table_work = ObjectSynchronizer::needs_resize())
+              (object_monitor_table_work = ObjectSynchronizer::needs_resize()) |
+              (hot_code_work = HotCodeGrouper::has_work())
              ) == 0) {
         // Wait until notified that there is some work to do or timer expires.
         // Some cleanup requests don't notify the ServiceThread so work needs to be done at periodic intervals.
@@ -175,6 +178,10 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     if (object_monitor_table_work) {
       ObjectSynchronizer::resize_table(jt);
     }
+
+    if (hot_code_work) {
+      HotCodeGrouper::do_work();
+    }
   }
 }
 
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "gc/shared/continuationGCSupport.inline.hpp"
+#include "memory/universe.hpp"
+#include "oops/stackChunkOop.inline.hpp"
+#include "oops/weakHandle.inline.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/stackChunkPool.hpp"
+
+StackChunkPool::~StackChunkPool() {
+  for (int i = 0; i < MaxChunks; i++) {
+    _chunks[i].release(Universe::vm_weak());
+  }
+}
+
+// The handle of a removed chunk is released rather than reused: once weak
+// processing has cleared it, OopStorage skips it in later GCs, see
+// WeakProcessorSkipClearedEntries.
+void StackChunkPool::remove_at(int i) {
+  assert(0 <= i && i < _count, "out of bounds");
+  _count--;
+  _chunks[i].release(Universe::vm_weak());
+  _chunks[i] = _chunks[_count];
+  _chunks[_count] = WeakHandle();
+}
+
+bool StackChunkPool::add(stackChunkOop chunk) {
+  assert(chunk->is_empty(), "only empty chunks are pooled");
+  if (_count >= MIN2((int)StackChunkPoolSize, MaxChunks)) {
+    return false;
+  }
+  if (!ContinuationGCSupport::can_recycle_stack_chunk(chunk)) {
+    return false;
+  }
+
+  // Don't let a pooled chunk refer to the continuation it came from.
+  chunk->set_parent(nullptr);
+  chunk->set_cont(nullptr);
+
+  assert(_chunks[_count].is_empty(), "unused slots hold no handle");
+  _chunks[_count++] = WeakHandle(Universe::vm_weak(), chunk);
+  return true;
+}
+
+stackChunkOop StackChunkPool::remove(size_t stack_size) {
+  for (int i = _count - 1; i >= 0; i--) {
+    oop obj = _chunks[i].resolve();
+    if (obj == nullptr) {
+      // Cleared by the GC
+      remove_at(i);
+      continue;
+    }
+    stackChunkOop chunk = stackChunkOopDesc::cast(obj);
+    if (!ContinuationGCSupport::can_recycle_stack_chunk(chunk)) {
+      remove_at(i);
+      continue;
+    }
+    if ((size_t)chunk->stack_size() >= stack_size) {
+      remove_at(i);
+      return chunk;
+    }
+  }
+  return nullptr;
+}
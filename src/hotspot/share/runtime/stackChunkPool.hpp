@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_RUNTIME_STACKCHUNKPOOL_HPP
+#define SHARE_RUNTIME_STACKCHUNKPOOL_HPP
+
+#include "oops/oopsHierarchy.hpp"
+#include "oops/weakHandle.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// A small per-carrier-thread cache of stack chunks that became empty when the
+// last frames of a continuation were thawed, so that a later freeze on the
+// same thread can reuse one instead of allocating a new StackChunk.
+//
+// The chunks are held through WeakHandles: the pool does not keep them alive,
+// and a GC clears any pooled chunk rather than tracing it. A chunk is only
+// handed out again if ContinuationGCSupport::can_recycle_stack_chunk() says
+// the GC has not seen it since it was pooled.
+//
+// Only the owning JavaThread adds or removes chunks.
+class StackChunkPool {
+  static const int MaxChunks = 16;
+
+  WeakHandle _chunks[MaxChunks];
+  int        _count;
+
+  void remove_at(int i);
+
+ public:
+  StackChunkPool() : _count(0) {}
+  ~StackChunkPool();
+
+  // Caches an empty chunk. Returns false if the pool is full or disabled.
+  bool add(stackChunkOop chunk);
+
+  // Returns a cached chunk with room for at least stack_size words, or null.
+  stackChunkOop remove(size_t stack_size);
+};
+
+#endif // SHARE_RUNTIME_STACKCHUNKPOOL_HPP
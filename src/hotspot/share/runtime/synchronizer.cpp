@@ -24,6 +24,7 @@
 
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -1037,6 +1038,89 @@ size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointe
   return deflated_count;
 }
 
+// Deflates a chunk of monitors from the in-use list in parallel.
+class DeflateMonitorsTask : public WorkerTask {
+  static const size_t ClaimSize = 256;
+
+  const GrowableArray<ObjectMonitor*>* const _monitors;
+  const size_t                               _max_deflated;
+  volatile size_t                            _claimed;
+  volatile size_t                            _deflated_count;
+
+public:
+  DeflateMonitorsTask(const GrowableArray<ObjectMonitor*>* monitors, size_t max_deflated) :
+    WorkerTask("Monitor Deflation"),
+    _monitors(monitors),
+    _max_deflated(max_deflated),
+    _claimed(0),
+    _deflated_count(0) {}
+
+  size_t deflated_count() const { return AtomicAccess::load(&_deflated_count); }
+
+  void work(uint worker_id) {
+    Thread* current = Thread::current();
+    const size_t length = (size_t)_monitors->length();
+    // The deflated count is checked once per claim, so at most
+    // ClaimSize monitors per worker are deflated past the maximum.
+    while (deflated_count() < _max_deflated) {
+      const size_t start = AtomicAccess::fetch_then_add(&_claimed, ClaimSize);
+      if (start >= length) {
+        return;
+      }
+      const size_t end = MIN2(start + ClaimSize, length);
+      size_t deflated = 0;
+      for (size_t i = start; i < end; i++) {
+        if (_monitors->at((int)i)->deflate_monitor(current)) {
+          deflated++;
+        }
+      }
+      AtomicAccess::add(&_deflated_count, deflated);
+    }
+  }
+};
+
+static WorkerThreads* _deflation_workers = nullptr;
+
+WorkerThreads* ObjectSynchronizer::deflation_workers() {
+  if (MonitorDeflationWorkers == 0) {
+    return nullptr;
+  }
+  // Only the MonitorDeflationThread deflates, so no synchronization is needed.
+  if (_deflation_workers == nullptr) {
+    _deflation_workers = new WorkerThreads("MonitorDeflation Worker", MonitorDeflationWorkers);
+    _deflation_workers->set_active_workers(MonitorDeflationWorkers);
+  }
+  // Worker creation may have failed.
+  return _deflation_workers->active_workers() > 0 ? _deflation_workers : nullptr;
+}
+
+// Same as deflate_monitor_list() but the monitors are gathered into chunks which
+// are deflated by the workers. The MonitorDeflationThread stays in the VM while
+// a chunk is deflated, so the chunks are kept small to not delay safepoints.
+size_t ObjectSynchronizer::deflate_monitor_list_parallel(WorkerThreads* workers,
+                                                         ObjectMonitorDeflationSafepointer* safepointer) {
+  const int chunk_size = 16 * K;
+  ResourceMark rm;
+  GrowableArray<ObjectMonitor*> chunk(chunk_size);
+  MonitorList::Iterator iter = _in_use_list.iterator();
+  size_t deflated_count = 0;
+
+  while (iter.has_next() && deflated_count < (size_t)MonitorDeflationMax) {
+    chunk.clear();
+    while (iter.has_next() && chunk.length() < chunk_size) {
+      chunk.append(iter.next());
+    }
+    DeflateMonitorsTask task(&chunk, (size_t)MonitorDeflationMax - deflated_count);
+    workers->run_task(&task);
+    deflated_count += task.deflated_count();
+
+    // Must check for a safepoint/handshake and honor it.
+    safepointer->block_for_safepoint("deflation", "deflated_count", deflated_count);
+  }
+
+  return deflated_count;
+}
+
 class DeflationHandshakeClosure : public HandshakeClosure {
  public:
   DeflationHandshakeClosure() : HandshakeClosure("DeflationHandshakeClosure") {}
@@ -1179,13 +1263,16 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   _last_async_deflation_time_ns = os::javaTimeNanos();
   set_is_async_deflation_requested(false);
 
+  EventJavaMonitorDeflationCycle event;
   ObjectMonitorDeflationLogging log;
   ObjectMonitorDeflationSafepointer safepointer(current, &log);
 
   log.begin();
 
   // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(&safepointer);
+  WorkerThreads* const workers = deflation_workers();
+  size_t deflated_count = workers != nullptr ? deflate_monitor_list_parallel(workers, &safepointer)
+                                             : deflate_monitor_list(&safepointer);
 
   // Unlink the deflated ObjectMonitors from the in-use list.
   size_t unlinked_count = 0;
@@ -1223,10 +1310,23 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
     // Delete the unlinked ObjectMonitors.
     deleted_count = delete_monitors(&delete_list, &safepointer);
     assert(unlinked_count == deleted_count, "must be");
+
+    if (UseObjectMonitorTable) {
+      // Deflation may have left the table sparse after a contention spike.
+      ObjectMonitorTable::try_notify_shrink();
+    }
   }
 
   log.end(deflated_count, unlinked_count);
 
+  if (event.should_commit()) {
+    event.set_deflatedMonitors(deflated_count);
+    event.set_deletedMonitors(deleted_count);
+    event.set_workers(workers != nullptr ? workers->active_workers() : 0);
+    event.set_inUseMonitors(in_use_list_count());
+    event.commit();
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
@@ -2325,6 +2425,13 @@ ObjectMonitor* ObjectSynchronizer::read_monitor(Thread* current, oop obj, markWo
   if (!UseObjectMonitorTable) {
     return read_monitor(mark);
   } else {
+    // Recently inflated or entered monitors are cached by the current thread.
+    if (current->is_Java_thread() && current == Thread::current()) {
+      ObjectMonitor* monitor = JavaThread::cast(current)->om_get_from_monitor_cache(obj);
+      if (monitor != nullptr) {
+        return monitor;
+      }
+    }
     return ObjectSynchronizer::get_monitor_from_table(current, obj);
   }
 }
@@ -37,6 +37,7 @@ class LogStream;
 class ObjectMonitor;
 class ObjectMonitorDeflationSafepointer;
 class ThreadsList;
+class WorkerThreads;
 
 class MonitorList {
   friend class VMStructs;
@@ -169,6 +170,9 @@ class ObjectSynchronizer : AllStatic {
 
   // Deflate idle monitors:
   static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer);
+  static size_t deflate_monitor_list_parallel(WorkerThreads* workers, ObjectMonitorDeflationSafepointer* safepointer);
+  // Returns the workers for parallel deflation, or null if deflating serially.
+  static WorkerThreads* deflation_workers();
   static size_t in_use_list_count();
   static size_t in_use_list_max();
   static size_t in_use_list_ceiling();
@@ -30,6 +30,7 @@
 #include "gc/shared/threadLocalAllocBuffer.hpp"
 #include "jni.h"
 #include "memory/allocation.hpp"
+#include "memory/arena.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/atomicAccess.hpp"
 #include "runtime/globals.hpp"
@@ -391,6 +392,7 @@ class Thread: public ThreadShadow {
 
   // Resource area
   ResourceArea* resource_area() const            { return _resource_area; }
+  ChunkThreadCache* chunk_thread_cache()         { return &_chunk_thread_cache; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
   OSThread* osthread() const                     { return _osthread;   }
@@ -515,6 +517,9 @@ class Thread: public ThreadShadow {
   // Thread local resource area for temporary allocation within the VM
   ResourceArea* _resource_area;
 
+  // Free arena chunks kept for reuse by this thread
+  ChunkThreadCache _chunk_thread_cache;
+
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
   // Thread local handle area for allocation of handles within the VM
@@ -25,6 +25,7 @@
 #include "classfile/javaClasses.inline.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/atomicAccess.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
@@ -42,6 +43,7 @@
 #include "utilities/hashTable.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/powerOfTwo.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/vmError.hpp"
 
 // The '_cnt', '_max' and '_times" fields are enabled via
@@ -732,6 +734,60 @@ JavaThread* ThreadsList::find_JavaThread_from_java_tid(jlong java_tid) const {
   return nullptr;
 }
 
+void ThreadsList::find_JavaThreads_from_java_tids(const jlong* java_tids, int count, JavaThread** threads) const {
+  ThreadIdTable::lazy_initialize(this);
+  int* const missing = NEW_RESOURCE_ARRAY(int, count);
+  int num_missing = 0;
+  for (int i = 0; i < count; i++) {
+    JavaThread* const thread = ThreadIdTable::find_thread_by_tid(java_tids[i]);
+    if (thread == nullptr) {
+      missing[num_missing++] = i;
+    }
+    threads[i] = (thread != nullptr && !thread->is_exiting()) ? thread : nullptr;
+  }
+  if (num_missing == 0) {
+    return;
+  }
+
+  // Sort the missing entries by ID, to look up each thread of the list among them
+  QuickSort::sort(missing, (size_t)num_missing, [&](const int& a, const int& b) {
+    return java_tids[a] < java_tids[b] ? -1 : (java_tids[a] > java_tids[b] ? 1 : 0);
+  });
+  for (uint i = 0; i < length(); i++) {
+    JavaThread* const thread = thread_at(i);
+    oop tobj = thread->threadObj();
+    // Ignore the thread if it hasn't run yet, has exited
+    // or is starting to exit.
+    if (tobj == nullptr) {
+      continue;
+    }
+    const jlong java_tid = java_lang_Thread::thread_id(tobj);
+    int low = 0;
+    int high = num_missing;
+    while (low < high) {
+      const int mid = low + (high - low) / 2;
+      if (java_tids[missing[mid]] < java_tid) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    if (low == num_missing || java_tids[missing[low]] != java_tid) {
+      continue;
+    }
+    MutexLocker ml(Threads_lock);
+    // Must be inside the lock to ensure that we don't add a thread to the table
+    // that has just passed the removal point in Threads::remove().
+    if (!thread->is_exiting()) {
+      ThreadIdTable::add_thread(java_tid, thread);
+      // The same ID may have been asked for more than once
+      for (int j = low; j < num_missing && java_tids[missing[j]] == java_tid; j++) {
+        threads[missing[j]] = thread;
+      }
+    }
+  }
+}
+
 void ThreadsList::inc_nested_handle_cnt() {
   AtomicAccess::inc(&_nested_handle_cnt);
 }
@@ -918,6 +974,10 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     return;
   }
 
+  // Wait for any ThreadsListCriticalSection that may still refer to
+  // this ThreadsList, or to a JavaThread only found on it.
+  GlobalCounter::write_synchronize();
+
   threads->set_next_list(_to_delete_list);
   _to_delete_list = threads;
   if (EnableThreadSMRStatistics) {
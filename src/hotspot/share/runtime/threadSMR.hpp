@@ -28,8 +28,10 @@
 #include "memory/allocation.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointVerifiers.hpp"
 #include "runtime/timer.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/globalCounter.hpp"
 
 class JavaThread;
 class Monitor;
@@ -75,6 +77,10 @@ class ThreadsList;
 // but that target JavaThread* will not be deleted until it is no
 // longer protected by a ThreadsListHandle.
 //
+// For short, read-only iterations a ThreadsListCriticalSection can be
+// used instead. It protects the ThreadsList with a GlobalCounter
+// critical section rather than a hazard pointer, see below.
+//
 // SMR Support for the Threads class.
 //
 class ThreadsSMRSupport : AllStatic {
@@ -195,6 +201,10 @@ class ThreadsList : public CHeapObj<mtThread> {
   // Returns -1 if target is not found.
   int find_index_of_JavaThread(JavaThread* target);
   JavaThread* find_JavaThread_from_java_tid(jlong java_tid) const;
+  // Batched variant, setting threads[i] to the thread with java_tids[i] or
+  // nullptr. The IDs missing in the ThreadIdTable are all resolved with a
+  // single linear search of the list. Caller must have a ResourceMark.
+  void find_JavaThreads_from_java_tids(const jlong* java_tids, int count, JavaThread** threads) const;
   bool includes(const JavaThread * const p) const;
 
 #ifdef ASSERT
@@ -322,6 +332,45 @@ class ThreadsListHandle : public StackObj {
   }
 };
 
+// This stack allocated ThreadsListCriticalSection keeps all JavaThreads
+// in the current ThreadsList from being deleted while it is in scope, like
+// a ThreadsListHandle. The ThreadsList is protected by a GlobalCounter
+// critical section instead of a hazard pointer, so no CAS or fence is
+// needed. This makes it suitable for monitoring code that iterates over
+// all threads at high frequency.
+//
+// A ThreadsList is only freed after a GlobalCounter::write_synchronize(),
+// which is done with the Threads_lock held. The holder of this critical
+// section must therefore not safepoint, block, or take the Threads_lock
+// (e.g. via ThreadsList::find_JavaThread_from_java_tid()).
+//
+class ThreadsListCriticalSection : public StackObj {
+  Thread* const            _thread;
+  GlobalCounter::CSContext _context;
+  ThreadsList*             _list;
+  NoSafepointVerifier      _nsv;
+
+public:
+  inline ThreadsListCriticalSection(Thread* thread = Thread::current());
+  inline ~ThreadsListCriticalSection();
+
+  ThreadsList* list() const {
+    return _list;
+  }
+
+  using Iterator = ThreadsList::Iterator;
+  inline Iterator begin();
+  inline Iterator end();
+
+  uint length() const {
+    return list()->length();
+  }
+
+  JavaThread* thread_at(uint i) const {
+    return list()->thread_at(i);
+  }
+};
+
 // This stack allocated FastThreadsListHandle implements the special case
 // where we want to quickly determine if a JavaThread* is protected by the
 // embedded ThreadsListHandle.
@@ -34,6 +34,7 @@
 #include "runtime/javaThread.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/globalCounter.inline.hpp"
 #include "utilities/macros.hpp"
 
 ThreadsList::Iterator::Iterator(ThreadsList* list, uint i) :
@@ -110,6 +111,23 @@ inline void ThreadsList::threads_do(T *cl) const {
 ThreadsListHandle::Iterator ThreadsListHandle::begin() { return list()->begin(); }
 ThreadsListHandle::Iterator ThreadsListHandle::end() { return list()->end(); }
 
+inline ThreadsListCriticalSection::ThreadsListCriticalSection(Thread* thread) :
+    _thread(thread),
+    _context(GlobalCounter::critical_section_begin(thread)),
+    // Loaded within the critical section, pairs with the write_synchronize()
+    // in ThreadsSMRSupport::free_list().
+    _list(ThreadsSMRSupport::get_java_thread_list()),
+    _nsv() {
+  assert(thread == Thread::current(), "sanity check");
+}
+
+inline ThreadsListCriticalSection::~ThreadsListCriticalSection() {
+  GlobalCounter::critical_section_end(_thread, _context);
+}
+
+ThreadsListCriticalSection::Iterator ThreadsListCriticalSection::begin() { return list()->begin(); }
+ThreadsListCriticalSection::Iterator ThreadsListCriticalSection::end() { return list()->end(); }
+
 // These three inlines are private to ThreadsSMRSupport, but
 // they are called by public inline update_tlh_stats() below:
 
@@ -25,6 +25,7 @@
  */
 
 #include "logging/log.hpp"
+#include "memory/arena.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/mutex.hpp"
@@ -48,6 +49,7 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   Monitor* const _lock;
   bool _stop;
+  bool _trimming;
   uint16_t _suspend_count;
 
   // Statistics
@@ -122,12 +124,18 @@ class NativeHeapTrimmerThread : public NamedThread {
 
           tnow = now();
         }
+        _trimming = true;
       }
 
       log_trace(trimnative)("Times: %u suspended, %u timed, %u safepoint",
                             times_suspended, times_waited, times_safepoint);
 
       execute_trim_and_log(tnow);
+
+      {
+        MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+        _trimming = false;
+      }
     }
   }
 
@@ -139,6 +147,9 @@ class NativeHeapTrimmerThread : public NamedThread {
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
 
+    // Free the pooled arena chunks first, so that their memory can be trimmed, too.
+    Arena::clean_chunk_pools();
+
     // We only collect size change information if we are logging; save the access to procfs otherwise.
     if (os::trim_native_heap(logging_enabled ? &sc : nullptr)) {
       _num_trims_performed++;
@@ -165,6 +176,7 @@ class NativeHeapTrimmerThread : public NamedThread {
   NativeHeapTrimmerThread() :
     _lock(new PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
+    _trimming(false),
     _suspend_count(0),
     _num_trims_performed(0)
   {
@@ -185,6 +197,21 @@ class NativeHeapTrimmerThread : public NamedThread {
     log_debug(trimnative)("Trim suspended for %s (%u suspend requests)", reason, n);
   }
 
+  // Fails, rather than waiting for it, if a trim is in progress.
+  bool try_suspend(const char* reason) {
+    assert(NativeHeapTrimmer::enabled(), "Only call if enabled");
+    uint16_t n = 0;
+    {
+      MonitorLocker ml(_lock, Mutex::_no_safepoint_check_flag);
+      if (_trimming) {
+        return false;
+      }
+      n = inc_suspend_count();
+    }
+    log_debug(trimnative)("Trim suspended for %s (%u suspend requests)", reason, n);
+    return true;
+  }
+
   void resume(const char* reason) {
     assert(NativeHeapTrimmer::enabled(), "Only call if enabled");
     uint16_t n = 0;
@@ -252,6 +279,13 @@ void NativeHeapTrimmer::suspend_periodic_trim(const char* reason) {
   }
 }
 
+bool NativeHeapTrimmer::try_suspend_periodic_trim(const char* reason) {
+  if (g_trimmer_thread != nullptr) {
+    return g_trimmer_thread->try_suspend(reason);
+  }
+  return true;
+}
+
 void NativeHeapTrimmer::resume_periodic_trim(const char* reason) {
   if (g_trimmer_thread != nullptr) {
     g_trimmer_thread->resume(reason);
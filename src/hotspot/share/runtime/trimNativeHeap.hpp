@@ -37,6 +37,10 @@ class NativeHeapTrimmer : public AllStatic {
   // Pause periodic trim (if enabled).
   static void suspend_periodic_trim(const char* reason);
 
+  // Pause periodic trim (if enabled), unless a trim is in progress.
+  // Returns false if it is.
+  static bool try_suspend_periodic_trim(const char* reason);
+
   // Unpause periodic trim (if enabled).
   static void resume_periodic_trim(const char* reason);
 
@@ -64,6 +68,23 @@ class NativeHeapTrimmer : public AllStatic {
       }
     }
   };
+
+  // Like SuspendMark, but does not pause periodic trimming if a trim is in
+  // progress, for callers that must not wait for it. Check suspended()
+  // before doing the work the trim should not overlap with.
+  struct TrySuspendMark {
+    const char* const _reason;
+    const bool _suspended;
+    TrySuspendMark(const char* reason = "unknown") :
+      _reason(reason),
+      _suspended(!NativeHeapTrimmer::enabled() || try_suspend_periodic_trim(reason)) {}
+    ~TrySuspendMark() {
+      if (NativeHeapTrimmer::enabled() && _suspended) {
+        resume_periodic_trim(_reason);
+      }
+    }
+    bool suspended() const { return _suspended; }
+  };
 };
 
 #endif // SHARE_RUNTIME_TRIMNATIVEHEAP_HPP
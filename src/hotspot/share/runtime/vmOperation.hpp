@@ -49,6 +49,7 @@
   template(HeapDumper)                            \
   template(CollectForMetadataAllocation)          \
   template(GC_HeapInspection)                     \
+  template(EpsilonClearReferences)                \
   template(SerialCollectForAllocation)            \
   template(SerialGCCollect)                       \
   template(ParallelCollectForAllocation)          \
@@ -30,6 +30,7 @@
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/perfData.inline.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/defaultStream.hpp"
@@ -63,17 +64,17 @@
 
 #if INCLUDE_MANAGEMENT
 // counters for classes loaded from class files
-PerfCounter*    ClassLoadingService::_classes_loaded_count = nullptr;
-PerfCounter*    ClassLoadingService::_classes_unloaded_count = nullptr;
-PerfCounter*    ClassLoadingService::_classbytes_loaded = nullptr;
-PerfCounter*    ClassLoadingService::_classbytes_unloaded = nullptr;
+PerfStripedCounter* ClassLoadingService::_classes_loaded_count = nullptr;
+PerfCounter*        ClassLoadingService::_classes_unloaded_count = nullptr;
+PerfStripedCounter* ClassLoadingService::_classbytes_loaded = nullptr;
+PerfCounter*        ClassLoadingService::_classbytes_unloaded = nullptr;
 
 // counters for classes loaded from shared archive
-PerfCounter*    ClassLoadingService::_shared_classes_loaded_count = nullptr;
-PerfCounter*    ClassLoadingService::_shared_classes_unloaded_count = nullptr;
-PerfCounter*    ClassLoadingService::_shared_classbytes_loaded = nullptr;
-PerfCounter*    ClassLoadingService::_shared_classbytes_unloaded = nullptr;
-PerfVariable*   ClassLoadingService::_class_methods_size = nullptr;
+PerfStripedCounter* ClassLoadingService::_shared_classes_loaded_count = nullptr;
+PerfCounter*        ClassLoadingService::_shared_classes_unloaded_count = nullptr;
+PerfStripedCounter* ClassLoadingService::_shared_classbytes_loaded = nullptr;
+PerfCounter*        ClassLoadingService::_shared_classbytes_unloaded = nullptr;
+PerfVariable*       ClassLoadingService::_class_methods_size = nullptr;
 
 void ClassLoadingService::init() {
   EXCEPTION_MARK;
@@ -82,16 +83,16 @@ void ClassLoadingService::init() {
   // They are created even if -XX:-UsePerfData is set and in
   // that case, they will be allocated on C heap.
   _classes_loaded_count =
-                 PerfDataManager::create_counter(JAVA_CLS, "loadedClasses",
-                                                 PerfData::U_Events, CHECK);
+                 PerfDataManager::create_striped_counter(JAVA_CLS, "loadedClasses",
+                                                         PerfData::U_Events, CHECK);
 
   _classes_unloaded_count =
                  PerfDataManager::create_counter(JAVA_CLS, "unloadedClasses",
                                                  PerfData::U_Events, CHECK);
 
   _shared_classes_loaded_count =
-                 PerfDataManager::create_counter(JAVA_CLS, "sharedLoadedClasses",
-                                                 PerfData::U_Events, CHECK);
+                 PerfDataManager::create_striped_counter(JAVA_CLS, "sharedLoadedClasses",
+                                                         PerfData::U_Events, CHECK);
 
   _shared_classes_unloaded_count =
                  PerfDataManager::create_counter(JAVA_CLS, "sharedUnloadedClasses",
@@ -99,15 +100,15 @@ void ClassLoadingService::init() {
 
   if (UsePerfData) {
     _classbytes_loaded =
-                 PerfDataManager::create_counter(SUN_CLS, "loadedBytes",
-                                                 PerfData::U_Bytes, CHECK);
+                 PerfDataManager::create_striped_counter(SUN_CLS, "loadedBytes",
+                                                         PerfData::U_Bytes, CHECK);
 
     _classbytes_unloaded =
                  PerfDataManager::create_counter(SUN_CLS, "unloadedBytes",
                                                  PerfData::U_Bytes, CHECK);
     _shared_classbytes_loaded =
-                 PerfDataManager::create_counter(SUN_CLS, "sharedLoadedBytes",
-                                                 PerfData::U_Bytes, CHECK);
+                 PerfDataManager::create_striped_counter(SUN_CLS, "sharedLoadedBytes",
+                                                         PerfData::U_Bytes, CHECK);
 
     _shared_classbytes_unloaded =
                  PerfDataManager::create_counter(SUN_CLS, "sharedUnloadedBytes",
@@ -207,14 +208,14 @@ static size_t compute_class_size(InstanceKlass* k) {
 
 void ClassLoadingService::notify_class_loaded(InstanceKlass* k, bool shared_class) {
   DTRACE_CLASSLOAD_PROBE(loaded, k, shared_class);
-  PerfCounter* classes_counter = (shared_class ? _shared_classes_loaded_count
-                                               : _classes_loaded_count);
+  PerfStripedCounter* classes_counter = (shared_class ? _shared_classes_loaded_count
+                                                      : _classes_loaded_count);
   // increment the count
   classes_counter->inc();
 
   if (UsePerfData) {
-    PerfCounter* classbytes_counter = (shared_class ? _shared_classbytes_loaded
-                                                    : _classbytes_loaded);
+    PerfStripedCounter* classbytes_counter = (shared_class ? _shared_classbytes_loaded
+                                                           : _classbytes_loaded);
     // add the class size
     size_t size = compute_class_size(k);
     classbytes_counter->inc(size);
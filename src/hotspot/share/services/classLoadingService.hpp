@@ -37,18 +37,18 @@ class InstanceKlass;
 class ClassLoadingService : public AllStatic {
  private:
   // Counters for classes loaded from class files
-  static PerfCounter*  _classes_loaded_count;
-  static PerfCounter*  _classes_unloaded_count;
-  static PerfCounter*  _classbytes_loaded;
-  static PerfCounter*  _classbytes_unloaded;
+  static PerfStripedCounter* _classes_loaded_count;
+  static PerfCounter*        _classes_unloaded_count;
+  static PerfStripedCounter* _classbytes_loaded;
+  static PerfCounter*        _classbytes_unloaded;
 
   // Counters for classes loaded from shared archive
-  static PerfCounter*  _shared_classes_loaded_count;
-  static PerfCounter*  _shared_classes_unloaded_count;
-  static PerfCounter*  _shared_classbytes_loaded;
-  static PerfCounter*  _shared_classbytes_unloaded;
+  static PerfStripedCounter* _shared_classes_loaded_count;
+  static PerfCounter*        _shared_classes_unloaded_count;
+  static PerfStripedCounter* _shared_classbytes_loaded;
+  static PerfCounter*        _shared_classbytes_unloaded;
 
-  static PerfVariable* _class_methods_size;
+  static PerfVariable*       _class_methods_size;
 
  public:
   static void init() NOT_MANAGEMENT_RETURN;
@@ -111,6 +111,7 @@ void DCmd::register_dcmds() {
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ReferenceStatsDCmd>(full_export));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemDictionaryDCmd>(full_export));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHierarchyDCmd>(full_export));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassesDCmd>(full_export));
@@ -529,9 +530,14 @@ ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
        "1 means use one thread (disable parallelism). "
        "For any other value the VM will try to use the specified number of "
        "threads, but might use fewer.",
-       "INT", false, "0") {
+       "INT", false, "0"),
+  _references("-references",
+       "Also print the number of java.lang.ref.Reference instances "
+       "by reference type and ReferenceQueue state",
+       "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_option(&_parallel_thread_num);
+  _dcmdparser.add_dcmd_option(&_references);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
@@ -545,10 +551,41 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
       : num;
   VM_GC_HeapInspection heapop(output(),
                               !_all.value(), /* request full gc if false */
-                              parallel_thread_num);
+                              parallel_thread_num,
+                              _references.value());
   VMThread::execute(&heapop);
 }
 
+ReferenceStatsDCmd::ReferenceStatsDCmd(outputStream* output, bool heap) :
+                                       DCmdWithParser(output, heap),
+  _all("-all", "Inspect all references, including unreachable ones",
+       "BOOLEAN", false, "false"),
+  _parallel_thread_num("-parallel",
+       "Number of parallel threads to use for heap inspection. "
+       "0 (the default) means let the VM determine the number of threads to use. "
+       "1 means use one thread (disable parallelism). "
+       "For any other value the VM will try to use the specified number of "
+       "threads, but might use fewer.",
+       "INT", false, "0") {
+  _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_parallel_thread_num);
+}
+
+void ReferenceStatsDCmd::execute(DCmdSource source, TRAPS) {
+  jlong num = _parallel_thread_num.value();
+  if (num < 0) {
+    output()->print_cr("Parallel thread number out of range (>=0): " JLONG_FORMAT, num);
+    return;
+  }
+  uint parallel_thread_num = num == 0
+      ? MAX2<uint>(1, (uint)os::initial_active_processor_count() * 3 / 8)
+      : num;
+  VM_GC_ReferenceStats op(output(),
+                          !_all.value(), /* request full gc if false */
+                          parallel_thread_num);
+  VMThread::execute(&op);
+}
+
 #endif // INCLUDE_SERVICES
 
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
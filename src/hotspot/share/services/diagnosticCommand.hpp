@@ -288,8 +288,9 @@ class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
   DCmdArgument<jlong> _parallel_thread_num;
+  DCmdArgument<bool> _references;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "GC.class_histogram";
@@ -303,6 +304,26 @@ class ClassHistogramDCmd : public DCmdWithParser {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ReferenceStatsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _all;
+  DCmdArgument<jlong> _parallel_thread_num;
+public:
+  static int num_arguments() { return 2; }
+  ReferenceStatsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "GC.reference_stats";
+  }
+  static const char* description() {
+    return "Provide statistics about java.lang.ref.Reference instances "
+           "by class and ReferenceQueue state.";
+  }
+  static const char* impact() {
+    return "High: Depends on Java heap size and content.";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class ClassHierarchyDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _print_interfaces; // true if inherited interfaces should be printed.
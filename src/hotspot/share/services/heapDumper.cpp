@@ -44,6 +44,7 @@
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomicAccess.hpp"
 #include "runtime/continuationWrapper.inline.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -60,11 +61,17 @@
 #include "services/heapDumper.hpp"
 #include "services/heapDumperCompression.hpp"
 #include "services/threadService.hpp"
+#include "utilities/align.hpp"
 #include "utilities/checkedCast.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/spinYield.hpp"
 #ifdef LINUX
 #include "os_linux.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #endif
 
 /*
@@ -417,6 +424,10 @@ class AbstractDumpWriter : public CHeapObj<mtInternal> {
 
   void write_address(address a);
 
+  // Flushes the internal buffer while a record has been written only partially,
+  // the rest of the record follows with the next flush.
+  virtual void flush_unfinished_record()        { flush(); }
+
  public:
   AbstractDumpWriter() :
     _buffer(nullptr),
@@ -478,7 +489,7 @@ void AbstractDumpWriter::write_raw(const void* s, size_t len) {
     s = (void*) ((char*) s + to_write);
     len -= to_write;
     set_position(position() + to_write);
-    flush();
+    flush_unfinished_record();
   }
 
   memcpy(buffer() + position(), s, len);
@@ -602,8 +613,171 @@ void AbstractDumpWriter::end_sub_record() {
   assert(_sub_record_left == 0, "sub-record not written completely");
   assert(!_sub_record_ended, "Must not have ended yet");
   DEBUG_ONLY(_sub_record_ended = true);
+
+  // A huge sub-record has been flushed in parts already, also flush its
+  // remaining part now so that nothing else is written in between.
+  if (_is_huge_sub_record) {
+    finish_dump_segment();
+  }
+}
+
+#ifdef LINUX
+// A region of the dump file that all dumpers write their heap dump segments
+// to directly, so the separate segment files and the merge step are not
+// needed. The region starts after the records written before the heap
+// iteration, it is preallocated for the estimated dump size and mapped.
+//
+// A dumper reserves the space for each flushed buffer by bumping a shared
+// cursor. Space that is reserved beyond the mapped capacity is written with
+// pwrite, so an underestimated dump size only costs performance.
+//
+// Dumpers only flush at record boundaries, except when writing records that
+// are larger than the buffer. The parts of such a record have to end up next
+// to each other, so its dumper pins the cursor while flushing them and the
+// other dumpers wait until the last part has been reserved.
+class DumpSegmentArea : public CHeapObj<mtServiceability> {
+private:
+  static const uint64_t pinned_bit = (uint64_t)1 << 63;
+
+  const int      _fd;
+  const jlong    _file_offset;  // File offset of the start of the area
+  char*          _map_base;     // Page aligned start of the mapping
+  size_t         _map_size;
+  char*          _base;         // Start of the area inside the mapping
+  const size_t   _capacity;     // Mapped size of the area
+  volatile uint64_t _top;       // Reserved size of the area, and the pinned bit
+
+  DumpSegmentArea(int fd, jlong file_offset, char* map_base, size_t map_size, size_t capacity) :
+    _fd(fd),
+    _file_offset(file_offset),
+    _map_base(map_base),
+    _map_size(map_size),
+    _base(map_base + (map_size - capacity)),
+    _capacity(capacity),
+    _top(0) {}
+
+  void unmap();
+
+public:
+  ~DumpSegmentArea() { unmap(); }
+
+  // Preallocates and maps 'capacity' bytes of the file starting at 'file_offset'.
+  // Returns null if the file system cannot provide the space.
+  static DumpSegmentArea* create(int fd, jlong file_offset, size_t capacity);
+
+  // Estimated size of the heap dump segments of the current heap.
+  static size_t estimated_capacity(bool compressed);
+
+  // Reserves 'size' bytes and returns their offset in the area. 'pinned' tells
+  // whether the caller holds the pin, 'pin' whether it holds it afterwards.
+  uint64_t reserve(size_t size, bool pinned, bool pin);
+
+  // Writes 'size' bytes at 'offset' in the area. Returns null on success and
+  // a static error message otherwise.
+  char const* write(uint64_t offset, const char* buf, size_t size);
+
+  // Unmaps the area and truncates the file after the reserved part. Returns
+  // the new file size, or -1 on failure.
+  jlong complete();
+};
+
+DumpSegmentArea* DumpSegmentArea::create(int fd, jlong file_offset, size_t capacity) {
+  const jlong map_offset = align_down(file_offset, (jlong)os::vm_page_size());
+  const size_t map_size = (size_t)(file_offset - map_offset) + capacity;
+  int ret = posix_fallocate(fd, (off_t)file_offset, (off_t)capacity);
+  if (ret != 0) {
+    log_info(heapdump)("Preallocation of %zu bytes for heap dump segments failed (%d)", capacity, ret);
+    os::ftruncate(fd, file_offset);
+    return nullptr;
+  }
+  char* map_base = (char*)::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, (off_t)map_offset);
+  if (map_base == MAP_FAILED) {
+    log_info(heapdump)("Mapping of %zu bytes for heap dump segments failed (%d)", map_size, errno);
+    os::ftruncate(fd, file_offset);
+    return nullptr;
+  }
+  return new (std::nothrow) DumpSegmentArea(fd, file_offset, map_base, map_size, capacity);
+}
+
+size_t DumpSegmentArea::estimated_capacity(bool compressed) {
+  // Object records are larger than the objects when references are compressed
+  // in the heap, while compressed dumps are usually a fraction of the heap size.
+  const size_t used = Universe::heap()->used();
+  const size_t estimate = compressed ? used / 4 : used + used / 2;
+  return align_up(MAX2(estimate, (size_t)M), os::vm_page_size());
+}
+
+uint64_t DumpSegmentArea::reserve(size_t size, bool pinned, bool pin) {
+  if (pinned) {
+    // Nobody else updates the cursor while we hold the pin.
+    const uint64_t cur = AtomicAccess::load(&_top);
+    assert((cur & pinned_bit) != 0, "must be pinned");
+    const uint64_t next = cur + size;
+    AtomicAccess::release_store(&_top, pin ? next : (next & ~pinned_bit));
+    return cur & ~pinned_bit;
+  }
+
+  SpinYield spin;
+  uint64_t cur = AtomicAccess::load_acquire(&_top);
+  while (true) {
+    if ((cur & pinned_bit) != 0) {
+      spin.wait();
+      cur = AtomicAccess::load_acquire(&_top);
+      continue;
+    }
+    const uint64_t next = cur + size;
+    const uint64_t prev = AtomicAccess::cmpxchg(&_top, cur, pin ? (next | pinned_bit) : next);
+    if (prev == cur) {
+      return cur;
+    }
+    cur = prev;
+  }
+}
+
+char const* DumpSegmentArea::write(uint64_t offset, const char* buf, size_t size) {
+  if (offset < _capacity) {
+    const size_t mapped = MIN2(size, (size_t)(_capacity - offset));
+    memcpy(_base + offset, buf, mapped);
+    buf += mapped;
+    size -= mapped;
+    offset += mapped;
+  }
+  while (size > 0) {
+    ssize_t ret = ::pwrite(_fd, buf, size, (off_t)(_file_offset + offset));
+    if (ret == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return os::strerror(errno);
+    }
+    buf += ret;
+    size -= ret;
+    offset += ret;
+  }
+  return nullptr;
+}
+
+void DumpSegmentArea::unmap() {
+  if (_map_base != nullptr) {
+    ::munmap(_map_base, _map_size);
+    _map_base = nullptr;
+  }
 }
 
+jlong DumpSegmentArea::complete() {
+  const uint64_t used = AtomicAccess::load_acquire(&_top);
+  assert((used & pinned_bit) == 0, "must not be pinned");
+  unmap();
+  // Drop the preallocated space that has not been used, and continue
+  // sequential writing after the heap dump segments.
+  const jlong end = _file_offset + (jlong)used;
+  if (os::ftruncate(_fd, end) != 0 || os::seek_to_file_offset(_fd, end) != end) {
+    return -1;
+  }
+  return end;
+}
+#endif // LINUX
+
 // Supports I/O operations for a dump
 
 class DumpWriter : public AbstractDumpWriter {
@@ -618,12 +792,28 @@ class DumpWriter : public AbstractDumpWriter {
   size_t _out_pos;
   char* _tmp_buffer;
   size_t _tmp_size;
+#ifdef LINUX
+  // Direct writing of heap dump segments
+  DumpSegmentArea* _segment_area;
+  bool _pinned;
+#endif
 
 private:
+  void init_buffers();
   void do_compress();
+  void flush_buffer(bool unfinished_record);
+  char const* write_buf(char* buf, size_t size, bool unfinished_record);
+  LINUX_ONLY(void release_pin();)
+
+protected:
+  void flush_unfinished_record() override     { flush_buffer(true); }
 
 public:
   DumpWriter(const char* path, bool overwrite, AbstractCompressor* compressor);
+#ifdef LINUX
+  // Writes to the given area of the dump file.
+  DumpWriter(DumpSegmentArea* area, AbstractCompressor* compressor);
+#endif
   ~DumpWriter();
   julong bytes_written() const override        { return (julong) _bytes_written; }
   char const* error() const override           { return _error; }
@@ -641,6 +831,12 @@ class DumpWriter : public AbstractDumpWriter {
   void set_bytes_written(julong bytes_written) { _bytes_written = bytes_written; }
   int get_fd() const                           { return _writer->get_fd(); }
   void set_compressor(AbstractCompressor* p)   { _compressor = p; }
+
+  // internals for VM_HeapDumper
+  friend class VM_HeapDumper;
+#ifdef LINUX
+  void set_segment_area(DumpSegmentArea* area) { assert(!_pinned, "must not be pinned"); _segment_area = area; }
+#endif
 };
 
 DumpWriter::DumpWriter(const char* path, bool overwrite, AbstractCompressor* compressor) :
@@ -653,19 +849,46 @@ DumpWriter::DumpWriter(const char* path, bool overwrite, AbstractCompressor* com
   _out_size(0),
   _out_pos(0),
   _tmp_buffer(nullptr),
-  _tmp_size(0) {
+  _tmp_size(0)
+#ifdef LINUX
+  , _segment_area(nullptr),
+  _pinned(false)
+#endif
+{
   _error = (char*)_writer->open_writer();
   if (_error == nullptr) {
-    _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
-    if (compressor != nullptr) {
-      _error = (char*)_compressor->init(io_buffer_max_size, &_out_size, &_tmp_size);
-      if (_error == nullptr) {
-        if (_out_size > 0) {
-          _out_buffer = (char*)os::malloc(_out_size, mtInternal);
-        }
-        if (_tmp_size > 0) {
-          _tmp_buffer = (char*)os::malloc(_tmp_size, mtInternal);
-        }
+    init_buffers();
+  }
+}
+
+#ifdef LINUX
+DumpWriter::DumpWriter(DumpSegmentArea* area, AbstractCompressor* compressor) :
+  AbstractDumpWriter(),
+  _writer(nullptr),
+  _compressor(compressor),
+  _bytes_written(0),
+  _error(nullptr),
+  _out_buffer(nullptr),
+  _out_size(0),
+  _out_pos(0),
+  _tmp_buffer(nullptr),
+  _tmp_size(0),
+  _segment_area(area),
+  _pinned(false) {
+  init_buffers();
+}
+#endif
+
+void DumpWriter::init_buffers() {
+  _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+  if (_compressor != nullptr) {
+    _error = (char*)_compressor->init(io_buffer_max_size, &_out_size, &_tmp_size);
+    if (_error == nullptr) {
+      if (_out_size > 0) {
+        _out_buffer = (char*)os::malloc(_out_size, mtInternal);
+      }
+      if (_tmp_size > 0) {
+        _tmp_buffer = (char*)os::malloc(_tmp_size, mtInternal);
       }
     }
   }
@@ -692,21 +915,27 @@ DumpWriter::~DumpWriter(){
 
 // flush any buffered bytes to the file
 void DumpWriter::flush() {
+  flush_buffer(false);
+}
+
+void DumpWriter::flush_buffer(bool unfinished_record) {
   if (_pos <= 0) {
+    LINUX_ONLY(if (!unfinished_record) release_pin();)
     return;
   }
   if (has_error()) {
     _pos = 0;
+    LINUX_ONLY(release_pin();)
     return;
   }
   char* result = nullptr;
   if (_compressor == nullptr) {
-    result = (char*)_writer->write_buf(_buffer, _pos);
+    result = (char*)write_buf(_buffer, _pos, unfinished_record);
     _bytes_written += _pos;
   } else {
     do_compress();
     if (!has_error()) {
-      result = (char*)_writer->write_buf(_out_buffer, _out_pos);
+      result = (char*)write_buf(_out_buffer, _out_pos, unfinished_record);
       _bytes_written += _out_pos;
     }
   }
@@ -715,6 +944,28 @@ void DumpWriter::flush() {
   if (result != nullptr) {
     set_error(result);
   }
+  LINUX_ONLY(if (has_error()) release_pin();)
+}
+
+#ifdef LINUX
+void DumpWriter::release_pin() {
+  if (_pinned) {
+    _segment_area->reserve(0, true /* pinned */, false /* pin */);
+    _pinned = false;
+  }
+}
+#endif
+
+char const* DumpWriter::write_buf(char* buf, size_t size, bool unfinished_record) {
+#ifdef LINUX
+  if (_segment_area != nullptr) {
+    // Keep the cursor pinned until the last part of an unfinished record is reserved.
+    uint64_t offset = _segment_area->reserve(size, _pinned, unfinished_record);
+    _pinned = unfinished_record;
+    return _segment_area->write(offset, buf, size);
+  }
+#endif
+  return _writer->write_buf(buf, size);
 }
 
 void DumpWriter::do_compress() {
@@ -2245,6 +2496,14 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   uint                    _num_dumper_threads;
   DumperController*       _dumper_controller;
   ParallelObjectIterator* _poi;
+#ifdef LINUX
+  // Area of the dump file the heap dump segments are written to directly, if any
+  DumpSegmentArea*        _segment_area;
+
+  void prepare_segment_area();
+#endif
+  // Whether to write the heap dump segments directly into the dump file
+  static bool use_segment_area() { return LINUX_ONLY(HeapDumpDirectSegmentWrite) NOT_LINUX(false); }
 
   // Dumper id of VMDumper thread.
   static const int VMDumperId = 0;
@@ -2289,6 +2548,7 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
     _num_dumper_threads = num_dump_threads;
     _dumper_controller = nullptr;
     _poi = nullptr;
+    LINUX_ONLY(_segment_area = nullptr;)
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -2315,9 +2575,14 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
       delete _dumper_controller;
       _dumper_controller = nullptr;
     }
+    LINUX_ONLY(delete _segment_area;)
     delete _klass_map;
   }
   int dump_seq()           { return _dump_seq; }
+#ifdef LINUX
+  bool has_segment_area() const { return _segment_area != nullptr; }
+  void complete_segment_area();
+#endif
   bool is_parallel_dump()  { return _num_dumper_threads > 1; }
   void prepare_parallel_dump(WorkerThreads* workers);
 
@@ -2438,7 +2703,11 @@ void VM_HeapDumper::work(uint worker_id) {
   if (is_vm_dumper(dumper_id)) {
     // lock global writer, it will be unlocked after VM Dumper finishes with non-heap data
     _dumper_controller->lock_global_writer();
-    _dumper_controller->signal_start();
+    // The segment area starts after the non-heap data, so the other dumpers must wait
+    // until it has been written when writing the heap dump segments directly.
+    if (!use_segment_area()) {
+      _dumper_controller->signal_start();
+    }
   } else {
     _dumper_controller->wait_for_start_signal();
   }
@@ -2467,6 +2736,13 @@ void VM_HeapDumper::work(uint worker_id) {
     // this must be called after _klass_map is built when iterating the classes above.
     dump_stack_traces(writer());
 
+#ifdef LINUX
+    if (use_segment_area()) {
+      prepare_segment_area();
+      _dumper_controller->signal_start();
+    }
+#endif
+
     // unlock global writer, so parallel dumpers can dump stack traces of unmounted virtual threads
     _dumper_controller->unlock_global_writer();
   }
@@ -2475,8 +2751,15 @@ void VM_HeapDumper::work(uint worker_id) {
 
   ResourceMark rm;
   // share global compressor, local DumpWriter is not responsible for its life cycle
+#ifdef LINUX
+  DumpWriter segment_writer = _segment_area != nullptr ?
+    DumpWriter(_segment_area, writer()->compressor()) :
+    DumpWriter(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
+               writer()->is_overwrite(), writer()->compressor());
+#else
   DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
                             writer()->is_overwrite(), writer()->compressor());
+#endif
   if (!segment_writer.has_error()) {
     if (is_vm_dumper(dumper_id)) {
       // dump some non-heap subrecords to heap dump segment
@@ -2579,6 +2862,36 @@ void VM_HeapDumper::dump_stack_traces(AbstractDumpWriter* writer) {
   }
 }
 
+#ifdef LINUX
+void VM_HeapDumper::prepare_segment_area() {
+  // Everything written so far stays in front of the area.
+  writer()->flush();
+  if (writer()->has_error()) {
+    return;
+  }
+  size_t capacity = DumpSegmentArea::estimated_capacity(writer()->compressor() != nullptr);
+  _segment_area = DumpSegmentArea::create(writer()->get_fd(), (jlong)writer()->bytes_written(), capacity);
+  if (_segment_area != nullptr) {
+    // Records written by the global writer during heap iteration go to the area as well.
+    writer()->set_segment_area(_segment_area);
+    log_info(heapdump)("Writing heap dump segments directly, preallocated %zu bytes", capacity);
+  }
+}
+
+void VM_HeapDumper::complete_segment_area() {
+  assert(has_segment_area(), "must be");
+  writer()->set_segment_area(nullptr);
+  jlong file_size = _segment_area->complete();
+  if (file_size < 0) {
+    writer()->set_error("Failed to complete heap dump segments");
+  } else {
+    writer()->set_bytes_written((julong)file_size);
+  }
+  delete _segment_area;
+  _segment_area = nullptr;
+}
+#endif
+
 void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
   // unmounted vthread has no JavaThread
   ThreadDumper thread_dumper(ThreadDumper::ThreadType::UnmountedVirtual, nullptr, vt);
@@ -2587,6 +2900,13 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
   // write HPROF_TRACE/HPROF_FRAME records to global writer
   _dumper_controller->lock_global_writer();
   thread_dumper.dump_stack_traces(writer(), _klass_map);
+#ifdef LINUX
+  if (has_segment_area()) {
+    // A record larger than the buffer keeps the segment area pinned until
+    // its remaining part has been flushed.
+    writer()->flush();
+  }
+#endif
   _dumper_controller->unlock_global_writer();
 
   // write HPROF_GC_ROOT_THREAD_OBJ/HPROF_GC_ROOT_JAVA_FRAME/HPROF_GC_ROOT_JNI_LOCAL subrecord
@@ -2648,6 +2968,15 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
   VMThread::execute(&dumper);
 
+  int dump_seq = dumper.dump_seq();
+#ifdef LINUX
+  if (dumper.has_segment_area()) {
+    // The heap dump segments are already in place, there is nothing to merge.
+    dumper.complete_segment_area();
+    dump_seq = 0;
+  }
+#endif
+
   // record any error that the writer may have encountered
   set_error(writer.error());
 
@@ -2658,8 +2987,11 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   //
   // Phase 2: Merge multiple heap files into one complete heap dump file.
   //          This is done by DumpMerger, which is performed outside safepoint
+  //
+  // With HeapDumpDirectSegmentWrite the threads write the heap data directly
+  // into the dump file in phase 1, then phase 2 only finishes the dump.
 
-  DumpMerger merger(path, &writer, dumper.dump_seq());
+  DumpMerger merger(path, &writer, dump_seq);
   // Perform heapdump file merge operation in the current thread prevents us
   // from occupying the VM Thread, which in turn affects the occurrence of
   // GC and other VM operations.
@@ -80,10 +80,25 @@ void LowMemoryDetector::process_sensor_changes(TRAPS) {
 // This method could be called from any Java threads
 // and also VMThread.
 void LowMemoryDetector::detect_low_memory() {
+  int num_memory_pools = MemoryService::num_memory_pools();
+
+  // Usage thresholds are rarely set, so first check without the lock
+  // whether there is anything to do. Setting a threshold does its own
+  // detection, see jmm_SetPoolThreshold.
+  bool any_enabled = false;
+  for (int i = 0; i < num_memory_pools; i++) {
+    if (is_enabled(MemoryService::get_memory_pool(i))) {
+      any_enabled = true;
+      break;
+    }
+  }
+  if (!any_enabled) {
+    return;
+  }
+
   MutexLocker ml(Notification_lock, Mutex::_no_safepoint_check_flag);
 
   bool has_pending_requests = false;
-  int num_memory_pools = MemoryService::num_memory_pools();
   for (int i = 0; i < num_memory_pools; i++) {
     MemoryPool* pool = MemoryService::get_memory_pool(i);
     SensorInfo* sensor = pool->usage_sensor();
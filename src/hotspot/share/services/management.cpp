@@ -51,7 +51,7 @@
 #include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threads.hpp"
-#include "runtime/threadSMR.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/cpuTimeUsage.hpp"
@@ -452,6 +452,25 @@ static bool is_platform_thread(JavaThread* jt) {
   }
 }
 
+// Resolves the thread IDs of ids_ah to the platform threads of the list, or
+// nullptr, with one lookup for the whole batch. Caller must have a ResourceMark.
+static JavaThread** find_platform_threads(ThreadsList* list, typeArrayHandle ids_ah) {
+  const int num_threads = ids_ah->length();
+  // Copy the IDs out, since the array may be moved if the lookup blocks
+  jlong* const java_tids = NEW_RESOURCE_ARRAY(jlong, num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    java_tids[i] = ids_ah->long_at(i);
+  }
+  JavaThread** const threads = NEW_RESOURCE_ARRAY(JavaThread*, num_threads);
+  list->find_JavaThreads_from_java_tids(java_tids, num_threads, threads);
+  for (int i = 0; i < num_threads; i++) {
+    if (!is_platform_thread(threads[i])) {
+      threads[i] = nullptr;
+    }
+  }
+  return threads;
+}
+
 static void validate_thread_info_array(objArrayHandle infoArray_h, TRAPS) {
   // check if the element of infoArray is of type ThreadInfo class
   Klass* threadinfo_klass = Management::java_lang_management_ThreadInfo_klass(CHECK);
@@ -2114,23 +2133,30 @@ jlong Management::ticks_to_ms(jlong ticks) {
 // Gets the amount of memory allocated on the Java heap since JVM launch.
 JVM_ENTRY(jlong, jmm_GetTotalThreadAllocatedMemory(JNIEnv *env))
     // A thread increments exited_allocated_bytes in ThreadService::remove_thread
-    // only after it removes itself from the threads list, and once a TLH is
-    // created, no thread it references can remove itself from the threads
-    // list, so none can update exited_allocated_bytes. We therefore initialize
-    // result with exited_allocated_bytes after after we create the TLH so that
-    // the final result can only be short due to (1) threads that start after
-    // the TLH is created, or (2) terminating threads that escape TLH creation
-    // and don't update exited_allocated_bytes before we initialize result.
+    // only after it removes itself from the threads list, and once a
+    // ThreadsListCriticalSection is entered, no thread on its list can remove
+    // itself from the threads list, so none can update exited_allocated_bytes.
+    // We therefore initialize result with exited_allocated_bytes after we
+    // enter the critical section so that the final result can only be short
+    // due to (1) threads that start after the critical section is entered,
+    // or (2) terminating threads that escape it and don't update
+    // exited_allocated_bytes before we initialize result.
+    //
+    // This is polled frequently by monitoring code, so the threads are
+    // protected with a ThreadsListCriticalSection instead of a TLH.
 
     // We keep a high water mark to ensure monotonicity in case threads counted
     // on a previous call end up in state (2).
     static jlong high_water_result = 0;
 
-    JavaThreadIteratorWithHandle jtiwh;
-    jlong result = ThreadService::exited_allocated_bytes();
-    for (; JavaThread* thread = jtiwh.next();) {
-      jlong size = thread->cooked_allocated_bytes();
-      result += size;
+    jlong result;
+    {
+      ThreadsListCriticalSection tlcs(thread);
+      result = ThreadService::exited_allocated_bytes();
+      for (JavaThread* jt : tlcs) {
+        jlong size = jt->cooked_allocated_bytes();
+        result += size;
+      }
     }
 
     {
@@ -2198,10 +2224,10 @@ JVM_ENTRY(void, jmm_GetThreadAllocatedMemory(JNIEnv *env, jlongArray ids,
   }
 
   ThreadsListHandle tlh;
+  JavaThread** const threads = find_platform_threads(tlh.list(), ids_ah);
   for (int i = 0; i < num_threads; i++) {
-    JavaThread* java_thread = tlh.list()->find_JavaThread_from_java_tid(ids_ah->long_at(i));
-    if (is_platform_thread(java_thread)) {
-      sizeArray_h->long_at_put(i, java_thread->cooked_allocated_bytes());
+    if (threads[i] != nullptr) {
+      sizeArray_h->long_at_put(i, threads[i]->cooked_allocated_bytes());
     }
   }
 JVM_END
@@ -2269,10 +2295,10 @@ JVM_ENTRY(void, jmm_GetThreadCpuTimesWithKind(JNIEnv *env, jlongArray ids,
   }
 
   ThreadsListHandle tlh;
+  JavaThread** const threads = find_platform_threads(tlh.list(), ids_ah);
   for (int i = 0; i < num_threads; i++) {
-    JavaThread* java_thread = tlh.list()->find_JavaThread_from_java_tid(ids_ah->long_at(i));
-    if (is_platform_thread(java_thread)) {
-      timeArray_h->long_at_put(i, os::thread_cpu_time((Thread*)java_thread,
+    if (threads[i] != nullptr) {
+      timeArray_h->long_at_put(i, os::thread_cpu_time((Thread*)threads[i],
                                                       user_sys_cpu_time != 0));
     }
   }
@@ -357,6 +357,19 @@ class ConcurrentHashTable : public CHeapObj<MT> {
   VALUE* internal_get(Thread* thread, LOOKUP_FUNC& lookup_f,
                       bool* grow_hint = nullptr);
 
+  // Prefetches the buckets, and the first node in each, for a batch of keys.
+  template <typename LOOKUP_FUNC>
+  void prefetch_buckets(size_t count, LOOKUP_FUNC* lookup_fs) const;
+
+  // Adapts a batch FOUND_FUNC to the single key callback.
+  template <typename FOUND_FUNC>
+  struct BatchFoundFunc {
+    FOUND_FUNC& _found_f;
+    size_t _index;
+    BatchFoundFunc(FOUND_FUNC& found_f, size_t index) : _found_f(found_f), _index(index) {}
+    void operator()(VALUE* value) { _found_f(_index, value); }
+  };
+
   // Insert and get current value.
   template <typename LOOKUP_FUNC, typename FOUND_FUNC>
   bool internal_insert_get(Thread* thread, LOOKUP_FUNC& lookup_f, const VALUE& value,
@@ -484,6 +497,25 @@ class ConcurrentHashTable : public CHeapObj<MT> {
     return internal_insert_get(thread, lookup_f, value, foundf, grow_hint, clean_hint);
   }
 
+  // Batched get and insert_get. The keys are handled BatchSize at a time
+  // under one critical section, in which the buckets of all of them are
+  // prefetched before the first one is probed. FOUND_FUNC is called with the
+  // index of the key and the value found or inserted for it.
+  static const size_t BatchSize = 8;
+
+  // Returns the number of keys found.
+  template <typename LOOKUP_FUNC, typename FOUND_FUNC>
+  size_t get_batch(Thread* thread, size_t count, LOOKUP_FUNC* lookup_fs,
+                   FOUND_FUNC& found_f, bool* grow_hint = nullptr);
+
+  // VALUE_FUNC returns the value to insert for an index. Returns the number
+  // of items inserted. Unlike insert, dead items are not removed inline but
+  // only reported with clean_hint.
+  template <typename LOOKUP_FUNC, typename VALUE_FUNC, typename FOUND_FUNC>
+  size_t insert_get_batch(Thread* thread, size_t count, LOOKUP_FUNC* lookup_fs,
+                          VALUE_FUNC& value_f, FOUND_FUNC& found_f,
+                          bool* grow_hint = nullptr, bool* clean_hint = nullptr);
+
   // This does a fast unsafe insert and can thus only be used when there is no
   // risk for a duplicates and no other threads uses this table.
   bool unsafe_insert(const VALUE& value);
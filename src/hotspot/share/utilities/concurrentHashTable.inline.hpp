@@ -880,6 +880,26 @@ inline typename CONFIG::Value* ConcurrentHashTable<CONFIG, MT>::
   return ret;
 }
 
+// Always called within critical section
+template <typename CONFIG, MemTag MT>
+template <typename LOOKUP_FUNC>
+inline void ConcurrentHashTable<CONFIG, MT>::
+  prefetch_buckets(size_t count, LOOKUP_FUNC* lookup_fs) const
+{
+  // First bring in the bucket slots, then the chain heads they point to, so
+  // the probes that follow do not serialize on one cache miss after another.
+  InternalTable* table = get_table();
+  for (size_t i = 0; i < count; i++) {
+    Prefetch::read(get_bucket_in(table, lookup_fs[i].get_hash()), 0);
+  }
+  for (size_t i = 0; i < count; i++) {
+    Node* first = get_bucket(lookup_fs[i].get_hash())->first();
+    if (first != nullptr) {
+      Prefetch::read(first, 0);
+    }
+  }
+}
+
 template <typename CONFIG, MemTag MT>
 template <typename LOOKUP_FUNC, typename FOUND_FUNC>
 inline bool ConcurrentHashTable<CONFIG, MT>::
@@ -1106,6 +1126,108 @@ inline bool ConcurrentHashTable<CONFIG, MT>::
   return ret;
 }
 
+template <typename CONFIG, MemTag MT>
+template <typename LOOKUP_FUNC, typename FOUND_FUNC>
+inline size_t ConcurrentHashTable<CONFIG, MT>::
+  get_batch(Thread* thread, size_t count, LOOKUP_FUNC* lookup_fs,
+            FOUND_FUNC& found_f, bool* grow_hint)
+{
+  size_t found = 0;
+  bool grow = false;
+  for (size_t base = 0; base < count; base += BatchSize) {
+    size_t n = MIN2(BatchSize, count - base);
+    ScopedCS cs(thread, this);
+    prefetch_buckets(n, lookup_fs + base);
+    for (size_t i = 0; i < n; i++) {
+      bool key_grow = false;
+      VALUE* val = internal_get(thread, lookup_fs[base + i], &key_grow);
+      grow |= key_grow;
+      if (val != nullptr) {
+        found_f(base + i, val);
+        found++;
+      }
+    }
+  }
+  if (grow_hint != nullptr) {
+    *grow_hint = grow;
+  }
+  return found;
+}
+
+template <typename CONFIG, MemTag MT>
+template <typename LOOKUP_FUNC, typename VALUE_FUNC, typename FOUND_FUNC>
+inline size_t ConcurrentHashTable<CONFIG, MT>::
+  insert_get_batch(Thread* thread, size_t count, LOOKUP_FUNC* lookup_fs,
+                   VALUE_FUNC& value_f, FOUND_FUNC& found_f,
+                   bool* grow_hint, bool* clean_hint)
+{
+  size_t inserted = 0;
+  bool clean = false;
+  bool grow = false;
+  for (size_t base = 0; base < count; base += BatchSize) {
+    size_t n = MIN2(BatchSize, count - base);
+    Node* new_nodes[BatchSize];
+    bool retry[BatchSize];
+    // Nodes are created outside the critical section, as for a single insert.
+    for (size_t i = 0; i < n; i++) {
+      new_nodes[i] = Node::create_node(_context, value_f(base + i), nullptr);
+      DEBUG_ONLY(new_nodes[i]->set_saved_hash(lookup_fs[base + i].get_hash());)
+      retry[i] = false;
+    }
+    {
+      ScopedCS cs(thread, this); /* protected the table/bucket */
+      prefetch_buckets(n, lookup_fs + base);
+      for (size_t i = 0; i < n; i++) {
+        LOOKUP_FUNC& lookup_f = lookup_fs[base + i];
+        size_t loops = 0;
+        Bucket* bucket = get_bucket(lookup_f.get_hash());
+        Node* first_at_start = bucket->first();
+        Node* old = get_node(bucket, lookup_f, &clean, &loops);
+        grow |= loops > _grow_hint;
+        if (old == nullptr) {
+          new_nodes[i]->set_next(first_at_start);
+          if (bucket->cas_first(new_nodes[i], first_at_start)) {
+            found_f(base + i, new_nodes[i]->value());
+            JFR_ONLY(safe_stats_add();)
+            new_nodes[i] = nullptr;
+            inserted++;
+          } else {
+            // The bucket changed or is locked, take the single insert path
+            // outside of this critical section.
+            retry[i] = true;
+          }
+        } else {
+          // There is a duplicate.
+          found_f(base + i, old->value());
+        }
+      }
+    } /* leave critical section */
+    for (size_t i = 0; i < n; i++) {
+      if (retry[i]) {
+        BatchFoundFunc<FOUND_FUNC> batch_found_f(found_f, base + i);
+        bool key_grow = false;
+        bool key_clean = false;
+        if (internal_insert_get(thread, lookup_fs[base + i], *new_nodes[i]->value(),
+                                batch_found_f, &key_grow, &key_clean)) {
+          inserted++;
+        }
+        grow |= key_grow;
+        clean |= key_clean;
+      }
+      if (new_nodes[i] != nullptr) {
+        Node::destroy_node(_context, new_nodes[i]);
+      }
+    }
+  }
+  if (grow_hint != nullptr) {
+    *grow_hint = grow;
+  }
+  if (clean_hint != nullptr) {
+    *clean_hint = clean;
+  }
+  return inserted;
+}
+
 template <typename CONFIG, MemTag MT>
 inline bool ConcurrentHashTable<CONFIG, MT>::
   unsafe_insert(const VALUE& value) {
@@ -25,6 +25,8 @@
 #ifndef SHARE_UTILITIES_DEVIRTUALIZER_HPP
 #define SHARE_UTILITIES_DEVIRTUALIZER_HPP
 
+#include "memory/iterator.hpp"
+#include "memory/referenceType.hpp"
 #include "oops/oopsHierarchy.hpp"
 #include "utilities/bitMap.hpp"
 
@@ -38,6 +40,8 @@ class Devirtualizer {
   template <typename OopClosureType>             static void do_klass(OopClosureType* closure, Klass* k);
   template <typename OopClosureType>             static void do_cld(OopClosureType* closure, ClassLoaderData* cld);
   template <typename OopClosureType>             static bool do_metadata(OopClosureType* closure);
+  template <typename OopClosureType>             static OopIterateClosure::ReferenceIterationMode reference_iteration_mode(OopClosureType* closure);
+  template <typename OopClosureType>             static bool discover_reference(OopClosureType* closure, oop obj, ReferenceType type);
   template <typename DerivedOopClosureType>      static void do_derived_oop(DerivedOopClosureType* closure, derived_base* base, derived_pointer* derived);
   template <typename BitMapClosureType>          static bool do_bit(BitMapClosureType* closure, BitMap::idx_t index);
 };
@@ -29,6 +29,7 @@
 
 #include "classfile/classLoaderData.hpp"
 #include "cppstdlib/type_traits.hpp"
+#include "gc/shared/referenceDiscoverer.hpp"
 #include "oops/access.inline.hpp"
 #include "utilities/debug.hpp"
 
@@ -111,6 +112,56 @@ inline bool Devirtualizer::do_metadata(OopClosureType* closure) {
   return call_do_metadata(&OopClosureType::do_metadata, &OopIterateClosure::do_metadata, closure);
 }
 
+// Implementation of the non-virtual reference_iteration_mode dispatch.
+
+template <typename Receiver, typename Base, typename OopClosureType>
+static typename EnableIf<std::is_same<Receiver, Base>::value, OopIterateClosure::ReferenceIterationMode>::type
+call_reference_iteration_mode(OopIterateClosure::ReferenceIterationMode (Receiver::*)(),
+                              OopIterateClosure::ReferenceIterationMode (Base::*)(),
+                              OopClosureType* closure) {
+  return closure->reference_iteration_mode();
+}
+
+template <typename Receiver, typename Base, typename OopClosureType>
+static typename EnableIf<!std::is_same<Receiver, Base>::value, OopIterateClosure::ReferenceIterationMode>::type
+call_reference_iteration_mode(OopIterateClosure::ReferenceIterationMode (Receiver::*)(),
+                              OopIterateClosure::ReferenceIterationMode (Base::*)(),
+                              OopClosureType* closure) {
+  return closure->OopClosureType::reference_iteration_mode();
+}
+
+template <typename OopClosureType>
+inline OopIterateClosure::ReferenceIterationMode Devirtualizer::reference_iteration_mode(OopClosureType* closure) {
+  return call_reference_iteration_mode(&OopClosureType::reference_iteration_mode,
+                                       &OopIterateClosure::reference_iteration_mode,
+                                       closure);
+}
+
+// Implementation of the non-virtual discover_reference dispatch.
+//
+// The discoverer type is taken from OopClosureType::ReferenceDiscovererType,
+// which defaults to ReferenceDiscoverer, and then the virtual call is taken.
+// A closure that redeclares it to a concrete discoverer must only be given
+// discoverers of that type, and the type must be final.
+
+template <typename Discoverer>
+static typename EnableIf<std::is_same<Discoverer, ReferenceDiscoverer>::value, bool>::type
+call_discover_reference(ReferenceDiscoverer* rd, oop obj, ReferenceType type) {
+  return rd->discover_reference(obj, type);
+}
+
+template <typename Discoverer>
+static typename EnableIf<!std::is_same<Discoverer, ReferenceDiscoverer>::value, bool>::type
+call_discover_reference(ReferenceDiscoverer* rd, oop obj, ReferenceType type) {
+  STATIC_ASSERT(std::is_final<Discoverer>::value);
+  return static_cast<Discoverer*>(rd)->Discoverer::discover_reference(obj, type);
+}
+
+template <typename OopClosureType>
+inline bool Devirtualizer::discover_reference(OopClosureType* closure, oop obj, ReferenceType type) {
+  return call_discover_reference<typename OopClosureType::ReferenceDiscovererType>(closure->ref_discoverer(), obj, type);
+}
+
 // Implementation of the non-virtual do_klass dispatch.
 
 template <typename Receiver, typename Base, typename OopClosureType>
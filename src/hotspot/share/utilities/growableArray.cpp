@@ -34,6 +34,11 @@ void* GrowableArrayResourceAllocator::allocate(int max, int elementSize) {
   return (void*)resource_allocate_bytes(byte_size);
 }
 
+void* GrowableArrayResourceAllocator::reallocate(void* mem, int old_max, int max, int element_size) {
+  assert(old_max >= 0 && max >= 0, "integer overflow");
+  return (void*)resource_reallocate_bytes((char*)mem, element_size * (size_t) old_max, element_size * (size_t) max);
+}
+
 void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* arena) {
   assert(max >= 0, "integer overflow");
   size_t byte_size = element_size * (size_t) max;
@@ -41,6 +46,11 @@ void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* ar
   return arena->Amalloc(byte_size);
 }
 
+void* GrowableArrayArenaAllocator::reallocate(void* mem, int old_max, int max, int element_size, Arena* arena) {
+  assert(old_max >= 0 && max >= 0, "integer overflow");
+  return arena->Arealloc(mem, element_size * (size_t) old_max, element_size * (size_t) max);
+}
+
 void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MemTag mem_tag) {
   assert(max >= 0, "integer overflow");
 
@@ -55,6 +65,21 @@ void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MemTag me
   return (void*)AllocateHeap(byte_size, mem_tag);
 }
 
+void* GrowableArrayCHeapAllocator::reallocate(void* mem, int max, int element_size, MemTag mem_tag) {
+  assert(max >= 0, "integer overflow");
+
+  if (max == 0) {
+    FreeHeap(mem);
+    return nullptr;
+  }
+
+  size_t byte_size = element_size * (size_t) max;
+
+  // memory tag has to be specified for C heap allocation
+  assert(mem_tag != mtNone, "memory tag not specified for C heap object");
+  return (void*)ReallocateHeap((char*)mem, byte_size, mem_tag);
+}
+
 void GrowableArrayCHeapAllocator::deallocate(void* elements) {
   FreeHeap(elements);
 }
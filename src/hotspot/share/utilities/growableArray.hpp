@@ -25,6 +25,7 @@
 #ifndef SHARE_UTILITIES_GROWABLEARRAY_HPP
 #define SHARE_UTILITIES_GROWABLEARRAY_HPP
 
+#include "cppstdlib/type_traits.hpp"
 #include "memory/allocation.hpp"
 #include "memory/iterator.hpp"
 #include "utilities/debug.hpp"
@@ -321,8 +322,19 @@ class GrowableArrayFromArray : public GrowableArrayView<E> {
 // Derived: The sub-class responsible for allocation / deallocation
 //  - E* Derived::allocate()       - member function responsible for allocation
 //  - void Derived::deallocate(E*) - member function responsible for deallocation
+//  - E* Derived::reallocate(E*, int old_capacity)
+//                                 - member function resizing the data array to
+//                                   _capacity, used for trivial element types
+//
+// Trivial element types, that are trivially copyable and trivially default
+// constructible, are not constructed or destroyed when the data array is
+// resized. Their elements are moved with the data array, by realloc for
+// CHeap arrays, and are copied with memcpy by the bulk operations.
 template <typename E, typename Derived>
 class GrowableArrayWithAllocator : public GrowableArrayView<E> {
+  static const bool is_trivial = std::is_trivially_copyable<E>::value &&
+                                 std::is_trivially_default_constructible<E>::value;
+
   void expand_to(int j);
   void grow(int j);
 
@@ -422,9 +434,36 @@ class GrowableArrayWithAllocator : public GrowableArrayView<E> {
     this->_len += array_len;
   }
 
+  // Appends n elements and returns the address of the first of them. The
+  // caller is responsible for initializing them.
+  E* append_uninitialized(int n) {
+    assert(0 <= n, "negative count %d", n);
+    int new_len = this->_len + n;
+    if (new_len > this->_capacity) grow(new_len);
+    E* first = this->_data + this->_len;
+    this->_len = new_len;
+    return first;
+  }
+
+  // Appends the n elements starting at elems, which must not point into
+  // this array.
+  void appendAll(const E* elems, int n) {
+    E* dst = append_uninitialized(n);
+    if (is_trivial) {
+      if (n > 0) {
+        memcpy((void*)dst, (const void*)elems, n * sizeof(E));
+      }
+    } else {
+      for (int i = 0; i < n; i++) {
+        dst[i] = elems[i];
+      }
+    }
+  }
+
   void appendAll(const GrowableArrayView<E>* l) {
-    for (int i = 0; i < l->length(); i++) {
-      this->at_put_grow(this->_len, l->at(i), E());
+    assert(l != this, "cannot append to itself");
+    if (l->is_nonempty()) {
+      appendAll(l->adr_at(0), l->length());
     }
   }
 
@@ -525,6 +564,12 @@ class GrowableArrayWithAllocator : public GrowableArrayView<E> {
 
   void clear() { this->_len = 0; }
   void clear_and_deallocate();
+
+  // Clear, keeping the data array if it can hold new_capacity elements.
+  void clear_and_reserve(int new_capacity) {
+    clear();
+    reserve(new_capacity);
+  }
 };
 
 template <typename E, typename Derived>
@@ -533,6 +578,10 @@ void GrowableArrayWithAllocator<E, Derived>::expand_to(int new_capacity) {
   assert(new_capacity > old_capacity,
          "expected growth but %d <= %d", new_capacity, old_capacity);
   this->_capacity = new_capacity;
+  if (is_trivial) {
+    this->_data = static_cast<Derived*>(this)->reallocate(this->_data, old_capacity);
+    return;
+  }
   E* newData = static_cast<Derived*>(this)->allocate();
   int i = 0;
   for (     ; i < this->_len; i++) ::new ((void*)&newData[i]) E(this->_data[i]);
@@ -572,6 +621,10 @@ void GrowableArrayWithAllocator<E, Derived>::shrink_to_fit() {
   E* old_data = this->_data;
   E* new_data = nullptr;
   this->_capacity = len;        // Must preceed allocate().
+  if (is_trivial) {
+    this->_data = static_cast<Derived*>(this)->reallocate(old_data, old_capacity);
+    return;
+  }
   if (len > 0) {
     new_data = static_cast<Derived*>(this)->allocate();
     for (int i = 0; i < len; ++i) ::new (&new_data[i]) E(old_data[i]);
@@ -594,18 +647,21 @@ void GrowableArrayWithAllocator<E, Derived>::clear_and_deallocate() {
 class GrowableArrayResourceAllocator {
 public:
   static void* allocate(int max, int element_size);
+  static void* reallocate(void* mem, int old_max, int max, int element_size);
 };
 
 // Arena allocator
 class GrowableArrayArenaAllocator {
 public:
   static void* allocate(int max, int element_size, Arena* arena);
+  static void* reallocate(void* mem, int old_max, int max, int element_size, Arena* arena);
 };
 
 // CHeap allocator
 class GrowableArrayCHeapAllocator {
 public:
   static void* allocate(int max, int element_size, MemTag mem_tag);
+  static void* reallocate(void* mem, int max, int element_size, MemTag mem_tag);
   static void deallocate(void* mem);
 };
 
@@ -764,6 +820,21 @@ class GrowableArray : public GrowableArrayWithAllocator<E, GrowableArray<E>> {
     }
   }
 
+  E* reallocate(E* mem, int old_capacity) {
+    if (on_resource_area()) {
+      DEBUG_ONLY(_metadata.on_resource_area_alloc_check());
+      return (E*)GrowableArrayResourceAllocator::reallocate(mem, old_capacity, this->_capacity, sizeof(E));
+    }
+
+    if (on_C_heap()) {
+      return (E*)GrowableArrayCHeapAllocator::reallocate(mem, this->_capacity, sizeof(E), _metadata.mem_tag());
+    }
+
+    assert(on_arena(), "Sanity");
+    DEBUG_ONLY(_metadata.on_arena_alloc_check());
+    return (E*)GrowableArrayArenaAllocator::reallocate(mem, old_capacity, this->_capacity, sizeof(E), _metadata.arena());
+  }
+
 public:
   GrowableArray() : GrowableArray(2 /* initial_capacity */) {}
 
@@ -844,6 +915,10 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
     GrowableArrayCHeapAllocator::deallocate(mem);
   }
 
+  E* reallocate(E* mem, int old_capacity) {
+    return (E*)GrowableArrayCHeapAllocator::reallocate(mem, this->_capacity, sizeof(E), MT);
+  }
+
 public:
   GrowableArrayCHeap(int initial_capacity = 0) :
       GrowableArrayWithAllocator<E, GrowableArrayCHeap<E, MT> >(
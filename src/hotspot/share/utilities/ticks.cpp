@@ -22,6 +22,8 @@
  *
  */
 
+#include "logging/log.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/ticks.hpp"
 
@@ -34,12 +36,62 @@ inline double conversion(typename TimeSource::Type& value) {
   return (double)value * ((double)unit / (double)TimeSource::frequency());
 }
 
+bool     ElapsedCounterSource::_fast           = false;
+jlong    ElapsedCounterSource::_fast_offset    = 0;
+uint64_t ElapsedCounterSource::_fast_frequency = 0;
+
+void ElapsedCounterSource::initialize() {
+#if defined(X86) && !defined(ZERO)
+  if (!UseFastElapsedCounter) {
+    return;
+  }
+
+  if (!Rdtsc::enabled()) {
+    log_info(os)("Fast elapsed counter not used, no invariant time stamp counter");
+    return;
+  }
+
+  // Calibrate against the OS elapsed counter over a short busy wait
+  const jlong os_frequency = os::elapsed_frequency();
+  const jlong os_start = os::elapsed_counter();
+  const jlong tsc_start = Rdtsc::elapsed_counter();
+  jlong os_end;
+  do {
+    os_end = os::elapsed_counter();
+  } while (os_end - os_start < os_frequency / 100);
+  const jlong tsc_end = Rdtsc::elapsed_counter();
+
+  const double measured = (double)(tsc_end - tsc_start) * (double)os_frequency / (double)(os_end - os_start);
+  const double nominal = (double)Rdtsc::frequency();
+
+  // The counter must tick at the rate the processor advertises, otherwise
+  // it is likely scaled or virtualized and will drift from the OS clock
+  if (fabs(measured - nominal) > nominal / 100) {
+    log_info(os)("Fast elapsed counter not used, measured %.0f Hz, expected %.0f Hz", measured, nominal);
+    return;
+  }
+
+  _fast_frequency = (uint64_t)measured;
+  _fast_offset = (jlong)((double)os_end * measured / (double)os_frequency) - tsc_end;
+  _fast = true;
+  log_info(os)("Fast elapsed counter used, %.0f Hz", measured);
+#endif
+}
+
 uint64_t ElapsedCounterSource::frequency() {
+  if (_fast) {
+    return _fast_frequency;
+  }
   static const uint64_t freq = (uint64_t)os::elapsed_frequency();
   return freq;
 }
 
 ElapsedCounterSource::Type ElapsedCounterSource::now() {
+#if defined(X86) && !defined(ZERO)
+  if (_fast) {
+    return Rdtsc::elapsed_counter() + _fast_offset;
+  }
+#endif
   return os::elapsed_counter();
 }
 
@@ -103,6 +155,14 @@ uint64_t CompositeElapsedCounterSource::frequency() {
 
 CompositeElapsedCounterSource::Type CompositeElapsedCounterSource::now() {
   CompositeTime ct;
+#if defined(X86) && !defined(ZERO)
+  if (ElapsedCounterSource::_fast) {
+    // Both values from a single counter read
+    ct.val2 = Rdtsc::elapsed_counter();
+    ct.val1 = ct.val2 + ElapsedCounterSource::_fast_offset;
+    return ct;
+  }
+#endif
   ct.val1 = ElapsedCounterSource::now();
 #if defined(X86) && !defined(ZERO)
   static bool valid_rdtsc = Rdtsc::enabled();
@@ -31,8 +31,18 @@
 
 // Time sources
 class ElapsedCounterSource {
+  friend class CompositeElapsedCounterSource;
+ private:
+  // Set when the time stamp counter backs the elapsed counter, see
+  // UseFastElapsedCounter. The offset moves the counter to the epoch
+  // of os::elapsed_counter(), so that both can still be compared.
+  static bool     _fast;
+  static jlong    _fast_offset;
+  static uint64_t _fast_frequency;
+
  public:
   typedef jlong Type;
+  static void initialize();
   static uint64_t frequency();
   static Type now();
   static double seconds(Type value);
@@ -36,3 +36,8 @@ JNIEXPORT jboolean JNICALL
 Java_java_lang_ref_Finalizer_isFinalizationEnabled(JNIEnv* env, jclass cls) {
     return JVM_IsFinalizationEnabled(env);
 }
+
+JNIEXPORT void JNICALL
+Java_java_lang_ref_Finalizer_runVMFinalization(JNIEnv* env, jclass cls) {
+    JVM_RunFinalization(env);
+}
@@ -303,6 +303,9 @@ bool ImageFileReader::open() {
     // Memory map image (minimally the index.)
     _index_data = (u1*)osSupport::map_memory(_fd, _name, 0, (size_t)map_size());
     assert(_index_data && "image file not memory mapped");
+    // The index is probed at random by every lookup, read it ahead in one go
+    // rather than faulting it in a page at a time.
+    osSupport::advise_will_need(_index_data, (size_t)_index_size);
     // Retrieve length of index perfect hash table.
     u4 length = table_length();
     // Compute offset of the perfect hash table redirect table.
@@ -442,6 +445,10 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
         if (!memory_map_image) {
                 delete[] compressed_data;
         }
+    } else if (memory_map_image) {
+        // Copy bytes straight out of the mapped image rather than
+        // going through a read system call.
+        memcpy(uncompressed_data, get_data_address() + offset, (size_t)uncompressed_size);
     } else {
         // Read bytes from offset beyond the image index.
         bool is_read = read_at(uncompressed_data, uncompressed_size, _index_size + offset);
@@ -71,6 +71,13 @@ class osSupport {
      * Unmap nBytes of memory at address.
      */
     static int unmap_memory(void* addr, size_t bytes);
+
+    /**
+     * Advise the system that nBytes of mapped memory at address will be
+     * accessed soon, so that the pages may be read ahead.  This is only a
+     * hint; failure is ignored.
+     */
+    static void advise_will_need(void* addr, size_t bytes);
 };
 
 /**
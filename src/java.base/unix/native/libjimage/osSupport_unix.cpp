@@ -89,6 +89,14 @@ int osSupport::unmap_memory(void *addr, size_t bytes) {
     return munmap((char *) addr, bytes) == 0;
 }
 
+/**
+ * Advise that nBytes of mapped memory at address will be needed soon.
+ */
+void osSupport::advise_will_need(void *addr, size_t bytes) {
+    // Only a hint, the result is ignored.
+    (void) madvise((char *) addr, bytes, MADV_WILLNEED);
+}
+
 /**
  * A CriticalSection to protect a small section of code.
  */
@@ -114,6 +114,13 @@ int osSupport::unmap_memory(void* addr, size_t bytes) {
     return result;
 }
 
+/**
+ * Advise that nBytes of mapped memory at address will be needed soon.
+ * Not supported; the mapped view is demand paged.
+ */
+void osSupport::advise_will_need(void* addr, size_t bytes) {
+}
+
 /**
  * A CriticalSection to protect a small section of code.
  */
@@ -188,6 +188,7 @@ D3DVertexCacher::Init(D3DContext *pCtx)
     firstPendingVertex = 0;
     firstUnusedVertex = 0;
     currentBatch = 0;
+    flushCount = 0;
     ZeroMemory(vertices, sizeof(vertices));
     ZeroMemory(batches, sizeof(batches));
 
@@ -733,11 +734,13 @@ HRESULT D3DVertexCacher::Render(int actionType)
         res = lpD3DVertexBuffer->Unlock();
         UINT currentVertex = firstPendingVertex;
         UINT batchSize;
+        flushCount++;
         J2dTraceLn(J2D_TRACE_VERBOSE,
-                   "D3DVC::Render Starting flushing of %d vertices "\
-                   "in %d batches",
-                   pendingVertices,
-                   (currentBatch - firstPendingBatch + 1));
+                   "D3DVC::Render Starting flush %d of %d vertices "\
+                   "in %d batches%s",
+                   flushCount, pendingVertices,
+                   (currentBatch - firstPendingBatch + 1),
+                   (actionType == RESET_ACTION) ? " (buffer full)" : "");
 
 
         for (UINT b = firstPendingBatch; b <= currentBatch; b++) {
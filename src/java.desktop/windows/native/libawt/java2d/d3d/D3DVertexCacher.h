@@ -29,7 +29,7 @@
 #include "jni.h"
 #include "D3DContext.h"
 
-#define MAX_BATCH_SIZE 1024
+#define MAX_BATCH_SIZE 4096
 #define APPEND_ACTION 0x0
 #define RESET_ACTION  0x1
 #define D3DFVF_J2DLVERTEX \
@@ -97,6 +97,8 @@ static
     UINT firstPendingVertex;
     UINT firstUnusedVertex;
     UINT currentBatch;
+    // number of times the vertex buffer was flushed, for tracing
+    UINT flushCount;
     J2DLVERTEX              vertices[MAX_BATCH_SIZE];
     VertexBatch             batches[MAX_BATCH_SIZE];
     IDirect3DVertexBuffer9  *lpD3DVertexBuffer;
@@ -23,6 +23,7 @@
  *
  */
 
+#include <cstdlib>
 #include <cstring>
 
 #include "dwarf.hpp"
@@ -289,41 +290,114 @@ unsigned int DwarfParser::get_pc_range() {
   return static_cast<unsigned int>(result);
 }
 
-bool DwarfParser::process_dwarf(const uintptr_t pc) {
+static int compare_fde(const void *a, const void *b) {
+  const eh_frame_fde *fde_a = static_cast<const eh_frame_fde *>(a);
+  const eh_frame_fde *fde_b = static_cast<const eh_frame_fde *>(b);
+  if (fde_a->pc_begin != fde_b->pc_begin) {
+    return (fde_a->pc_begin < fde_b->pc_begin) ? -1 : 1;
+  }
+  // Keep the section order for FDEs starting at the same pc
+  return (fde_a->entry < fde_b->entry) ? -1 : ((fde_a->entry > fde_b->entry) ? 1 : 0);
+}
+
+// Walk all entries in .eh_frame once and record the pc range of every FDE,
+// so that lookups for the many frames of a stack walk are binary searches
+// instead of a linear scan of the section each.
+bool DwarfParser::build_fde_index() {
   // https://refspecs.linuxfoundation.org/LSB_3.0.0/LSB-PDA/LSB-PDA/ehframechpt.html
-  _buf = _lib->eh_frame.data;
-  unsigned char *end = _lib->eh_frame.data + _lib->eh_frame.size;
+  eh_frame_info *eh_frame = &_lib->eh_frame;
+  int capacity = 256;
+  int count = 0;
+  eh_frame_fde *index = static_cast<eh_frame_fde *>(malloc(sizeof(eh_frame_fde) * capacity));
+  if (index == NULL) {
+    return false;
+  }
+
+  _buf = eh_frame->data;
+  unsigned char *end = eh_frame->data + eh_frame->size;
   while (_buf <= end) {
+    unsigned char *entry = _buf;
     uint64_t length = get_entry_length();
     if (length == 0L) {
-      return false;
+      break;
     }
     unsigned char *next_entry = _buf + length;
-    unsigned char *start_of_entry = _buf;
     uint32_t id = *(reinterpret_cast<uint32_t *>(_buf));
     _buf += 4;
     if (id != 0) { // FDE
-      uintptr_t pc_begin = get_decoded_value() + _lib->eh_frame.library_base_addr;
-      uintptr_t pc_end = pc_begin + get_pc_range();
-
-      if ((pc >= pc_begin) && (pc < pc_end)) {
-        // Process CIE
-        if (!process_cie(start_of_entry, id)) {
+      if (count == capacity) {
+        capacity *= 2;
+        eh_frame_fde *new_index = static_cast<eh_frame_fde *>(realloc(index, sizeof(eh_frame_fde) * capacity));
+        if (new_index == NULL) {
+          free(index);
           return false;
         }
-
-        // Skip Augumenation
-        uintptr_t augmentation_length = read_leb(false);
-        _buf += augmentation_length; // skip
-
-        // Process FDE
-        parse_dwarf_instructions(pc_begin, pc, next_entry);
-        return true;
+        index = new_index;
       }
+      index[count].pc_begin = get_decoded_value() + eh_frame->library_base_addr;
+      index[count].pc_end = index[count].pc_begin + get_pc_range();
+      index[count].entry = entry;
+      count++;
     }
 
     _buf = next_entry;
   }
 
-  return false;
+  qsort(index, count, sizeof(eh_frame_fde), compare_fde);
+  eh_frame->fde_index = index;
+  eh_frame->fde_count = count;
+  return true;
+}
+
+// Find the FDE with the greatest pc_begin not above pc, if it covers pc.
+const eh_frame_fde *DwarfParser::find_fde(uintptr_t pc) const {
+  const eh_frame_fde *index = _lib->eh_frame.fde_index;
+  int low = 0;
+  int high = _lib->eh_frame.fde_count - 1;
+  const eh_frame_fde *found = NULL;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    if (index[mid].pc_begin <= pc) {
+      found = &index[mid];
+      low = mid + 1;
+    } else {
+      high = mid - 1;
+    }
+  }
+  if ((found != NULL) && (pc < found->pc_end)) {
+    return found;
+  }
+  return NULL;
+}
+
+bool DwarfParser::process_dwarf(const uintptr_t pc) {
+  if ((_lib->eh_frame.fde_index == NULL) && !build_fde_index()) {
+    return false;
+  }
+  const eh_frame_fde *fde = find_fde(pc);
+  if (fde == NULL) {
+    return false;
+  }
+
+  _buf = fde->entry;
+  uint64_t length = get_entry_length();
+  unsigned char *next_entry = _buf + length;
+  unsigned char *start_of_entry = _buf;
+  uint32_t id = *(reinterpret_cast<uint32_t *>(_buf));
+  _buf += 4;
+  uintptr_t pc_begin = get_decoded_value() + _lib->eh_frame.library_base_addr;
+  get_pc_range(); // already checked through the index
+
+  // Process CIE
+  if (!process_cie(start_of_entry, id)) {
+    return false;
+  }
+
+  // Skip Augumenation
+  uintptr_t augmentation_length = read_leb(false);
+  _buf += augmentation_length; // skip
+
+  // Process FDE
+  parse_dwarf_instructions(pc_begin, pc, next_entry);
+  return true;
 }
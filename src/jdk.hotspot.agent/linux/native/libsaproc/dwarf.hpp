@@ -61,7 +61,7 @@ enum DWARF_Register {
  */
 class DwarfParser {
   private:
-    const lib_info *_lib;
+    lib_info *_lib;
     unsigned char *_buf;
     unsigned char _encoding;
     enum DWARF_Register _cfa_reg;
@@ -81,6 +81,8 @@ class DwarfParser {
     void parse_dwarf_instructions(uintptr_t begin, uintptr_t pc, const unsigned char *end);
     uint32_t get_decoded_value();
     unsigned int get_pc_range();
+    bool build_fde_index();
+    const eh_frame_fde *find_fde(uintptr_t pc) const;
 
   public:
     DwarfParser(lib_info *lib) : _lib(lib),
@@ -129,6 +129,7 @@ static void destroy_lib_info(struct ps_prochandle* ph) {
         destroy_symtab(lib->symtab);
      }
      free(lib->eh_frame.data);
+     free(lib->eh_frame.fde_index);
      free(lib);
      lib = next;
    }
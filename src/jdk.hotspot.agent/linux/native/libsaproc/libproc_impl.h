@@ -34,12 +34,22 @@
 
 #define BUF_SIZE     (PATH_MAX + NAME_MAX + 1)
 
+// FDE in .eh_frame covering [pc_begin, pc_end)
+typedef struct eh_frame_fde {
+  uintptr_t pc_begin;
+  uintptr_t pc_end;
+  unsigned char* entry;
+} eh_frame_fde;
+
 // .eh_frame data
 typedef struct eh_frame_info {
   uintptr_t library_base_addr;
   uintptr_t v_addr;
   unsigned char* data;
   int size;
+  // FDEs sorted by pc_begin, built by DwarfParser on first lookup
+  eh_frame_fde* fde_index;
+  int fde_count;
 } eh_frame_info;
 
 // list of shared objects
@@ -363,6 +363,19 @@ eventInstance(EventInfo *evinfo)
     return object;
 }
 
+/*
+ * Return the class name of the event class, looking it up on
+ * first use. The result is cached in *pclassname.
+ */
+static char *
+eventClassname(jclass clazz, char **pclassname)
+{
+    if (*pclassname == NULL) {
+        *pclassname = getClassname(clazz);
+    }
+    return *pclassname;
+}
+
 /*
  * Determine if this event is interesting to this handler.
  * Do so by checking each of the handler's filters.
@@ -374,10 +387,15 @@ eventInstance(EventInfo *evinfo)
  *
  * If shouldDelete is returned true, a count filter has expired
  * and the corresponding node should be deleted.
+ *
+ * The class name of the event is only needed by ClassMatch and
+ * ClassExclude filters, so it is looked up lazily through pclassname
+ * the first time such a filter is checked. *pclassname must be NULL
+ * initially and the caller must free it once all handlers have run.
  */
 jboolean
 eventFilterRestricted_passesFilter(JNIEnv *env,
-                                   char *classname,
+                                   char **pclassname,
                                    EventInfo *evinfo,
                                    HandlerNode *node,
                                    jboolean *shouldDelete)
@@ -497,7 +515,7 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
                 break;
 
         case JDWP_REQUEST_MODIFIER(ClassMatch): {
-            if (!patternStringMatch(classname,
+            if (!patternStringMatch(eventClassname(clazz, pclassname),
                        filter->u.ClassMatch.classPattern)) {
                 return JNI_FALSE;
             }
@@ -505,7 +523,7 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
         }
 
         case JDWP_REQUEST_MODIFIER(ClassExclude): {
-            if (patternStringMatch(classname,
+            if (patternStringMatch(eventClassname(clazz, pclassname),
                       filter->u.ClassExclude.classPattern)) {
                 return JNI_FALSE;
             }
@@ -551,7 +551,8 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
         char        *classname;
 
         node = getHandlerChain(ei)->first;
-        classname = getClassname(evinfo->clazz);
+        /* Looked up by the filters only if a handler needs it. */
+        classname = NULL;
 
         /* Filter the event over each handler node. */
         while (node != NULL) {
@@ -559,7 +560,7 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
-            if (eventFilterRestricted_passesFilter(env, classname,
+            if (eventFilterRestricted_passesFilter(env, &classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
                 HandlerFunction func = HANDLER_FUNCTION(node);
@@ -21,6 +21,7 @@
  * questions.
  */
 
+#include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "threadHelper.inline.hpp"
@@ -193,3 +194,19 @@ TEST_VM(SymbolTable, test_cleanup_delay_drain) {
     ASSERT_EQ(symbols[i]->refcount(), 1) << "TempNewSymbol refcount after drain is 1";
   }
 }
+
+TEST(SymbolTable, hash_code_unrolled) {
+  // The unrolled byte hash must match the plain polynomial hash, since
+  // archived symbols and strings are looked up with hashes computed at dump time.
+  jbyte bytes[37];
+  for (int i = 0; i < (int)sizeof(bytes); i++) {
+    bytes[i] = (jbyte)(i * 73 + 0xA5);
+  }
+  for (int len = 0; len <= (int)sizeof(bytes); len++) {
+    unsigned int expected = 0;
+    for (int i = 0; i < len; i++) {
+      expected = 31 * expected + (((unsigned int)bytes[i]) & 0xFF);
+    }
+    ASSERT_EQ(expected, java_lang_String::hash_code(bytes, len)) << "length " << len;
+  }
+}
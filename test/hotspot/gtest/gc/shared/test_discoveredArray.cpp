@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shared/referenceProcessor.inline.hpp"
+#include "unittest.hpp"
+
+// The references are never dereferenced, so fake oops will do
+static oop fake_ref(size_t i) {
+  return cast_to_oop((i + 1) * HeapWordSize);
+}
+
+static void append_refs(DiscoveredArray& array, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++) {
+    array.append(fake_ref(i));
+  }
+}
+
+TEST_VM(DiscoveredArray, append) {
+  DiscoveredArray array;
+  ASSERT_TRUE(array.is_empty());
+
+  append_refs(array, 0, 1000);
+  ASSERT_EQ(array.length(), 1000u);
+
+  for (size_t i = 0; i < array.length(); i++) {
+    ASSERT_EQ(array.at(i), fake_ref(i));
+  }
+
+  array.truncate(10);
+  ASSERT_EQ(array.length(), 10u);
+  ASSERT_EQ(array.at(9), fake_ref(9));
+
+  array.clear();
+  ASSERT_TRUE(array.is_empty());
+}
+
+TEST_VM(DiscoveredArray, move_to) {
+  DiscoveredArray from;
+  DiscoveredArray to;
+
+  append_refs(from, 0, 100);
+  append_refs(to, 100, 10);
+
+  from.move_to(to, 30);
+  ASSERT_EQ(from.length(), 70u);
+  ASSERT_EQ(to.length(), 40u);
+
+  // The moved references are the last ones, appended in order
+  for (size_t i = 0; i < 30; i++) {
+    ASSERT_EQ(to.at(10 + i), fake_ref(70 + i));
+  }
+
+  from.move_to(to, from.length());
+  ASSERT_TRUE(from.is_empty());
+  ASSERT_EQ(to.length(), 110u);
+}
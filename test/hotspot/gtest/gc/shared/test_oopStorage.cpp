@@ -529,6 +529,41 @@ TEST_VM_F(OopStorageTest, bulk_allocation) {
   }
 }
 
+TEST_VM_F(OopStorageTest, allocation_cache) {
+  static const size_t num_entries = 100;
+  oop* entries[num_entries] = {};
+
+  {
+    OopStorageAllocationCache cache(&storage());
+    for (size_t i = 0; i < num_entries; ++i) {
+      entries[i] = cache.allocate();
+      ASSERT_TRUE(entries[i] != nullptr);
+      EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, storage().allocation_status(entries[i]));
+      for (size_t j = 0; j < i; ++j) {
+        EXPECT_NE(entries[j], entries[i]);
+      }
+    }
+    EXPECT_LE(num_entries, storage().allocation_count());
+
+    for (size_t i = 0; i < num_entries; ++i) {
+      cache.release(entries[i]);
+    }
+    // Released entries are reused.
+    oop* reused = cache.allocate();
+    EXPECT_EQ(entries[num_entries - 1], reused);
+    cache.release(reused);
+
+    cache.flush();
+    EXPECT_EQ(0u, storage().allocation_count());
+
+    entries[0] = cache.allocate();
+    ASSERT_TRUE(entries[0] != nullptr);
+    cache.release(entries[0]);
+    EXPECT_LT(0u, storage().allocation_count());
+  } // Cache destruction releases the cached entries.
+  EXPECT_EQ(0u, storage().allocation_count());
+}
+
 TEST_VM_F(OopStorageTest, invalid_malloc_pointer) {
   char* mem = NEW_C_HEAP_ARRAY(char, 1000, mtInternal);
   oop* ptr = reinterpret_cast<oop*>(align_down(mem + 250, sizeof(oop)));
@@ -1034,6 +1069,112 @@ TEST_VM_F(OopStorageTestParIteration, par_state_concurrent_const_oops_do) {
   vstate.check();
 }
 
+class VM_IterateUncleared : public VM_GTestExecuteAtSafepoint {
+public:
+  VM_IterateUncleared(OopStorage* storage, bool clear_some) :
+    _storage(storage), _clear_some(clear_some), _visited(0), _cleared(0), _skipped(0)
+  {}
+
+  void doit() {
+    OopStorage::ParState<false, false> state(_storage, 1);
+    _skipped = state.iterate_uncleared([&](oop* ptr) {
+      // Clear every other entry with a value
+      ++_visited;
+      if (_clear_some && *ptr != nullptr && (_visited % 2) == 0) {
+        *ptr = nullptr;
+        ++_cleared;
+        return true;
+      }
+      return false;
+    });
+  }
+
+  OopStorage* _storage;
+  bool _clear_some;
+  size_t _visited;
+  size_t _cleared;
+  size_t _skipped;
+};
+
+TEST_VM_F(OopStorageTestWithAllocation, iterate_uncleared) {
+  // Dummy oop value.
+  intptr_t dummy_oop_value = 0xbadbeaf;
+  oop dummy_oop = reinterpret_cast<oopDesc*>(&dummy_oop_value);
+
+  for (size_t i = 0; i < _max_entries; ++i) {
+    *_entries[i] = dummy_oop;
+  }
+
+  VM_IterateUncleared clear_op(&storage(), true);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&clear_op);
+  }
+  EXPECT_EQ(_max_entries, clear_op._visited);
+  EXPECT_EQ(_max_entries / 2, clear_op._cleared);
+  EXPECT_EQ(0u, clear_op._skipped);
+
+  // Cleared entries are skipped by the next iteration
+  VM_IterateUncleared skip_op(&storage(), false);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&skip_op);
+  }
+  EXPECT_EQ(_max_entries - clear_op._cleared, skip_op._visited);
+  EXPECT_EQ(clear_op._cleared, skip_op._skipped);
+
+  // A reallocated entry is visited again
+  size_t released = 0;
+  for ( ; *_entries[released] != nullptr; ++released) {}
+  release_entry(storage(), _entries[released]);
+  _entries[released] = storage().allocate();
+  ASSERT_TRUE(_entries[released] != nullptr);
+  *_entries[released] = dummy_oop;
+
+  VM_IterateUncleared realloc_op(&storage(), false);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&realloc_op);
+  }
+  EXPECT_EQ(_max_entries - clear_op._cleared + 1, realloc_op._visited);
+  EXPECT_EQ(clear_op._cleared - 1, realloc_op._skipped);
+}
+
+TEST_VM_F(OopStorageTestWithAllocation, allocation_cache_reuse_cleared) {
+  // Dummy oop value.
+  intptr_t dummy_oop_value = 0xbadbeaf;
+  oop dummy_oop = reinterpret_cast<oopDesc*>(&dummy_oop_value);
+
+  for (size_t i = 0; i < _max_entries; ++i) {
+    *_entries[i] = dummy_oop;
+  }
+
+  VM_IterateUncleared clear_op(&storage(), true);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&clear_op);
+  }
+  ASSERT_LT(0u, clear_op._cleared);
+
+  // An entry cleared by weak processing and released to a cache is visited
+  // again once the cache hands it out.
+  size_t released = 0;
+  for ( ; *_entries[released] != nullptr; ++released) {}
+  OopStorageAllocationCache cache(&storage());
+  cache.release(_entries[released]);
+  oop* reused = cache.allocate();
+  ASSERT_EQ(_entries[released], reused);
+  *reused = dummy_oop;
+
+  VM_IterateUncleared reuse_op(&storage(), false);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&reuse_op);
+  }
+  EXPECT_EQ(_max_entries - clear_op._cleared + 1, reuse_op._visited);
+  EXPECT_EQ(clear_op._cleared - 1, reuse_op._skipped);
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, delete_empty_blocks) {
   size_t initial_active_size = active_count(storage());
   EXPECT_EQ(initial_active_size, storage().block_count());
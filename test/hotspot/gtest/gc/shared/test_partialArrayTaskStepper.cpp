@@ -64,6 +64,17 @@ static void run_test(size_t length, size_t chunk_size, uint n_workers) {
   ASSERT_EQ(tasks, length / chunk_size);
 }
 
+static void run_adaptive_test(size_t length, size_t chunk_size, uint n_workers, uint chunks_per_worker) {
+  const PartialArrayTaskStepper stepper(n_workers, chunk_size, chunks_per_worker);
+  Atomic<size_t> to_length;
+  uint tasks = simulate(&stepper, length, &to_length);
+  ASSERT_EQ(length, to_length.load_relaxed());
+  ASSERT_EQ(tasks, length / stepper.chunk_size(length));
+  const size_t max_chunks = (size_t)n_workers * chunks_per_worker;
+  // Rounding down the adapted chunk size may add a few chunks
+  ASSERT_LE(tasks, max_chunks + max_chunks / chunk_size);
+}
+
 TEST(PartialArrayTaskStepperTest, doit) {
   for (size_t chunk_size = 50; chunk_size <= 500; chunk_size += 50) {
     for (uint n_workers = 1; n_workers <= 256; n_workers = (n_workers * 3 / 2 + 1)) {
@@ -77,3 +88,13 @@ TEST(PartialArrayTaskStepperTest, doit) {
     }
   }
 }
+
+TEST(PartialArrayTaskStepperTest, adaptive) {
+  for (uint chunks_per_worker = 1; chunks_per_worker <= 64; chunks_per_worker *= 4) {
+    for (uint n_workers = 1; n_workers <= 256; n_workers = (n_workers * 3 / 2 + 1)) {
+      for (size_t length = 0; length <= 100000000; length = (length * 3 + 1)) {
+        run_adaptive_test(length, 50, n_workers, chunks_per_worker);
+      }
+    }
+  }
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "classfile/javaClasses.inline.hpp"
+#include "classfile/vmClasses.hpp"
+#include "gc/shared/referenceProcessor.inline.hpp"
+#include "memory/iterator.hpp"
+#include "memory/oopFactory.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/objArrayOop.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+
+#include "unittest.hpp"
+
+// This "test" doesn't really verify much.  Rather, it's mostly a
+// microbenchmark for the discovered reference data structures and the
+// kernels that process them.  It runs each kernel on a synthetic set of
+// WeakReferences without ReferenceQueue, and logs the time per reference.
+//
+// The DiscoveredArray kernels use fake oops and go up to 10M entries.  The
+// processing kernels need real Reference objects in the Java heap, and stop
+// at 1M entries to keep the heap needed by the test reasonable.
+
+static const size_t _array_sizes[] = { 1000, 10000, 100000, 1000000, 10000000 };
+static const size_t _heap_sizes[]  = { 1000, 10000, 100000, 1000000 };
+
+class ReferenceProcessorPerfTest : public ::testing::Test {
+public:
+  class VM_ProcessRefs;
+
+  static ReferenceProcessor* ref_processor();
+  static objArrayHandle allocate_refs(size_t count, objArrayHandle& referents, TRAPS);
+  static void run_process_test(size_t count, bool use_array, bool alive);
+
+  static void show(const char* name, size_t count, Tickspan duration);
+
+  static ReferenceProcessor* _ref_processor;
+};
+
+ReferenceProcessor* ReferenceProcessorPerfTest::_ref_processor = nullptr;
+
+static AlwaysTrueClosure _always_true;
+static AlwaysFalseClosure _always_false;
+
+ReferenceProcessor* ReferenceProcessorPerfTest::ref_processor() {
+  if (_ref_processor == nullptr) {
+    _ref_processor = new ReferenceProcessor(&_always_true);
+    _ref_processor->initialize_null_queue_handle();
+  }
+  return _ref_processor;
+}
+
+void ReferenceProcessorPerfTest::show(const char* name, size_t count, Tickspan duration) {
+  tty->print_cr("%-24s %9zu refs: %10.3f ms %8.2f ns/ref",
+                name, count, duration.seconds() * MILLIUNITS,
+                (double)duration.nanoseconds() / (double)count);
+}
+
+// The references are never dereferenced, so fake oops will do
+static oop fake_ref(size_t i) {
+  return cast_to_oop((i + 1) * HeapWordSize);
+}
+
+TEST_VM_F(ReferenceProcessorPerfTest, discovered_array) {
+  for (size_t size : _array_sizes) {
+    DiscoveredArray array;
+
+    Ticks start = Ticks::now();
+    for (size_t i = 0; i < size; i++) {
+      array.append(fake_ref(i));
+    }
+    show("DiscoveredArray grow", size, Ticks::now() - start);
+
+    // The storage is kept after a clear, like between collections
+    start = Ticks::now();
+    array.clear();
+    show("DiscoveredArray clear", size, Ticks::now() - start);
+
+    start = Ticks::now();
+    for (size_t i = 0; i < size; i++) {
+      array.append(fake_ref(i));
+    }
+    show("DiscoveredArray append", size, Ticks::now() - start);
+
+    // Balancing moves references between the per-worker arrays
+    DiscoveredArray other;
+    start = Ticks::now();
+    array.move_to(other, size / 2);
+    show("DiscoveredArray move_to", size / 2, Ticks::now() - start);
+
+    ASSERT_EQ(array.length() + other.length(), size);
+  }
+}
+
+objArrayHandle ReferenceProcessorPerfTest::allocate_refs(size_t count, objArrayHandle& referents, TRAPS) {
+  objArrayHandle refs = oopFactory::new_objArray_handle(vmClasses::Object_klass(), (int)count, CHECK_(objArrayHandle()));
+  referents = oopFactory::new_objArray_handle(vmClasses::Object_klass(), (int)count, CHECK_(objArrayHandle()));
+
+  const oop null_queue = ref_processor()->_null_queue_handle.resolve();
+  for (size_t i = 0; i < count; i++) {
+    // Keep the referents strongly reachable, so that collections
+    // during the allocation do not clear them
+    oop referent = vmClasses::Object_klass()->allocate_instance(CHECK_(objArrayHandle()));
+    referents->obj_at_put((int)i, referent);
+
+    oop ref = vmClasses::WeakReference_klass()->allocate_instance(CHECK_(objArrayHandle()));
+    ref->obj_field_put(java_lang_ref_Reference::referent_offset(), referents->obj_at((int)i));
+    ref->obj_field_put(java_lang_ref_Reference::queue_offset(), null_queue);
+    refs->obj_at_put((int)i, ref);
+  }
+  return refs;
+}
+
+class ReferenceProcessorPerfTest::VM_ProcessRefs : public VM_GTestExecuteAtSafepoint {
+  objArrayHandle _refs;
+  bool _use_array;
+  bool _alive;
+  Tickspan _discover_time;
+  Tickspan _process_time;
+  size_t _removed;
+  size_t _cleared_without_queue;
+
+public:
+  VM_ProcessRefs(objArrayHandle refs, bool use_array, bool alive) :
+    _refs(refs), _use_array(use_array), _alive(alive),
+    _discover_time(), _process_time(), _removed(0), _cleared_without_queue(0)
+  {}
+
+  void doit() {
+    ReferenceProcessor* const rp = ref_processor();
+    BoolObjectClosure* const is_alive = _alive ? (BoolObjectClosure*)&_always_true : &_always_false;
+    BarrierEnqueueDiscoveredFieldClosure enqueue;
+    const int length = _refs->length();
+
+    if (_use_array) {
+      DiscoveredArray array;
+      Ticks start = Ticks::now();
+      for (int i = 0; i < length; i++) {
+        // References in an array are self-looped, like when discovered
+        const oop ref = _refs->obj_at(i);
+        java_lang_ref_Reference::set_discovered_raw(ref, ref);
+        array.append(ref);
+      }
+      _discover_time = Ticks::now() - start;
+
+      start = Ticks::now();
+      _removed = rp->process_discovered_array_work(array, is_alive, &do_nothing_cl, &_cleared_without_queue);
+      _process_time = Ticks::now() - start;
+    } else {
+      DiscoveredList list;
+      Ticks start = Ticks::now();
+      for (int i = 0; i < length; i++) {
+        // The last reference in a list is self-looped
+        const oop ref = _refs->obj_at(i);
+        java_lang_ref_Reference::set_discovered_raw(ref, list.is_empty() ? ref : list.head());
+        list.add_as_head(ref);
+      }
+      _discover_time = Ticks::now() - start;
+
+      start = Ticks::now();
+      PendingListSegment segment;
+      _removed = rp->process_discovered_list_work(list, is_alive, &do_nothing_cl, &enqueue, &segment, true /* do_enqueue_and_clear */,
+                                                  &_cleared_without_queue);
+      assert(segment.is_empty(), "references without ReferenceQueue are not enqueued");
+      _process_time = Ticks::now() - start;
+    }
+  }
+
+  Tickspan discover_time() const { return _discover_time; }
+  Tickspan process_time() const { return _process_time; }
+  size_t removed() const { return _removed; }
+  size_t cleared_without_queue() const { return _cleared_without_queue; }
+};
+
+void ReferenceProcessorPerfTest::run_process_test(size_t count, bool use_array, bool alive) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  HandleMark hm(THREAD);
+
+  objArrayHandle referents;
+  objArrayHandle refs = allocate_refs(count, referents, THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION) << "allocation of " << count << " references failed";
+
+  VM_ProcessRefs op(refs, use_array, alive);
+  VMThread::execute(&op);
+
+  // All references are without ReferenceQueue, none stay discovered
+  ASSERT_EQ(op.removed(), count);
+  ASSERT_EQ(op.cleared_without_queue(), alive ? 0 : count);
+  for (size_t i = 0; i < count; i++) {
+    const oop ref = refs->obj_at((int)i);
+    ASSERT_TRUE(java_lang_ref_Reference::discovered(ref) == nullptr);
+    ASSERT_TRUE(java_lang_ref_Reference::unknown_referent_no_keepalive(ref) ==
+                (alive ? referents->obj_at((int)i) : oop(nullptr)));
+  }
+
+  const char* const kind = use_array ? "array" : "list";
+  show(err_msg("%s discover", kind).buffer(), count, op.discover_time());
+  show(err_msg("%s %s", kind, alive ? "filter" : "clear").buffer(), count, op.process_time());
+}
+
+TEST_VM_F(ReferenceProcessorPerfTest, process_discovered_list) {
+  for (size_t size : _heap_sizes) {
+    run_process_test(size, false /* use_array */, false /* alive */);
+    run_process_test(size, false /* use_array */, true /* alive */);
+  }
+}
+
+TEST_VM_F(ReferenceProcessorPerfTest, process_discovered_array) {
+  for (size_t size : _heap_sizes) {
+    run_process_test(size, true /* use_array */, false /* alive */);
+    run_process_test(size, true /* use_array */, true /* alive */);
+  }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/z/zAddressArray.hpp"
+#include "unittest.hpp"
+
+static void append_entries(ZAddressArray& array, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    array.append(zaddress(i * 16), zaddress(i), zpointer(i));
+  }
+}
+
+TEST(ZAddressArray, append) {
+  ZAddressArray array;
+
+  ASSERT_TRUE(array.is_empty());
+  ASSERT_EQ(array.capacity(), 0u);
+
+  append_entries(array, 100);
+
+  ASSERT_EQ(array.length(), 100u);
+  ASSERT_GE(array.capacity(), 100u);
+  ASSERT_FALSE(array.is_empty());
+
+  for (size_t i = 0; i < array.length(); i++) {
+    ASSERT_EQ(array.reference_addr_at(i), zaddress(i * 16));
+    ASSERT_EQ(array.referent_addr_at(i), zaddress(i));
+    ASSERT_EQ(array.referent_field_value_at(i), zpointer(i));
+    ASSERT_EQ(array.referent_field_values()[i], zpointer(i));
+  }
+}
+
+TEST_VM(ZAddressArray, sort_by_referent_addr) {
+  ZAddressArray array;
+
+  for (size_t i = 0; i < 100; i++) {
+    array.append(zaddress(i), zaddress(100 - i), zpointer(i));
+  }
+
+  // Sort all but the first and last entries
+  array.sort_by_referent_addr(1, 99);
+
+  ASSERT_EQ(array.referent_addr_at(0), zaddress(100));
+  ASSERT_EQ(array.referent_addr_at(99), zaddress(1));
+
+  for (size_t i = 1; i < 99; i++) {
+    ASSERT_EQ(array.referent_addr_at(i), zaddress(i + 1));
+
+    // The other parts of the entry follow along
+    ASSERT_EQ(array.reference_addr_at(i), zaddress(99 - i));
+    ASSERT_EQ(array.referent_field_value_at(i), zpointer(99 - i));
+  }
+}
+
+TEST(ZAddressArray, retain_storage) {
+  ZAddressArray array;
+
+  append_entries(array, 1000);
+  const size_t capacity = array.capacity();
+
+  // Fewer entries needed, but not enough to shrink
+  array.clear_and_reserve(600);
+  ASSERT_TRUE(array.is_empty());
+  ASSERT_EQ(array.capacity(), capacity);
+
+  // Heavily oversized, storage is retained for a few cycles
+  array.clear_and_reserve(0);
+  array.clear_and_reserve(0);
+  array.clear_and_reserve(0);
+  ASSERT_EQ(array.capacity(), capacity);
+
+  // Shrink once oversized for long enough
+  array.clear_and_reserve(0);
+  ASSERT_LT(array.capacity(), capacity);
+  ASSERT_GT(array.capacity(), 0u);
+
+  // Grow immediately
+  array.clear_and_reserve(capacity);
+  ASSERT_GE(array.capacity(), capacity);
+  ASSERT_EQ(array.size_in_bytes(), array.capacity() * sizeof(ZWeakRefData));
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zAddressArray.hpp"
+#include "utilities/count_trailing_zeros.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+
+#include "unittest.hpp"
+
+// This "test" doesn't really verify much.  Rather, it's mostly a
+// microbenchmark for ZAddressArray, which holds the discovered references
+// without ReferenceQueue.  It times appending, growing, filtering and
+// clearing arrays of increasing sizes, and logs the time per reference.
+//
+// The filter loop has the same shape as the one used when processing the
+// references without queue. A fake mark bad bit is used, so that the test
+// does not depend on the state of the pointer colors.
+
+static const size_t _sizes[] = { 1000, 10000, 100000, 1000000, 10000000 };
+
+static const uintptr_t _fake_mark_bad_bit = 1 << 4;
+
+static void show(const char* name, size_t count, Tickspan duration) {
+  tty->print_cr("%-24s %9zu refs: %10.3f ms %8.2f ns/ref",
+                name, count, duration.seconds() * MILLIUNITS,
+                (double)duration.nanoseconds() / (double)count);
+}
+
+static void append_entries(ZAddressArray& array, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    // Every fourth referent field value is mark bad
+    const uintptr_t value = (i + 1) << 16 | ((i % 4) == 0 ? _fake_mark_bad_bit : 0);
+    array.append(zaddress((i + 1) * 16), zaddress((i + 1) * 16 + 8), zpointer(value));
+  }
+}
+
+static size_t filter_entries(const ZAddressArray& array) {
+  const zpointer* const values = array.referent_field_values();
+  const size_t length = array.length();
+
+  size_t slow = 0;
+  for (size_t start = 0; start < length; start += BitsPerWord) {
+    const size_t block_length = MIN2((size_t)BitsPerWord, length - start);
+
+    uintx bits = 0;
+    for (size_t i = 0; i < block_length; i++) {
+      const uintptr_t value = untype(values[start + i]);
+      const uintx not_good = ((value & _fake_mark_bad_bit) != 0) | (value == 0);
+      bits |= not_good << i;
+    }
+
+    // Visit the entries that need a liveness check
+    for (; bits != 0; bits &= bits - 1) {
+      const size_t i = start + count_trailing_zeros(bits);
+      slow += (array.reference_addr_at(i) != zaddress::null);
+    }
+  }
+
+  return slow;
+}
+
+TEST(ZAddressArrayPerf, append_grow_filter_clear) {
+  for (size_t size : _sizes) {
+    ZAddressArray array;
+
+    Ticks start = Ticks::now();
+    append_entries(array, size);
+    show("ZAddressArray grow", size, Ticks::now() - start);
+
+    // Sized for the next cycle, like after processing
+    start = Ticks::now();
+    array.clear_and_reserve(size);
+    show("ZAddressArray clear", size, Ticks::now() - start);
+
+    start = Ticks::now();
+    append_entries(array, size);
+    show("ZAddressArray append", size, Ticks::now() - start);
+
+    start = Ticks::now();
+    const size_t slow = filter_entries(array);
+    show("ZAddressArray filter", size, Ticks::now() - start);
+
+    ASSERT_EQ(slow, (size + 3) / 4);
+  }
+}
+
+TEST_VM(ZAddressArrayPerf, sort_by_referent_addr) {
+  for (size_t size : _sizes) {
+    if (size > 1000000) {
+      // The sort copies the entries to the resource area
+      break;
+    }
+
+    ZAddressArray array;
+
+    // Referents in decreasing address order
+    for (size_t i = 0; i < size; i++) {
+      array.append(zaddress(i * 16), zaddress((size - i) * 16), zpointer(i + 1));
+    }
+
+    const Ticks start = Ticks::now();
+    array.sort_by_referent_addr(0, size);
+    show("ZAddressArray sort", size, Ticks::now() - start);
+
+    ASSERT_TRUE(array.referent_addr_at(0) < array.referent_addr_at(size - 1));
+  }
+}
@@ -31,6 +31,7 @@
 #include "memory/metaspace/metaspaceStatistics.hpp"
 #include "memory/metaspace.hpp"
 #include "oops/klass.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutex.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/align.hpp"
@@ -230,6 +231,16 @@ class ClmsTester {
     return MetaBlock();
   }
 
+  ClassLoaderMetaspace* clms() const { return _clms; }
+
+  void set_contended() { _clms->_is_contended = true; }
+
+  ArenaStats nonclass_arena_stats() const {
+    ClmsStats stats;
+    _clms->add_to_statistics(&stats);
+    return stats._arena_stats_nonclass;
+  }
+
   MetaBlock allocate_expect_success(size_t word_size, bool is_class) {
     MetaBlock bl = allocate_and_check(word_size, is_class);
     EXPECT_TRUE(bl.is_nonempty());
@@ -392,6 +403,55 @@ static void test_random(size_t klass_arena_alignment) {
   }
 }
 
+static void test_allocation_buffer(bool contended) {
+  const size_t buffer_words = align_down(MetaspaceAllocationBufferSize / BytesPerWord, Metaspace::min_allocation_word_size);
+  if (buffer_words == 0) {
+    return;
+  }
+  const size_t word_size = Metaspace::min_allocation_word_size * 4;
+  MetaspaceGtestContext class_context, nonclass_context;
+  {
+    ClmsTester tester(1, Metaspace::StandardMetaspaceType, class_context.context(), nonclass_context.context());
+    if (contended) {
+      tester.set_contended();
+    }
+    const ArenaStats before = tester.nonclass_arena_stats();
+    {
+      MetaspaceAllocationBuffer buffer(tester.clms());
+      MetaWord* p1 = tester.clms()->allocate(word_size, Metaspace::NonClassType);
+      MetaWord* p2 = tester.clms()->allocate(word_size, Metaspace::NonClassType);
+      ASSERT_NOT_NULL(p1);
+      ASSERT_NOT_NULL(p2);
+      if (contended) {
+        // Both allocations were carved from the same thread-local buffer.
+        EXPECT_EQ(p2, p1 + word_size);
+        EXPECT_EQ(buffer.free_words(), buffer_words - 2 * word_size);
+      } else {
+        // Uncontended metaspaces never hand out buffers.
+        EXPECT_EQ(buffer.free_words(), (size_t)0);
+      }
+    }
+    // The unused tail of the buffer went back to the free blocks of the arena.
+    const ArenaStats after = tester.nonclass_arena_stats();
+    if (contended) {
+      EXPECT_EQ(after._free_blocks_num, before._free_blocks_num + 1);
+      EXPECT_EQ(after._free_blocks_word_size, before._free_blocks_word_size + buffer_words - 2 * word_size);
+    } else {
+      EXPECT_EQ(after._free_blocks_num, before._free_blocks_num);
+    }
+  }
+  EXPECT_EQ(class_context.used_words(), (size_t)0);
+  EXPECT_EQ(nonclass_context.used_words(), (size_t)0);
+}
+
+TEST_VM(metaspace, CLMS_allocation_buffer_uncontended) {
+  test_allocation_buffer(false);
+}
+
+TEST_VM(metaspace, CLMS_allocation_buffer_contended) {
+  test_allocation_buffer(true);
+}
+
 #define TEST_RANDOM_N(n)               \
 TEST_VM(metaspace, CLMS_random_##n) {  \
   test_random(n);                      \
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "nmt/mallocTracker.hpp"
+#include "nmt/memTracker.hpp"
+#include "unittest.hpp"
+
+TEST_VM(NMT, malloc_sampler) {
+  // The sampler is only consulted with NMT=detail, don't change it under its feet
+  if (MemTracker::tracking_level() == NMT_detail) {
+    return;
+  }
+
+  // Disabled, every malloc is sampled at its own size
+  EXPECT_FALSE(MallocSampler::is_enabled());
+  EXPECT_TRUE(MallocSampler::should_sample(16));
+  EXPECT_EQ(MallocSampler::weight(16), (size_t)16);
+
+  const size_t interval = 4 * K;
+  const size_t size = 64;
+  const size_t n = 100000;
+  MallocSampler::initialize(interval);
+  ASSERT_TRUE(MallocSampler::is_enabled());
+
+  size_t sampled = 0;
+  size_t estimated = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (MallocSampler::should_sample(size)) {
+      sampled++;
+      estimated += MallocSampler::weight(size);
+    }
+  }
+  MallocSampler::initialize(0);
+
+  // A small malloc is sampled about size / interval of the time, and
+  // scaling the sampled ones estimates the total within a few percent
+  EXPECT_GT(sampled, (size_t)0);
+  EXPECT_LT(sampled, n / 10);
+  const size_t total = n * size;
+  EXPECT_GT(estimated, total - total / 10);
+  EXPECT_LT(estimated, total + total / 10);
+
+  // Larger than the interval, nearly always sampled at about its size
+  EXPECT_GE(MallocSampler::weight(64 * interval), 64 * interval);
+  EXPECT_LE(MallocSampler::weight(64 * interval), 64 * interval + 1);
+}
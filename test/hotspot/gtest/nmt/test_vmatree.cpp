@@ -2070,4 +2070,38 @@ TEST_VM_F(NMTVMATreeTest, UpdateRegionTest) {
   for (auto ci : call_info) {
     call_update_region(ci);
   }
-}
\ No newline at end of file
+}
+TEST_VM_F(NMTVMATreeTest, BatchedMappings) {
+  VMATree::RegionData rd{si[0], mtTest};
+  Tree tree;
+  VMATree::SummaryDiff diff;
+  tree.reserve_mapping(0, 1000, rd, diff);
+
+  // Abutting ranges are merged, the others are applied one by one
+  const VMATree::MappingRange ranges[] = {{0, 100}, {100, 200}, {300, 400}, {500, 600}, {600, 700}};
+  const int count = (int)(sizeof(ranges) / sizeof(ranges[0]));
+  tree.commit_mappings(ranges, count, rd, diff);
+  EXPECT_EQ(0, diff.tag[NMTUtil::tag_to_index(mtTest)].reserve);
+  EXPECT_EQ(500, diff.tag[NMTUtil::tag_to_index(mtTest)].commit);
+  EXPECT_EQ(7, count_nodes(tree));
+
+  // Same result as registering the ranges one by one
+  Tree expected;
+  expected.reserve_mapping(0, 1000, rd, diff);
+  expected.commit_mapping(0, 200, rd, diff);
+  expected.commit_mapping(300, 100, rd, diff);
+  expected.commit_mapping(500, 200, rd, diff);
+  VMATree::VMARBTree::Range r = tree.tree().find_enclosing_range(550);
+  VMATree::VMARBTree::Range e = expected.tree().find_enclosing_range(550);
+  EXPECT_EQ(e.start->key(), r.start->key());
+  EXPECT_EQ(e.end->key(), r.end->key());
+  EXPECT_EQ(count_nodes(expected), count_nodes(tree));
+
+  tree.uncommit_mappings(ranges, count, rd, diff);
+  EXPECT_EQ(0, diff.tag[NMTUtil::tag_to_index(mtTest)].reserve);
+  EXPECT_EQ(-500, diff.tag[NMTUtil::tag_to_index(mtTest)].commit);
+
+  tree.release_mappings(ranges, count, diff);
+  EXPECT_EQ(-500, diff.tag[NMTUtil::tag_to_index(mtTest)].reserve);
+  EXPECT_EQ(0, diff.tag[NMTUtil::tag_to_index(mtTest)].commit);
+}
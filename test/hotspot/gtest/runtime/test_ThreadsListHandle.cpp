@@ -22,7 +22,7 @@
  */
 
 #include "runtime/thread.inline.hpp"
-#include "runtime/threadSMR.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "unittest.hpp"
 
 class ThreadsListHandleTest : public ::testing::Test {
@@ -693,3 +693,38 @@ TEST_VM(ThreadsListHandle, sanity) {
 
   EnableThreadSMRStatistics = saved_flag_val;
 }
+
+TEST_VM(ThreadsListCriticalSection, sanity) {
+  Thread* thr = Thread::current();
+
+  {
+    ThreadsListCriticalSection tlcs(thr);
+
+    // A ThreadsListCriticalSection does not use a hazard ptr:
+    EXPECT_EQ(ThreadsListHandleTest::get_Thread_threads_hazard_ptr(thr), (ThreadsList*)nullptr)
+        << "thr->_threads_hazard_ptr must be null";
+    EXPECT_EQ(ThreadsListHandleTest::get_Thread_threads_list_ptr(thr), (SafeThreadsListPtr*)nullptr)
+        << "thr->_threads_list_ptr must be null";
+
+    EXPECT_EQ(tlcs.list(), ThreadsSMRSupport::get_java_thread_list())
+        << "tlcs.list() must match the current ThreadsList";
+
+    uint count = 0;
+    bool found_self = false;
+    for (JavaThread* jt : tlcs) {
+      found_self |= (jt == thr);
+      count++;
+    }
+    EXPECT_EQ(count, tlcs.length())
+        << "iteration must visit every thread in tlcs.list()";
+    EXPECT_TRUE(found_self)
+        << "the current thread must be on tlcs.list()";
+
+    {
+      // A nested ThreadsListHandle sees the same list:
+      ThreadsListHandle tlh(thr);
+      EXPECT_EQ(tlh.list(), tlcs.list())
+          << "tlh.list() must match tlcs.list()";
+    }
+  }
+}
@@ -21,6 +21,8 @@
  * questions.
  */
 
+#include "runtime/javaThread.hpp"
+#include "runtime/perfData.inline.hpp"
 #include "runtime/perfMemory.hpp"
 #include "unittest.hpp"
 
@@ -40,3 +42,20 @@ TEST_VM_F(PerfMemoryTest, destroy) {
   ASSERT_NE(PerfMemory::capacity(), (size_t)0) << "PerfMemory::_capacity should not be 0";
 }
 
+
+TEST_VM(PerfStripedCounter, sum_and_publish) {
+  JavaThread* THREAD = JavaThread::current();
+  PerfStripedCounter* counter =
+    PerfDataManager::create_striped_counter(SUN_RT, "gtestStripedCounter",
+                                            PerfData::U_Events, THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  ASSERT_NE(counter, (PerfStripedCounter*)nullptr);
+
+  counter->inc();
+  counter->inc(41);
+  EXPECT_EQ(42, counter->get_value());
+
+  // External readers only see the published value.
+  counter->publish();
+  EXPECT_EQ(42, static_cast<PerfLong*>(counter)->get_value());
+}
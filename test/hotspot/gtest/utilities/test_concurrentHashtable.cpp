@@ -102,7 +102,7 @@ typedef ConcurrentHashTable<Config, mtInternal> CustomTestTable;
 
 struct SimpleTestLookup {
   uintptr_t _val;
-  SimpleTestLookup(uintptr_t val) : _val(val) {}
+  SimpleTestLookup(uintptr_t val = 0) : _val(val) {}
   uintx get_hash() {
     return Pointer::get_hash(_val, nullptr);
   }
@@ -194,6 +194,36 @@ static void cht_get_insert(Thread* thr) {
   delete cht;
 }
 
+static void cht_insert_get_batch(Thread* thr) {
+  // More keys than one batch, with the last one repeating the first.
+  const size_t count = SimpleTestTable::BatchSize * 2 + 1;
+  SimpleTestLookup lookups[count];
+  uintptr_t found[count];
+  for (size_t i = 0; i < count; i++) {
+    lookups[i] = SimpleTestLookup((i % (count - 1)) + 1);
+    found[i] = 0;
+  }
+  SimpleTestTable* cht = new SimpleTestTable();
+  auto value_f = [&](size_t i) -> const uintptr_t& {
+    return lookups[i]._val;
+  };
+  auto found_f = [&](size_t i, uintptr_t* value) {
+    found[i] = *value;
+  };
+  EXPECT_EQ(cht->get_batch(thr, count, lookups, found_f), (size_t)0) << "Got values from an empty table.";
+  EXPECT_EQ(cht->insert_get_batch(thr, count, lookups, value_f, found_f), count - 1) << "Duplicate was inserted.";
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(found[i], lookups[i]._val) << "Inserted or duplicate value not passed to FOUND_FUNC.";
+    found[i] = 0;
+  }
+  EXPECT_TRUE(cht->remove(thr, lookups[1])) << "Removing an existing value failed.";
+  EXPECT_EQ(cht->get_batch(thr, count, lookups, found_f), count - 1) << "Getting existing values failed.";
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(found[i], i == 1 ? 0 : lookups[i]._val) << "Wrong value found.";
+  }
+  delete cht;
+}
+
 static bool getinsert_bulkdelete_eval(uintptr_t* val) {
   EXPECT_TRUE(*val > 0 && *val < 4) << "Val wrong for this test.";
   return (*val & 0x1); // Delete all values ending with first bit set.
@@ -503,6 +533,10 @@ TEST_VM(ConcurrentHashTable, basic_insert_get) {
   nomt_test_doer(cht_insert_get);
 }
 
+TEST_VM(ConcurrentHashTable, basic_insert_get_batch) {
+  nomt_test_doer(cht_insert_get_batch);
+}
+
 TEST_VM(ConcurrentHashTable, basic_scope) {
   nomt_test_doer(cht_scope);
 }
@@ -804,3 +804,51 @@ TEST(GrowableArrayCHeap, returning_references_works_as_expected) {
   EXPECT_EQ(5, first);
   EXPECT_EQ(5, last);
 }
+
+TEST(GrowableArrayCHeap, bulk_append) {
+  GrowableArrayCHeap<int, mtTest> arr(0);
+  int* first = arr.append_uninitialized(5);
+  ASSERT_EQ(arr.length(), 5);
+  for (int i = 0; i < 5; i++) {
+    first[i] = i;
+  }
+
+  GrowableArrayCHeap<int, mtTest> other(0);
+  other.appendAll(&arr);
+  other.appendAll(arr.adr_at(1), 3);
+  ASSERT_EQ(other.length(), 8);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(other.at(i), i);
+  }
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(other.at(5 + i), i + 1);
+  }
+
+  // Growing and shrinking keeps the elements.
+  other.reserve(1000);
+  EXPECT_EQ(other.capacity(), 1000);
+  other.shrink_to_fit();
+  EXPECT_EQ(other.capacity(), 8);
+  EXPECT_EQ(other.at(7), 3);
+
+  other.clear_and_reserve(16);
+  EXPECT_TRUE(other.is_empty());
+  EXPECT_EQ(other.capacity(), 16);
+  other.clear_and_reserve(4);
+  EXPECT_EQ(other.capacity(), 16);
+}
+
+TEST_VM(GrowableArrayResource, bulk_append) {
+  ResourceMark rm;
+  GrowableArray<int> arr(2);
+  for (int i = 0; i < 100; i++) {
+    arr.appendAll(&i, 1);
+  }
+  ASSERT_EQ(arr.length(), 100);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(arr.at(i), i);
+  }
+  arr.shrink_to_fit();
+  EXPECT_EQ(arr.capacity(), 100);
+  EXPECT_EQ(arr.at(99), 99);
+}
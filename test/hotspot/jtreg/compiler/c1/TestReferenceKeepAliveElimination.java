@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check which Reference.get() calls C1EliminateReferenceKeepAlive eliminates the keep-alive of
+ * @requires vm.compiler1.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.c1.TestReferenceKeepAliveElimination
+ */
+
+package compiler.c1;
+
+import java.lang.ref.WeakReference;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestReferenceKeepAliveElimination {
+    private static final String LOG_FILE = "reference_keep_alive.log";
+
+    private static final Pattern TASK = Pattern.compile("<task [^>]*method='([^']*)'");
+    private static final Pattern ELIMINATION =
+        Pattern.compile("<reference_keep_alive_elimination candidates='(\\d+)' eliminated='(\\d+)'");
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-Xbatch",
+            "-XX:TieredStopAtLevel=1",
+            "-XX:CompileCommand=compileonly," + Launcher.class.getName() + "::test*",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+C1EliminateReferenceKeepAlive",
+            "-XX:+LogCompilation",
+            "-XX:LogFile=" + LOG_FILE,
+            Launcher.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String log = Files.readString(Path.of(LOG_FILE));
+
+        // The result of get() only decides a forward branch
+        checkElimination(log, "testForwardBranch", 1, 1);
+
+        // The loop condition is a backward branch, which keeps the
+        // result in its state for the safepoint
+        checkElimination(log, "testLoopCondition", 1, 0);
+
+        // The result escapes to the caller
+        checkElimination(log, "testEscape", 1, 0);
+    }
+
+    private static void checkElimination(String log, String method, int candidates, int eliminated) {
+        String task = null;
+        Matcher m = TASK.matcher(log);
+        while (m.find()) {
+            if (m.group(1).contains(" " + method + " ")) {
+                int end = log.indexOf("</task>", m.end());
+                task = log.substring(m.start(), end == -1 ? log.length() : end);
+                break;
+            }
+        }
+        if (task == null) {
+            throw new RuntimeException(method + " was not compiled");
+        }
+
+        Matcher e = ELIMINATION.matcher(task);
+        if (!e.find()) {
+            throw new RuntimeException("No reference_keep_alive_elimination in the compilation of " + method);
+        }
+        int actualCandidates = Integer.parseInt(e.group(1));
+        int actualEliminated = Integer.parseInt(e.group(2));
+        if (actualCandidates != candidates || actualEliminated != eliminated) {
+            throw new RuntimeException(method + ": expected " + candidates + " candidates and " + eliminated +
+                                       " eliminated, got " + actualCandidates + " and " + actualEliminated);
+        }
+    }
+
+    public static class Launcher {
+        static final Object referent = new Object();
+        static final WeakReference<Object> ref = new WeakReference<>(referent);
+
+        static int testForwardBranch(WeakReference<Object> r) {
+            if (r.get() == null) {
+                return 0;
+            }
+            return 1;
+        }
+
+        static int testLoopCondition(WeakReference<Object> r, int n) {
+            int i = 0;
+            do {
+                i++;
+                if (i >= n) {
+                    break;
+                }
+            } while (r.get() != null);
+            return i;
+        }
+
+        static Object testEscape(WeakReference<Object> r) {
+            return r.get();
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 20_000; i++) {
+                sum += testForwardBranch(ref);
+                sum += testLoopCondition(ref, 4);
+                sum += testEscape(ref) == referent ? 1 : 0;
+            }
+            if (sum != 20_000 * 6) {
+                throw new RuntimeException("Unexpected sum " + sum);
+            }
+        }
+    }
+}
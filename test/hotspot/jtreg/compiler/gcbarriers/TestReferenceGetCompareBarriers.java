@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.gcbarriers;
+
+import compiler.lib.ir_framework.*;
+import java.lang.ref.WeakReference;
+import jdk.test.lib.Asserts;
+
+/**
+ * @test id=G1
+ * @summary Test the keep-alive barriers of Reference.get() with ElideCompareOnlyKeepAlive
+ * @library /test/lib /
+ * @requires vm.gc.G1 & vm.flagless
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @run driver compiler.gcbarriers.TestReferenceGetCompareBarriers G1
+ */
+
+/**
+ * @test id=Z
+ * @library /test/lib /
+ * @requires vm.gc.Z & vm.flagless
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @run driver compiler.gcbarriers.TestReferenceGetCompareBarriers Z
+ */
+
+public class TestReferenceGetCompareBarriers {
+    static final String PRE_ONLY = "pre";
+    static final String WEAK = "weak";
+    static final String WEAK_NO_KEEPALIVE = "weak nokeepalive";
+
+    static final Object referent = new Object();
+    static final WeakReference<Object> live = new WeakReference<>(referent);
+    static Object sink;
+
+    public static void main(String[] args) {
+        final String gc = "-XX:+Use" + args[0] + "GC";
+        TestFramework framework = new TestFramework();
+        Scenario keep = new Scenario(0, gc, "-XX:-UseCompressedOops",
+                                     "-XX:+UnlockDiagnosticVMOptions", "-XX:-ElideCompareOnlyKeepAlive");
+        Scenario elide = new Scenario(1, gc, "-XX:-UseCompressedOops",
+                                      "-XX:+UnlockDiagnosticVMOptions", "-XX:+ElideCompareOnlyKeepAlive");
+        framework.addScenarios(keep, elide).start();
+    }
+
+    // The referent is only compared, its keep-alive barrier can be elided
+    @Test
+    @IR(applyIfAnd = {"UseG1GC", "true", "ElideCompareOnlyKeepAlive", "false"},
+        counts = {IRNode.G1_LOAD_P_WITH_BARRIER_FLAG, PRE_ONLY, "1"},
+        phase = CompilePhase.FINAL_CODE)
+    @IR(applyIfAnd = {"UseG1GC", "true", "ElideCompareOnlyKeepAlive", "true"},
+        failOn = {IRNode.G1_LOAD_P_WITH_BARRIER_FLAG, PRE_ONLY},
+        phase = CompilePhase.FINAL_CODE)
+    @IR(applyIfAnd = {"UseZGC", "true", "ElideCompareOnlyKeepAlive", "false"},
+        counts = {IRNode.Z_LOAD_P_WITH_BARRIER_FLAG, WEAK, "1"},
+        phase = CompilePhase.FINAL_CODE)
+    @IR(applyIfAnd = {"UseZGC", "true", "ElideCompareOnlyKeepAlive", "true"},
+        counts = {IRNode.Z_LOAD_P_WITH_BARRIER_FLAG, WEAK_NO_KEEPALIVE, "1"},
+        phase = CompilePhase.FINAL_CODE)
+    static boolean testGetIsNull(WeakReference<Object> ref) {
+        return ref.get() == null;
+    }
+
+    // The referent escapes, the keep-alive barrier must be kept
+    @Test
+    @IR(applyIf = {"UseG1GC", "true"},
+        counts = {IRNode.G1_LOAD_P_WITH_BARRIER_FLAG, PRE_ONLY, "1"},
+        phase = CompilePhase.FINAL_CODE)
+    @IR(applyIf = {"UseZGC", "true"},
+        counts = {IRNode.Z_LOAD_P_WITH_BARRIER_FLAG, WEAK, "1"},
+        phase = CompilePhase.FINAL_CODE)
+    @IR(applyIf = {"UseZGC", "true"},
+        failOn = {IRNode.Z_LOAD_P_WITH_BARRIER_FLAG, WEAK_NO_KEEPALIVE},
+        phase = CompilePhase.FINAL_CODE)
+    static boolean testGetEscapes(WeakReference<Object> ref) {
+        Object obj = ref.get();
+        sink = obj;
+        return obj == null;
+    }
+
+    @Run(test = {"testGetIsNull", "testGetEscapes"})
+    static void run() {
+        Asserts.assertFalse(testGetIsNull(live));
+        Asserts.assertFalse(testGetEscapes(live));
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Runtime.runFinalization() runs the finalizers queued for the VM finalizer threads
+ * @requires vm.gc != "Epsilon"
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:FinalizerThreads=2
+ *                   TestRunFinalizationFinalizerThreads
+ */
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class TestRunFinalizationFinalizerThreads {
+    private static final int FINALIZER_THREADS = 2;
+    private static final int COUNT = 100;
+    private static final long TIMEOUT_NS = TimeUnit.SECONDS.toNanos(60);
+
+    private static final CountDownLatch release = new CountDownLatch(1);
+    private static final AtomicInteger blocked = new AtomicInteger();
+    private static final AtomicInteger finalized = new AtomicInteger();
+
+    // Occupies a VM finalizer thread until released
+    static class Blocker {
+        @Override
+        @SuppressWarnings("removal")
+        protected void finalize() throws InterruptedException {
+            blocked.incrementAndGet();
+            release.await();
+        }
+    }
+
+    static class Counted {
+        @Override
+        @SuppressWarnings("removal")
+        protected void finalize() {
+            finalized.incrementAndGet();
+        }
+    }
+
+    private static void createBlockers() {
+        for (int i = 0; i < FINALIZER_THREADS; i++) {
+            new Blocker();
+        }
+    }
+
+    private static void createCounted() {
+        for (int i = 0; i < COUNT; i++) {
+            new Counted();
+        }
+    }
+
+    @SuppressWarnings("removal")
+    public static void main(String[] args) throws Exception {
+        try {
+            // Block all the VM finalizer threads
+            createBlockers();
+            final long start = System.nanoTime();
+            while (blocked.get() < FINALIZER_THREADS) {
+                if (System.nanoTime() - start > TIMEOUT_NS) {
+                    throw new RuntimeException("Finalizer threads not blocked: " + blocked.get());
+                }
+                System.gc();
+                Thread.sleep(10);
+            }
+
+            // Only runFinalization() can run these finalizers now
+            createCounted();
+            while (finalized.get() < COUNT) {
+                if (System.nanoTime() - start > TIMEOUT_NS) {
+                    throw new RuntimeException("Finalized " + finalized.get() + " of " + COUNT);
+                }
+                System.gc();
+                Runtime.getRuntime().runFinalization();
+            }
+        } finally {
+            release.countDown();
+        }
+    }
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=serial
+ * @summary Stress thawing of stack chunks seen by the GC with UseContinuationBarrierFastThaw
+ * @requires vm.continuations
+ * @requires vm.gc.Serial
+ * @run main/othervm -XX:+UseSerialGC -Xbatch
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseContinuationBarrierFastThaw
+ *                   ContinuationBarrierFastThawStress
+ */
+
+/*
+ * @test id=parallel
+ * @requires vm.continuations
+ * @requires vm.gc.Parallel
+ * @run main/othervm -XX:+UseParallelGC -Xbatch
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseContinuationBarrierFastThaw
+ *                   ContinuationBarrierFastThawStress
+ */
+
+/*
+ * @test id=g1
+ * @requires vm.continuations
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -Xbatch
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseContinuationBarrierFastThaw
+ *                   ContinuationBarrierFastThawStress
+ */
+
+/*
+ * @test id=z
+ * @requires vm.continuations
+ * @requires vm.gc.Z
+ * @run main/othervm -XX:+UseZGC -Xbatch
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseContinuationBarrierFastThaw
+ *                   ContinuationBarrierFastThawStress
+ */
+
+/*
+ * @test id=g1-verify
+ * @requires vm.continuations
+ * @requires vm.debug
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -Xbatch
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseContinuationBarrierFastThaw
+ *                   -XX:+VerifyContinuations -XX:+VerifyAfterGC
+ *                   ContinuationBarrierFastThawStress 20
+ */
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.locks.LockSupport;
+
+public class ContinuationBarrierFastThawStress {
+    private static final int THREADS = 64;
+    private static volatile boolean done;
+
+    public static void main(String[] args) throws Exception {
+        final int seconds = args.length > 0 ? Integer.parseInt(args[0]) : 10;
+
+        // Warm up so that the frames parked below are compiled, the barrier
+        // fast thaw only handles compiled-only chunks.
+        Worker warmup = new Worker(-1);
+        for (int i = 0; i < 20_000; i++) {
+            warmup.check(i);
+        }
+
+        List<Thread> threads = new ArrayList<>();
+        List<Worker> workers = new ArrayList<>();
+        for (int i = 0; i < THREADS; i++) {
+            Worker w = new Worker(i);
+            workers.add(w);
+            threads.add(Thread.ofVirtual().start(w));
+        }
+
+        // Collect while the virtual threads are parked, so that their chunks
+        // are seen by the GC and are promoted to the old generation.
+        final long end = System.nanoTime() + seconds * 1_000_000_000L;
+        while (System.nanoTime() < end) {
+            System.gc();
+            for (Thread t : threads) {
+                LockSupport.unpark(t);
+            }
+            Thread.sleep(10);
+        }
+
+        done = true;
+        for (Thread t : threads) {
+            LockSupport.unpark(t);
+            t.join();
+        }
+
+        for (Worker w : workers) {
+            if (w.failure != null) {
+                throw new RuntimeException("Worker " + w.id + " failed", w.failure);
+            }
+            if (w.iterations == 0) {
+                throw new RuntimeException("Worker " + w.id + " never ran");
+            }
+        }
+    }
+
+    static final class Box {
+        final long value;
+        final String name;
+
+        Box(long value) {
+            this.value = value;
+            this.name = Long.toString(value);
+        }
+    }
+
+    static final class Worker implements Runnable {
+        final int id;
+        volatile Throwable failure;
+        long iterations;
+
+        Worker(int id) {
+            this.id = id;
+        }
+
+        @Override
+        public void run() {
+            try {
+                for (long i = 0; !done; i++) {
+                    check(i);
+                    iterations++;
+                }
+            } catch (Throwable t) {
+                failure = t;
+            }
+        }
+
+        // A few compiled frames holding oops across the park
+        void check(long i) {
+            Box a = new Box(i);
+            Object[] b = new Object[] { new Box(i + 1), "x" + i };
+            level1(a, b, i);
+            verify(a, i);
+            verify((Box) b[0], i + 1);
+            if (!b[1].equals("x" + i)) {
+                throw new RuntimeException("Unexpected " + b[1] + " for " + i);
+            }
+        }
+
+        void level1(Box a, Object[] b, long i) {
+            Box c = new Box(i + 2);
+            level2(a, c, i);
+            verify(c, i + 2);
+        }
+
+        void level2(Box a, Box c, long i) {
+            Box d = new Box(i + 3);
+            if (id >= 0) {
+                LockSupport.park();
+            }
+            verify(d, i + 3);
+            verify(a, i);
+            verify(c, i + 2);
+        }
+
+        static void verify(Box box, long expected) {
+            if (box.value != expected || !box.name.equals(Long.toString(expected))) {
+                throw new RuntimeException("Unexpected " + box.value + "/" + box.name + ", expected " + expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.vm.gc;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.time.Duration;
+import java.time.Instant;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+
+/**
+ * Records the GC phase events of all collectors with JFR and prints the time
+ * spent in each phase and sub-phase, e.g. "Reference Processing" and its
+ * "Notify Soft/WeakReferences" sub-phases for Serial, Parallel and G1, or
+ * "Concurrent References Process" for ZGC.
+ *
+ * Only phases that start inside a window opened with begin() and closed with
+ * end() are counted, so that collections done to set up the heap are left
+ * out of the numbers.
+ */
+class GCPhaseRecorder {
+
+    private static final String[] PHASE_EVENTS = {
+        "jdk.GCPhasePause",
+        "jdk.GCPhasePauseLevel1",
+        "jdk.GCPhasePauseLevel2",
+        "jdk.GCPhasePauseLevel3",
+        "jdk.GCPhasePauseLevel4",
+        "jdk.GCPhaseConcurrent",
+        "jdk.GCPhaseConcurrentLevel1",
+        "jdk.GCPhaseConcurrentLevel2",
+        "jdk.GCPhaseParallel",
+    };
+
+    private final Recording recording = new Recording();
+    private final List<Instant> windows = new ArrayList<>();
+
+    GCPhaseRecorder() {
+        for (String event : PHASE_EVENTS) {
+            recording.enable(event).withoutThreshold();
+        }
+    }
+
+    void start() {
+        recording.start();
+    }
+
+    void begin() {
+        windows.add(Instant.now());
+    }
+
+    void end() {
+        windows.add(Instant.now());
+    }
+
+    private boolean inWindow(Instant time) {
+        for (int i = 0; i + 1 < windows.size(); i += 2) {
+            if (!time.isBefore(windows.get(i)) && !time.isAfter(windows.get(i + 1))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void stopAndReport(String title) throws IOException {
+        recording.stop();
+        Path file = Files.createTempFile("gcphases", ".jfr");
+        try {
+            recording.dump(file);
+
+            // Summed over all workers for jdk.GCPhaseParallel
+            Map<String, Duration> phases = new TreeMap<>();
+            for (RecordedEvent event : RecordingFile.readAllEvents(file)) {
+                if (inWindow(event.getStartTime())) {
+                    String key = event.getEventType().getName().substring("jdk.".length()) + ": " + event.getString("name");
+                    phases.merge(key, event.getDuration(), Duration::plus);
+                }
+            }
+
+            int collections = windows.size() / 2;
+            System.out.println();
+            System.out.println("GC phase times for " + title + " (" + collections + " collections)");
+            for (Map.Entry<String, Duration> phase : phases.entrySet()) {
+                double totalMs = phase.getValue().toNanos() / 1_000_000.0;
+                System.out.printf("  %-70s %10.3f ms total %10.3f ms/collection%n",
+                                  phase.getKey(), totalMs, totalMs / Math.max(1, collections));
+            }
+        } finally {
+            recording.close();
+            Files.deleteIfExists(file);
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Threads;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * A cache with weakly or softly referenced values, in the style of the
+ * weakValues() and softValues() caches of Caffeine and Guava. Lookups that
+ * miss, or find a cleared value, load a new value and replace the entry,
+ * so the cache keeps creating references that the GC has to discover.
+ *
+ * With a queue, cleared entries are removed from the map after each
+ * operation by draining the ReferenceQueue, like Caffeine does in its
+ * maintenance work. Without a queue, stale entries are only replaced when
+ * they are looked up again.
+ *
+ * The time spent in each GC phase is printed at the end of each trial.
+ */
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 2)
+@Threads(4)
+@Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" })
+public abstract class ReferenceCacheChurn {
+
+    public enum Kind { WEAK, SOFT }
+
+    @Param({"WEAK", "SOFT"})
+    public Kind kind;
+
+    @Param({"false", "true"})
+    public boolean queued;
+
+    @Param({"1000000"})
+    public int keys;
+
+    @Param({"256"})
+    public int valueSize;
+
+    private final GCPhaseRecorder recorder = new GCPhaseRecorder();
+    private final ReferenceQueue<byte[]> queue = new ReferenceQueue<>();
+    private ConcurrentHashMap<Integer, Value> cache;
+
+    // Remembers its key so that the entry can be removed once cleared
+    private interface Value {
+        Integer key();
+        byte[] get();
+    }
+
+    private static final class WeakValue extends WeakReference<byte[]> implements Value {
+        private final Integer key;
+
+        WeakValue(Integer key, byte[] value, ReferenceQueue<byte[]> queue) {
+            super(value, queue);
+            this.key = key;
+        }
+
+        public Integer key() {
+            return key;
+        }
+    }
+
+    private static final class SoftValue extends SoftReference<byte[]> implements Value {
+        private final Integer key;
+
+        SoftValue(Integer key, byte[] value, ReferenceQueue<byte[]> queue) {
+            super(value, queue);
+            this.key = key;
+        }
+
+        public Integer key() {
+            return key;
+        }
+    }
+
+    private Value newValue(Integer key, byte[] value) {
+        ReferenceQueue<byte[]> q = queued ? queue : null;
+        return kind == Kind.WEAK ? new WeakValue(key, value, q) : new SoftValue(key, value, q);
+    }
+
+    @Setup(Level.Trial)
+    public void setup() {
+        cache = new ConcurrentHashMap<>(keys);
+        for (int i = 0; i < keys; i++) {
+            Integer key = i;
+            cache.put(key, newValue(key, new byte[valueSize]));
+        }
+        recorder.start();
+        recorder.begin();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws IOException {
+        recorder.end();
+        recorder.stopAndReport(getClass().getSimpleName() + " " + kind + (queued ? " queued " : " ") + keys);
+    }
+
+    private void drainQueue() {
+        for (Reference<? extends byte[]> ref; (ref = queue.poll()) != null;) {
+            Value value = (Value)ref;
+            cache.remove(value.key(), value);
+        }
+    }
+
+    @Benchmark
+    public byte[] lookup() {
+        Integer key = ThreadLocalRandom.current().nextInt(keys);
+        Value value = cache.get(key);
+        byte[] result = (value != null) ? value.get() : null;
+        if (result == null) {
+            // Miss, load a new value
+            result = new byte[valueSize];
+            cache.put(key, newValue(key, result));
+        }
+        if (queued) {
+            drainQueue();
+        }
+        return result;
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseSerialGC" })
+    public static class Serial extends ReferenceCacheChurn {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseParallelGC" })
+    public static class Parallel extends ReferenceCacheChurn {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseG1GC" })
+    public static class G1 extends ReferenceCacheChurn {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseZGC" })
+    public static class Z extends ReferenceCacheChurn {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseShenandoahGC" })
+    public static class Shenandoah extends ReferenceCacheChurn {
+    }
+}
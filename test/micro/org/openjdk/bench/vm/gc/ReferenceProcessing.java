@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.AuxCounters;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the cost of a collection that has to process a large number of
+ * discovered references, with and without a ReferenceQueue, and with young
+ * or old referents. All referents are unreachable when the collection runs.
+ *
+ * The nested classes run the benchmark with each collector. The GC times of
+ * the measured collections are reported as secondary results, and the time
+ * spent in each GC phase is printed at the end of each trial.
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, batchSize = 1)
+@Measurement(iterations = 10, batchSize = 1)
+@Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" })
+public abstract class ReferenceProcessing {
+
+    public enum Kind {
+        WEAK(false), WEAK_QUEUED(true),
+        SOFT(false), SOFT_QUEUED(true),
+        PHANTOM(false), PHANTOM_QUEUED(true),
+        // FinalReferences always have a queue
+        FINAL(true);
+
+        final boolean queued;
+
+        Kind(boolean queued) {
+            this.queued = queued;
+        }
+    }
+
+    public enum Age { YOUNG, OLD }
+
+    @Param({"WEAK", "WEAK_QUEUED", "SOFT", "SOFT_QUEUED", "PHANTOM", "PHANTOM_QUEUED", "FINAL"})
+    public Kind kind;
+
+    @Param({"YOUNG", "OLD"})
+    public Age age;
+
+    @Param({"100000", "1000000"})
+    public int count;
+
+    private final ReferenceQueue<Object> queue = new ReferenceQueue<>();
+
+    private final GCPhaseRecorder recorder = new GCPhaseRecorder();
+
+    // Keeps the references themselves alive
+    private Reference<?>[] refs;
+
+    // Keep the referents alive until the setup is done
+    private Object[] referents;
+
+    static class Finalizable {
+        @SuppressWarnings("removal")
+        @Override
+        protected void finalize() {
+        }
+    }
+
+    @AuxCounters(AuxCounters.Type.EVENTS)
+    @State(Scope.Thread)
+    public static class GCTime {
+        public long gcTimeMs;
+        public long gcCount;
+    }
+
+    private static long totalGCTimeMs() {
+        long total = 0;
+        for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+            total += Math.max(0, gc.getCollectionTime());
+        }
+        return total;
+    }
+
+    private static long totalGCCount() {
+        long total = 0;
+        for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+            total += Math.max(0, gc.getCollectionCount());
+        }
+        return total;
+    }
+
+    private Reference<?> newReference(Object referent) {
+        ReferenceQueue<Object> q = kind.queued ? queue : null;
+        switch (kind) {
+            case WEAK:
+            case WEAK_QUEUED:    return new WeakReference<>(referent, q);
+            case SOFT:
+            case SOFT_QUEUED:    return new SoftReference<>(referent, q);
+            case PHANTOM:
+            case PHANTOM_QUEUED: return new PhantomReference<>(referent, q);
+            default:             throw new IllegalArgumentException(kind.toString());
+        }
+    }
+
+    @Setup(Level.Trial)
+    public void startRecording() {
+        recorder.start();
+    }
+
+    @TearDown(Level.Trial)
+    public void stopRecording() throws IOException {
+        recorder.stopAndReport(getClass().getSimpleName() + " " + kind + " " + age + " " + count);
+    }
+
+    @Setup(Level.Invocation)
+    public void setup() {
+        // Start with nothing left over from the previous invocation
+        System.gc();
+        while (queue.poll() != null) {
+            // Drain
+        }
+
+        referents = new Object[count];
+        if (kind == Kind.FINAL) {
+            // The FinalReferences are created by the VM
+            for (int i = 0; i < count; i++) {
+                referents[i] = new Finalizable();
+            }
+            refs = null;
+        } else {
+            for (int i = 0; i < count; i++) {
+                referents[i] = new Object();
+            }
+            refs = new Reference<?>[count];
+            for (int i = 0; i < count; i++) {
+                refs[i] = newReference(referents[i]);
+            }
+        }
+
+        if (age == Age.OLD) {
+            // Promote the referents, and the references with them
+            System.gc();
+            System.gc();
+        }
+
+        // Make the referents unreachable
+        referents = null;
+    }
+
+    @Benchmark
+    public void collect(GCTime time) {
+        long startTime = totalGCTimeMs();
+        long startCount = totalGCCount();
+        recorder.begin();
+        System.gc();
+        recorder.end();
+        time.gcTimeMs += totalGCTimeMs() - startTime;
+        time.gcCount += totalGCCount() - startCount;
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseSerialGC" })
+    public static class Serial extends ReferenceProcessing {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseParallelGC" })
+    public static class Parallel extends ReferenceProcessing {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseG1GC" })
+    public static class G1 extends ReferenceProcessing {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseZGC" })
+    public static class Z extends ReferenceProcessing {
+    }
+
+    @Fork(value = 3, jvmArgs = { "-Xms2g", "-Xmx2g" }, jvmArgsAppend = { "-XX:+UseShenandoahGC" })
+    public static class Shenandoah extends ReferenceProcessing {
+    }
+}